@@ -1,12 +1,27 @@
 /*
  * Bridge Module Implementation
  *
- * Uses message queues to buffer data between BLE and TCP.
+ * Each direction is buffered the way its traffic arrives. BLE writes are
+ * small, so BLE->TCP goes through a byte pipe: a 20-byte write takes 20
+ * bytes of buffer rather than a whole CONFIG_BRIDGE_MSG_MAX_SIZE message,
+ * and the bridge thread forwards it in chunks of up to that size. TCP
+ * delivers whole recv() chunks, so each TCP->BLE chunk is copied once
+ * into an eai_buf buffer, queued as a pointer, and sent straight from the
+ * buffer. A message that doesn't fit is dropped whole.
+ *
+ * The bridge thread sleeps in eai_osal_poll() on the TCP->BLE queue and
+ * on event bits for BLE data and stop. It clears the data bit before it
+ * drains the pipe, so a write that lands while it is draining leaves the
+ * bit set for the next round.
  */
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
-#include <string.h>
+#include <eai_osal/buf.h>
+#include <eai_osal/event.h>
+#include <eai_osal/pipe.h>
+#include <eai_osal/poll.h>
+#include <eai_osal/queue.h>
 
 #include "bridge.h"
 #include "ble_nus.h"
@@ -17,58 +32,68 @@ LOG_MODULE_REGISTER(bridge, LOG_LEVEL_INF);
 #define BRIDGE_THREAD_STACK_SIZE 2048
 #define BRIDGE_THREAD_PRIORITY 6
 
-/* Message structure for queued data */
-struct bridge_msg {
-	uint8_t data[CONFIG_BRIDGE_MSG_MAX_SIZE];
-	uint16_t len;
-};
+/* BLE->TCP: one writer, the bridge thread reading */
+static eai_osal_pipe_t ble_to_tcp_pipe;
+static uint8_t ble_to_tcp_storage[CONFIG_BRIDGE_PIPE_SIZE];
+
+/* Bridge thread's chunk buffer for the pipe */
+static uint8_t bridge_chunk[CONFIG_BRIDGE_MSG_MAX_SIZE];
 
-/* Message queues */
-K_MSGQ_DEFINE(ble_to_tcp_queue, sizeof(struct bridge_msg),
-	      CONFIG_BRIDGE_QUEUE_SIZE, 4);
-K_MSGQ_DEFINE(tcp_to_ble_queue, sizeof(struct bridge_msg),
-	      CONFIG_BRIDGE_QUEUE_SIZE, 4);
+/* TCP->BLE: a queue of eai_buf_t pointers, each holding one reference */
+EAI_BUF_POOL_STORAGE_DEFINE(bridge_buf_storage, CONFIG_BRIDGE_QUEUE_SIZE,
+			    CONFIG_BRIDGE_MSG_MAX_SIZE);
+static eai_buf_pool_t bridge_pool;
+static eai_osal_queue_t tcp_to_ble_queue;
+static eai_buf_t *tcp_to_ble_slots[CONFIG_BRIDGE_QUEUE_SIZE];
+
+/* Wake the bridge thread for data in the pipe, or to stop */
+#define BRIDGE_EVT_STOP BIT(0)
+#define BRIDGE_EVT_BLE_RX BIT(1)
+static eai_osal_event_t bridge_events;
 
 static bool bridge_running;
 
 K_THREAD_STACK_DEFINE(bridge_stack, BRIDGE_THREAD_STACK_SIZE);
 static struct k_thread bridge_thread;
 
-/* Process BLE to TCP queue */
+/* Forward everything in the BLE->TCP pipe, a chunk at a time */
 static void process_ble_to_tcp(void)
 {
-	struct bridge_msg msg;
+	size_t len;
 
-	while (k_msgq_get(&ble_to_tcp_queue, &msg, K_NO_WAIT) == 0) {
+	while (eai_osal_pipe_read(&ble_to_tcp_pipe, bridge_chunk, sizeof(bridge_chunk),
+				  &len, EAI_OSAL_NO_WAIT) == EAI_OSAL_OK) {
 		if (tcp_socket_is_connected()) {
-			int ret = tcp_socket_send(msg.data, msg.len);
+			int ret = tcp_socket_send(bridge_chunk, (uint16_t)len);
 			if (ret < 0) {
 				LOG_ERR("Failed to send to TCP: %d", ret);
 			} else {
-				LOG_INF("Bridge: BLE->TCP %d bytes", msg.len);
+				LOG_INF("Bridge: BLE->TCP %u bytes", (unsigned int)len);
 			}
 		} else {
-			LOG_WRN("TCP not connected, dropping message");
+			LOG_WRN("TCP not connected, dropping %u bytes", (unsigned int)len);
 		}
 	}
 }
 
-/* Process TCP to BLE queue */
+/* Send every queued TCP->BLE buffer */
 static void process_tcp_to_ble(void)
 {
-	struct bridge_msg msg;
+	eai_buf_t *buf;
 
-	while (k_msgq_get(&tcp_to_ble_queue, &msg, K_NO_WAIT) == 0) {
+	while (eai_osal_queue_recv(&tcp_to_ble_queue, &buf, EAI_OSAL_NO_WAIT) ==
+	       EAI_OSAL_OK) {
 		if (ble_nus_is_connected()) {
-			int ret = ble_nus_send(msg.data, msg.len);
+			int ret = ble_nus_send(buf->data, buf->len);
 			if (ret < 0) {
 				LOG_ERR("Failed to send to BLE: %d", ret);
 			} else {
-				LOG_INF("Bridge: TCP->BLE %d bytes", msg.len);
+				LOG_INF("Bridge: TCP->BLE %d bytes", buf->len);
 			}
 		} else {
 			LOG_WRN("BLE not connected, dropping message");
 		}
+		eai_buf_unref(buf);
 	}
 }
 
@@ -79,24 +104,69 @@ static void bridge_thread_fn(void *p1, void *p2, void *p3)
 	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
+	eai_osal_poll_event_t events[] = {
+		EAI_OSAL_POLL_QUEUE(&tcp_to_ble_queue),
+		EAI_OSAL_POLL_EVENT(&bridge_events, BRIDGE_EVT_BLE_RX | BRIDGE_EVT_STOP),
+	};
+
 	LOG_INF("Bridge thread started");
 
 	while (bridge_running) {
+		eai_osal_poll(events, ARRAY_SIZE(events), EAI_OSAL_WAIT_FOREVER);
+		eai_osal_event_clear(&bridge_events, BRIDGE_EVT_BLE_RX);
 		process_ble_to_tcp();
 		process_tcp_to_ble();
-
-		/* Small sleep to avoid busy-waiting */
-		k_sleep(K_MSEC(10));
 	}
 
 	LOG_INF("Bridge thread exiting");
 }
 
+/* Drop stale bytes */
+static void purge_pipe(eai_osal_pipe_t *pipe)
+{
+	size_t len;
+
+	while (eai_osal_pipe_count(pipe) > 0) {
+		eai_osal_pipe_read(pipe, bridge_chunk, sizeof(bridge_chunk), &len,
+				   EAI_OSAL_NO_WAIT);
+	}
+}
+
+/* Drop stale messages, returning their buffers to the pool */
+static void purge_queue(eai_osal_queue_t *queue)
+{
+	eai_buf_t *buf;
+
+	while (eai_osal_queue_recv(queue, &buf, EAI_OSAL_NO_WAIT) == EAI_OSAL_OK) {
+		eai_buf_unref(buf);
+	}
+}
+
 int bridge_init(void)
 {
-	/* Clear any stale messages */
-	k_msgq_purge(&ble_to_tcp_queue);
-	k_msgq_purge(&tcp_to_ble_queue);
+	static bool objs_ready;
+
+	if (!objs_ready) {
+		if (eai_osal_pipe_create(&ble_to_tcp_pipe, ble_to_tcp_storage,
+					 sizeof(ble_to_tcp_storage), 1) != EAI_OSAL_OK) {
+			LOG_ERR("Failed to create bridge pipe");
+			return -ENOMEM;
+		}
+		if (eai_buf_pool_create(&bridge_pool, CONFIG_BRIDGE_QUEUE_SIZE,
+					CONFIG_BRIDGE_MSG_MAX_SIZE,
+					bridge_buf_storage) != EAI_OSAL_OK) {
+			LOG_ERR("Failed to create bridge buffer pool");
+			return -ENOMEM;
+		}
+		eai_osal_queue_create(&tcp_to_ble_queue, sizeof(eai_buf_t *),
+				      CONFIG_BRIDGE_QUEUE_SIZE, tcp_to_ble_slots);
+		eai_osal_event_create(&bridge_events);
+		objs_ready = true;
+	}
+
+	/* Clear any stale data */
+	purge_pipe(&ble_to_tcp_pipe);
+	purge_queue(&tcp_to_ble_queue);
 
 	LOG_INF("Bridge module initialized");
 	return 0;
@@ -110,6 +180,7 @@ void bridge_start(void)
 	}
 
 	bridge_running = true;
+	eai_osal_event_clear(&bridge_events, BRIDGE_EVT_STOP);
 
 	k_thread_create(&bridge_thread, bridge_stack,
 			K_THREAD_STACK_SIZEOF(bridge_stack),
@@ -124,45 +195,49 @@ void bridge_start(void)
 void bridge_stop(void)
 {
 	bridge_running = false;
+	eai_osal_event_set(&bridge_events, BRIDGE_EVT_STOP);
 	LOG_INF("Bridge stopped");
 }
 
+/* Write a whole message into the pipe (its only writer) and wake the bridge */
 int bridge_queue_ble_to_tcp(const uint8_t *data, uint16_t len)
 {
-	struct bridge_msg msg;
-
-	if (len > CONFIG_BRIDGE_MSG_MAX_SIZE) {
-		LOG_ERR("Message too large: %u > %u", len, CONFIG_BRIDGE_MSG_MAX_SIZE);
+	if (len > CONFIG_BRIDGE_PIPE_SIZE) {
+		LOG_ERR("Message too large: %u > %u", len, CONFIG_BRIDGE_PIPE_SIZE);
 		return -EMSGSIZE;
 	}
 
-	memcpy(msg.data, data, len);
-	msg.len = len;
-
-	int ret = k_msgq_put(&ble_to_tcp_queue, &msg, K_NO_WAIT);
-	if (ret) {
-		LOG_WRN("BLE->TCP queue full, dropping message");
+	/* Space only grows under the writer, so this write won't come up short */
+	if (eai_osal_pipe_space(&ble_to_tcp_pipe) < len) {
+		LOG_WRN("BLE->TCP pipe full, dropping message");
 		return -ENOMEM;
 	}
+	eai_osal_pipe_write(&ble_to_tcp_pipe, data, len, NULL, EAI_OSAL_NO_WAIT);
+	eai_osal_event_set(&bridge_events, BRIDGE_EVT_BLE_RX);
 
 	return 0;
 }
 
+/* Copy data into a pooled buffer and queue its pointer */
 int bridge_queue_tcp_to_ble(const uint8_t *data, uint16_t len)
 {
-	struct bridge_msg msg;
+	eai_buf_t *buf;
 
 	if (len > CONFIG_BRIDGE_MSG_MAX_SIZE) {
 		LOG_ERR("Message too large: %u > %u", len, CONFIG_BRIDGE_MSG_MAX_SIZE);
 		return -EMSGSIZE;
 	}
 
-	memcpy(msg.data, data, len);
-	msg.len = len;
+	if (eai_buf_alloc(&bridge_pool, &buf, EAI_OSAL_NO_WAIT) != EAI_OSAL_OK) {
+		LOG_WRN("TCP->BLE out of buffers, dropping message");
+		return -ENOMEM;
+	}
+	eai_buf_add_mem(buf, data, len);
 
-	int ret = k_msgq_put(&tcp_to_ble_queue, &msg, K_NO_WAIT);
-	if (ret) {
+	if (eai_osal_queue_send(&tcp_to_ble_queue, &buf, EAI_OSAL_NO_WAIT) !=
+	    EAI_OSAL_OK) {
 		LOG_WRN("TCP->BLE queue full, dropping message");
+		eai_buf_unref(buf);
 		return -ENOMEM;
 	}
 
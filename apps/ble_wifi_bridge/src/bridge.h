@@ -12,7 +12,7 @@
 /**
  * @brief Initialize the bridge module
  *
- * Sets up message queues and callbacks for BLE/TCP bridging.
+ * Sets up the pipe and buffer queue that carry data between BLE and TCP.
  *
  * @return 0 on success, negative errno on failure
  */
@@ -1,8 +1,9 @@
 /*
  * OSAL FreeRTOS backend tests — ported from Zephyr ztest to Unity.
  *
- * 44 tests across 9 suites: mutex, semaphore, thread, queue, timer,
- * event, critical, time, work.
+ * 80 tests across 18 suites: mutex, semaphore, thread, queue, timer,
+ * event, critical, time, work, spsc, mempool, buf, poll, rwlock, atomic,
+ * pqueue, task, pipe.
  */
 
 #include "unity.h"
@@ -151,7 +152,7 @@ static void test_sem_give_at_limit(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Thread tests (4)
+ * Thread tests (6)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static volatile int thread_counter;
@@ -239,8 +240,62 @@ static void test_thread_priority(void)
 	vSemaphoreDelete(prio_gate);
 }
 
+static void test_thread_set_affinity(void)
+{
+	eai_osal_thread_t thread;
+	int arg = 7;
+
+	eai_osal_thread_create(&thread, "aff", simple_thread_entry, &arg,
+			       test_thread_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(test_thread_stack), 10);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_thread_set_affinity(&thread, 0));
+	/* Every CPU is always accepted */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_thread_set_affinity(&thread, UINT32_MAX));
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(stats_stack, 4096);
+
+/* Touch 1 KiB of stack, then hold on the gate */
+static void stats_thread_entry(void *arg)
+{
+	volatile uint8_t buf[1024];
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)i;
+	}
+	xSemaphoreTake(prio_gate, portMAX_DELAY);
+}
+
+static void test_thread_stats(void)
+{
+	eai_osal_thread_t thread;
+	eai_osal_thread_stats_t st;
+
+	prio_gate = xSemaphoreCreateCounting(1, 0);
+	eai_osal_thread_create(&thread, "stats", stats_thread_entry, NULL,
+			       stats_stack, EAI_OSAL_THREAD_STACK_SIZEOF(stats_stack), 10);
+	test_sleep_ms(50);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_thread_get_stats(&thread, &st));
+	TEST_ASSERT_EQUAL_STRING("stats", st.name);
+	TEST_ASSERT_EQUAL(4096, st.stack_size);
+	TEST_ASSERT_GREATER_OR_EQUAL(1024, st.stack_used);
+	TEST_ASSERT_LESS_THAN(4096, st.stack_used);
+	TEST_ASSERT_TRUE(st.runtime_ns > 0);
+
+	xSemaphoreGive(prio_gate);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_thread_get_stats(&thread, &st));
+	vSemaphoreDelete(prio_gate);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Queue tests (5)
+ * Queue tests (10)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static uint8_t __attribute__((aligned(4))) queue_buf_4[4 * sizeof(int)];
@@ -319,6 +374,130 @@ static void test_queue_empty_timeout(void)
 	eai_osal_queue_destroy(&queue);
 }
 
+static void test_queue_reserve_commit(void)
+{
+	eai_osal_queue_t queue;
+	void *slot;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT));
+	*(int *)slot = 7;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_commit(&queue, slot));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_peek(&queue, &slot, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(7, *(int *)slot);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_release(&queue, slot));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_peek(&queue, &slot, EAI_OSAL_NO_WAIT));
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_reserve_outstanding(void)
+{
+	eai_osal_queue_t queue;
+	void *wr, *rd, *other;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_reserve(&queue, &wr, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR,
+			  eai_osal_queue_reserve(&queue, &other, EAI_OSAL_NO_WAIT));
+	*(int *)wr = 1;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_commit(&queue, wr));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_queue_commit(&queue, wr));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_peek(&queue, &rd, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR,
+			  eai_osal_queue_peek(&queue, &other, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_release(&queue, rd));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_queue_release(&queue, rd));
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_send_recv_many(void)
+{
+	eai_osal_queue_t queue;
+	int in[3] = {1, 2, 3};
+	int out[4] = {0};
+	uint32_t n = 0;
+	int msg = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	/* Offset the ring so the batch wraps around the end of the buffer */
+	eai_osal_queue_send(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_recv(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_recv(&queue, &msg, EAI_OSAL_NO_WAIT);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_send_many(&queue, in, 3, &n,
+						   EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(3, n);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_recv_many(&queue, out, 4, &n,
+						   EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(3, n);
+	TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 3);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_recv_many(&queue, out, 4, &n, 50));
+	TEST_ASSERT_EQUAL(0, n);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_send_many_partial(void)
+{
+	eai_osal_queue_t queue;
+	int in[6] = {1, 2, 3, 4, 5, 6};
+	int out[4] = {0};
+	uint32_t n = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_send_many(&queue, in, 6, &n, 50));
+	TEST_ASSERT_EQUAL(4, n);
+
+	eai_osal_queue_recv_many(&queue, out, 4, &n, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(4, n);
+	TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 4);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_drain_timeout(void)
+{
+	eai_osal_queue_t queue;
+	int in[2] = {7, 8};
+	int out[4] = {0};
+	uint32_t n = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+	eai_osal_queue_send_many(&queue, in, 2, NULL, EAI_OSAL_NO_WAIT);
+
+	uint32_t start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_drain(&queue, out, 4, &n, 50));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	/* Partial batch is still delivered after waiting out the timeout */
+	TEST_ASSERT_EQUAL(2, n);
+	TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 2);
+	TEST_ASSERT_GREATER_OR_EQUAL(40, elapsed);
+
+	eai_osal_queue_destroy(&queue);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Timer tests (5)
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -521,7 +700,7 @@ static void test_critical_nested(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Time tests (3)
+ * Time tests (5)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static void test_time_get_ms(void)
@@ -548,8 +727,33 @@ static void test_time_tick_roundtrip(void)
 	TEST_ASSERT_INT_WITHIN(10, 0, diff);
 }
 
+static void test_time_us_ns(void)
+{
+	uint32_t ms = eai_osal_time_get_ms();
+	uint64_t us = eai_osal_time_get_us();
+
+	/* get_ms follows the RTOS tick, get_us the esp_timer — close, not equal */
+	TEST_ASSERT_UINT32_WITHIN(20, ms, (uint32_t)(us / 1000));
+
+	test_sleep_ms(20);
+	TEST_ASSERT_TRUE(eai_osal_time_get_us() - us >= 15000);
+	TEST_ASSERT_TRUE(eai_osal_time_get_ns() / 1000 >= us);
+}
+
+static void test_time_cycles(void)
+{
+	uint32_t c0 = eai_osal_cycle_get();
+	test_sleep_ms(20);
+	uint32_t c1 = eai_osal_cycle_get();
+
+	uint64_t ns = eai_osal_cycles_to_ns(c1 - c0);
+
+	TEST_ASSERT_TRUE(ns >= 15000000);
+	TEST_ASSERT_TRUE(ns < 1000000000);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Work queue tests (9)
+ * Work queue tests (15)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static SemaphoreHandle_t work_sem;
@@ -711,6 +915,988 @@ static void test_dwork_submit_to_queue(void)
 	vSemaphoreDelete(work_sem);
 }
 
+/* Bounded work queue — depth 2, its worker parked in a gate item */
+EAI_OSAL_THREAD_STACK_DEFINE(depth_wq_stack, 2048);
+static eai_osal_workqueue_t depth_wq;
+static bool depth_wq_started;
+static eai_osal_sem_t wq_gate;
+
+static void wq_gate_callback(void *arg)
+{
+	(void)arg;
+	eai_osal_sem_take(&wq_gate, 2000);
+}
+
+static void wq_release_callback(void *arg)
+{
+	(void)arg;
+	eai_osal_sem_give(&wq_gate);
+}
+
+static void depth_wq_block(eai_osal_work_t *gate)
+{
+	eai_osal_workqueue_stats_t stats;
+
+	if (!depth_wq_started) {
+		eai_osal_workqueue_create_with_depth(&depth_wq, "depth_wq",
+						     depth_wq_stack,
+						     EAI_OSAL_THREAD_STACK_SIZEOF(depth_wq_stack),
+						     10, 2);
+		depth_wq_started = true;
+	}
+	eai_osal_sem_create(&wq_gate, 0, 1);
+	eai_osal_work_init(gate, wq_gate_callback, NULL);
+	eai_osal_work_submit_to(gate, &depth_wq);
+
+	/* Wait for the worker to take the gate item off the queue */
+	for (int i = 0; i < 100; i++) {
+		eai_osal_workqueue_get_stats(&depth_wq, &stats);
+		if (stats.pending == 0) {
+			break;
+		}
+		test_sleep_ms(5);
+	}
+	eai_osal_workqueue_reset_stats(&depth_wq);
+}
+
+static void test_workqueue_depth_backpressure(void)
+{
+	eai_osal_work_t gate, items[3];
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	work_sem = xSemaphoreCreateCounting(3, 0);
+	depth_wq_block(&gate);
+
+	for (int i = 0; i < 3; i++) {
+		eai_osal_work_init(&items[i], work_callback, NULL);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&items[0], &depth_wq));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&items[1], &depth_wq));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_work_submit_to(&items[2], &depth_wq));
+
+	uint32_t start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_work_submit_timeout(&items[2], &depth_wq, 30));
+	TEST_ASSERT_GREATER_OR_EQUAL(25, eai_osal_time_get_ms() - start);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_workqueue_get_stats(&depth_wq, &stats));
+	TEST_ASSERT_EQUAL(2, stats.depth);
+	TEST_ASSERT_EQUAL(2, stats.pending);
+	TEST_ASSERT_EQUAL(2, stats.high_water);
+	TEST_ASSERT_EQUAL(2, stats.rejected);
+
+	eai_osal_sem_give(&wq_gate);
+	xSemaphoreTake(work_sem, pdMS_TO_TICKS(500));
+	xSemaphoreTake(work_sem, pdMS_TO_TICKS(500));
+	TEST_ASSERT_EQUAL(2, work_counter);
+
+	eai_osal_sem_destroy(&wq_gate);
+	vSemaphoreDelete(work_sem);
+}
+
+/* A blocking submit waits for the worker to make room */
+static void test_work_submit_timeout_waits(void)
+{
+	eai_osal_work_t gate, items[3];
+	eai_osal_dwork_t release;
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	work_sem = xSemaphoreCreateCounting(3, 0);
+	depth_wq_block(&gate);
+
+	for (int i = 0; i < 3; i++) {
+		eai_osal_work_init(&items[i], work_callback, NULL);
+	}
+	eai_osal_work_submit_to(&items[0], &depth_wq);
+	eai_osal_work_submit_to(&items[1], &depth_wq);
+
+	/* Open the gate from the system queue while the third submit waits */
+	eai_osal_dwork_init(&release, wq_release_callback, NULL);
+	eai_osal_dwork_submit(&release, 50);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_submit_timeout(&items[2], &depth_wq, 1000));
+
+	for (int i = 0; i < 3; i++) {
+		xSemaphoreTake(work_sem, pdMS_TO_TICKS(500));
+	}
+	TEST_ASSERT_EQUAL(3, work_counter);
+
+	eai_osal_workqueue_get_stats(&depth_wq, &stats);
+	TEST_ASSERT_EQUAL(0, stats.rejected);
+
+	eai_osal_sem_destroy(&wq_gate);
+	vSemaphoreDelete(work_sem);
+}
+
+static void test_workqueue_stats_latency(void)
+{
+	eai_osal_work_t gate, work;
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	work_sem = xSemaphoreCreateBinary();
+	depth_wq_block(&gate);
+
+	eai_osal_work_init(&work, work_callback, NULL);
+	eai_osal_work_submit_to(&work, &depth_wq);
+	test_sleep_ms(30);
+	eai_osal_sem_give(&wq_gate);
+	xSemaphoreTake(work_sem, pdMS_TO_TICKS(500));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_workqueue_get_stats(&depth_wq, &stats));
+	TEST_ASSERT_EQUAL(0, stats.pending);
+	TEST_ASSERT_EQUAL(1, stats.high_water);
+	/* Latency has tick resolution on FreeRTOS */
+	TEST_ASSERT_GREATER_OR_EQUAL(20000, stats.max_latency_us);
+
+	/* NULL reads the system work queue */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_workqueue_get_stats(NULL, &stats));
+	TEST_ASSERT_EQUAL(EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH, stats.depth);
+
+	eai_osal_sem_destroy(&wq_gate);
+	vSemaphoreDelete(work_sem);
+}
+
+/* Work queue pool */
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(pool_stacks, 2, 2048);
+
+#define POOL_ITEMS 16
+
+static volatile int pool_counter;
+static volatile int pool_in_flight;
+static volatile int pool_overlap;
+
+static void pool_count_callback(void *arg)
+{
+	(void)arg;
+	__atomic_fetch_add(&pool_counter, 1, __ATOMIC_SEQ_CST);
+}
+
+/* Flags overlap if two workers are ever inside the same item at once */
+static void pool_exclusive_callback(void *arg)
+{
+	(void)arg;
+	if (__atomic_fetch_add(&pool_in_flight, 1, __ATOMIC_SEQ_CST) != 0) {
+		pool_overlap = 1;
+	}
+	test_sleep_ms(20);
+	__atomic_fetch_sub(&pool_in_flight, 1, __ATOMIC_SEQ_CST);
+	__atomic_fetch_add(&pool_counter, 1, __ATOMIC_SEQ_CST);
+}
+
+static void test_pool_runs_all(void)
+{
+	eai_osal_workqueue_pool_t pool;
+	eai_osal_work_t items[POOL_ITEMS];
+
+	pool_counter = 0;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_workqueue_pool_create(&pool, 2, "pool",
+							 pool_stacks,
+							 EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+							 10));
+
+	for (int i = 0; i < POOL_ITEMS; i++) {
+		eai_osal_work_init(&items[i], pool_count_callback, NULL);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_work_submit_to_pool(&items[i], &pool));
+	}
+
+	/* Destroy finishes queued work before stopping the workers */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_workqueue_pool_destroy(&pool));
+	TEST_ASSERT_EQUAL(POOL_ITEMS, pool_counter);
+}
+
+static void test_pool_no_self_concurrency(void)
+{
+	eai_osal_workqueue_pool_t pool;
+	eai_osal_work_t work;
+
+	pool_counter = 0;
+	pool_in_flight = 0;
+	pool_overlap = 0;
+	eai_osal_workqueue_pool_create(&pool, 2, "pool", pool_stacks,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+				       10);
+	eai_osal_work_init(&work, pool_exclusive_callback, NULL);
+
+	/* Resubmit while running: must queue one rerun, never a second copy */
+	eai_osal_work_submit_to_pool(&work, &pool);
+	test_sleep_ms(5);
+	for (int i = 0; i < 5; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_work_submit_to_pool(&work, &pool));
+	}
+
+	eai_osal_workqueue_pool_destroy(&pool);
+	TEST_ASSERT_EQUAL(0, pool_overlap);
+	TEST_ASSERT_EQUAL(2, pool_counter);
+}
+
+/* A prioritized item overtakes default-level work already queued */
+static int prio_order[2];
+static volatile int prio_ran;
+
+static void prio_record_callback(void *arg)
+{
+	prio_order[__atomic_fetch_add(&prio_ran, 1, __ATOMIC_SEQ_CST)] = (int)(intptr_t)arg;
+	eai_osal_sem_give(&work_sem);
+}
+
+static void test_work_submit_prio(void)
+{
+	eai_osal_work_t gate, bulk, urgent;
+
+	prio_ran = 0;
+	eai_osal_sem_create(&work_sem, 0, 2);
+	depth_wq_block(&gate);
+
+	eai_osal_work_init(&bulk, prio_record_callback, (void *)(intptr_t)1);
+	eai_osal_work_init(&urgent, prio_record_callback, (void *)(intptr_t)2);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&bulk, &depth_wq));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_submit_prio(&urgent, &depth_wq,
+						    EAI_OSAL_PQUEUE_LEVELS - 1));
+
+	/* Full queue: prioritized submits don't wait either */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_work_submit_prio(&urgent, &depth_wq, 1));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_work_submit_prio(&urgent, &depth_wq,
+						    EAI_OSAL_PQUEUE_LEVELS));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_work_submit_prio(NULL, NULL, 0));
+
+	eai_osal_sem_give(&wq_gate);
+	eai_osal_sem_take(&work_sem, 500);
+	eai_osal_sem_take(&work_sem, 500);
+	TEST_ASSERT_EQUAL(2, prio_ran);
+	TEST_ASSERT_EQUAL(2, prio_order[0]);
+	TEST_ASSERT_EQUAL(1, prio_order[1]);
+
+	eai_osal_sem_destroy(&wq_gate);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SPSC tests (4)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static uint32_t spsc_buf[8];
+
+static void test_spsc_push_pop(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t val;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_spsc_create(&ring, sizeof(uint32_t), 8,
+					       spsc_buf, false));
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_count(&ring));
+	TEST_ASSERT_EQUAL(8, eai_osal_spsc_space(&ring));
+
+	for (uint32_t i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_spsc_push(&ring, &i, EAI_OSAL_NO_WAIT));
+	}
+	TEST_ASSERT_EQUAL(3, eai_osal_spsc_count(&ring));
+
+	for (uint32_t i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_spsc_pop(&ring, &val, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_EQUAL(i, val);
+	}
+	eai_osal_spsc_destroy(&ring);
+}
+
+static void test_spsc_full_empty(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t val = 0;
+
+	eai_osal_spsc_create(&ring, sizeof(uint32_t), 8, spsc_buf, false);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_spsc_pop(&ring, &val, EAI_OSAL_NO_WAIT));
+	for (uint32_t i = 0; i < 8; i++) {
+		eai_osal_spsc_push(&ring, &i, EAI_OSAL_NO_WAIT);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_spsc_push(&ring, &val, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_space(&ring));
+
+	eai_osal_spsc_destroy(&ring);
+}
+
+static void test_spsc_bulk_wraparound(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t in[6], out[8];
+
+	eai_osal_spsc_create(&ring, sizeof(uint32_t), 8, spsc_buf, false);
+
+	/* Move the indices so the next bulk write straddles the end */
+	for (uint32_t i = 0; i < 6; i++) {
+		in[i] = 100 + i;
+	}
+	TEST_ASSERT_EQUAL(5, eai_osal_spsc_write(&ring, in, 5));
+	TEST_ASSERT_EQUAL(5, eai_osal_spsc_read(&ring, out, 8));
+
+	TEST_ASSERT_EQUAL(6, eai_osal_spsc_write(&ring, in, 6));
+	/* Only 2 slots left — write is truncated, not rejected */
+	TEST_ASSERT_EQUAL(2, eai_osal_spsc_write(&ring, in, 6));
+	TEST_ASSERT_EQUAL(8, eai_osal_spsc_read(&ring, out, 8));
+	TEST_ASSERT_EQUAL_UINT32_ARRAY(in, out, 6);
+	TEST_ASSERT_EQUAL(100, out[6]);
+	TEST_ASSERT_EQUAL(101, out[7]);
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_read(&ring, out, 8));
+
+	eai_osal_spsc_destroy(&ring);
+}
+
+static void test_spsc_invalid(void)
+{
+	eai_osal_spsc_ring_t ring;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_spsc_create(&ring, sizeof(uint32_t), 6,
+					       spsc_buf, false));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_spsc_create(&ring, 0, 8, spsc_buf, false));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_spsc_create(NULL, sizeof(uint32_t), 8,
+					       spsc_buf, false));
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Mempool tests (3)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define MEMPOOL_BLOCK 32
+#define MEMPOOL_N     4
+
+EAI_OSAL_MEMPOOL_BUF_DEFINE(mempool_buf, MEMPOOL_BLOCK, MEMPOOL_N);
+
+static void test_mempool_alloc_free(void)
+{
+	eai_osal_mempool_t pool;
+	void *blk[MEMPOOL_N];
+	void *extra;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mempool_create(&pool, MEMPOOL_BLOCK, MEMPOOL_N,
+						  mempool_buf));
+
+	for (int i = 0; i < MEMPOOL_N; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_mempool_alloc(&pool, &blk[i], EAI_OSAL_NO_WAIT));
+		/* A fresh pool hands blocks out in address order */
+		TEST_ASSERT_EQUAL_PTR(mempool_buf + i * MEMPOOL_BLOCK, blk[i]);
+		memset(blk[i], 0xA5, MEMPOOL_BLOCK);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_mempool_alloc(&pool, &extra, EAI_OSAL_NO_WAIT));
+
+	/* Last freed is first reused */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_free(&pool, blk[2]));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mempool_alloc(&pool, &extra, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL_PTR(blk[2], extra);
+
+	for (int i = 0; i < MEMPOOL_N; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_free(&pool, blk[i]));
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_destroy(&pool));
+}
+
+static void test_mempool_stats(void)
+{
+	eai_osal_mempool_t pool;
+	eai_osal_mempool_stats_t st;
+	void *a, *b, *c;
+
+	eai_osal_mempool_create(&pool, MEMPOOL_BLOCK, 2, mempool_buf);
+
+	eai_osal_mempool_alloc(&pool, &a, EAI_OSAL_NO_WAIT);
+	eai_osal_mempool_alloc(&pool, &b, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_mempool_alloc(&pool, &c, EAI_OSAL_NO_WAIT));
+	eai_osal_mempool_free(&pool, a);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_get_stats(&pool, &st));
+	TEST_ASSERT_EQUAL(MEMPOOL_BLOCK, st.block_size);
+	TEST_ASSERT_EQUAL(2, st.n_blocks);
+	TEST_ASSERT_EQUAL(1, st.used);
+	TEST_ASSERT_EQUAL(2, st.high_water);
+	TEST_ASSERT_EQUAL(1, st.failures);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_reset_stats(&pool));
+	eai_osal_mempool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(1, st.high_water);
+	TEST_ASSERT_EQUAL(0, st.failures);
+
+	eai_osal_mempool_free(&pool, b);
+	eai_osal_mempool_destroy(&pool);
+}
+
+static eai_osal_mempool_t mempool_wait_pool;
+static void *mempool_held;
+
+static void mempool_free_entry(void *arg)
+{
+	(void)arg;
+	test_sleep_ms(50);
+	eai_osal_mempool_free(&mempool_wait_pool, mempool_held);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(mempool_stack, 2048);
+
+static void test_mempool_blocking(void)
+{
+	eai_osal_thread_t thread;
+	void *blk;
+
+	eai_osal_mempool_create(&mempool_wait_pool, MEMPOOL_BLOCK, 1, mempool_buf);
+	eai_osal_mempool_alloc(&mempool_wait_pool, &mempool_held, EAI_OSAL_NO_WAIT);
+
+	uint32_t start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_mempool_alloc(&mempool_wait_pool, &blk, 50));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	TEST_ASSERT_GREATER_OR_EQUAL(40, elapsed);
+	TEST_ASSERT_LESS_OR_EQUAL(150, elapsed);
+
+	/* A free from another thread wakes a waiting alloc */
+	eai_osal_thread_create(&thread, "mp_free", mempool_free_entry, NULL,
+			       mempool_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(mempool_stack), 10);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mempool_alloc(&mempool_wait_pool, &blk, 1000));
+	TEST_ASSERT_EQUAL_PTR(mempool_held, blk);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mempool_free(&mempool_wait_pool, blk);
+	eai_osal_mempool_destroy(&mempool_wait_pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Buf tests (3)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define BUF_DATA 64
+#define BUF_N    4
+
+EAI_BUF_POOL_STORAGE_DEFINE(buf_storage, BUF_N, BUF_DATA);
+
+static void test_buf_headroom_tailroom(void)
+{
+	eai_buf_pool_t pool;
+	eai_buf_t *buf;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_buf_pool_create(&pool, BUF_N, BUF_DATA, buf_storage));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_buf_alloc(&pool, &buf, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(0, buf->len);
+	TEST_ASSERT_EQUAL(BUF_DATA, eai_buf_tailroom(buf));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_buf_reserve(buf, 8));
+	TEST_ASSERT_EQUAL(8, eai_buf_headroom(buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_buf_add_mem(buf, "payload", 7));
+	TEST_ASSERT_EQUAL(BUF_DATA - 15, eai_buf_tailroom(buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_buf_reserve(buf, 1));
+
+	/* Prepend a header in the headroom; the payload doesn't move */
+	uint8_t *hdr = eai_buf_push(buf, 2);
+
+	TEST_ASSERT_NOT_NULL(hdr);
+	hdr[0] = 0xAB;
+	hdr[1] = 7;
+	TEST_ASSERT_EQUAL(9, buf->len);
+	TEST_ASSERT_NULL(eai_buf_push(buf, 7));
+
+	TEST_ASSERT_NOT_NULL(eai_buf_pull(buf, 2));
+	TEST_ASSERT_EQUAL_MEMORY("payload", buf->data, 7);
+	TEST_ASSERT_NULL(eai_buf_pull(buf, 8));
+	TEST_ASSERT_NULL(eai_buf_add(buf, BUF_DATA));
+	TEST_ASSERT_EQUAL(EAI_OSAL_NO_MEMORY,
+			  eai_buf_add_mem(buf, buf_storage, BUF_DATA));
+
+	eai_buf_unref(buf);
+	eai_buf_pool_destroy(&pool);
+}
+
+static void test_buf_refcount(void)
+{
+	eai_buf_pool_t pool;
+	eai_osal_mempool_stats_t st;
+	eai_buf_t *buf;
+
+	eai_buf_pool_create(&pool, BUF_N, BUF_DATA, buf_storage);
+	eai_buf_alloc(&pool, &buf, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(buf, "shared", 6);
+
+	TEST_ASSERT_EQUAL_PTR(buf, eai_buf_ref(buf));
+	eai_buf_ref(buf);
+	eai_buf_unref(buf);
+	eai_buf_unref(buf);
+	eai_buf_pool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(1, st.used);
+	TEST_ASSERT_EQUAL_MEMORY("shared", buf->data, 6);
+
+	eai_buf_unref(buf);
+	eai_buf_pool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(0, st.used);
+
+	eai_buf_unref(NULL);
+	eai_buf_pool_destroy(&pool);
+}
+
+static void test_buf_fragments(void)
+{
+	eai_buf_pool_t pool;
+	eai_osal_mempool_stats_t st;
+	eai_buf_t *head, *frag;
+	char out[16] = {0};
+
+	eai_buf_pool_create(&pool, BUF_N, BUF_DATA, buf_storage);
+
+	eai_buf_alloc(&pool, &head, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(head, "abc", 3);
+	eai_buf_alloc(&pool, &frag, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(frag, "defg", 4);
+	eai_buf_frag_add(head, frag);
+	eai_buf_alloc(&pool, &frag, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(frag, "hi", 2);
+	eai_buf_frag_add(head, frag);
+
+	TEST_ASSERT_EQUAL(9, eai_buf_chain_len(head));
+	TEST_ASSERT_EQUAL(9, eai_buf_linearize(head, out, 0, sizeof(out)));
+	TEST_ASSERT_EQUAL_STRING("abcdefghi", out);
+
+	/* Offset and length both cut across fragment boundaries */
+	memset(out, 0, sizeof(out));
+	TEST_ASSERT_EQUAL(5, eai_buf_linearize(head, out, 2, 5));
+	TEST_ASSERT_EQUAL_STRING("cdefg", out);
+	TEST_ASSERT_EQUAL(0, eai_buf_linearize(head, out, 9, 4));
+
+	/* A fragment with its own holder outlives the chain */
+	eai_buf_ref(frag);
+	eai_buf_unref(head);
+	eai_buf_pool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(1, st.used);
+	TEST_ASSERT_EQUAL_MEMORY("hi", frag->data, 2);
+
+	eai_buf_unref(frag);
+	eai_buf_pool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(0, st.used);
+	eai_buf_pool_destroy(&pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Poll tests (3)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_poll_ready_now(void)
+{
+	eai_osal_sem_t sem;
+	eai_osal_queue_t q;
+	eai_osal_event_t ev;
+	int msg = 7;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	eai_osal_queue_create(&q, sizeof(int), 4, queue_buf_4);
+	eai_osal_event_create(&ev);
+
+	eai_osal_poll_event_t events[] = {
+		EAI_OSAL_POLL_SEM(&sem),
+		EAI_OSAL_POLL_QUEUE(&q),
+		EAI_OSAL_POLL_EVENT(&ev, 0x06),
+	};
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(events, 3, EAI_OSAL_NO_WAIT));
+	eai_osal_event_set(&ev, 0x01);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(events, 3, EAI_OSAL_NO_WAIT));
+
+	eai_osal_queue_send(&q, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_event_set(&ev, 0x04);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(events, 3, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_FALSE(events[0].ready);
+	TEST_ASSERT_TRUE(events[1].ready);
+	TEST_ASSERT_TRUE(events[2].ready);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_poll(NULL, 1, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_poll(events, 0, 0));
+
+	eai_osal_queue_destroy(&q);
+	eai_osal_sem_destroy(&sem);
+	eai_osal_event_destroy(&ev);
+}
+
+static void test_poll_timeout(void)
+{
+	eai_osal_sem_t sem;
+
+	eai_osal_sem_create(&sem, 0, 1);
+
+	eai_osal_poll_event_t events[] = { EAI_OSAL_POLL_SEM(&sem) };
+	uint32_t start = eai_osal_time_get_ms();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(events, 1, 50));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	TEST_ASSERT_GREATER_OR_EQUAL(40, elapsed);
+	TEST_ASSERT_LESS_OR_EQUAL(150, elapsed);
+	eai_osal_sem_destroy(&sem);
+}
+
+static eai_osal_sem_t poll_sem;
+static eai_osal_event_t poll_ev;
+
+static void poll_event_setter(void *arg)
+{
+	(void)arg;
+	test_sleep_ms(30);
+	eai_osal_event_set(&poll_ev, 0x10);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(poll_stack, 2048);
+
+static void test_poll_wake_on_event(void)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_sem_create(&poll_sem, 0, 1);
+	eai_osal_event_create(&poll_ev);
+
+	eai_osal_poll_event_t events[] = {
+		EAI_OSAL_POLL_SEM(&poll_sem),
+		EAI_OSAL_POLL_EVENT(&poll_ev, 0x10),
+	};
+
+	eai_osal_thread_create(&thread, "poll_set", poll_event_setter, NULL,
+			       poll_stack, EAI_OSAL_THREAD_STACK_SIZEOF(poll_stack), 10);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(events, 2, 1000));
+	TEST_ASSERT_FALSE(events[0].ready);
+	TEST_ASSERT_TRUE(events[1].ready);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_sem_destroy(&poll_sem);
+	eai_osal_event_destroy(&poll_ev);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * RWLock tests (2)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_rwlock_readers_share(void)
+{
+	eai_osal_rwlock_t rw;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_create(&rw));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_write_lock(&rw, 20));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_read_unlock(&rw));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_read_lock(&rw, 20));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_write_unlock(&rw));
+
+	/* A timed-out writer must not leave readers held back */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	eai_osal_rwlock_read_unlock(&rw);
+
+	eai_osal_rwlock_destroy(&rw);
+}
+
+static eai_osal_rwlock_t rw_lock;
+static eai_osal_atomic_t rw_writer_done;
+
+static void rw_writer(void *arg)
+{
+	(void)arg;
+	if (eai_osal_rwlock_write_lock(&rw_lock, EAI_OSAL_WAIT_FOREVER) == EAI_OSAL_OK) {
+		eai_osal_atomic_store(&rw_writer_done, 1, EAI_OSAL_ATOMIC_RELEASE);
+		eai_osal_rwlock_write_unlock(&rw_lock);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(rw_stack, 2048);
+
+static void test_rwlock_writer_preference(void)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_rwlock_create(&rw_lock);
+	eai_osal_atomic_init(&rw_writer_done, 0);
+
+	eai_osal_rwlock_read_lock(&rw_lock, EAI_OSAL_NO_WAIT);
+	eai_osal_thread_create(&thread, "rw_writer", rw_writer, NULL,
+			       rw_stack, EAI_OSAL_THREAD_STACK_SIZEOF(rw_stack), 10);
+	test_sleep_ms(30);
+
+	/* The writer is queued, so a new reader waits behind it */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_read_lock(&rw_lock, 20));
+
+	eai_osal_rwlock_read_unlock(&rw_lock);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw_lock, 1000));
+	TEST_ASSERT_EQUAL(1, eai_osal_atomic_load(&rw_writer_done, EAI_OSAL_ATOMIC_ACQUIRE));
+	eai_osal_rwlock_read_unlock(&rw_lock);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_rwlock_destroy(&rw_lock);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Atomic tests (1)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_atomic_ops(void)
+{
+	eai_osal_atomic_t a = EAI_OSAL_ATOMIC_INIT(5);
+
+	TEST_ASSERT_EQUAL(5, eai_osal_atomic_add(&a, 3, EAI_OSAL_ATOMIC_ACQ_REL));
+	TEST_ASSERT_EQUAL(8, eai_osal_atomic_sub(&a, 1, EAI_OSAL_ATOMIC_SEQ_CST));
+	TEST_ASSERT_EQUAL(7, eai_osal_atomic_or(&a, 0x100, EAI_OSAL_ATOMIC_RELAXED));
+	TEST_ASSERT_EQUAL(0x107, eai_osal_atomic_and(&a, 0x0ff, EAI_OSAL_ATOMIC_RELAXED));
+	TEST_ASSERT_EQUAL(7, eai_osal_atomic_exchange(&a, 20, EAI_OSAL_ATOMIC_ACQ_REL));
+
+	uint32_t expected = 1;
+
+	TEST_ASSERT_FALSE(eai_osal_atomic_cas(&a, &expected, 2, EAI_OSAL_ATOMIC_RELEASE));
+	TEST_ASSERT_EQUAL(20, expected);
+	TEST_ASSERT_TRUE(eai_osal_atomic_cas(&a, &expected, 2, EAI_OSAL_ATOMIC_ACQ_REL));
+	TEST_ASSERT_EQUAL(2, eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_ACQUIRE));
+
+	int x;
+	eai_osal_atomic_ptr_t p = EAI_OSAL_ATOMIC_INIT(NULL);
+	void *old = NULL;
+
+	TEST_ASSERT_TRUE(eai_osal_atomic_ptr_cas(&p, &old, &x, EAI_OSAL_ATOMIC_ACQ_REL));
+	TEST_ASSERT_EQUAL_PTR(&x, eai_osal_atomic_ptr_exchange(&p, NULL,
+							       EAI_OSAL_ATOMIC_SEQ_CST));
+	TEST_ASSERT_NULL(eai_osal_atomic_ptr_load(&p, EAI_OSAL_ATOMIC_ACQUIRE));
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PQueue tests (1)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_pqueue_priority_order(void)
+{
+	eai_osal_pqueue_t pq;
+	static uint8_t buf[EAI_OSAL_PQUEUE_BUF_SIZE(sizeof(uint32_t), 8)];
+	static const uint32_t sent[] = { 10, 30, 11, 70, 31, 12, 71 };
+	static const uint32_t want[] = { 70, 71, 30, 31, 10, 11, 12 };
+	uint32_t v;
+	uint8_t prio;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_pqueue_create(&pq, sizeof(uint32_t), 8, buf));
+
+	/* Level in the tens digit, arrival order in the units */
+	for (size_t i = 0; i < sizeof(sent) / sizeof(sent[0]); i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_pqueue_send(&pq, &sent[i], (uint8_t)(sent[i] / 10),
+						       EAI_OSAL_NO_WAIT));
+	}
+	for (size_t i = 0; i < sizeof(want) / sizeof(want[0]); i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_pqueue_recv(&pq, &v, &prio, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_EQUAL(want[i], v);
+		TEST_ASSERT_EQUAL(want[i] / 10, prio);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_pqueue_recv(&pq, &v, NULL, 20));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pqueue_send(&pq, &v, EAI_OSAL_PQUEUE_LEVELS, 0));
+
+	eai_osal_pqueue_destroy(&pq);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Task tests (2)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static eai_osal_poll_event_t wp_event;
+static volatile int wp_runs;
+static volatile bool wp_was_ready;
+
+static void wp_callback(void *arg)
+{
+	(void)arg;
+	wp_was_ready = wp_event.ready;
+	wp_runs++;
+}
+
+static void test_work_poll_fires(void)
+{
+	eai_osal_work_poll_t wp;
+	eai_osal_sem_t sem;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	wp_event = (eai_osal_poll_event_t)EAI_OSAL_POLL_SEM(&sem);
+	wp_runs = 0;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_poll_init(&wp, wp_callback, NULL));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_poll_submit(&wp, NULL, &wp_event, 1, 2000));
+	eai_osal_sem_give(&sem);
+	test_sleep_ms(50);
+	TEST_ASSERT_EQUAL(1, wp_runs);
+	TEST_ASSERT_TRUE(wp_was_ready);
+	eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT);
+
+	/* Times out with the entry not ready */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_poll_submit(&wp, NULL, &wp_event, 1, 20));
+	test_sleep_ms(100);
+	TEST_ASSERT_EQUAL(2, wp_runs);
+	TEST_ASSERT_FALSE(wp_was_ready);
+
+	/* Cancelled before the sem comes */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_poll_submit(&wp, NULL, &wp_event, 1,
+						    EAI_OSAL_WAIT_FOREVER));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_poll_cancel(&wp));
+	eai_osal_sem_give(&sem);
+	test_sleep_ms(50);
+	TEST_ASSERT_EQUAL(2, wp_runs);
+
+	eai_osal_sem_destroy(&sem);
+}
+
+struct relay {
+	eai_osal_task_t task;
+	eai_osal_queue_t in;
+	uint32_t in_buf[4];
+	uint32_t sum;
+	eai_osal_status_t ret;
+};
+
+static void relay_fn(eai_osal_task_t *task)
+{
+	struct relay *r = eai_osal_task_arg(task);
+	uint32_t v = 0;
+
+	EAI_OSAL_TASK_BEGIN(task);
+	for (;;) {
+		EAI_OSAL_TASK_AWAIT_QUEUE(task, &r->in, &v, 1000, r->ret);
+		if (r->ret != EAI_OSAL_OK || v == 0) {
+			break;
+		}
+		r->sum += v;
+		EAI_OSAL_TASK_SLEEP(task, 1);
+	}
+	EAI_OSAL_TASK_END(task);
+}
+
+static void test_task_queue_flow(void)
+{
+	static struct relay r;
+	uint32_t v;
+
+	memset(&r, 0, sizeof(r));
+	eai_osal_queue_create(&r.in, sizeof(uint32_t), 4, r.in_buf);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_task_init(&r.task, relay_fn, &r));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_task_start(&r.task, NULL));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_task_start(&r.task, NULL));
+
+	for (v = 1; v <= 3; v++) {
+		eai_osal_queue_send(&r.in, &v, EAI_OSAL_WAIT_FOREVER);
+		test_sleep_ms(5);
+	}
+	v = 0;
+	eai_osal_queue_send(&r.in, &v, EAI_OSAL_WAIT_FOREVER);
+
+	for (int i = 0; i < 100 && !eai_osal_task_is_done(&r.task); i++) {
+		test_sleep_ms(10);
+	}
+	TEST_ASSERT_TRUE(eai_osal_task_is_done(&r.task));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, r.ret);
+	TEST_ASSERT_EQUAL(6, r.sum);
+
+	eai_osal_queue_destroy(&r.in);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Pipe tests (2)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_pipe_partial_transfer(void)
+{
+	eai_osal_pipe_t pipe;
+	uint8_t storage[17]; /* the stream buffer keeps one byte free */
+	uint8_t in[20], out[20];
+	size_t n;
+
+	for (size_t i = 0; i < sizeof(in); i++) {
+		in[i] = (uint8_t)i;
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_pipe_create(&pipe, storage, sizeof(storage), 1));
+
+	/* Only what fits goes in */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_pipe_write(&pipe, in, 20, &n, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(16, n);
+	TEST_ASSERT_EQUAL(0, eai_osal_pipe_space(&pipe));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_read(&pipe, out, 10, &n, 0));
+	TEST_ASSERT_EQUAL(10, n);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_read(&pipe, out + 10, 10, &n, 0));
+	TEST_ASSERT_EQUAL(6, n);
+	TEST_ASSERT_EQUAL_MEMORY(in, out, 16);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_pipe_read(&pipe, out, 4, &n, 20));
+	TEST_ASSERT_EQUAL(0, n);
+	eai_osal_pipe_destroy(&pipe);
+}
+
+static eai_osal_pipe_t pipe_dut;
+
+static void pipe_dribble_task(void *arg)
+{
+	(void)arg;
+	for (uint8_t i = 0; i < 4; i++) {
+		uint8_t chunk[4] = { i, i, i, i };
+
+		test_sleep_ms(10);
+		eai_osal_pipe_write(&pipe_dut, chunk, sizeof(chunk), NULL,
+				    EAI_OSAL_WAIT_FOREVER);
+	}
+	vTaskDelete(NULL);
+}
+
+static void test_pipe_threshold(void)
+{
+	static uint8_t storage[64];
+	uint8_t out[32];
+	size_t n;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_pipe_create(&pipe_dut, storage, sizeof(storage), 8));
+
+	/* Under the threshold at the timeout, the bytes still come out */
+	eai_osal_pipe_write(&pipe_dut, "abc", 3, NULL, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_pipe_read(&pipe_dut, out, sizeof(out), &n, 20));
+	TEST_ASSERT_EQUAL(3, n);
+
+	/* Sleeps through the first 4-byte write */
+	xTaskCreate(pipe_dribble_task, "dribble", 2048, NULL, 5, NULL);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_pipe_read(&pipe_dut, out, sizeof(out), &n, 1000));
+	TEST_ASSERT_TRUE(n >= 8);
+	test_sleep_ms(50);
+	eai_osal_pipe_destroy(&pipe_dut);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Test runner
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -737,18 +1923,25 @@ void app_main(void)
 	RUN_TEST(test_sem_timeout);
 	RUN_TEST(test_sem_give_at_limit);
 
-	/* Thread (4) */
+	/* Thread (6) */
 	RUN_TEST(test_thread_create_join);
 	RUN_TEST(test_thread_sleep);
 	RUN_TEST(test_thread_yield);
 	RUN_TEST(test_thread_priority);
+	RUN_TEST(test_thread_set_affinity);
+	RUN_TEST(test_thread_stats);
 
-	/* Queue (5) */
+	/* Queue (10) */
 	RUN_TEST(test_queue_create_destroy);
 	RUN_TEST(test_queue_send_recv);
 	RUN_TEST(test_queue_full);
 	RUN_TEST(test_queue_fifo_order);
 	RUN_TEST(test_queue_empty_timeout);
+	RUN_TEST(test_queue_reserve_commit);
+	RUN_TEST(test_queue_reserve_outstanding);
+	RUN_TEST(test_queue_send_recv_many);
+	RUN_TEST(test_queue_send_many_partial);
+	RUN_TEST(test_queue_drain_timeout);
 
 	/* Timer (5) */
 	RUN_TEST(test_timer_create_destroy);
@@ -768,12 +1961,14 @@ void app_main(void)
 	RUN_TEST(test_critical_enter_exit);
 	RUN_TEST(test_critical_nested);
 
-	/* Time (3) */
+	/* Time (5) */
 	RUN_TEST(test_time_get_ms);
 	RUN_TEST(test_time_monotonic);
 	RUN_TEST(test_time_tick_roundtrip);
+	RUN_TEST(test_time_us_ns);
+	RUN_TEST(test_time_cycles);
 
-	/* Work (9) */
+	/* Work (15) */
 	RUN_TEST(test_work_init);
 	RUN_TEST(test_work_init_null);
 	RUN_TEST(test_work_submit);
@@ -783,6 +1978,51 @@ void app_main(void)
 	RUN_TEST(test_dwork_cancel);
 	RUN_TEST(test_custom_workqueue);
 	RUN_TEST(test_dwork_submit_to_queue);
+	RUN_TEST(test_workqueue_depth_backpressure);
+	RUN_TEST(test_work_submit_timeout_waits);
+	RUN_TEST(test_workqueue_stats_latency);
+	RUN_TEST(test_pool_runs_all);
+	RUN_TEST(test_pool_no_self_concurrency);
+	RUN_TEST(test_work_submit_prio);
+
+	/* SPSC (4) */
+	RUN_TEST(test_spsc_push_pop);
+	RUN_TEST(test_spsc_full_empty);
+	RUN_TEST(test_spsc_bulk_wraparound);
+	RUN_TEST(test_spsc_invalid);
+
+	/* Mempool (3) */
+	RUN_TEST(test_mempool_alloc_free);
+	RUN_TEST(test_mempool_stats);
+	RUN_TEST(test_mempool_blocking);
+
+	/* Buf (3) */
+	RUN_TEST(test_buf_headroom_tailroom);
+	RUN_TEST(test_buf_refcount);
+	RUN_TEST(test_buf_fragments);
+
+	/* Poll (3) */
+	RUN_TEST(test_poll_ready_now);
+	RUN_TEST(test_poll_timeout);
+	RUN_TEST(test_poll_wake_on_event);
+
+	/* RWLock (2) */
+	RUN_TEST(test_rwlock_readers_share);
+	RUN_TEST(test_rwlock_writer_preference);
+
+	/* Atomic (1) */
+	RUN_TEST(test_atomic_ops);
+
+	/* PQueue (1) */
+	RUN_TEST(test_pqueue_priority_order);
+
+	/* Task (2) */
+	RUN_TEST(test_work_poll_fires);
+	RUN_TEST(test_task_queue_flow);
+
+	/* Pipe (2) */
+	RUN_TEST(test_pipe_partial_transfer);
+	RUN_TEST(test_pipe_threshold);
 
 	UNITY_END();
 }
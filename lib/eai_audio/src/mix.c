@@ -0,0 +1,702 @@
+/*
+ * eai_audio mini-flinger — mix kernels
+ *
+ * Each kernel is written once against a handful of vector operations that
+ * every supported instruction set provides, mapped below. The vector loop
+ * covers whole vectors and hands the tail to the scalar reference.
+ *
+ * The kernels match the reference bit for bit because they perform the
+ * same float operations in the same order. Scaling by a format's full
+ * scale is by a power of two and exact. Clamping is min-then-max, which
+ * picks the bound for a NaN on every ISA used here. Rounding to integer is
+ * to nearest even, the conversion these ISAs provide. Dither is a hash of
+ * a per-sample position, so vector lanes compute exactly what the scalar
+ * loop would.
+ *
+ * The S16 fast path (eai_audio_mix_s16) stays integer, on kernels of its own.
+ * They split a volume of at most unity into its low 16 bits vl and bit 15.
+ * A signed 16x16 high-half multiply by vl read as int16 gives
+ * floor(s * vl / 65536), less s whenever bit 15 of vl is set, so adding s
+ * back in that case gives the reference's (s * volume) >> 16 exactly.
+ * Unity (vl = 0, with the add) comes out as s. The scaled sample always
+ * fits int16, and a saturating add then matches the reference clip.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "mix.h"
+#include "mixer.h"
+#include <math.h>
+#include <string.h>
+
+/* ── Vector operations ──────────────────────────────────────────────────── */
+
+/*
+ * MIX_VECTOR: ingest and mix kernels exist.
+ * MIX_VECTOR_OUT: the output kernel exists too. It needs float-to-int
+ * conversion rounding to nearest, which 32-bit NEON before Armv8 lacks.
+ */
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 2)
+#include <arm_mve.h>
+#define MIX_KERNEL "mve"
+#define MIX_VECTOR
+#define MIX_VECTOR_OUT
+#define MIX_LANES 4
+typedef float32x4_t vf_t;
+typedef int32x4_t vi_t;
+#define vf_load(p)         vld1q_f32(p)
+#define vf_store(p, v)     vst1q_f32(p, v)
+#define vf_splat(x)        vdupq_n_f32(x)
+#define vf_add(a, b)       vaddq_f32(a, b)
+#define vf_mul(a, b)       vmulq_f32(a, b)
+#define vf_min(a, b)       vminnmq_f32(a, b)
+#define vf_max(a, b)       vmaxnmq_f32(a, b)
+#define vf_from_vi(v)      vcvtq_f32_s32(v)
+#define vf_to_vi(v)        vcvtnq_s32_f32(v)
+#define vi_load(p)         vld1q_s32(p)
+#define vi_store(p, v)     vst1q_s32(p, v)
+#define vi_load_s16(p)     vldrhq_s32(p)
+#define vi_store_s16(p, v) vstrhq_s32(p, v)
+#define vi_splat(x)        vdupq_n_s32(x)
+#define vi_add(a, b)       vaddq_s32(a, b)
+#define vi_sub(a, b)       vsubq_s32(a, b)
+#define vi_and(a, b)       vandq_s32(a, b)
+#define vi_xor(a, b)       veorq_s32(a, b)
+#define vi_shl(a, n)       vshlq_n_s32(a, n)
+#define vi_shru(a, n) \
+	vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(a), n))
+
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MIX_KERNEL "neon"
+#define MIX_VECTOR
+#if defined(__ARM_FEATURE_DIRECTED_ROUNDING) && \
+	defined(__ARM_FEATURE_NUMERIC_MAXMIN)
+#define MIX_VECTOR_OUT
+#endif
+#define MIX_LANES 4
+typedef float32x4_t vf_t;
+typedef int32x4_t vi_t;
+#define vf_load(p)         vld1q_f32(p)
+#define vf_store(p, v)     vst1q_f32(p, v)
+#define vf_splat(x)        vdupq_n_f32(x)
+#define vf_add(a, b)       vaddq_f32(a, b)
+#define vf_mul(a, b)       vmulq_f32(a, b)
+#define vf_min(a, b)       vminnmq_f32(a, b)
+#define vf_max(a, b)       vmaxnmq_f32(a, b)
+#define vf_from_vi(v)      vcvtq_f32_s32(v)
+#define vf_to_vi(v)        vcvtnq_s32_f32(v)
+#define vi_load(p)         vld1q_s32(p)
+#define vi_store(p, v)     vst1q_s32(p, v)
+#define vi_load_s16(p)     vmovl_s16(vld1_s16(p))
+#define vi_store_s16(p, v) vst1_s16(p, vmovn_s32(v))
+#define vi_splat(x)        vdupq_n_s32(x)
+#define vi_add(a, b)       vaddq_s32(a, b)
+#define vi_sub(a, b)       vsubq_s32(a, b)
+#define vi_and(a, b)       vandq_s32(a, b)
+#define vi_xor(a, b)       veorq_s32(a, b)
+#define vi_shl(a, n)       vshlq_n_s32(a, n)
+#define vi_shru(a, n) \
+	vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(a), n))
+
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define MIX_KERNEL "avx2"
+#define MIX_VECTOR
+#define MIX_VECTOR_OUT
+#define MIX_LANES 8
+typedef __m256 vf_t;
+typedef __m256i vi_t;
+#define vf_load(p)         _mm256_loadu_ps(p)
+#define vf_store(p, v)     _mm256_storeu_ps(p, v)
+#define vf_splat(x)        _mm256_set1_ps(x)
+#define vf_add(a, b)       _mm256_add_ps(a, b)
+#define vf_mul(a, b)       _mm256_mul_ps(a, b)
+#define vf_min(a, b)       _mm256_min_ps(a, b)
+#define vf_max(a, b)       _mm256_max_ps(a, b)
+#define vf_from_vi(v)      _mm256_cvtepi32_ps(v)
+#define vf_to_vi(v)        _mm256_cvtps_epi32(v)
+#define vi_load(p)         _mm256_loadu_si256((const __m256i *)(p))
+#define vi_store(p, v)     _mm256_storeu_si256((__m256i *)(p), v)
+#define vi_load_s16(p) \
+	_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(p)))
+#define vi_store_s16(p, v) \
+	_mm_storeu_si128((__m128i *)(p), \
+			 _mm_packs_epi32(_mm256_castsi256_si128(v), \
+					 _mm256_extracti128_si256(v, 1)))
+#define vi_splat(x)        _mm256_set1_epi32(x)
+#define vi_add(a, b)       _mm256_add_epi32(a, b)
+#define vi_sub(a, b)       _mm256_sub_epi32(a, b)
+#define vi_and(a, b)       _mm256_and_si256(a, b)
+#define vi_xor(a, b)       _mm256_xor_si256(a, b)
+#define vi_shl(a, n)       _mm256_slli_epi32(a, n)
+#define vi_shru(a, n)      _mm256_srli_epi32(a, n)
+
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define MIX_KERNEL "sse2"
+#define MIX_VECTOR
+#define MIX_VECTOR_OUT
+#define MIX_LANES 4
+typedef __m128 vf_t;
+typedef __m128i vi_t;
+#define vf_load(p)         _mm_loadu_ps(p)
+#define vf_store(p, v)     _mm_storeu_ps(p, v)
+#define vf_splat(x)        _mm_set1_ps(x)
+#define vf_add(a, b)       _mm_add_ps(a, b)
+#define vf_mul(a, b)       _mm_mul_ps(a, b)
+#define vf_min(a, b)       _mm_min_ps(a, b)
+#define vf_max(a, b)       _mm_max_ps(a, b)
+#define vf_from_vi(v)      _mm_cvtepi32_ps(v)
+#define vf_to_vi(v)        _mm_cvtps_epi32(v)
+#define vi_load(p)         _mm_loadu_si128((const __m128i *)(p))
+#define vi_store(p, v)     _mm_storeu_si128((__m128i *)(p), v)
+#define vi_load_s16(p) \
+	_mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), \
+					  _mm_loadl_epi64((const __m128i *)(p))), 16)
+#define vi_store_s16(p, v) \
+	_mm_storel_epi64((__m128i *)(p), _mm_packs_epi32(v, v))
+#define vi_splat(x)        _mm_set1_epi32(x)
+#define vi_add(a, b)       _mm_add_epi32(a, b)
+#define vi_sub(a, b)       _mm_sub_epi32(a, b)
+#define vi_and(a, b)       _mm_and_si128(a, b)
+#define vi_xor(a, b)       _mm_xor_si128(a, b)
+#define vi_shl(a, n)       _mm_slli_epi32(a, n)
+#define vi_shru(a, n)      _mm_srli_epi32(a, n)
+
+#else
+#define MIX_KERNEL "scalar"
+#endif
+
+/* ── Formats ────────────────────────────────────────────────────────────── */
+
+/* Float value of one LSB of each integer format */
+#define S16_LSB (1.0f / 32768.0f)
+#define S24_LSB (1.0f / 8388608.0f)
+#define S32_LSB (1.0f / 2147483648.0f)
+
+/* Output scaling and clip range, in LSBs of the format */
+struct out_range {
+	float full_scale;
+	float lo;
+	float hi;
+	bool dither;
+};
+
+static const struct out_range out_ranges[] = {
+	[EAI_AUDIO_FORMAT_PCM_S16_LE] = { 32768.0f, -32768.0f, 32767.0f, true },
+	[EAI_AUDIO_FORMAT_PCM_S24_LE] = { 8388608.0f, -8388608.0f, 8388607.0f, true },
+	/* 2147483520 is the largest float below 2^31 */
+	[EAI_AUDIO_FORMAT_PCM_S32_LE] = { 2147483648.0f, -2147483648.0f,
+					  2147483520.0f, false },
+};
+
+uint32_t eai_audio_format_bytes(enum eai_audio_format format)
+{
+	switch (format) {
+	case EAI_AUDIO_FORMAT_PCM_S16_LE: return 2;
+	case EAI_AUDIO_FORMAT_PCM_S24_LE: return 3;
+	case EAI_AUDIO_FORMAT_PCM_S32_LE: return 4;
+	case EAI_AUDIO_FORMAT_PCM_F32_LE: return 4;
+	default: return 0;
+	}
+}
+
+/* Gain folded with the format's LSB, so ingest is one multiply */
+static float ingest_scale(enum eai_audio_format format, float gain)
+{
+	switch (format) {
+	case EAI_AUDIO_FORMAT_PCM_S16_LE: return gain * S16_LSB;
+	case EAI_AUDIO_FORMAT_PCM_S24_LE: return gain * S24_LSB;
+	case EAI_AUDIO_FORMAT_PCM_S32_LE: return gain * S32_LSB;
+	default: return gain;
+	}
+}
+
+static int32_t s24_load(const uint8_t *p)
+{
+	return (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 |
+			 (uint32_t)p[2] << 24) >> 8;
+}
+
+static void s24_store(uint8_t *p, int32_t s)
+{
+	p[0] = (uint8_t)s;
+	p[1] = (uint8_t)(s >> 8);
+	p[2] = (uint8_t)(s >> 16);
+}
+
+/* ── Dither ─────────────────────────────────────────────────────────────── */
+
+/* Weyl step: successive positions spread over the whole 32-bit range */
+#define DITHER_STEP 0x9E3779B9u
+
+static uint32_t dither_hash(uint32_t x)
+{
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return x;
+}
+
+/* Difference of two uniform 16-bit values: triangular over (-1, 1) LSB */
+static float dither_lsb(uint32_t pos)
+{
+	uint32_t h = dither_hash(pos);
+
+	return (float)((int32_t)(h & 0xFFFF) - (int32_t)(h >> 16)) *
+	       (1.0f / 65536.0f);
+}
+
+/* Min then max, so a NaN comes out as hi (see the top of this file) */
+static float clamp(float v, float lo, float hi)
+{
+	v = v < hi ? v : hi;
+	return v > lo ? v : lo;
+}
+
+/* ── Scalar reference ───────────────────────────────────────────────────── */
+
+void eai_audio_to_f32_ref(float *dst, const void *src,
+			  enum eai_audio_format format, uint32_t samples,
+			  float gain)
+{
+	float scale = ingest_scale(format, gain);
+
+	for (uint32_t i = 0; i < samples; i++) {
+		switch (format) {
+		case EAI_AUDIO_FORMAT_PCM_S16_LE:
+			dst[i] = (float)((const int16_t *)src)[i] * scale;
+			break;
+		case EAI_AUDIO_FORMAT_PCM_S24_LE:
+			dst[i] = (float)s24_load((const uint8_t *)src + 3 * i) * scale;
+			break;
+		case EAI_AUDIO_FORMAT_PCM_S32_LE:
+			dst[i] = (float)((const int32_t *)src)[i] * scale;
+			break;
+		default:
+			dst[i] = ((const float *)src)[i] * scale;
+			break;
+		}
+	}
+}
+
+void eai_audio_from_f32_ref(void *dst, const float *src,
+			    enum eai_audio_format format, uint32_t samples,
+			    uint32_t *dither)
+{
+	if (format == EAI_AUDIO_FORMAT_PCM_F32_LE) {
+		for (uint32_t i = 0; i < samples; i++) {
+			((float *)dst)[i] = clamp(src[i], -1.0f, 1.0f);
+		}
+		return;
+	}
+
+	const struct out_range *r = &out_ranges[format];
+	bool dithered = dither != NULL && r->dither;
+	uint32_t pos = dithered ? *dither : 0;
+
+	for (uint32_t i = 0; i < samples; i++) {
+		float v = src[i] * r->full_scale;
+
+		if (dithered) {
+			v += dither_lsb(pos);
+			pos += DITHER_STEP;
+		}
+
+		int32_t s = (int32_t)lrintf(clamp(v, r->lo, r->hi));
+
+		switch (format) {
+		case EAI_AUDIO_FORMAT_PCM_S16_LE:
+			((int16_t *)dst)[i] = (int16_t)s;
+			break;
+		case EAI_AUDIO_FORMAT_PCM_S24_LE:
+			s24_store((uint8_t *)dst + 3 * i, s);
+			break;
+		default:
+			((int32_t *)dst)[i] = s;
+			break;
+		}
+	}
+
+	if (dithered) {
+		*dither = pos;
+	}
+}
+
+void eai_audio_mix_f32_ref(float *acc, const float *src, uint32_t samples)
+{
+	for (uint32_t i = 0; i < samples; i++) {
+		acc[i] += src[i];
+	}
+}
+
+/*
+ * One running sum per tap index mod 8, added pairwise at the end: the
+ * order 4- and 8-lane vectors sum in as well.
+ */
+#define DOT_SUMS 8
+
+static float dot_reduce(const float *sum)
+{
+	return ((sum[0] + sum[4]) + (sum[2] + sum[6])) +
+	       ((sum[1] + sum[5]) + (sum[3] + sum[7]));
+}
+
+float eai_audio_dot_q15_ref(const float *x, const int16_t *coefs, uint32_t taps)
+{
+	float sum[DOT_SUMS] = { 0 };
+
+	for (uint32_t k = 0; k < taps; k += DOT_SUMS) {
+		for (int j = 0; j < DOT_SUMS; j++) {
+			sum[j] += x[k + j] * (float)coefs[k + j];
+		}
+	}
+	return dot_reduce(sum);
+}
+
+/* ── Vector kernels ─────────────────────────────────────────────────────── */
+
+#ifdef MIX_VECTOR
+
+/* Each returns how many samples it did; the caller finishes the tail */
+
+static uint32_t vec_to_f32(float *dst, const void *src,
+			   enum eai_audio_format format, uint32_t samples,
+			   float gain)
+{
+	vf_t scale = vf_splat(ingest_scale(format, gain));
+	uint32_t i = 0;
+
+	/*
+	 * Packed 24-bit has no vector load, and widening through memory stalls
+	 * on the store-to-load forward; the scalar loop is faster.
+	 */
+	if (format == EAI_AUDIO_FORMAT_PCM_S24_LE) {
+		return 0;
+	}
+
+	for (; i + MIX_LANES <= samples; i += MIX_LANES) {
+		vf_t v;
+
+		switch (format) {
+		case EAI_AUDIO_FORMAT_PCM_S16_LE:
+			v = vf_from_vi(vi_load_s16((const int16_t *)src + i));
+			break;
+		case EAI_AUDIO_FORMAT_PCM_S32_LE:
+			v = vf_from_vi(vi_load((const int32_t *)src + i));
+			break;
+		default:
+			v = vf_load((const float *)src + i);
+			break;
+		}
+		vf_store(dst + i, vf_mul(v, scale));
+	}
+	return i;
+}
+
+#ifdef MIX_VECTOR_OUT
+
+static uint32_t vec_from_f32(void *dst, const float *src,
+			     enum eai_audio_format format, uint32_t samples,
+			     uint32_t *dither)
+{
+	uint32_t i = 0;
+
+	if (format == EAI_AUDIO_FORMAT_PCM_F32_LE) {
+		vf_t lo = vf_splat(-1.0f);
+		vf_t hi = vf_splat(1.0f);
+
+		for (; i + MIX_LANES <= samples; i += MIX_LANES) {
+			vf_store((float *)dst + i,
+				 vf_max(vf_min(vf_load(src + i), hi), lo));
+		}
+		return i;
+	}
+
+	const struct out_range *r = &out_ranges[format];
+	bool dithered = dither != NULL && r->dither;
+	vf_t full_scale = vf_splat(r->full_scale);
+	vf_t lo = vf_splat(r->lo);
+	vf_t hi = vf_splat(r->hi);
+	vf_t dither_unit = vf_splat(1.0f / 65536.0f);
+	vi_t low_half = vi_splat(0xFFFF);
+	vi_t pos;
+	int32_t tmp[MIX_LANES];
+
+	/* Lane j dithers with the position sample i + j would have */
+	for (int j = 0; j < MIX_LANES; j++) {
+		tmp[j] = (int32_t)((dithered ? *dither : 0) + (uint32_t)j * DITHER_STEP);
+	}
+	pos = vi_load(tmp);
+
+	for (; i + MIX_LANES <= samples; i += MIX_LANES) {
+		vf_t v = vf_mul(vf_load(src + i), full_scale);
+
+		if (dithered) {
+			vi_t h = pos;
+
+			h = vi_xor(h, vi_shl(h, 13));
+			h = vi_xor(h, vi_shru(h, 17));
+			h = vi_xor(h, vi_shl(h, 5));
+			v = vf_add(v, vf_mul(vf_from_vi(vi_sub(vi_and(h, low_half),
+							       vi_shru(h, 16))),
+					     dither_unit));
+			pos = vi_add(pos, vi_splat((int32_t)(MIX_LANES * DITHER_STEP)));
+		}
+
+		vi_t s = vf_to_vi(vf_max(vf_min(v, hi), lo));
+
+		switch (format) {
+		case EAI_AUDIO_FORMAT_PCM_S16_LE:
+			vi_store_s16((int16_t *)dst + i, s);
+			break;
+		case EAI_AUDIO_FORMAT_PCM_S24_LE:
+			vi_store(tmp, s);
+			for (int j = 0; j < MIX_LANES; j++) {
+				s24_store((uint8_t *)dst + 3 * (i + j), tmp[j]);
+			}
+			break;
+		default:
+			vi_store((int32_t *)dst + i, s);
+			break;
+		}
+	}
+
+	if (dithered) {
+		*dither += i * DITHER_STEP;
+	}
+	return i;
+}
+
+#endif /* MIX_VECTOR_OUT */
+
+static uint32_t vec_mix_f32(float *acc, const float *src, uint32_t samples)
+{
+	uint32_t i = 0;
+
+	for (; i + MIX_LANES <= samples; i += MIX_LANES) {
+		vf_store(acc + i, vf_add(vf_load(acc + i), vf_load(src + i)));
+	}
+	return i;
+}
+
+static float vec_dot_q15(const float *x, const int16_t *coefs, uint32_t taps)
+{
+	vf_t acc[DOT_SUMS / MIX_LANES];
+	float sum[DOT_SUMS];
+
+	for (int v = 0; v < DOT_SUMS / MIX_LANES; v++) {
+		acc[v] = vf_splat(0.0f);
+	}
+	for (uint32_t k = 0; k < taps; k += DOT_SUMS) {
+		for (int v = 0; v < DOT_SUMS / MIX_LANES; v++) {
+			uint32_t at = k + v * MIX_LANES;
+
+			acc[v] = vf_add(acc[v],
+					vf_mul(vf_load(x + at),
+					       vf_from_vi(vi_load_s16(coefs + at))));
+		}
+	}
+	for (int v = 0; v < DOT_SUMS / MIX_LANES; v++) {
+		vf_store(sum + v * MIX_LANES, acc[v]);
+	}
+	return dot_reduce(sum);
+}
+
+#endif /* MIX_VECTOR */
+
+/* ── Dispatch ───────────────────────────────────────────────────────────── */
+
+void eai_audio_to_f32(float *dst, const void *src, enum eai_audio_format format,
+		      uint32_t samples, float gain)
+{
+	uint32_t done = 0;
+
+#ifdef MIX_VECTOR
+	done = vec_to_f32(dst, src, format, samples, gain);
+#endif
+	eai_audio_to_f32_ref(dst + done,
+			     (const uint8_t *)src + done * eai_audio_format_bytes(format),
+			     format, samples - done, gain);
+}
+
+void eai_audio_from_f32(void *dst, const float *src, enum eai_audio_format format,
+			uint32_t samples, uint32_t *dither)
+{
+	uint32_t done = 0;
+
+#ifdef MIX_VECTOR_OUT
+	done = vec_from_f32(dst, src, format, samples, dither);
+#endif
+	eai_audio_from_f32_ref((uint8_t *)dst + done * eai_audio_format_bytes(format),
+			       src + done, format, samples - done, dither);
+}
+
+void eai_audio_mix_f32(float *acc, const float *src, uint32_t samples)
+{
+	uint32_t done = 0;
+
+#ifdef MIX_VECTOR
+	done = vec_mix_f32(acc, src, samples);
+#endif
+	eai_audio_mix_f32_ref(acc + done, src + done, samples - done);
+}
+
+float eai_audio_dot_q15(const float *x, const int16_t *coefs, uint32_t taps)
+{
+#ifdef MIX_VECTOR
+	return vec_dot_q15(x, coefs, taps);
+#else
+	return eai_audio_dot_q15_ref(x, coefs, taps);
+#endif
+}
+
+/* ── S16 fast path ──────────────────────────────────────────────────────── */
+
+void eai_audio_mix_s16_ref(int16_t *acc, const int16_t *src, uint32_t samples,
+			   uint32_t volume_q16)
+{
+	for (uint32_t i = 0; i < samples; i++) {
+		/* 64-bit product: gains above unity overflow int32 */
+		int64_t scaled = ((int64_t)src[i] * volume_q16) >> 16;
+		int64_t sum = acc[i] + scaled;
+
+		/* Hard clip to int16 range */
+		if (sum > INT16_MAX) {
+			sum = INT16_MAX;
+		} else if (sum < INT16_MIN) {
+			sum = INT16_MIN;
+		}
+
+		acc[i] = (int16_t)sum;
+	}
+}
+
+/* Low 16 bits of a volume <= unity, read as int16 */
+#define MIX_VL(v) ((int16_t)(uint16_t)(v))
+
+/* All ones when s must be added back: bit 15 set, or unity */
+#define MIX_ADD_MASK(v) ((int16_t)(((v) & 0x18000u) ? -1 : 0))
+
+/* Integer MVE is enough here, so this path can be vector where float isn't */
+#if defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 1)
+#include <arm_mve.h>
+#define MIX_S16_VECTOR
+
+/* Tail-predicated: the last partial vector loads and stores only n lanes */
+static void vec_mix_s16(int16_t *acc, const int16_t *src, uint32_t samples,
+			uint32_t volume_q16)
+{
+	int16x8_t vol = vdupq_n_s16(MIX_VL(volume_q16));
+	int16x8_t mask = vdupq_n_s16(MIX_ADD_MASK(volume_q16));
+	int32_t n = (int32_t)samples;
+
+	while (n > 0) {
+		mve_pred16_t p = vctp16q((uint32_t)n);
+		int16x8_t s = vld1q_z_s16(src, p);
+		int16x8_t a = vld1q_z_s16(acc, p);
+		int16x8_t scaled = vaddq_s16(vmulhq_s16(s, vol),
+					     vandq_s16(s, mask));
+
+		vst1q_p_s16(acc, vqaddq_s16(a, scaled), p);
+		src += 8;
+		acc += 8;
+		n -= 8;
+	}
+}
+
+#elif defined(__ARM_NEON)
+#define MIX_S16_VECTOR
+
+static void vec_mix_s16(int16_t *acc, const int16_t *src, uint32_t samples,
+			uint32_t volume_q16)
+{
+	int16x4_t vol = vdup_n_s16(MIX_VL(volume_q16));
+	int16x8_t mask = vdupq_n_s16(MIX_ADD_MASK(volume_q16));
+	uint32_t i = 0;
+
+	for (; i + 8 <= samples; i += 8) {
+		int16x8_t s = vld1q_s16(src + i);
+		int16x8_t a = vld1q_s16(acc + i);
+		int32x4_t lo = vmull_s16(vget_low_s16(s), vol);
+		int32x4_t hi = vmull_s16(vget_high_s16(s), vol);
+		int16x8_t scaled = vcombine_s16(vshrn_n_s32(lo, 16),
+						vshrn_n_s32(hi, 16));
+
+		scaled = vaddq_s16(scaled, vandq_s16(s, mask));
+		vst1q_s16(acc + i, vqaddq_s16(a, scaled));
+	}
+	eai_audio_mix_s16_ref(acc + i, src + i, samples - i, volume_q16);
+}
+
+#elif defined(__AVX2__)
+#define MIX_S16_VECTOR
+
+static void vec_mix_s16(int16_t *acc, const int16_t *src, uint32_t samples,
+			uint32_t volume_q16)
+{
+	__m256i vol = _mm256_set1_epi16(MIX_VL(volume_q16));
+	__m256i mask = _mm256_set1_epi16(MIX_ADD_MASK(volume_q16));
+	uint32_t i = 0;
+
+	for (; i + 16 <= samples; i += 16) {
+		__m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+		__m256i a = _mm256_loadu_si256((const __m256i *)(acc + i));
+		__m256i scaled = _mm256_add_epi16(_mm256_mulhi_epi16(s, vol),
+						  _mm256_and_si256(s, mask));
+
+		_mm256_storeu_si256((__m256i *)(acc + i),
+				    _mm256_adds_epi16(a, scaled));
+	}
+	for (; i + 8 <= samples; i += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i a = _mm_loadu_si128((const __m128i *)(acc + i));
+		__m128i scaled = _mm_add_epi16(
+			_mm_mulhi_epi16(s, _mm256_castsi256_si128(vol)),
+			_mm_and_si128(s, _mm256_castsi256_si128(mask)));
+
+		_mm_storeu_si128((__m128i *)(acc + i), _mm_adds_epi16(a, scaled));
+	}
+	eai_audio_mix_s16_ref(acc + i, src + i, samples - i, volume_q16);
+}
+
+#elif defined(__SSE2__)
+#define MIX_S16_VECTOR
+
+static void vec_mix_s16(int16_t *acc, const int16_t *src, uint32_t samples,
+			uint32_t volume_q16)
+{
+	__m128i vol = _mm_set1_epi16(MIX_VL(volume_q16));
+	__m128i mask = _mm_set1_epi16(MIX_ADD_MASK(volume_q16));
+	uint32_t i = 0;
+
+	for (; i + 8 <= samples; i += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i a = _mm_loadu_si128((const __m128i *)(acc + i));
+		__m128i scaled = _mm_add_epi16(_mm_mulhi_epi16(s, vol),
+					       _mm_and_si128(s, mask));
+
+		_mm_storeu_si128((__m128i *)(acc + i), _mm_adds_epi16(a, scaled));
+	}
+	eai_audio_mix_s16_ref(acc + i, src + i, samples - i, volume_q16);
+}
+
+#endif
+
+void eai_audio_mix_s16(int16_t *acc, const int16_t *src, uint32_t samples,
+		       uint32_t volume_q16)
+{
+#ifdef MIX_S16_VECTOR
+	if (volume_q16 <= EAI_AUDIO_MIXER_VOLUME_UNITY) {
+		vec_mix_s16(acc, src, samples, volume_q16);
+		return;
+	}
+#endif
+	eai_audio_mix_s16_ref(acc, src, samples, volume_q16);
+}
+
+const char *eai_audio_mix_kernel(void)
+{
+	return MIX_KERNEL;
+}
@@ -0,0 +1,110 @@
+/*
+ * eai_audio mini-flinger — mix kernels
+ *
+ * The mixer works in float: each slot's samples are converted once on
+ * ingest (with the slot's volume applied), summed into a float mix buffer
+ * without clipping, and converted once more to the hardware format. The
+ * vector kernels are chosen at compile time from the target's instruction
+ * set (Helium/MVE with floating point, NEON, AVX2, SSE2) and fall back to
+ * the scalar reference elsewhere. Every kernel gives bit-identical results
+ * to the reference.
+ *
+ * When every slot and the hardware are S16, the mixer can skip float and
+ * mix with eai_audio_mix_s16(), a saturating Q16 integer kernel.
+ *
+ * Full scale is [-1.0, 1.0) in float. S24_LE is packed, 3 bytes per sample.
+ * The resampler's FIR (resample.c) runs on the dot product kernel here.
+ *
+ * Not part of the public API.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef EAI_AUDIO_MIX_H
+#define EAI_AUDIO_MIX_H
+
+#include <eai_audio/types.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Bytes per sample of a format, or 0 if the format is unknown. */
+uint32_t eai_audio_format_bytes(enum eai_audio_format format);
+
+/**
+ * Convert samples to float, scaled by gain: dst[i] = src[i] * gain.
+ *
+ * @param dst      Float samples.
+ * @param src      Samples in the given format.
+ * @param format   Format of src.
+ * @param samples  Number of samples (frames * channels).
+ * @param gain     Linear gain (1.0 = unity).
+ */
+void eai_audio_to_f32(float *dst, const void *src, enum eai_audio_format format,
+		      uint32_t samples, float gain);
+
+/**
+ * Convert float samples to a format, clipping to its range.
+ *
+ * With dither, S16 and S24 get triangular (TPDF) dither of +/-1 LSB before
+ * rounding. The dither sequence continues from *dither across calls; wider
+ * formats need none and leave it alone.
+ *
+ * @param dst      Samples in the given format.
+ * @param src      Float samples.
+ * @param format   Format of dst.
+ * @param samples  Number of samples (frames * channels).
+ * @param dither   Dither position, or NULL for plain rounding.
+ */
+void eai_audio_from_f32(void *dst, const float *src, enum eai_audio_format format,
+			uint32_t samples, uint32_t *dither);
+
+/** Mix samples into acc: acc[i] += src[i]. */
+void eai_audio_mix_f32(float *acc, const float *src, uint32_t samples);
+
+/**
+ * Dot product of float samples with Q15 coefficients, in Q15 units:
+ * the sum of x[k] * coefs[k].
+ *
+ * @param x      Samples.
+ * @param coefs  Q15 coefficients.
+ * @param taps   Length of both, a multiple of 8.
+ */
+float eai_audio_dot_q15(const float *x, const int16_t *coefs, uint32_t taps);
+
+/**
+ * Mix S16 samples into acc: acc[i] = sat16(acc[i] + ((src[i] * volume) >> 16)).
+ *
+ * Volumes up to unity run on the vector kernel. Gains above unity are rare
+ * and take the reference path.
+ *
+ * @param acc         Mix buffer, updated in place.
+ * @param src         Slot samples.
+ * @param samples     Number of samples (frames * channels).
+ * @param volume_q16  Volume in Q16 fixed-point (0x10000 = unity).
+ */
+void eai_audio_mix_s16(int16_t *acc, const int16_t *src, uint32_t samples,
+		       uint32_t volume_q16);
+
+/* Scalar references for the kernels above, built on every target */
+void eai_audio_to_f32_ref(float *dst, const void *src,
+			  enum eai_audio_format format, uint32_t samples,
+			  float gain);
+void eai_audio_from_f32_ref(void *dst, const float *src,
+			    enum eai_audio_format format, uint32_t samples,
+			    uint32_t *dither);
+void eai_audio_mix_f32_ref(float *acc, const float *src, uint32_t samples);
+float eai_audio_dot_q15_ref(const float *x, const int16_t *coefs, uint32_t taps);
+void eai_audio_mix_s16_ref(int16_t *acc, const int16_t *src, uint32_t samples,
+			   uint32_t volume_q16);
+
+/** Name of the kernel this build selected ("sse2", "neon", ...). */
+const char *eai_audio_mix_kernel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EAI_AUDIO_MIX_H */
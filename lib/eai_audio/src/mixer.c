@@ -2,13 +2,23 @@
  * eai_audio mini-flinger — software mixer
  *
  * Platform-independent. Uses eai_osal for thread, mutex, semaphore.
- * Mixes up to N output streams (S16_LE) via int32 accumulator with
- * per-slot Q16 volume and hard clipping.
+ * Mixes up to N output streams, each in its own sample format, with
+ * per-slot Q16 volume. Each slot is converted to float once as the mixer
+ * reads it, summed without clipping, and the sum converted once to the
+ * hardware format, on vector kernels where the target has them (mix.c).
+ * One or two S16 slots into S16 hardware skip float for an integer mix.
+ * Each slot feeds the mixer through its own lock-free SPSC ring, so an
+ * app writing a slot never waits for the mixer or for other slots. A slot
+ * at another rate is resampled (resample.c) between conversion and mix.
+ * Periods are mixed on absolute deadlines counted in frames, so the
+ * output keeps the configured rate exactly.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "mixer.h"
+#include "mix.h"
+#include "resample.h"
 #include <eai_osal/eai_osal.h>
 #include <string.h>
 
@@ -18,19 +28,66 @@
 #define RING_CAP_SAMPLES \
 	(2 * EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES * EAI_AUDIO_MIXER_MAX_CHANNELS)
 
+_Static_assert((RING_CAP_SAMPLES & (RING_CAP_SAMPLES - 1)) == 0,
+	       "SPSC ring capacity must be a power of two");
+
+/*
+ * Each ring holds RING_CAP_SAMPLES of this many bytes. A wider format
+ * fits fewer samples in the same bytes (see ring_capacity()).
+ */
+#ifdef CONFIG_EAI_AUDIO_MIXER_RING_SAMPLE_BYTES
+#define RING_SAMPLE_BYTES CONFIG_EAI_AUDIO_MIXER_RING_SAMPLE_BYTES
+#else
+#define RING_SAMPLE_BYTES 2
+#endif
+
+#define RING_BYTES (RING_CAP_SAMPLES * RING_SAMPLE_BYTES)
+
 /* Mix output buffer in samples */
 #define MIX_BUF_SAMPLES \
 	(EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES * EAI_AUDIO_MIXER_MAX_CHANNELS)
 
+/* ── Resampler sizing ───────────────────────────────────────────────────── */
+
+#if defined(CONFIG_EAI_AUDIO_MIXER_RESAMPLE_FAST)
+#define RESAMPLE_QUALITY EAI_AUDIO_RESAMPLE_FAST
+#define RESAMPLE_TAPS    EAI_AUDIO_RESAMPLE_FAST_TAPS
+#define RESAMPLE_PHASES  EAI_AUDIO_RESAMPLE_FAST_PHASES
+#elif defined(CONFIG_EAI_AUDIO_MIXER_RESAMPLE_HIGH)
+#define RESAMPLE_QUALITY EAI_AUDIO_RESAMPLE_HIGH
+#define RESAMPLE_TAPS    EAI_AUDIO_RESAMPLE_HIGH_TAPS
+#define RESAMPLE_PHASES  EAI_AUDIO_RESAMPLE_HIGH_PHASES
+#else
+#define RESAMPLE_QUALITY EAI_AUDIO_RESAMPLE_MEDIUM
+#define RESAMPLE_TAPS    EAI_AUDIO_RESAMPLE_MEDIUM_TAPS
+#define RESAMPLE_PHASES  EAI_AUDIO_RESAMPLE_MEDIUM_PHASES
+#endif
+
+#define RESAMPLE_MAX_TAPS EAI_AUDIO_RESAMPLE_MAX_TAPS(RESAMPLE_TAPS)
+
 /* ── Per-slot state ─────────────────────────────────────────────────────── */
 
+/*
+ * The app thread writing a slot is the ring's producer and the mixer
+ * thread its consumer. Open and close run under mixer.mutex, which the
+ * mixer thread holds while it mixes, so neither races a ring read. A slot
+ * being opened is set up outside the mutex; the mixer skips it until it
+ * is active. Writers check active without the mutex, so it is atomic, and
+ * its release store publishes the set-up slot to them.
+ */
 struct mixer_slot {
-	int16_t ring[RING_CAP_SAMPLES];
-	uint32_t wr; /* total samples written (monotonic) */
-	uint32_t rd; /* total samples read (monotonic) */
-	uint32_t volume; /* Q16: 0x10000 = unity */
-	uint32_t underruns;
-	bool active;
+	eai_osal_spsc_ring_t ring; /* samples in the slot's format and rate */
+	uint8_t buf[RING_BYTES];
+	enum eai_audio_format format;
+	eai_osal_atomic_t volume; /* Q16: 0x10000 = unity */
+	eai_osal_atomic_t underruns;
+	eai_osal_atomic_t started; /* written to since open */
+	bool resample; /* rate differs from the mixer's */
+	struct eai_audio_resampler rs;
+	int16_t bank[EAI_AUDIO_RESAMPLE_BANK_SIZE(RESAMPLE_TAPS, RESAMPLE_PHASES)];
+	float history[RESAMPLE_MAX_TAPS * EAI_AUDIO_MIXER_MAX_CHANNELS];
+	bool opening;
+	eai_osal_atomic_t active;
 };
 
 /* ── Module state ───────────────────────────────────────────────────────── */
@@ -39,126 +96,206 @@ static struct {
 	struct eai_audio_mixer_config config;
 	struct mixer_slot slots[EAI_AUDIO_MIXER_MAX_SLOTS];
 
-	int16_t mix_buf[MIX_BUF_SAMPLES];
+	/* Mixer thread scratch, too big for its stack */
+	float mix_buf[MIX_BUF_SAMPLES];   /* sum of all slots */
+	union {
+		float slot_buf[MIX_BUF_SAMPLES];  /* one slot, volume applied */
+		int16_t s16_buf[MIX_BUF_SAMPLES]; /* one slot as read, S16 path */
+	};
+	uint32_t io_buf[MIX_BUF_SAMPLES]; /* raw samples in or out, any format */
+	float rs_buf[RESAMPLE_MAX_TAPS + EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES];
+	uint32_t dither;
 
 	eai_osal_thread_t thread;
 	eai_osal_mutex_t mutex;
 	eai_osal_sem_t sem;
+	eai_osal_atomic_t deadline_misses;
 
-	bool running;
+	eai_osal_atomic_t running; /* read by the mixer thread without the mutex */
 	bool initialized;
 } mixer;
 
 EAI_OSAL_THREAD_STACK_DEFINE(mixer_stack, 2048);
 
-/* ── Ring buffer helpers ────────────────────────────────────────────────── */
+/* ── Mixer thread ───────────────────────────────────────────────────────── */
 
-static uint32_t ring_count(const struct mixer_slot *s)
+/* Read up to want samples of a slot, counting an underrun if short */
+static uint32_t read_slot(struct mixer_slot *slot, void *buf, uint32_t want)
 {
-	return s->wr - s->rd;
-}
+	uint32_t got = eai_osal_spsc_read(&slot->ring, buf, want);
 
-static uint32_t ring_space(const struct mixer_slot *s)
-{
-	return RING_CAP_SAMPLES - ring_count(s);
+	if (got < want) {
+		/* Underrun: use what was there, rest is silence */
+		eai_osal_atomic_add(&slot->underruns, 1, EAI_OSAL_ATOMIC_RELAXED);
+	}
+	return got;
 }
 
-static void ring_write(struct mixer_slot *s, const int16_t *data,
-		       uint32_t samples)
+/* Mix in float: convert each slot once, sum unclipped, convert out once */
+static void mix_f32(struct mixer_slot *const *live, const uint32_t *volume,
+		    uint8_t n, uint32_t period_samples)
 {
-	for (uint32_t i = 0; i < samples; i++) {
-		s->ring[s->wr % RING_CAP_SAMPLES] = data[i];
-		s->wr++;
+	memset(mixer.mix_buf, 0, period_samples * sizeof(float));
+
+	for (uint8_t k = 0; k < n; k++) {
+		struct mixer_slot *slot = live[k];
+		uint32_t want = period_samples;
+
+		/* A resampled slot consumes its own rate's worth */
+		if (slot->resample) {
+			want = eai_audio_resampler_input_frames(
+				       &slot->rs, mixer.config.period_frames) *
+			       mixer.config.channels;
+		}
+
+		uint32_t got = read_slot(slot, mixer.io_buf, want);
+		float gain = (float)volume[k] / EAI_AUDIO_MIXER_VOLUME_UNITY;
+
+		/* Convert with volume, then mix into the accumulator */
+		eai_audio_to_f32(mixer.slot_buf, mixer.io_buf, slot->format,
+				 got, gain);
+		if (slot->resample) {
+			/* Fill the gap, so the resampler keeps time */
+			memset(mixer.slot_buf + got, 0, (want - got) * sizeof(float));
+			eai_audio_resample_mix(&slot->rs, mixer.mix_buf, mixer.slot_buf,
+					       mixer.config.period_frames,
+					       mixer.rs_buf);
+		} else {
+			eai_audio_mix_f32(mixer.mix_buf, mixer.slot_buf, got);
+		}
 	}
+
+	/* One conversion to the hardware format, clipping only here */
+	eai_audio_from_f32(mixer.io_buf, mixer.mix_buf, mixer.config.format,
+			   period_samples,
+			   mixer.config.dither ? &mixer.dither : NULL);
 }
 
-static void ring_read(struct mixer_slot *s, int16_t *data, uint32_t samples)
+/* Mix S16 slots straight into S16 output with the saturating Q16 kernel */
+static void mix_s16(struct mixer_slot *const *live, const uint32_t *volume,
+		    uint8_t n, uint32_t period_samples)
 {
-	for (uint32_t i = 0; i < samples; i++) {
-		data[i] = s->ring[s->rd % RING_CAP_SAMPLES];
-		s->rd++;
+	int16_t *acc = (int16_t *)mixer.io_buf;
+
+	memset(acc, 0, period_samples * sizeof(int16_t));
+
+	for (uint8_t k = 0; k < n; k++) {
+		uint32_t got = read_slot(live[k], mixer.s16_buf, period_samples);
+
+		eai_audio_mix_s16(acc, mixer.s16_buf, got, volume[k]);
 	}
 }
 
-/* ── Mixer thread ───────────────────────────────────────────────────────── */
-
-static void mixer_thread_entry(void *arg)
+/*
+ * Mix one period of every started slot into io_buf, in the hardware
+ * format. Returns false, leaving io_buf alone, if no slot has started.
+ *
+ * When the slots and the hardware are all S16, unresampled, undithered
+ * and at most unity volume, the period stays in integer. With one or two
+ * such slots the kernel's saturating running sum clips exactly where the
+ * float mix would clip once at the end, and only volume rounds
+ * differently (down, not to nearest). A third slot could clip an
+ * intermediate sum the others would pull back, so more take float.
+ */
+static bool mix_period(void)
 {
-	(void)arg;
-
 	uint32_t period_samples =
 		mixer.config.period_frames * mixer.config.channels;
+	struct mixer_slot *live[EAI_AUDIO_MIXER_MAX_SLOTS];
+	uint32_t volume[EAI_AUDIO_MIXER_MAX_SLOTS];
+	uint8_t n = 0;
+	bool s16 = mixer.config.format == EAI_AUDIO_FORMAT_PCM_S16_LE &&
+		   !mixer.config.dither;
 
-	/* Compute period in ms for timeout-based wakeup */
-	uint32_t period_ms = (mixer.config.period_frames * 1000) /
-			     mixer.config.sample_rate;
-	if (period_ms == 0) {
-		period_ms = 1;
+	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
+
+	for (uint8_t i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
+		struct mixer_slot *slot = &mixer.slots[i];
+
+		/* Not yet written to: nothing to mix, and no underrun */
+		if (!eai_osal_atomic_load(&slot->active, EAI_OSAL_ATOMIC_RELAXED) ||
+		    !eai_osal_atomic_load(&slot->started, EAI_OSAL_ATOMIC_RELAXED)) {
+			continue;
+		}
+
+		/* One volume per period, whichever path mixes it */
+		live[n] = slot;
+		volume[n] = eai_osal_atomic_load(&slot->volume,
+						 EAI_OSAL_ATOMIC_RELAXED);
+		s16 = s16 && slot->format == EAI_AUDIO_FORMAT_PCM_S16_LE &&
+		      !slot->resample && volume[n] <= EAI_AUDIO_MIXER_VOLUME_UNITY;
+		n++;
 	}
 
-	int16_t slot_buf[MIX_BUF_SAMPLES];
+	if (n > 0) {
+		if (s16 && n <= 2) {
+			mix_s16(live, volume, n, period_samples);
+		} else {
+			mix_f32(live, volume, n, period_samples);
+		}
+	}
 
-	while (mixer.running) {
-		/* Wait for kick or timeout */
-		eai_osal_sem_take(&mixer.sem, period_ms);
+	eai_osal_mutex_unlock(&mixer.mutex);
+	return n > 0;
+}
 
-		if (!mixer.running) {
-			break;
+/* When period n is due, counted in frames so no rounding accumulates */
+static uint64_t period_due_us(uint64_t start_us, uint64_t n)
+{
+	return start_us + n * mixer.config.period_frames * 1000000ULL /
+			  mixer.config.sample_rate;
+}
+
+/*
+ * Periods run on an absolute clock: period n is due n periods after the
+ * first stream started, however long mixing and hw_write take. A kick or
+ * a stream starting only cuts a wait short; it never mixes a period early.
+ */
+static void mixer_thread_entry(void *arg)
+{
+	(void)arg;
+
+	bool playing = false;
+	uint64_t start_us = 0;
+	uint64_t n = 0;
+
+	while (eai_osal_atomic_load(&mixer.running, EAI_OSAL_ATOMIC_ACQUIRE)) {
+		if (!playing) {
+			/*
+			 * Idle until a stream starts. Its first period is one
+			 * period off, so streams started together share it.
+			 */
+			eai_osal_sem_take(&mixer.sem, EAI_OSAL_WAIT_FOREVER);
+			start_us = eai_osal_time_get_us();
+			n = 1;
+			playing = true;
+			continue;
 		}
 
-		eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
+		uint64_t now = eai_osal_time_get_us();
+		uint64_t due = period_due_us(start_us, n);
 
-		/* Zero mix buffer */
-		memset(mixer.mix_buf, 0, period_samples * sizeof(int16_t));
-
-		bool any_active = false;
-
-		for (uint8_t i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
-			struct mixer_slot *slot = &mixer.slots[i];
-
-			if (!slot->active) {
-				continue;
-			}
-			any_active = true;
-
-			uint32_t avail = ring_count(slot);
-
-			if (avail < period_samples) {
-				/* Underrun: read what's available, rest is silence */
-				slot->underruns++;
-				memset(slot_buf, 0,
-				       period_samples * sizeof(int16_t));
-				if (avail > 0) {
-					ring_read(slot, slot_buf, avail);
-				}
-			} else {
-				ring_read(slot, slot_buf, period_samples);
-			}
-
-			/* Mix into accumulator with volume */
-			for (uint32_t j = 0; j < period_samples; j++) {
-				int32_t scaled = ((int32_t)slot_buf[j] *
-						  (int32_t)slot->volume) >> 16;
-				int32_t acc = (int32_t)mixer.mix_buf[j] + scaled;
-
-				/* Hard clip to int16 range */
-				if (acc > 32767) {
-					acc = 32767;
-				} else if (acc < -32768) {
-					acc = -32768;
-				}
-
-				mixer.mix_buf[j] = (int16_t)acc;
-			}
+		if (now < due) {
+			eai_osal_sem_take(&mixer.sem, (uint32_t)((due - now + 999) / 1000));
+			continue;
 		}
 
-		eai_osal_mutex_unlock(&mixer.mutex);
+		/*
+		 * A whole period late, the output has run dry. Count it and
+		 * restart the clock rather than burst to catch up.
+		 */
+		if (now >= period_due_us(start_us, n + 1)) {
+			eai_osal_atomic_add(&mixer.deadline_misses, 1,
+					    EAI_OSAL_ATOMIC_RELAXED);
+			start_us = now;
+			n = 0;
+		}
 
-		/* Write mixed output to hardware */
-		if (any_active && mixer.config.hw_write) {
-			mixer.config.hw_write(mixer.mix_buf,
-					      mixer.config.period_frames);
+		playing = mix_period();
+		if (playing && mixer.config.hw_write) {
+			mixer.config.hw_write(mixer.io_buf, mixer.config.period_frames);
 		}
+		n++;
 	}
 }
 
@@ -177,6 +314,9 @@ int eai_audio_mixer_init(const struct eai_audio_mixer_config *config)
 	    config->channels > EAI_AUDIO_MIXER_MAX_CHANNELS) {
 		return -1;
 	}
+	if (eai_audio_format_bytes(config->format) == 0) {
+		return -1;
+	}
 	if (mixer.initialized) {
 		return -1;
 	}
@@ -186,7 +326,8 @@ int eai_audio_mixer_init(const struct eai_audio_mixer_config *config)
 
 	/* Default all slots to unity volume */
 	for (uint8_t i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
-		mixer.slots[i].volume = EAI_AUDIO_MIXER_VOLUME_UNITY;
+		eai_osal_atomic_init(&mixer.slots[i].volume,
+				     EAI_AUDIO_MIXER_VOLUME_UNITY);
 	}
 
 	eai_osal_status_t rc;
@@ -202,7 +343,7 @@ int eai_audio_mixer_init(const struct eai_audio_mixer_config *config)
 		return -1;
 	}
 
-	mixer.running = true;
+	eai_osal_atomic_store(&mixer.running, 1, EAI_OSAL_ATOMIC_RELEASE);
 	mixer.initialized = true;
 
 	rc = eai_osal_thread_create(&mixer.thread, "mixer",
@@ -211,7 +352,7 @@ int eai_audio_mixer_init(const struct eai_audio_mixer_config *config)
 				    EAI_OSAL_THREAD_STACK_SIZEOF(mixer_stack),
 				    20); /* high priority */
 	if (rc != EAI_OSAL_OK) {
-		mixer.running = false;
+		eai_osal_atomic_store(&mixer.running, 0, EAI_OSAL_ATOMIC_RELEASE);
 		mixer.initialized = false;
 		eai_osal_sem_destroy(&mixer.sem);
 		eai_osal_mutex_destroy(&mixer.mutex);
@@ -227,7 +368,7 @@ int eai_audio_mixer_deinit(void)
 		return -1;
 	}
 
-	mixer.running = false;
+	eai_osal_atomic_store(&mixer.running, 0, EAI_OSAL_ATOMIC_RELEASE);
 	eai_osal_sem_give(&mixer.sem); /* wake thread so it exits */
 	eai_osal_thread_join(&mixer.thread, 1000);
 
@@ -238,29 +379,96 @@ int eai_audio_mixer_deinit(void)
 	return 0;
 }
 
-int eai_audio_mixer_slot_open(uint8_t *slot)
+/* Samples of a format a slot's ring holds: a power of two, in RING_BYTES */
+static uint32_t ring_capacity(uint32_t sample_bytes)
 {
-	if (!mixer.initialized || !slot) {
+	uint32_t cap = RING_CAP_SAMPLES;
+
+	while (cap * sample_bytes > RING_BYTES) {
+		cap /= 2;
+	}
+	return cap;
+}
+
+int eai_audio_mixer_slot_open(uint8_t *slot, enum eai_audio_format format,
+			      uint32_t sample_rate)
+{
+	uint32_t sample_bytes = eai_audio_format_bytes(format);
+
+	if (!mixer.initialized || !slot || sample_bytes == 0 || sample_rate == 0) {
 		return -1;
 	}
 
-	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
+	/* A period's input, rounded up, must fit the mixer's buffers */
+	uint64_t in_frames = ((uint64_t)mixer.config.period_frames * sample_rate +
+			      mixer.config.sample_rate - 1) / mixer.config.sample_rate;
 
+	if (in_frames > EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES) {
+		return -1;
+	}
+
+	/* The ring must hold two periods, so the app can write one ahead */
+	uint32_t ring_cap = ring_capacity(sample_bytes);
+
+	if (ring_cap < 2 * in_frames * mixer.config.channels) {
+		return -1;
+	}
+
+	struct mixer_slot *s = NULL;
+
+	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
 	for (uint8_t i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
-		if (!mixer.slots[i].active) {
-			mixer.slots[i].active = true;
-			mixer.slots[i].wr = 0;
-			mixer.slots[i].rd = 0;
-			mixer.slots[i].underruns = 0;
-			mixer.slots[i].volume = EAI_AUDIO_MIXER_VOLUME_UNITY;
+		if (!eai_osal_atomic_load(&mixer.slots[i].active, EAI_OSAL_ATOMIC_RELAXED) &&
+		    !mixer.slots[i].opening) {
+			s = &mixer.slots[i];
+			s->opening = true;
 			*slot = i;
-			eai_osal_mutex_unlock(&mixer.mutex);
-			return 0;
+			break;
 		}
 	}
+	eai_osal_mutex_unlock(&mixer.mutex);
+
+	if (!s) {
+		return -12; /* ENOMEM */
+	}
+
+	/* Building the filter takes a while; don't hold up the mixer for it */
+	int rc = 0;
+
+	s->resample = sample_rate != mixer.config.sample_rate;
+	if (s->resample) {
+		rc = eai_audio_resampler_init(&s->rs, RESAMPLE_QUALITY, sample_rate,
+					      mixer.config.sample_rate,
+					      mixer.config.channels,
+					      s->bank, sizeof(s->bank) / sizeof(s->bank[0]),
+					      s->history,
+					      sizeof(s->history) / sizeof(s->history[0]));
+	}
 
+	/* Starts empty */
+	if (rc == 0 &&
+	    eai_osal_spsc_create(&s->ring, sample_bytes, ring_cap,
+				 s->buf, false) != EAI_OSAL_OK) {
+		rc = -1;
+	}
+	if (rc != 0) {
+		/* Give the slot back */
+		eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
+		s->opening = false;
+		eai_osal_mutex_unlock(&mixer.mutex);
+		return -1; /* EINVAL */
+	}
+	s->format = format;
+	eai_osal_atomic_store(&s->underruns, 0, EAI_OSAL_ATOMIC_RELAXED);
+	eai_osal_atomic_store(&s->started, 0, EAI_OSAL_ATOMIC_RELAXED);
+	eai_osal_atomic_store(&s->volume, EAI_AUDIO_MIXER_VOLUME_UNITY,
+			      EAI_OSAL_ATOMIC_RELAXED);
+
+	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
+	s->opening = false;
+	eai_osal_atomic_store(&s->active, 1, EAI_OSAL_ATOMIC_RELEASE);
 	eai_osal_mutex_unlock(&mixer.mutex);
-	return -12; /* ENOMEM */
+	return 0;
 }
 
 int eai_audio_mixer_slot_close(uint8_t slot)
@@ -270,40 +478,41 @@ int eai_audio_mixer_slot_close(uint8_t slot)
 	}
 
 	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
-	mixer.slots[slot].active = false;
-	mixer.slots[slot].wr = 0;
-	mixer.slots[slot].rd = 0;
+	eai_osal_atomic_store(&mixer.slots[slot].active, 0, EAI_OSAL_ATOMIC_RELEASE);
 	eai_osal_mutex_unlock(&mixer.mutex);
 	return 0;
 }
 
-int eai_audio_mixer_write(uint8_t slot, const int16_t *data, uint32_t frames)
+int eai_audio_mixer_write(uint8_t slot, const void *data, uint32_t frames)
 {
 	if (!mixer.initialized || !data || frames == 0) {
 		return -1;
 	}
-	if (slot >= EAI_AUDIO_MIXER_MAX_SLOTS || !mixer.slots[slot].active) {
+	if (slot >= EAI_AUDIO_MIXER_MAX_SLOTS ||
+	    !eai_osal_atomic_load(&mixer.slots[slot].active, EAI_OSAL_ATOMIC_ACQUIRE)) {
 		return -1;
 	}
 
+	struct mixer_slot *s = &mixer.slots[slot];
 	uint32_t samples = frames * mixer.config.channels;
 
-	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
-
-	uint32_t space = ring_space(&mixer.slots[slot]);
+	/* Space only grows under us: the mixer is the sole reader */
+	uint32_t space = eai_osal_spsc_space(&s->ring);
 	uint32_t to_write = samples < space ? samples : space;
 
 	/* Round down to whole frames */
 	to_write = (to_write / mixer.config.channels) * mixer.config.channels;
 
 	if (to_write > 0) {
-		ring_write(&mixer.slots[slot], data, to_write);
+		/* One index update, so the mixer never sees half a frame */
+		eai_osal_spsc_write(&s->ring, data, to_write);
 	}
 
-	eai_osal_mutex_unlock(&mixer.mutex);
-
-	/* Wake mixer thread */
-	eai_osal_sem_give(&mixer.sem);
+	/* The first write starts the stream, and the mixer's clock if idle */
+	if (!eai_osal_atomic_load(&s->started, EAI_OSAL_ATOMIC_RELAXED)) {
+		eai_osal_atomic_store(&s->started, 1, EAI_OSAL_ATOMIC_RELAXED);
+		eai_osal_sem_give(&mixer.sem);
+	}
 
 	return (int)(to_write / mixer.config.channels);
 }
@@ -321,9 +530,8 @@ int eai_audio_mixer_set_volume(uint8_t slot, uint32_t volume_q16)
 		return -1;
 	}
 
-	eai_osal_mutex_lock(&mixer.mutex, EAI_OSAL_WAIT_FOREVER);
-	mixer.slots[slot].volume = volume_q16;
-	eai_osal_mutex_unlock(&mixer.mutex);
+	eai_osal_atomic_store(&mixer.slots[slot].volume, volume_q16,
+			      EAI_OSAL_ATOMIC_RELAXED);
 	return 0;
 }
 
@@ -332,5 +540,14 @@ uint32_t eai_audio_mixer_get_underruns(uint8_t slot)
 	if (!mixer.initialized || slot >= EAI_AUDIO_MIXER_MAX_SLOTS) {
 		return 0;
 	}
-	return mixer.slots[slot].underruns;
+	return eai_osal_atomic_load(&mixer.slots[slot].underruns,
+				    EAI_OSAL_ATOMIC_RELAXED);
+}
+
+uint32_t eai_audio_mixer_get_deadline_misses(void)
+{
+	if (!mixer.initialized) {
+		return 0;
+	}
+	return eai_osal_atomic_load(&mixer.deadline_misses, EAI_OSAL_ATOMIC_RELAXED);
 }
@@ -10,6 +10,8 @@
 #ifndef EAI_AUDIO_MIXER_H
 #define EAI_AUDIO_MIXER_H
 
+#include <eai_audio/types.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -28,7 +30,10 @@ extern "C" {
 #define EAI_AUDIO_MIXER_VOLUME_UNITY  0x10000
 #define EAI_AUDIO_MIXER_VOLUME_MUTE   0
 
-/** Callback to write mixed audio to hardware. */
+/**
+ * Callback to write mixed audio, in the configured format, to hardware.
+ * Called once per period, on the mixer's clock.
+ */
 typedef int (*eai_audio_mixer_hw_write_t)(const void *buf, uint32_t frames);
 
 /** Mixer configuration. */
@@ -37,6 +42,8 @@ struct eai_audio_mixer_config {
 	uint8_t channels;
 	uint32_t period_frames;
 	eai_audio_mixer_hw_write_t hw_write;
+	enum eai_audio_format format; /* hardware format, S16_LE if zeroed */
+	bool dither;                  /* TPDF dither when output is S16/S24 */
 };
 
 /**
@@ -57,10 +64,19 @@ int eai_audio_mixer_deinit(void);
 /**
  * Open a mixer slot for a new output stream.
  *
- * @param slot  Output slot index.
- * @return 0 on success, -ENOMEM if no slots available.
+ * A stream at another rate than the mixer's is resampled to it, at the
+ * quality chosen by CONFIG_EAI_AUDIO_MIXER_RESAMPLE_*. One period of its
+ * input must fit EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES, and two periods must
+ * fit the slot's ring (see CONFIG_EAI_AUDIO_MIXER_RING_SAMPLE_BYTES).
+ *
+ * @param slot         Output slot index.
+ * @param format       Sample format the stream writes in.
+ * @param sample_rate  Rate the stream writes at, in Hz.
+ * @return 0 on success, -ENOMEM if no slots available,
+ *         -EINVAL if format unknown or rate unsupported.
  */
-int eai_audio_mixer_slot_open(uint8_t *slot);
+int eai_audio_mixer_slot_open(uint8_t *slot, enum eai_audio_format format,
+			      uint32_t sample_rate);
 
 /**
  * Close a mixer slot.
@@ -73,21 +89,26 @@ int eai_audio_mixer_slot_close(uint8_t slot);
 /**
  * Write audio data to a mixer slot's ring buffer.
  *
+ * Lock-free: never waits for the mixer thread or writers of other slots.
+ * One thread at a time may write a given slot. The first write starts the
+ * slot: from the next period on it is mixed, and counts underruns.
+ *
  * @param slot    Slot index.
- * @param data    S16_LE audio samples.
+ * @param data    Samples in the slot's format.
  * @param frames  Number of frames to write.
  * @return Number of frames written (may be < frames if ring full),
  *         negative errno on error.
  */
-int eai_audio_mixer_write(uint8_t slot, const int16_t *data, uint32_t frames);
+int eai_audio_mixer_write(uint8_t slot, const void *data, uint32_t frames);
 
 /**
- * Wake the mixer thread to process pending data.
+ * Wake the mixer thread. It mixes only when a period is due, so this
+ * never adds a period; writes need no kick.
  */
 void eai_audio_mixer_kick(void);
 
 /**
- * Set per-slot volume.
+ * Set per-slot volume. Takes effect from the next mix period.
  *
  * @param slot       Slot index.
  * @param volume_q16 Volume in Q16 fixed-point (0x10000 = unity).
@@ -103,6 +124,16 @@ int eai_audio_mixer_set_volume(uint8_t slot, uint32_t volume_q16);
  */
 uint32_t eai_audio_mixer_get_underruns(uint8_t slot);
 
+/**
+ * Get the number of periods mixed a whole period or more late.
+ *
+ * After each, the mixer restarts its clock from the late period rather
+ * than mix the lost ones back to back.
+ *
+ * @return Deadline miss count, or 0 if not initialized.
+ */
+uint32_t eai_audio_mixer_get_deadline_misses(void);
+
 #ifdef __cplusplus
 }
 #endif
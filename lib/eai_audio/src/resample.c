@@ -0,0 +1,239 @@
+/*
+ * eai_audio mini-flinger — sample-rate conversion
+ *
+ * Output frame j sits at input position j * in / out, kept as a whole
+ * frame plus num / out. Each output takes the taps input frames starting
+ * at the whole frame, weighted by the bank row for the fraction: the
+ * nearest row, or the two either side interpolated. Row p holds the
+ * filter centred p / phases past the middle of the window, so row phases
+ * is row 0 a frame later and interpolation never runs off the end.
+ *
+ * Channels are filtered one at a time through a contiguous scratch copy
+ * of their history and new input, which is what the dot product kernel
+ * wants.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "resample.h"
+#include "mix.h"
+#include <math.h>
+#include <string.h>
+
+/* ── Quality levels ─────────────────────────────────────────────────────── */
+
+struct quality {
+	uint32_t taps;
+	uint8_t phase_bits;
+	bool interpolate;
+	float cutoff; /* passband edge, as a fraction of the lower Nyquist */
+	float beta;   /* Kaiser window shape: higher trades width for depth */
+};
+
+static const struct quality qualities[] = {
+	[EAI_AUDIO_RESAMPLE_FAST] = {
+		EAI_AUDIO_RESAMPLE_FAST_TAPS, 5, false, 0.80f, 5.0f,
+	},
+	[EAI_AUDIO_RESAMPLE_MEDIUM] = {
+		EAI_AUDIO_RESAMPLE_MEDIUM_TAPS, 5, true, 0.88f, 7.0f,
+	},
+	[EAI_AUDIO_RESAMPLE_HIGH] = {
+		EAI_AUDIO_RESAMPLE_HIGH_TAPS, 6, true, 0.92f, 9.0f,
+	},
+};
+
+_Static_assert(EAI_AUDIO_RESAMPLE_FAST_PHASES == 1 << 5 &&
+	       EAI_AUDIO_RESAMPLE_MEDIUM_PHASES == 1 << 5 &&
+	       EAI_AUDIO_RESAMPLE_HIGH_PHASES == 1 << 6,
+	       "phase counts must match the quality table");
+
+/* ── Coefficients ───────────────────────────────────────────────────────── */
+
+#define PI_F 3.14159265f
+
+/* Modified Bessel function of the first kind, order 0 */
+static float bessel_i0(float x)
+{
+	float term = 1.0f;
+	float sum = 1.0f;
+
+	for (int k = 1; k < 50 && term > sum * 1e-9f; k++) {
+		float t = x / (2.0f * (float)k);
+
+		term *= t * t;
+		sum += term;
+	}
+	return sum;
+}
+
+static float sinc(float x)
+{
+	return x == 0.0f ? 1.0f : sinf(PI_F * x) / (PI_F * x);
+}
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+	while (b != 0) {
+		uint32_t t = a % b;
+
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+/*
+ * Row p, tap k weighs input frame k for an output p / phases past the
+ * window's middle. Each row is scaled to sum to one, so DC passes at unity
+ * whatever the phase.
+ */
+static void build_bank(int16_t *bank, uint32_t taps, uint32_t phases,
+		       float cutoff, float beta)
+{
+	float half = (float)taps / 2.0f;
+	float i0_beta = bessel_i0(beta);
+	float h[EAI_AUDIO_RESAMPLE_MAX_TAPS(EAI_AUDIO_RESAMPLE_HIGH_TAPS)];
+
+	for (uint32_t p = 0; p <= phases; p++) {
+		float frac = (float)p / (float)phases;
+		float sum = 0.0f;
+
+		for (uint32_t k = 0; k < taps; k++) {
+			float x = (float)k - (half - 1.0f) - frac;
+			float r = x / half;
+			float w = r * r < 1.0f ?
+				  bessel_i0(beta * sqrtf(1.0f - r * r)) / i0_beta : 0.0f;
+
+			h[k] = cutoff * sinc(cutoff * x) * w;
+			sum += h[k];
+		}
+		for (uint32_t k = 0; k < taps; k++) {
+			long q = lrintf(h[k] / sum * 32768.0f);
+
+			bank[p * taps + k] = (int16_t)(q > 32767 ? 32767 :
+						       q < -32768 ? -32768 : q);
+		}
+	}
+}
+
+/* ── API ────────────────────────────────────────────────────────────────── */
+
+int eai_audio_resampler_init(struct eai_audio_resampler *rs,
+			     enum eai_audio_resample_quality quality,
+			     uint32_t in_rate, uint32_t out_rate, uint8_t channels,
+			     int16_t *bank, uint32_t bank_size,
+			     float *history, uint32_t history_size)
+{
+	if (!rs || !bank || !history || in_rate == 0 || out_rate == 0 ||
+	    channels == 0 || (uint32_t)quality > EAI_AUDIO_RESAMPLE_HIGH) {
+		return -1;
+	}
+
+	const struct quality *q = &qualities[quality];
+	uint32_t phases = 1u << q->phase_bits;
+	uint32_t max_taps = EAI_AUDIO_RESAMPLE_MAX_TAPS(q->taps);
+	uint32_t taps = q->taps;
+	float cutoff = q->cutoff;
+
+	if (bank_size < (phases + 1) * max_taps ||
+	    history_size < max_taps * channels) {
+		return -1;
+	}
+
+	/* Downsampling: cut at the output's Nyquist, stretching to match */
+	if (in_rate > out_rate) {
+		uint64_t stretched = ((uint64_t)taps * in_rate + out_rate - 1) / out_rate;
+
+		/* Whole groups of 8 for the dot product */
+		stretched = (stretched + 7) & ~(uint64_t)7;
+		taps = stretched < max_taps ? (uint32_t)stretched : max_taps;
+		cutoff *= (float)out_rate / (float)in_rate;
+	}
+
+	uint32_t g = gcd(in_rate, out_rate);
+
+	memset(rs, 0, sizeof(*rs));
+	rs->bank = bank;
+	rs->history = history;
+	rs->taps = taps;
+	rs->phase_bits = q->phase_bits;
+	rs->interpolate = q->interpolate;
+	rs->channels = channels;
+	rs->in = in_rate / g;
+	rs->out = out_rate / g;
+	/* 2^32 / out truncated to 32 bits: 0 for out == 1, where num stays 0 */
+	rs->phase_scale = (uint32_t)((1ULL << 32) / rs->out);
+
+	build_bank(bank, taps, phases, cutoff, q->beta);
+	memset(history, 0, taps * channels * sizeof(float));
+	return 0;
+}
+
+uint32_t eai_audio_resampler_input_frames(const struct eai_audio_resampler *rs,
+					  uint32_t out_frames)
+{
+	return (uint32_t)(((uint64_t)out_frames * rs->in + rs->num) / rs->out);
+}
+
+uint32_t eai_audio_resampler_delay(const struct eai_audio_resampler *rs)
+{
+	/* The window's middle is taps / 2 - 1 into taps frames of history */
+	return rs->taps / 2 + 1;
+}
+
+void eai_audio_resample_mix(struct eai_audio_resampler *rs, float *acc,
+			    const float *in, uint32_t out_frames, float *scratch)
+{
+	uint32_t taps = rs->taps;
+	uint32_t channels = rs->channels;
+	uint32_t in_frames = eai_audio_resampler_input_frames(rs, out_frames);
+	uint32_t step = rs->in / rs->out;
+	uint32_t step_num = rs->in % rs->out;
+	uint32_t shift = 32 - rs->phase_bits;
+	uint32_t num = rs->num;
+
+	for (uint32_t ch = 0; ch < channels; ch++) {
+		float *history = rs->history + ch * taps;
+		uint32_t pos = 0;
+
+		/* History then new input, so every window is contiguous */
+		memcpy(scratch, history, taps * sizeof(float));
+		for (uint32_t i = 0; i < in_frames; i++) {
+			scratch[taps + i] = in[i * channels + ch];
+		}
+
+		num = rs->num;
+		for (uint32_t j = 0; j < out_frames; j++) {
+			uint32_t phase = num * rs->phase_scale;
+			const float *x = scratch + pos;
+			float y;
+
+			if (rs->interpolate) {
+				const int16_t *row = rs->bank + (phase >> shift) * taps;
+				float w = (float)((phase << rs->phase_bits) >> 8) *
+					  (1.0f / 16777216.0f);
+				float y0 = eai_audio_dot_q15(x, row, taps);
+				float y1 = eai_audio_dot_q15(x, row + taps, taps);
+
+				y = y0 + w * (y1 - y0);
+			} else {
+				uint32_t p = (uint32_t)(((uint64_t)phase +
+							 (1u << (shift - 1))) >> shift);
+
+				y = eai_audio_dot_q15(x, rs->bank + p * taps, taps);
+			}
+			acc[j * channels + ch] += y * (1.0f / 32768.0f);
+
+			pos += step;
+			num += step_num;
+			if (num >= rs->out) {
+				num -= rs->out;
+				pos++;
+			}
+		}
+
+		/* pos == in_frames: the next window starts after this input */
+		memcpy(history, scratch + in_frames, taps * sizeof(float));
+	}
+	rs->num = num;
+}
@@ -0,0 +1,117 @@
+/*
+ * eai_audio mini-flinger — sample-rate conversion
+ *
+ * Polyphase FIR resampler for one mixer slot. Coefficients are a
+ * Kaiser-windowed sinc, computed once at init into a caller-provided Q15
+ * table of (phases + 1) rows, one per fractional position; the per-sample
+ * work is then only table lookups and dot products (mix.c). Positions step
+ * by the exact rate ratio, so no drift accumulates however long a stream
+ * runs. When downsampling, the filter is stretched to the output's
+ * Nyquist, up to twice the quality's taps.
+ *
+ * Not part of the public API.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef EAI_AUDIO_RESAMPLE_H
+#define EAI_AUDIO_RESAMPLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Quality levels, cheapest first. */
+enum eai_audio_resample_quality {
+	EAI_AUDIO_RESAMPLE_FAST,   /* 8 taps, nearest of 32 phases */
+	EAI_AUDIO_RESAMPLE_MEDIUM, /* 16 taps, 32 phases interpolated */
+	EAI_AUDIO_RESAMPLE_HIGH,   /* 32 taps, 64 phases interpolated */
+};
+
+/* Taps and phases of each quality, for sizing storage at compile time */
+#define EAI_AUDIO_RESAMPLE_FAST_TAPS     8
+#define EAI_AUDIO_RESAMPLE_FAST_PHASES   32
+#define EAI_AUDIO_RESAMPLE_MEDIUM_TAPS   16
+#define EAI_AUDIO_RESAMPLE_MEDIUM_PHASES 32
+#define EAI_AUDIO_RESAMPLE_HIGH_TAPS     32
+#define EAI_AUDIO_RESAMPLE_HIGH_PHASES   64
+
+/** Most taps a quality uses, when downsampling. */
+#define EAI_AUDIO_RESAMPLE_MAX_TAPS(taps) (2 * (taps))
+
+/** Coefficients the bank needs for a quality's taps and phases. */
+#define EAI_AUDIO_RESAMPLE_BANK_SIZE(taps, phases) \
+	(((phases) + 1) * EAI_AUDIO_RESAMPLE_MAX_TAPS(taps))
+
+/** Resampler state. Fields are private. */
+struct eai_audio_resampler {
+	int16_t *bank;         /* (phases + 1) rows of taps, Q15 */
+	float *history;        /* last taps input frames, per channel */
+	uint32_t taps;
+	uint8_t phase_bits;
+	bool interpolate;
+	uint8_t channels;
+	uint32_t in;           /* rate ratio in lowest terms */
+	uint32_t out;
+	uint32_t num;          /* position past the current frame, in 1/out */
+	uint32_t phase_scale;  /* 2^32 / out: turns num into a Q32 phase */
+};
+
+/**
+ * Set up a resampler and build its coefficient bank.
+ *
+ * Costs a few thousand float operations; call it before mixing starts,
+ * not from the mixer thread.
+ *
+ * @param rs            Resampler.
+ * @param quality       Quality level.
+ * @param in_rate       Input rate in Hz.
+ * @param out_rate      Output rate in Hz.
+ * @param channels      Interleaved channels.
+ * @param bank          Coefficient storage.
+ * @param bank_size     Coefficients it holds, at least
+ *                      EAI_AUDIO_RESAMPLE_BANK_SIZE() for the quality.
+ * @param history       History storage.
+ * @param history_size  Floats it holds, at least
+ *                      EAI_AUDIO_RESAMPLE_MAX_TAPS() * channels.
+ * @return 0 on success, -1 if a rate is 0 or storage is too small.
+ */
+int eai_audio_resampler_init(struct eai_audio_resampler *rs,
+			     enum eai_audio_resample_quality quality,
+			     uint32_t in_rate, uint32_t out_rate, uint8_t channels,
+			     int16_t *bank, uint32_t bank_size,
+			     float *history, uint32_t history_size);
+
+/**
+ * Input frames the next out_frames output frames consume.
+ *
+ * Varies by one from call to call when the ratio isn't whole.
+ */
+uint32_t eai_audio_resampler_input_frames(const struct eai_audio_resampler *rs,
+					  uint32_t out_frames);
+
+/** Input frames an output lags behind the input position it stands for. */
+uint32_t eai_audio_resampler_delay(const struct eai_audio_resampler *rs);
+
+/**
+ * Resample and mix into acc: acc += resampled input.
+ *
+ * @param rs          Resampler.
+ * @param acc         Interleaved float output, out_frames frames.
+ * @param in          Interleaved float input, exactly
+ *                    eai_audio_resampler_input_frames(rs, out_frames) frames.
+ * @param out_frames  Frames to produce.
+ * @param scratch     Floats for the taps plus that many input frames, one
+ *                    channel's worth.
+ */
+void eai_audio_resample_mix(struct eai_audio_resampler *rs, float *acc,
+			    const float *in, uint32_t out_frames, float *scratch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EAI_AUDIO_RESAMPLE_H */
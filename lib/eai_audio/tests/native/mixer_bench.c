@@ -0,0 +1,369 @@
+/*
+ * eai_audio mixer micro-benchmarks.
+ *
+ * Not a pass/fail test — prints costs so mixer changes can be compared
+ * before/after on the same host. Run all benchmarks, or name the ones to
+ * run:
+ *
+ *   ./mixer_bench
+ *   ./mixer_bench kernel
+ *   ./mixer_bench resample
+ *
+ * Build with -mavx2 (or natively on ARM) to see the other mix kernels.
+ */
+
+#include "mix.h"
+#include "mixer.h"
+#include "resample.h"
+#include <eai_osal/eai_osal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_CHANNELS 2
+#define BENCH_MAX_FRAMES (48000 / 100)
+#define BENCH_ITERS 20000
+
+/* A typical attenuated stream */
+#define BENCH_VOLUME 0xC000
+#define BENCH_GAIN   ((float)BENCH_VOLUME / EAI_AUDIO_MIXER_VOLUME_UNITY)
+
+static uint64_t bench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Mix kernels — one 10 ms stereo period of 1-4 S16 slots to S16, per frame,
+ * in float and on the integer S16 fast path
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+struct kernels {
+	void (*to_f32)(float *dst, const void *src, enum eai_audio_format format,
+		       uint32_t samples, float gain);
+	void (*mix_f32)(float *acc, const float *src, uint32_t samples);
+	void (*from_f32)(void *dst, const float *src, enum eai_audio_format format,
+			 uint32_t samples, uint32_t *dither);
+};
+
+static const struct kernels ref_kernels = {
+	eai_audio_to_f32_ref, eai_audio_mix_f32_ref, eai_audio_from_f32_ref,
+};
+
+static const struct kernels vec_kernels = {
+	eai_audio_to_f32, eai_audio_mix_f32, eai_audio_from_f32,
+};
+
+static int16_t bench_src[EAI_AUDIO_MIXER_MAX_SLOTS]
+			[BENCH_MAX_FRAMES * BENCH_CHANNELS];
+static float bench_slot[BENCH_MAX_FRAMES * BENCH_CHANNELS];
+static float bench_mix[BENCH_MAX_FRAMES * BENCH_CHANNELS];
+static uint32_t bench_out[BENCH_MAX_FRAMES * BENCH_CHANNELS];
+
+/* One mixer period: clear, convert and mix each slot in, convert out */
+static double bench_period(const struct kernels *k, uint32_t frames,
+			   uint32_t slots)
+{
+	uint32_t samples = frames * BENCH_CHANNELS;
+	uint32_t dither = 0;
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t i = 0; i < BENCH_ITERS; i++) {
+		memset(bench_mix, 0, samples * sizeof(float));
+		for (uint32_t s = 0; s < slots; s++) {
+			k->to_f32(bench_slot, bench_src[s], EAI_AUDIO_FORMAT_PCM_S16_LE,
+				  samples, BENCH_GAIN);
+			k->mix_f32(bench_mix, bench_slot, samples);
+		}
+		k->from_f32(bench_out, bench_mix, EAI_AUDIO_FORMAT_PCM_S16_LE,
+			    samples, &dither);
+	}
+	return (double)(bench_now_ns() - start) / ((double)BENCH_ITERS * frames);
+}
+
+/* The same period on the S16 fast path: integer mix, no conversions */
+static double bench_period_s16(uint32_t frames, uint32_t slots)
+{
+	uint32_t samples = frames * BENCH_CHANNELS;
+	int16_t *acc = (int16_t *)bench_out;
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t i = 0; i < BENCH_ITERS; i++) {
+		memset(acc, 0, samples * sizeof(int16_t));
+		for (uint32_t s = 0; s < slots; s++) {
+			eai_audio_mix_s16(acc, bench_src[s], samples, BENCH_VOLUME);
+		}
+	}
+	return (double)(bench_now_ns() - start) / ((double)BENCH_ITERS * frames);
+}
+
+static void bench_kernel(void)
+{
+	static const uint32_t rates[] = { 16000, 48000 };
+
+	printf("mix kernel: %s\n", eai_audio_mix_kernel());
+	for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		uint32_t frames = rates[r] / 100;
+
+		for (uint32_t slots = 1; slots <= 4; slots++) {
+			double ref = bench_period(&ref_kernels, frames, slots);
+			double vec = bench_period(&vec_kernels, frames, slots);
+			double s16 = bench_period_s16(frames, slots);
+			char name[32];
+
+			snprintf(name, sizeof(name), "%u Hz stereo, %u slot%s",
+				 rates[r], slots, slots == 1 ? "" : "s");
+			printf("%-28s scalar %7.2f ns/frame  %-6s %7.2f ns/frame  x%.1f"
+			       "  s16 %7.2f ns/frame\n",
+			       name, ref, eai_audio_mix_kernel(), vec, ref / vec, s16);
+		}
+	}
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Format converters — ns per sample, each format in and out
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define CONVERT_SAMPLES (BENCH_MAX_FRAMES * BENCH_CHANNELS)
+
+static double bench_convert_one(const struct kernels *k,
+				enum eai_audio_format format, bool out)
+{
+	uint32_t dither = 0;
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t i = 0; i < BENCH_ITERS; i++) {
+		if (out) {
+			k->from_f32(bench_out, bench_mix, format, CONVERT_SAMPLES,
+				    &dither);
+		} else {
+			k->to_f32(bench_slot, bench_out, format, CONVERT_SAMPLES,
+				  BENCH_GAIN);
+		}
+	}
+	return (double)(bench_now_ns() - start) /
+	       ((double)BENCH_ITERS * CONVERT_SAMPLES);
+}
+
+static void bench_convert(void)
+{
+	static const struct {
+		const char *name;
+		enum eai_audio_format format;
+	} formats[] = {
+		{ "s16", EAI_AUDIO_FORMAT_PCM_S16_LE },
+		{ "s24", EAI_AUDIO_FORMAT_PCM_S24_LE },
+		{ "s32", EAI_AUDIO_FORMAT_PCM_S32_LE },
+		{ "f32", EAI_AUDIO_FORMAT_PCM_F32_LE },
+	};
+
+	/* Half-scale input, so nothing clips */
+	for (uint32_t i = 0; i < CONVERT_SAMPLES; i++) {
+		bench_mix[i] = (float)bench_src[0][i] / 65536.0f;
+	}
+	for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+		for (int out = 0; out <= 1; out++) {
+			double ref = bench_convert_one(&ref_kernels, formats[f].format, out);
+			double vec = bench_convert_one(&vec_kernels, formats[f].format, out);
+			char name[32];
+
+			snprintf(name, sizeof(name), out ? "f32 -> %s, dither" : "%s -> f32",
+				 formats[f].name);
+			printf("%-28s scalar %7.2f ns/sample %-6s %7.2f ns/sample x%.1f\n",
+			       name, ref, eai_audio_mix_kernel(), vec, ref / vec);
+		}
+	}
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Resampler — CPU cost of one stereo slot at each quality
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define RESAMPLE_PERIOD  256
+#define RESAMPLE_PERIODS 2000
+#define RESAMPLE_TAPS \
+	EAI_AUDIO_RESAMPLE_MAX_TAPS(EAI_AUDIO_RESAMPLE_HIGH_TAPS)
+
+static int16_t resample_bank[EAI_AUDIO_RESAMPLE_BANK_SIZE(
+	EAI_AUDIO_RESAMPLE_HIGH_TAPS, EAI_AUDIO_RESAMPLE_HIGH_PHASES)];
+static float resample_history[RESAMPLE_TAPS * BENCH_CHANNELS];
+static float resample_scratch[RESAMPLE_TAPS + 4 * RESAMPLE_PERIOD];
+static float resample_in[4 * RESAMPLE_PERIOD * BENCH_CHANNELS];
+
+/* ns per output frame for one slot */
+static double bench_resample_one(enum eai_audio_resample_quality quality,
+				 uint32_t in_rate, uint32_t out_rate)
+{
+	struct eai_audio_resampler rs;
+
+	eai_audio_resampler_init(&rs, quality, in_rate, out_rate, BENCH_CHANNELS,
+				 resample_bank,
+				 sizeof(resample_bank) / sizeof(resample_bank[0]),
+				 resample_history,
+				 sizeof(resample_history) / sizeof(resample_history[0]));
+
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t i = 0; i < RESAMPLE_PERIODS; i++) {
+		eai_audio_resample_mix(&rs, bench_mix, resample_in, RESAMPLE_PERIOD,
+				       resample_scratch);
+	}
+	return (double)(bench_now_ns() - start) /
+	       ((double)RESAMPLE_PERIODS * RESAMPLE_PERIOD);
+}
+
+static void bench_resample(void)
+{
+	static const char *const names[] = { "fast", "medium", "high" };
+	static const uint32_t rates[][2] = {
+		{ 16000, 48000 }, { 44100, 48000 }, { 48000, 16000 }, { 8000, 16000 },
+	};
+
+	for (uint32_t i = 0; i < sizeof(resample_in) / sizeof(resample_in[0]); i++) {
+		resample_in[i] = (float)bench_src[0][i % (BENCH_MAX_FRAMES * BENCH_CHANNELS)] /
+				 65536.0f;
+	}
+	printf("resample, stereo, %s kernel\n", eai_audio_mix_kernel());
+	for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		for (int q = EAI_AUDIO_RESAMPLE_FAST; q <= EAI_AUDIO_RESAMPLE_HIGH; q++) {
+			double ns = bench_resample_one(q, rates[r][0], rates[r][1]);
+			char name[40];
+
+			snprintf(name, sizeof(name), "%u -> %u Hz, %s",
+				 rates[r][0], rates[r][1], names[q]);
+			/* Share of one core a slot needs in real time */
+			printf("%-28s %7.2f ns/frame  %5.2f%% CPU per slot\n",
+			       name, ns, ns * rates[r][1] / 1e7);
+		}
+	}
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Writer latency — four streams feeding the running mixer
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define WRITE_STREAMS 4
+#define WRITE_FRAMES  64
+#define WRITE_RUN_MS  2000
+
+struct bench_writer {
+	uint8_t slot;
+	uint32_t ops;
+	uint64_t total_ns;
+	uint64_t max_ns;
+	uint32_t over_100us;
+};
+
+static struct bench_writer writers[WRITE_STREAMS];
+static eai_osal_atomic_t writers_run;
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(writer_stacks, WRITE_STREAMS, 4096);
+
+static int bench_hw_write(const void *buf, uint32_t frames)
+{
+	(void)buf;
+	(void)frames;
+	return 0;
+}
+
+/* Write a chunk whenever there is room, like an app feeding its stream */
+static void writer_entry(void *arg)
+{
+	struct bench_writer *w = arg;
+	int16_t chunk[WRITE_FRAMES * BENCH_CHANNELS];
+
+	memcpy(chunk, bench_src[w->slot], sizeof(chunk));
+	while (eai_osal_atomic_load(&writers_run, EAI_OSAL_ATOMIC_RELAXED)) {
+		uint64_t start = bench_now_ns();
+		int n = eai_audio_mixer_write(w->slot, chunk, WRITE_FRAMES);
+		uint64_t ns = bench_now_ns() - start;
+
+		w->ops++;
+		w->total_ns += ns;
+		if (ns > w->max_ns) {
+			w->max_ns = ns;
+		}
+		if (ns > 100000) {
+			w->over_100us++;
+		}
+		if (n < WRITE_FRAMES) {
+			eai_osal_thread_sleep(1);
+		}
+	}
+}
+
+static void bench_write(void)
+{
+	const struct eai_audio_mixer_config config = {
+		.sample_rate = 48000,
+		.channels = BENCH_CHANNELS,
+		.period_frames = 256,
+		.hw_write = bench_hw_write,
+	};
+	eai_osal_thread_t threads[WRITE_STREAMS];
+
+	eai_audio_mixer_init(&config);
+	memset(writers, 0, sizeof(writers));
+	eai_osal_atomic_store(&writers_run, 1, EAI_OSAL_ATOMIC_RELAXED);
+	for (int i = 0; i < WRITE_STREAMS; i++) {
+		eai_audio_mixer_slot_open(&writers[i].slot, EAI_AUDIO_FORMAT_PCM_S16_LE,
+					  config.sample_rate);
+		eai_audio_mixer_set_volume(writers[i].slot, BENCH_VOLUME);
+		eai_osal_thread_create(&threads[i], "writer", writer_entry, &writers[i],
+				       writer_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(writer_stacks[i]), 15);
+	}
+
+	eai_osal_thread_sleep(WRITE_RUN_MS);
+	eai_osal_atomic_store(&writers_run, 0, EAI_OSAL_ATOMIC_RELAXED);
+
+	for (int i = 0; i < WRITE_STREAMS; i++) {
+		struct bench_writer *w = &writers[i];
+
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+		printf("write, stream %d of %d %10u ops %8.1f ns avg %9.1f us max %6u >100us\n",
+		       i + 1, WRITE_STREAMS, w->ops, (double)w->total_ns / w->ops,
+		       w->max_ns / 1000.0, w->over_100us);
+		eai_audio_mixer_slot_close(w->slot);
+	}
+	eai_audio_mixer_deinit();
+}
+
+static const struct {
+	const char *name;
+	void (*fn)(void);
+} benches[] = {
+	{ "kernel",  bench_kernel },
+	{ "convert", bench_convert },
+	{ "resample", bench_resample },
+	{ "write",   bench_write },
+};
+
+int main(int argc, char **argv)
+{
+	uint32_t seed = 1;
+
+	for (uint32_t s = 0; s < EAI_AUDIO_MIXER_MAX_SLOTS; s++) {
+		for (uint32_t i = 0; i < BENCH_MAX_FRAMES * BENCH_CHANNELS; i++) {
+			seed = seed * 1664525u + 1013904223u;
+			bench_src[s][i] = (int16_t)(seed >> 16);
+		}
+	}
+
+	for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+		bool run = argc < 2;
+
+		for (int a = 1; a < argc; a++) {
+			if (strcmp(argv[a], benches[i].name) == 0) {
+				run = true;
+			}
+		}
+		if (run) {
+			benches[i].fn();
+		}
+	}
+	return 0;
+}
@@ -7,7 +7,11 @@
 
 #include "unity.h"
 #include "mixer.h"
+#include "mix.h"
+#include "resample.h"
 #include <eai_osal/eai_osal.h>
+#include <math.h>
+#include <stdio.h>
 #include <string.h>
 
 /* ── Test hw_write callback ─────────────────────────────────────────────── */
@@ -81,7 +85,9 @@ static void test_mixer_slot_open_close(void)
 
 	uint8_t slot;
 
-	TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_open(&slot));
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+						       EAI_AUDIO_FORMAT_PCM_S16_LE,
+						       16000));
 	TEST_ASSERT_EQUAL(0, slot);
 	TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_close(slot));
 
@@ -96,12 +102,16 @@ static void test_mixer_slot_exhaustion(void)
 	uint8_t slots[EAI_AUDIO_MIXER_MAX_SLOTS];
 
 	for (int i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
-		TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_open(&slots[i]));
+		TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_open(&slots[i],
+							       EAI_AUDIO_FORMAT_PCM_S16_LE,
+							       16000));
 	}
 
 	uint8_t extra;
 
-	TEST_ASSERT_NOT_EQUAL(0, eai_audio_mixer_slot_open(&extra));
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_mixer_slot_open(&extra,
+							   EAI_AUDIO_FORMAT_PCM_S16_LE,
+							   16000));
 
 	for (int i = 0; i < EAI_AUDIO_MIXER_MAX_SLOTS; i++) {
 		eai_audio_mixer_slot_close(slots[i]);
@@ -117,7 +127,7 @@ static void test_mixer_single_stream(void)
 
 	uint8_t slot;
 
-	eai_audio_mixer_slot_open(&slot);
+	eai_audio_mixer_slot_open(&slot, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
 
 	/* Write one period of data */
 	int16_t data[64];
@@ -154,8 +164,8 @@ static void test_mixer_two_streams(void)
 
 	uint8_t slot_a, slot_b;
 
-	eai_audio_mixer_slot_open(&slot_a);
-	eai_audio_mixer_slot_open(&slot_b);
+	eai_audio_mixer_slot_open(&slot_a, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
+	eai_audio_mixer_slot_open(&slot_b, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
 
 	/* Write complementary data to two slots */
 	int16_t data_a[64], data_b[64];
@@ -191,8 +201,8 @@ static void test_mixer_clipping(void)
 
 	uint8_t slot_a, slot_b;
 
-	eai_audio_mixer_slot_open(&slot_a);
-	eai_audio_mixer_slot_open(&slot_b);
+	eai_audio_mixer_slot_open(&slot_a, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
+	eai_audio_mixer_slot_open(&slot_b, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
 
 	/* Both at near-max: should clip to 32767 */
 	int16_t data_a[64], data_b[64];
@@ -226,8 +236,8 @@ static void test_mixer_negative_clipping(void)
 
 	uint8_t slot_a, slot_b;
 
-	eai_audio_mixer_slot_open(&slot_a);
-	eai_audio_mixer_slot_open(&slot_b);
+	eai_audio_mixer_slot_open(&slot_a, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
+	eai_audio_mixer_slot_open(&slot_b, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
 
 	int16_t data_a[64], data_b[64];
 
@@ -260,7 +270,7 @@ static void test_mixer_volume(void)
 
 	uint8_t slot;
 
-	eai_audio_mixer_slot_open(&slot);
+	eai_audio_mixer_slot_open(&slot, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
 
 	/* Set volume to 50% (0x8000 = 0.5 in Q16) */
 	eai_audio_mixer_set_volume(slot, 0x8000);
@@ -292,7 +302,7 @@ static void test_mixer_mute(void)
 
 	uint8_t slot;
 
-	eai_audio_mixer_slot_open(&slot);
+	eai_audio_mixer_slot_open(&slot, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
 	eai_audio_mixer_set_volume(slot, EAI_AUDIO_MIXER_VOLUME_MUTE);
 
 	int16_t data[64];
@@ -322,7 +332,7 @@ static void test_mixer_underrun(void)
 
 	uint8_t slot;
 
-	eai_audio_mixer_slot_open(&slot);
+	eai_audio_mixer_slot_open(&slot, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
 
 	/* Write only 10 frames but period is 64 */
 	int16_t data[10];
@@ -342,6 +352,934 @@ static void test_mixer_underrun(void)
 	eai_audio_mixer_deinit();
 }
 
+/* ── Formats ────────────────────────────────────────────────────────────── */
+
+static uint8_t hw_raw[HW_BUF_MAX_SAMPLES * 4];
+static uint32_t hw_raw_bytes;
+
+/* Capture S24 mono output as raw bytes */
+static int test_hw_write_s24(const void *buf, uint32_t frames)
+{
+	uint32_t bytes = frames * 3;
+
+	if (bytes <= sizeof(hw_raw) - hw_raw_bytes) {
+		memcpy(&hw_raw[hw_raw_bytes], buf, bytes);
+		hw_raw_bytes += bytes;
+	}
+	hw_write_count++;
+	return 0;
+}
+
+static int32_t s24_at(const uint8_t *p)
+{
+	return (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 |
+			 (uint32_t)p[2] << 24) >> 8;
+}
+
+static void test_mixer_bad_format(void)
+{
+	struct eai_audio_mixer_config bad = mono_config;
+
+	bad.format = (enum eai_audio_format)99;
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_mixer_init(&bad));
+
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slot;
+
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+							   (enum eai_audio_format)99,
+							   16000));
+	eai_audio_mixer_deinit();
+}
+
+static void test_mixer_mixed_formats(void)
+{
+	reset_hw_output();
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slot_a, slot_b;
+
+	eai_audio_mixer_slot_open(&slot_a, EAI_AUDIO_FORMAT_PCM_S24_LE, 16000);
+	eai_audio_mixer_slot_open(&slot_b, EAI_AUDIO_FORMAT_PCM_F32_LE, 16000);
+
+	/* 1000 and 2000 in S16 LSBs, in each slot's format */
+	uint8_t data_a[64 * 3];
+	float data_b[64];
+
+	for (int i = 0; i < 64; i++) {
+		data_a[3 * i] = 0;
+		data_a[3 * i + 1] = 1000 & 0xFF;
+		data_a[3 * i + 2] = 1000 >> 8;
+		data_b[i] = 2000.0f / 32768.0f;
+	}
+
+	eai_audio_mixer_write(slot_a, data_a, 64);
+	eai_audio_mixer_write(slot_b, data_b, 64);
+
+	eai_audio_mixer_kick();
+	eai_osal_thread_sleep(50);
+
+	TEST_ASSERT_GREATER_THAN(0, hw_write_count);
+	for (uint32_t i = 0; i < 64 && i < hw_output_frames; i++) {
+		TEST_ASSERT_EQUAL(3000, hw_output[i]);
+	}
+
+	eai_audio_mixer_slot_close(slot_a);
+	eai_audio_mixer_slot_close(slot_b);
+	eai_audio_mixer_deinit();
+}
+
+/* Slots sum in float and clip once, so a loud pair can be pulled back */
+static void test_mixer_no_per_slot_clip(void)
+{
+	reset_hw_output();
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slots[3];
+	int16_t data[3][64];
+	static const int16_t level[3] = { 30000, 30000, -30000 };
+
+	for (int s = 0; s < 3; s++) {
+		eai_audio_mixer_slot_open(&slots[s], EAI_AUDIO_FORMAT_PCM_S16_LE,
+					  16000);
+		for (int i = 0; i < 64; i++) {
+			data[s][i] = level[s];
+		}
+	}
+	for (int s = 0; s < 3; s++) {
+		eai_audio_mixer_write(slots[s], data[s], 64);
+	}
+
+	eai_audio_mixer_kick();
+	eai_osal_thread_sleep(50);
+
+	/* Clipping after each slot would give 32767 - 30000 = 2767 */
+	TEST_ASSERT_GREATER_THAN(0, hw_write_count);
+	for (uint32_t i = 0; i < 64 && i < hw_output_frames; i++) {
+		TEST_ASSERT_EQUAL(30000, hw_output[i]);
+	}
+
+	for (int s = 0; s < 3; s++) {
+		eai_audio_mixer_slot_close(slots[s]);
+	}
+	eai_audio_mixer_deinit();
+}
+
+/* S32 in, S24 out: detail below 16 bits survives the mix */
+static void test_mixer_s24_output(void)
+{
+	struct eai_audio_mixer_config config = mono_config;
+
+	config.format = EAI_AUDIO_FORMAT_PCM_S24_LE;
+	config.hw_write = test_hw_write_s24;
+	reset_hw_output();
+	hw_raw_bytes = 0;
+	eai_audio_mixer_init(&config);
+
+	uint8_t slot;
+	int32_t data[64];
+
+	eai_audio_mixer_slot_open(&slot, EAI_AUDIO_FORMAT_PCM_S32_LE, 16000);
+	for (int i = 0; i < 64; i++) {
+		data[i] = (i - 32) * 256; /* one S24 LSB per step */
+	}
+	eai_audio_mixer_write(slot, data, 64);
+
+	eai_audio_mixer_kick();
+	eai_osal_thread_sleep(50);
+
+	TEST_ASSERT_GREATER_OR_EQUAL(64 * 3, hw_raw_bytes);
+	for (int i = 0; i < 64; i++) {
+		TEST_ASSERT_EQUAL(i - 32, s24_at(&hw_raw[3 * i]));
+	}
+
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+}
+
+/* Rings are sized for S16: a wider format gets half the samples */
+static void test_mixer_ring_fits_two_periods(void)
+{
+	struct eai_audio_mixer_config config = mono_config;
+	uint8_t slot;
+
+	/* Two of the largest stereo periods fill an S16 ring exactly */
+	config.channels = 2;
+	config.period_frames = EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES;
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_init(&config));
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+						       EAI_AUDIO_FORMAT_PCM_S16_LE,
+						       16000));
+	eai_audio_mixer_slot_close(slot);
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+							   EAI_AUDIO_FORMAT_PCM_F32_LE,
+							   16000));
+	eai_audio_mixer_deinit();
+
+	/* Half that period leaves room for two in F32 too */
+	config.period_frames = EAI_AUDIO_MIXER_MAX_PERIOD_FRAMES / 2;
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_init(&config));
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+						       EAI_AUDIO_FORMAT_PCM_F32_LE,
+						       16000));
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+}
+
+/* ── Sample rates ───────────────────────────────────────────────────────── */
+
+static void test_mixer_bad_rate(void)
+{
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slot;
+
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+							   EAI_AUDIO_FORMAT_PCM_S16_LE,
+							   0));
+
+	/* A 64-frame period at 16 kHz is 1088 frames at 272 kHz: too many */
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+							   EAI_AUDIO_FORMAT_PCM_S16_LE,
+							   272000));
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+						       EAI_AUDIO_FORMAT_PCM_S16_LE,
+						       256000));
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+}
+
+/* A 48 kHz stream on the 16 kHz mixer: three input frames per output */
+static void test_mixer_resampled_slot(void)
+{
+	reset_hw_output();
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slot;
+	static int16_t data[3 * 64 * 3];
+
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_slot_open(&slot,
+						       EAI_AUDIO_FORMAT_PCM_S16_LE,
+						       48000));
+	for (size_t i = 0; i < sizeof(data) / sizeof(data[0]); i++) {
+		data[i] = 8000;
+	}
+	TEST_ASSERT_EQUAL(3 * 64 * 3, eai_audio_mixer_write(slot, data, 3 * 64 * 3));
+
+	eai_audio_mixer_kick();
+	eai_osal_thread_sleep(50);
+
+	/* Three periods of DC, after the filter ramps up from silence */
+	uint32_t start = 0;
+
+	while (start < hw_output_frames && hw_output[start] == 0) {
+		start++;
+	}
+	TEST_ASSERT_GREATER_OR_EQUAL(start + 3 * 64, hw_output_frames);
+	for (uint32_t i = start + 16; i < start + 3 * 64 - 16; i++) {
+		TEST_ASSERT_INT_WITHIN(8, 8000, hw_output[i]);
+	}
+
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+}
+
+/* ── Scheduling ─────────────────────────────────────────────────────────── */
+
+static bool stall_armed;
+
+/* Blocks for 20 ms on its fifth period, as a wedged driver would */
+static int stalling_hw_write(const void *buf, uint32_t frames)
+{
+	if (stall_armed && hw_write_count == 4) {
+		stall_armed = false;
+		eai_osal_thread_sleep(20);
+	}
+	return test_hw_write(buf, frames);
+}
+
+static void test_mixer_deadline_miss(void)
+{
+	struct eai_audio_mixer_config config = mono_config;
+
+	config.hw_write = stalling_hw_write;
+	reset_hw_output();
+	stall_armed = true;
+	eai_audio_mixer_init(&config);
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_get_deadline_misses());
+
+	uint8_t slot;
+	static int16_t data[16 * 64];
+
+	eai_audio_mixer_slot_open(&slot, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
+	eai_audio_mixer_write(slot, data, 16 * 64);
+	eai_osal_thread_sleep(80);
+
+	/* Five 4 ms periods lost in the stall: counted, not mixed back to back */
+	TEST_ASSERT_GREATER_OR_EQUAL(1, eai_audio_mixer_get_deadline_misses());
+
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+}
+
+static uint64_t hw_frames_total;
+
+static int counting_hw_write(const void *buf, uint32_t frames)
+{
+	(void)buf;
+	hw_frames_total += frames;
+	return 0;
+}
+
+/*
+ * Play seconds of 48 kHz stereo, written in 5 ms chunks that keep about
+ * four periods queued. Output must never run ahead of the stream's rate,
+ * nor underrun. Until a deadline is missed, every write must be taken
+ * whole and output must keep the rate to within two periods; a miss
+ * loses periods, and the ring then backs up. Returns the misses.
+ */
+static uint32_t run_playback(uint64_t seconds)
+{
+	static const struct eai_audio_mixer_config config = {
+		.sample_rate = 48000,
+		.channels = 2,
+		.period_frames = 256,
+		.hw_write = counting_hw_write,
+	};
+	const uint32_t chunk = 240;
+	const uint64_t lead = 4 * 256;
+	static int16_t data[2 * 240];
+
+	for (uint32_t i = 0; i < chunk; i++) {
+		data[2 * i] = (int16_t)(i * 100);
+		data[2 * i + 1] = (int16_t)-(int16_t)(i * 100);
+	}
+
+	hw_frames_total = 0;
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_init(&config));
+
+	uint8_t slot;
+
+	eai_audio_mixer_slot_open(&slot, EAI_AUDIO_FORMAT_PCM_S16_LE, 48000);
+
+	uint64_t t0 = eai_osal_time_get_us();
+	uint64_t written = 0;
+	uint64_t elapsed_us = 0;
+
+	while (elapsed_us < seconds * 1000000) {
+		uint64_t due = elapsed_us * 48000 / 1000000 + lead;
+
+		while (written < due) {
+			int n = eai_audio_mixer_write(slot, data, chunk);
+
+			if (eai_audio_mixer_get_deadline_misses() == 0) {
+				TEST_ASSERT_EQUAL((int)chunk, n);
+			} else if (n <= 0) {
+				break;
+			}
+			written += (uint64_t)n;
+		}
+		eai_osal_thread_sleep(10);
+		elapsed_us = eai_osal_time_get_us() - t0;
+	}
+
+	uint32_t misses = eai_audio_mixer_get_deadline_misses();
+
+	TEST_ASSERT_EQUAL(0, eai_audio_mixer_get_underruns(slot));
+
+	/* The first period is due one period in */
+	uint64_t expect = elapsed_us * 48000 / 1000000;
+
+	TEST_ASSERT_LESS_OR_EQUAL_UINT64(expect + 2 * 256, hw_frames_total);
+	if (misses == 0) {
+		TEST_ASSERT_UINT64_WITHIN(2 * 256, expect, hw_frames_total);
+	}
+
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+	return misses;
+}
+
+/* A second on the real clock, where a loaded host may run the mixer late */
+static void test_mixer_playback_rate(void)
+{
+	(void)run_playback(1);
+}
+
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+
+/* Virtual time makes the period count exact: 4 ms periods, kicks or not */
+static void test_mixer_period_clock(void)
+{
+	reset_hw_output();
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slot;
+	static int16_t data[16 * 64];
+
+	eai_audio_mixer_slot_open(&slot, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
+	for (int i = 0; i < 4; i++) {
+		eai_audio_mixer_write(slot, data, 4 * 64);
+		eai_audio_mixer_kick();
+	}
+	eai_osal_thread_sleep(10);
+	TEST_ASSERT_EQUAL(2, hw_write_count);
+	eai_osal_thread_sleep(32);
+	TEST_ASSERT_EQUAL(10, hw_write_count);
+
+	eai_audio_mixer_slot_close(slot);
+	eai_audio_mixer_deinit();
+}
+
+/* Ten minutes, on time to the period, in a second or two of real time */
+static void test_mixer_long_playback(void)
+{
+	TEST_ASSERT_EQUAL(0, run_playback(600));
+}
+
+#endif /* CONFIG_EAI_OSAL_VIRTUAL_TIME */
+
+/* ── Conversion and mix kernels ─────────────────────────────────────────── */
+
+static const enum eai_audio_format all_formats[] = {
+	EAI_AUDIO_FORMAT_PCM_S16_LE,
+	EAI_AUDIO_FORMAT_PCM_S24_LE,
+	EAI_AUDIO_FORMAT_PCM_S32_LE,
+	EAI_AUDIO_FORMAT_PCM_F32_LE,
+};
+
+#define NUM_FORMATS (sizeof(all_formats) / sizeof(all_formats[0]))
+
+/* Long enough for a few vectors plus every tail length */
+#define KERNEL_MAX 67
+
+static uint32_t mix_rand_state = 1;
+
+static uint32_t mix_rand(void)
+{
+	mix_rand_state = mix_rand_state * 1664525u + 1013904223u;
+	return mix_rand_state;
+}
+
+static float mix_rand_float(void)
+{
+	/* [-1.5, 1.5), so clipping is exercised too */
+	return (float)(int32_t)mix_rand() * (1.5f / 2147483648.0f);
+}
+
+/* Encode a value given in S16 LSBs in any format, exactly */
+static void put_sample(void *buf, enum eai_audio_format format, uint32_t i,
+		       int32_t s16)
+{
+	switch (format) {
+	case EAI_AUDIO_FORMAT_PCM_S16_LE:
+		((int16_t *)buf)[i] = (int16_t)s16;
+		break;
+	case EAI_AUDIO_FORMAT_PCM_S24_LE: {
+		uint8_t *p = (uint8_t *)buf + 3 * i;
+		int32_t v = s16 * 256;
+
+		p[0] = (uint8_t)v;
+		p[1] = (uint8_t)(v >> 8);
+		p[2] = (uint8_t)(v >> 16);
+		break;
+	}
+	case EAI_AUDIO_FORMAT_PCM_S32_LE:
+		((int32_t *)buf)[i] = s16 * 65536;
+		break;
+	default:
+		((float *)buf)[i] = (float)s16 / 32768.0f;
+		break;
+	}
+}
+
+/* Decode a sample back to S16 LSBs (exact for values put_sample makes) */
+static int32_t get_sample(const void *buf, enum eai_audio_format format,
+			  uint32_t i)
+{
+	switch (format) {
+	case EAI_AUDIO_FORMAT_PCM_S16_LE:
+		return ((const int16_t *)buf)[i];
+	case EAI_AUDIO_FORMAT_PCM_S24_LE:
+		return s24_at((const uint8_t *)buf + 3 * i) / 256;
+	case EAI_AUDIO_FORMAT_PCM_S32_LE:
+		return ((const int32_t *)buf)[i] / 65536;
+	default:
+		return (int32_t)(((const float *)buf)[i] * 32768.0f);
+	}
+}
+
+static void test_mix_to_f32_bit_exact(void)
+{
+	static const float gains[] = { 0.0f, 0.5f, 0.7071f, 1.0f, 3.0f };
+	uint32_t raw[KERNEL_MAX];
+	float want[KERNEL_MAX], got[KERNEL_MAX];
+
+	for (size_t f = 0; f < NUM_FORMATS; f++) {
+		for (uint32_t len = 1; len <= KERNEL_MAX; len++) {
+			for (uint32_t i = 0; i < len; i++) {
+				raw[i] = mix_rand();
+			}
+			if (all_formats[f] == EAI_AUDIO_FORMAT_PCM_F32_LE) {
+				for (uint32_t i = 0; i < len; i++) {
+					((float *)raw)[i] = mix_rand_float();
+				}
+			}
+			for (size_t g = 0; g < sizeof(gains) / sizeof(gains[0]); g++) {
+				eai_audio_to_f32_ref(want, raw, all_formats[f], len,
+						     gains[g]);
+				eai_audio_to_f32(got, raw, all_formats[f], len, gains[g]);
+				TEST_ASSERT_EQUAL_MEMORY_MESSAGE(want, got, len * sizeof(float),
+								 eai_audio_mix_kernel());
+			}
+		}
+	}
+}
+
+static void test_mix_from_f32_bit_exact(void)
+{
+	/* Edge values, NaN and infinities on the first lanes */
+	static const float edge[] = { 1.0f, -1.0f, -0.0f, 1e-9f,
+				      NAN, INFINITY, -INFINITY };
+	float src[KERNEL_MAX];
+	uint8_t want[KERNEL_MAX * 4], got[KERNEL_MAX * 4];
+
+	for (size_t f = 0; f < NUM_FORMATS; f++) {
+		uint32_t bytes = eai_audio_format_bytes(all_formats[f]);
+
+		for (uint32_t len = 1; len <= KERNEL_MAX; len++) {
+			for (uint32_t i = 0; i < len; i++) {
+				src[i] = mix_rand_float();
+			}
+			for (uint32_t i = 0; i < len && i < sizeof(edge) / sizeof(edge[0]);
+			     i++) {
+				src[i] = edge[i];
+			}
+
+			uint32_t dither_want = mix_rand();
+			uint32_t dither_got = dither_want;
+
+			eai_audio_from_f32_ref(want, src, all_formats[f], len, NULL);
+			eai_audio_from_f32(got, src, all_formats[f], len, NULL);
+			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(want, got, len * bytes,
+							 eai_audio_mix_kernel());
+
+			eai_audio_from_f32_ref(want, src, all_formats[f], len,
+					       &dither_want);
+			eai_audio_from_f32(got, src, all_formats[f], len, &dither_got);
+			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(want, got, len * bytes,
+							 eai_audio_mix_kernel());
+			TEST_ASSERT_EQUAL_UINT32(dither_want, dither_got);
+		}
+	}
+}
+
+static void test_mix_f32_bit_exact(void)
+{
+	float src[KERNEL_MAX], want[KERNEL_MAX], got[KERNEL_MAX];
+
+	for (uint32_t len = 1; len <= KERNEL_MAX; len++) {
+		for (uint32_t i = 0; i < len; i++) {
+			src[i] = mix_rand_float();
+			want[i] = got[i] = mix_rand_float();
+		}
+		eai_audio_mix_f32_ref(want, src, len);
+		eai_audio_mix_f32(got, src, len);
+		TEST_ASSERT_EQUAL_MEMORY_MESSAGE(want, got, len * sizeof(float),
+						 eai_audio_mix_kernel());
+	}
+}
+
+static void test_mix_dot_q15_bit_exact(void)
+{
+	float x[64];
+	int16_t coefs[64];
+
+	for (uint32_t taps = 8; taps <= 64; taps += 8) {
+		for (uint32_t i = 0; i < taps; i++) {
+			x[i] = mix_rand_float();
+			coefs[i] = (int16_t)mix_rand();
+		}
+
+		float want = eai_audio_dot_q15_ref(x, coefs, taps);
+		float got = eai_audio_dot_q15(x, coefs, taps);
+
+		TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&want, &got, sizeof(float),
+						 eai_audio_mix_kernel());
+	}
+}
+
+/* Every input format through float to every output format, losslessly */
+static void test_mix_format_pairs(void)
+{
+	static const int32_t values[] = { -32768, -12345, -256, -1, 0,
+					  1, 255, 12345, 32767 };
+	const uint32_t n = sizeof(values) / sizeof(values[0]);
+	uint8_t in[sizeof(values) / sizeof(values[0]) * 4];
+	uint8_t out[sizeof(values) / sizeof(values[0]) * 4];
+	float mid[sizeof(values) / sizeof(values[0])];
+
+	for (size_t a = 0; a < NUM_FORMATS; a++) {
+		for (size_t b = 0; b < NUM_FORMATS; b++) {
+			for (uint32_t i = 0; i < n; i++) {
+				put_sample(in, all_formats[a], i, values[i]);
+			}
+			eai_audio_to_f32(mid, in, all_formats[a], n, 1.0f);
+			eai_audio_from_f32(out, mid, all_formats[b], n, NULL);
+
+			for (uint32_t i = 0; i < n; i++) {
+				TEST_ASSERT_EQUAL_INT32(values[i],
+							get_sample(out, all_formats[b], i));
+			}
+		}
+	}
+}
+
+static void test_mix_clip_per_format(void)
+{
+	const float src[2] = { 2.0f, -2.0f };
+	int16_t s16[2];
+	uint8_t s24[6];
+	int32_t s32[2];
+	float f32[2];
+
+	eai_audio_from_f32(s16, src, EAI_AUDIO_FORMAT_PCM_S16_LE, 2, NULL);
+	TEST_ASSERT_EQUAL(INT16_MAX, s16[0]);
+	TEST_ASSERT_EQUAL(INT16_MIN, s16[1]);
+
+	eai_audio_from_f32(s24, src, EAI_AUDIO_FORMAT_PCM_S24_LE, 2, NULL);
+	TEST_ASSERT_EQUAL(8388607, s24_at(&s24[0]));
+	TEST_ASSERT_EQUAL(-8388608, s24_at(&s24[3]));
+
+	/* Float can't hold 2^31 - 1; the largest float below 2^31 stands in */
+	eai_audio_from_f32(s32, src, EAI_AUDIO_FORMAT_PCM_S32_LE, 2, NULL);
+	TEST_ASSERT_EQUAL_INT32(2147483520, s32[0]);
+	TEST_ASSERT_EQUAL_INT32(INT32_MIN, s32[1]);
+
+	eai_audio_from_f32(f32, src, EAI_AUDIO_FORMAT_PCM_F32_LE, 2, NULL);
+	TEST_ASSERT_EQUAL_FLOAT(1.0f, f32[0]);
+	TEST_ASSERT_EQUAL_FLOAT(-1.0f, f32[1]);
+}
+
+/* TPDF dither: within one LSB either way, and unbiased on average */
+static void test_mix_dither(void)
+{
+	static float src[4096];
+	static int16_t out[4096];
+	uint32_t dither = 12345;
+	int64_t sum = 0;
+
+	for (int i = 0; i < 4096; i++) {
+		src[i] = 0.25f / 32768.0f; /* a quarter of an S16 LSB */
+	}
+	eai_audio_from_f32(out, src, EAI_AUDIO_FORMAT_PCM_S16_LE, 4096, &dither);
+
+	for (int i = 0; i < 4096; i++) {
+		TEST_ASSERT_INT_WITHIN(1, 0, out[i]);
+		sum += out[i];
+	}
+	/* Plain rounding would give 0 every time */
+	TEST_ASSERT_FLOAT_WITHIN(0.05f, 0.25f, (float)sum / 4096);
+	TEST_ASSERT_NOT_EQUAL(12345, dither);
+}
+
+/* ── S16 fast path ──────────────────────────────────────────────────────── */
+
+/* Volumes around every branch of the vector kernels, plus boosts */
+static const uint32_t mix_volumes[] = {
+	0, 1, 0x4000, 0x7FFF, 0x8000, 0x8001, 0xC000, 0xFFFF,
+	EAI_AUDIO_MIXER_VOLUME_UNITY, 0x10001, 0x18000, 0x40000, 0xFFFFFFFF,
+};
+
+/* Compare the built kernel against the reference on the given buffers */
+static void check_mix_s16_bit_exact(const int16_t *acc, const int16_t *src,
+				    uint32_t samples)
+{
+	int16_t want[KERNEL_MAX], got[KERNEL_MAX];
+
+	for (size_t v = 0; v < sizeof(mix_volumes) / sizeof(mix_volumes[0]); v++) {
+		memcpy(want, acc, samples * sizeof(int16_t));
+		memcpy(got, acc, samples * sizeof(int16_t));
+		eai_audio_mix_s16_ref(want, src, samples, mix_volumes[v]);
+		eai_audio_mix_s16(got, src, samples, mix_volumes[v]);
+		TEST_ASSERT_EQUAL_INT16_ARRAY_MESSAGE(want, got, samples,
+						      eai_audio_mix_kernel());
+	}
+}
+
+static void test_mix_s16_bit_exact(void)
+{
+	int16_t acc[KERNEL_MAX], src[KERNEL_MAX];
+
+	/* Every length up to a few vectors, so each tail path runs */
+	for (uint32_t len = 1; len <= KERNEL_MAX; len++) {
+		for (int round = 0; round < 8; round++) {
+			for (uint32_t i = 0; i < len; i++) {
+				acc[i] = (int16_t)(mix_rand() >> 16);
+				src[i] = (int16_t)(mix_rand() >> 16);
+			}
+			check_mix_s16_bit_exact(acc, src, len);
+		}
+	}
+}
+
+static void test_mix_s16_extremes(void)
+{
+	static const int16_t edge[] = { INT16_MIN, INT16_MIN + 1, -16384, -1,
+					0, 1, 16384, INT16_MAX - 1, INT16_MAX };
+	const uint32_t n = sizeof(edge) / sizeof(edge[0]);
+	int16_t acc[KERNEL_MAX], src[KERNEL_MAX];
+	uint32_t k = 0;
+
+	/* Every (acc, src) pair of edge values, 64 pairs per run */
+	for (uint32_t a = 0; a < n; a++) {
+		for (uint32_t b = 0; b < n; b++) {
+			acc[k] = edge[a];
+			src[k] = edge[b];
+			if (++k == 64) {
+				check_mix_s16_bit_exact(acc, src, k);
+				k = 0;
+			}
+		}
+	}
+	check_mix_s16_bit_exact(acc, src, k);
+}
+
+static void test_mix_s16_saturates(void)
+{
+	int16_t acc[16], src[16];
+
+	for (int i = 0; i < 16; i++) {
+		acc[i] = (i & 1) ? -30000 : 30000;
+		src[i] = (i & 1) ? -10000 : 10000;
+	}
+	eai_audio_mix_s16(acc, src, 16, EAI_AUDIO_MIXER_VOLUME_UNITY);
+
+	for (int i = 0; i < 16; i++) {
+		TEST_ASSERT_EQUAL((i & 1) ? INT16_MIN : INT16_MAX, acc[i]);
+	}
+}
+
+/* Two S16 slots take the integer path: one clip, at the end, as in float */
+static void test_mixer_s16_path_clips_once(void)
+{
+	reset_hw_output();
+	eai_audio_mixer_init(&mono_config);
+
+	uint8_t slot_a, slot_b;
+	int16_t data_a[64], data_b[64];
+
+	eai_audio_mixer_slot_open(&slot_a, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
+	eai_audio_mixer_slot_open(&slot_b, EAI_AUDIO_FORMAT_PCM_S16_LE, 16000);
+	eai_audio_mixer_set_volume(slot_b, 0x8000);
+
+	for (int i = 0; i < 64; i++) {
+		data_a[i] = (i & 1) ? -30000 : 30000;
+		data_b[i] = (i & 1) ? -10000 : 10000;
+	}
+	eai_audio_mixer_write(slot_a, data_a, 64);
+	eai_audio_mixer_write(slot_b, data_b, 64);
+
+	eai_audio_mixer_kick();
+	eai_osal_thread_sleep(50);
+
+	/* 30000 + 5000 clips; the float path gives the same */
+	TEST_ASSERT_GREATER_THAN(0, hw_write_count);
+	for (uint32_t i = 0; i < 64 && i < hw_output_frames; i++) {
+		TEST_ASSERT_EQUAL((i & 1) ? INT16_MIN : INT16_MAX, hw_output[i]);
+	}
+
+	eai_audio_mixer_slot_close(slot_a);
+	eai_audio_mixer_slot_close(slot_b);
+	eai_audio_mixer_deinit();
+}
+
+/* ── Resampler ──────────────────────────────────────────────────────────── */
+
+#define RS_MAX_TAPS EAI_AUDIO_RESAMPLE_MAX_TAPS(EAI_AUDIO_RESAMPLE_HIGH_TAPS)
+#define RS_PERIOD   256
+#define RS_MAX_RATE 48000
+#define RS_PI       3.14159265358979323846
+
+static int16_t rs_bank[EAI_AUDIO_RESAMPLE_BANK_SIZE(EAI_AUDIO_RESAMPLE_HIGH_TAPS,
+						    EAI_AUDIO_RESAMPLE_HIGH_PHASES)];
+static float rs_history[RS_MAX_TAPS];
+static float rs_scratch[RS_MAX_TAPS + RS_MAX_RATE];
+static float rs_in[2 * RS_MAX_RATE];
+static float rs_out[RS_MAX_RATE];
+
+static const enum eai_audio_resample_quality all_qualities[] = {
+	EAI_AUDIO_RESAMPLE_FAST,
+	EAI_AUDIO_RESAMPLE_MEDIUM,
+	EAI_AUDIO_RESAMPLE_HIGH,
+};
+
+#define NUM_QUALITIES (sizeof(all_qualities) / sizeof(all_qualities[0]))
+
+/* One second of rs_in, mono, to rs_out in periods; returns the resampler */
+static struct eai_audio_resampler rs_run(enum eai_audio_resample_quality quality,
+					 uint32_t in_rate, uint32_t out_rate)
+{
+	struct eai_audio_resampler rs;
+	uint32_t consumed = 0;
+
+	TEST_ASSERT_EQUAL(0, eai_audio_resampler_init(&rs, quality, in_rate, out_rate,
+						      1, rs_bank,
+						      sizeof(rs_bank) / sizeof(rs_bank[0]),
+						      rs_history, RS_MAX_TAPS));
+	memset(rs_out, 0, sizeof(rs_out));
+	for (uint32_t done = 0; done + RS_PERIOD <= out_rate; done += RS_PERIOD) {
+		uint32_t need = eai_audio_resampler_input_frames(&rs, RS_PERIOD);
+
+		eai_audio_resample_mix(&rs, rs_out + done, rs_in + consumed,
+				       RS_PERIOD, rs_scratch);
+		consumed += need;
+	}
+	return rs;
+}
+
+static void rs_sine(uint32_t rate, double freq)
+{
+	for (uint32_t i = 0; i < 2 * RS_MAX_RATE; i++) {
+		rs_in[i] = (float)(0.5 * sin(2.0 * RS_PI * freq * i / rate));
+	}
+}
+
+/* Output against the ideal half-scale sine, once the filter has settled */
+static double rs_snr_db(const struct eai_audio_resampler *rs, uint32_t in_rate,
+			uint32_t out_rate, double freq)
+{
+	uint32_t frames = out_rate / RS_PERIOD * RS_PERIOD;
+	double delay = eai_audio_resampler_delay(rs);
+	double sig = 0.0;
+	double err = 0.0;
+
+	for (uint32_t j = frames / 4; j < frames; j++) {
+		double t = (double)j * in_rate / out_rate - delay;
+		double ideal = 0.5 * sin(2.0 * RS_PI * freq * t / in_rate);
+
+		sig += ideal * ideal;
+		err += (rs_out[j] - ideal) * (rs_out[j] - ideal);
+	}
+	return 10.0 * log10(sig / err);
+}
+
+static void test_resample_sine(void)
+{
+	static const struct {
+		uint32_t in_rate;
+		uint32_t out_rate;
+		double min_db[NUM_QUALITIES]; /* fast, medium, high */
+	} cases[] = {
+		{ 16000, 48000, { 45.0, 70.0, 80.0 } },
+		{ 44100, 48000, { 50.0, 75.0, 80.0 } },
+		{ 48000, 16000, { 60.0, 60.0, 80.0 } },
+		{ 48000, 44100, { 55.0, 75.0, 80.0 } },
+	};
+
+	for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+		rs_sine(cases[c].in_rate, 1000.0);
+		for (size_t q = 0; q < NUM_QUALITIES; q++) {
+			struct eai_audio_resampler rs = rs_run(all_qualities[q],
+								cases[c].in_rate,
+								cases[c].out_rate);
+			double snr = rs_snr_db(&rs, cases[c].in_rate,
+					       cases[c].out_rate, 1000.0);
+			char msg[64];
+
+			snprintf(msg, sizeof(msg), "%u -> %u Hz, quality %u: %.1f dB",
+				 cases[c].in_rate, cases[c].out_rate,
+				 (unsigned)q, snr);
+			TEST_ASSERT_TRUE_MESSAGE(snr >= cases[c].min_db[q], msg);
+		}
+	}
+}
+
+/* 12 kHz can't exist at 16 kHz; downsampling must filter, not fold it */
+static void test_resample_alias(void)
+{
+	rs_sine(48000, 12000.0);
+	for (size_t q = 0; q < NUM_QUALITIES; q++) {
+		float peak = 0.0f;
+
+		rs_run(all_qualities[q], 48000, 16000);
+		for (uint32_t j = 1000; j < 16000 / RS_PERIOD * RS_PERIOD; j++) {
+			peak = fabsf(rs_out[j]) > peak ? fabsf(rs_out[j]) : peak;
+		}
+		/* -40 dB below the half-scale input */
+		TEST_ASSERT_LESS_THAN_FLOAT(0.005f, peak);
+	}
+}
+
+static void test_resample_dc(void)
+{
+	static const uint32_t rates[][2] = {
+		{ 16000, 48000 }, { 8000, 48000 }, { 44100, 48000 },
+		{ 48000, 16000 }, { 48000, 44100 }, { 32000, 48000 },
+	};
+
+	for (uint32_t i = 0; i < 2 * RS_MAX_RATE; i++) {
+		rs_in[i] = 0.25f;
+	}
+	for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		for (size_t q = 0; q < NUM_QUALITIES; q++) {
+			rs_run(all_qualities[q], rates[r][0], rates[r][1]);
+			for (uint32_t j = 200; j < rates[r][1] / RS_PERIOD * RS_PERIOD; j++) {
+				TEST_ASSERT_FLOAT_WITHIN(0.25f * 1e-3f, 0.25f, rs_out[j]);
+			}
+		}
+	}
+}
+
+/* Whole seconds consume exactly a second of input, period after period */
+static void test_resample_no_drift(void)
+{
+	static const uint32_t rates[][2] = {
+		{ 44100, 48000 }, { 48000, 44100 }, { 16000, 48000 }, { 11025, 16000 },
+	};
+
+	for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		struct eai_audio_resampler rs;
+		uint64_t consumed = 0;
+		uint32_t out_rate = rates[r][1];
+
+		eai_audio_resampler_init(&rs, EAI_AUDIO_RESAMPLE_FAST, rates[r][0],
+					 out_rate, 1, rs_bank,
+					 sizeof(rs_bank) / sizeof(rs_bank[0]),
+					 rs_history, RS_MAX_TAPS);
+		/* 10 s in 100-frame periods: a whole number for these rates */
+		for (uint32_t done = 0; done < 10 * out_rate; done += 100) {
+			consumed += eai_audio_resampler_input_frames(&rs, 100);
+			eai_audio_resample_mix(&rs, rs_out, rs_in, 100, rs_scratch);
+		}
+		TEST_ASSERT_EQUAL_UINT64(10ULL * rates[r][0], consumed);
+	}
+}
+
+static void test_resample_init_bad(void)
+{
+	struct eai_audio_resampler rs;
+	uint32_t bank_size = sizeof(rs_bank) / sizeof(rs_bank[0]);
+
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_resampler_init(&rs, EAI_AUDIO_RESAMPLE_FAST,
+							  0, 48000, 1, rs_bank,
+							  bank_size, rs_history,
+							  RS_MAX_TAPS));
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_resampler_init(&rs, EAI_AUDIO_RESAMPLE_FAST,
+							  16000, 0, 1, rs_bank,
+							  bank_size, rs_history,
+							  RS_MAX_TAPS));
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_resampler_init(&rs, EAI_AUDIO_RESAMPLE_HIGH,
+							  16000, 48000, 1, rs_bank,
+							  bank_size - 1, rs_history,
+							  RS_MAX_TAPS));
+	TEST_ASSERT_NOT_EQUAL(0, eai_audio_resampler_init(&rs, EAI_AUDIO_RESAMPLE_HIGH,
+							  16000, 48000, 2, rs_bank,
+							  bank_size, rs_history,
+							  RS_MAX_TAPS));
+}
+
 /* ── Runner ─────────────────────────────────────────────────────────────── */
 
 void run_mixer_tests(void)
@@ -358,4 +1296,33 @@ void run_mixer_tests(void)
 	RUN_TEST(test_mixer_volume);
 	RUN_TEST(test_mixer_mute);
 	RUN_TEST(test_mixer_underrun);
+	RUN_TEST(test_mixer_bad_format);
+	RUN_TEST(test_mixer_mixed_formats);
+	RUN_TEST(test_mixer_no_per_slot_clip);
+	RUN_TEST(test_mixer_s24_output);
+	RUN_TEST(test_mixer_ring_fits_two_periods);
+	RUN_TEST(test_mixer_bad_rate);
+	RUN_TEST(test_mixer_resampled_slot);
+	RUN_TEST(test_mixer_deadline_miss);
+	RUN_TEST(test_mixer_playback_rate);
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+	RUN_TEST(test_mixer_period_clock);
+	RUN_TEST(test_mixer_long_playback);
+#endif
+	RUN_TEST(test_mix_to_f32_bit_exact);
+	RUN_TEST(test_mix_from_f32_bit_exact);
+	RUN_TEST(test_mix_f32_bit_exact);
+	RUN_TEST(test_mix_dot_q15_bit_exact);
+	RUN_TEST(test_mix_format_pairs);
+	RUN_TEST(test_mix_clip_per_format);
+	RUN_TEST(test_mix_dither);
+	RUN_TEST(test_mix_s16_bit_exact);
+	RUN_TEST(test_mix_s16_extremes);
+	RUN_TEST(test_mix_s16_saturates);
+	RUN_TEST(test_mixer_s16_path_clips_once);
+	RUN_TEST(test_resample_sine);
+	RUN_TEST(test_resample_alias);
+	RUN_TEST(test_resample_dc);
+	RUN_TEST(test_resample_no_drift);
+	RUN_TEST(test_resample_init_bad);
 }
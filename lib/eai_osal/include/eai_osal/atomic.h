@@ -0,0 +1,160 @@
+#ifndef EAI_OSAL_ATOMIC_H
+#define EAI_OSAL_ATOMIC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+/*
+ * Portable atomics with an explicit memory order.
+ *
+ * Thin inline wrappers over C11 <stdatomic.h>, which every OSAL toolchain
+ * provides. Use them instead of a mutex around a single word, and to
+ * write lock-free structures against one API on every backend. The
+ * orders mean the same as in C11. When unsure, use SEQ_CST.
+ *
+ * Only 32-bit integers and pointers are covered. Both are lock-free on
+ * every supported target.
+ */
+
+typedef enum {
+	EAI_OSAL_ATOMIC_RELAXED = memory_order_relaxed,
+	EAI_OSAL_ATOMIC_ACQUIRE = memory_order_acquire,
+	EAI_OSAL_ATOMIC_RELEASE = memory_order_release,
+	EAI_OSAL_ATOMIC_ACQ_REL = memory_order_acq_rel,
+	EAI_OSAL_ATOMIC_SEQ_CST = memory_order_seq_cst,
+} eai_osal_memory_order_t;
+
+typedef _Atomic uint32_t eai_osal_atomic_t;
+typedef _Atomic(void *) eai_osal_atomic_ptr_t;
+
+/** Static initializer for either type, e.g. `= EAI_OSAL_ATOMIC_INIT(0)`. */
+#define EAI_OSAL_ATOMIC_INIT(v) (v)
+
+/* A failed CAS only loads, so it can't carry a release half */
+static inline memory_order osal_atomic_fail_order(eai_osal_memory_order_t order)
+{
+	switch (order) {
+	case EAI_OSAL_ATOMIC_RELEASE:
+		return memory_order_relaxed;
+	case EAI_OSAL_ATOMIC_ACQ_REL:
+		return memory_order_acquire;
+	default:
+		return (memory_order)order;
+	}
+}
+
+/* ── 32-bit integer ───────────────────────────────────────────────────── */
+
+/** @brief Set the value without ordering; not for objects already shared. */
+static inline void eai_osal_atomic_init(eai_osal_atomic_t *a, uint32_t v)
+{
+	atomic_init(a, v);
+}
+
+static inline uint32_t eai_osal_atomic_load(const eai_osal_atomic_t *a,
+					    eai_osal_memory_order_t order)
+{
+	return atomic_load_explicit((eai_osal_atomic_t *)a, (memory_order)order);
+}
+
+static inline void eai_osal_atomic_store(eai_osal_atomic_t *a, uint32_t v,
+					 eai_osal_memory_order_t order)
+{
+	atomic_store_explicit(a, v, (memory_order)order);
+}
+
+/** @brief Add v (wrapping); returns the value before the add. */
+static inline uint32_t eai_osal_atomic_add(eai_osal_atomic_t *a, uint32_t v,
+					   eai_osal_memory_order_t order)
+{
+	return atomic_fetch_add_explicit(a, v, (memory_order)order);
+}
+
+/** @brief Subtract v (wrapping); returns the value before the subtract. */
+static inline uint32_t eai_osal_atomic_sub(eai_osal_atomic_t *a, uint32_t v,
+					   eai_osal_memory_order_t order)
+{
+	return atomic_fetch_sub_explicit(a, v, (memory_order)order);
+}
+
+/** @brief Set bits; returns the value before. */
+static inline uint32_t eai_osal_atomic_or(eai_osal_atomic_t *a, uint32_t bits,
+					  eai_osal_memory_order_t order)
+{
+	return atomic_fetch_or_explicit(a, bits, (memory_order)order);
+}
+
+/** @brief Keep only bits; returns the value before. */
+static inline uint32_t eai_osal_atomic_and(eai_osal_atomic_t *a, uint32_t bits,
+					   eai_osal_memory_order_t order)
+{
+	return atomic_fetch_and_explicit(a, bits, (memory_order)order);
+}
+
+/** @brief Store v; returns the value it replaced. */
+static inline uint32_t eai_osal_atomic_exchange(eai_osal_atomic_t *a, uint32_t v,
+						eai_osal_memory_order_t order)
+{
+	return atomic_exchange_explicit(a, v, (memory_order)order);
+}
+
+/**
+ * @brief Compare-and-swap.
+ *
+ * Stores desired if the value equals *expected. Otherwise loads the
+ * current value into *expected, so a retry loop needs no extra load.
+ *
+ * @return true if desired was stored.
+ */
+static inline bool eai_osal_atomic_cas(eai_osal_atomic_t *a, uint32_t *expected,
+				       uint32_t desired,
+				       eai_osal_memory_order_t order)
+{
+	return atomic_compare_exchange_strong_explicit(a, expected, desired,
+						       (memory_order)order,
+						       osal_atomic_fail_order(order));
+}
+
+/* ── Pointer ──────────────────────────────────────────────────────────── */
+
+static inline void eai_osal_atomic_ptr_init(eai_osal_atomic_ptr_t *a, void *v)
+{
+	atomic_init(a, v);
+}
+
+static inline void *eai_osal_atomic_ptr_load(const eai_osal_atomic_ptr_t *a,
+					     eai_osal_memory_order_t order)
+{
+	return atomic_load_explicit((eai_osal_atomic_ptr_t *)a, (memory_order)order);
+}
+
+static inline void eai_osal_atomic_ptr_store(eai_osal_atomic_ptr_t *a, void *v,
+					     eai_osal_memory_order_t order)
+{
+	atomic_store_explicit(a, v, (memory_order)order);
+}
+
+static inline void *eai_osal_atomic_ptr_exchange(eai_osal_atomic_ptr_t *a, void *v,
+						 eai_osal_memory_order_t order)
+{
+	return atomic_exchange_explicit(a, v, (memory_order)order);
+}
+
+/** @brief Pointer compare-and-swap; same contract as eai_osal_atomic_cas(). */
+static inline bool eai_osal_atomic_ptr_cas(eai_osal_atomic_ptr_t *a, void **expected,
+					   void *desired,
+					   eai_osal_memory_order_t order)
+{
+	return atomic_compare_exchange_strong_explicit(a, expected, desired,
+						       (memory_order)order,
+						       osal_atomic_fail_order(order));
+}
+
+/** @brief Standalone fence, for orderings no single operation carries. */
+static inline void eai_osal_atomic_fence(eai_osal_memory_order_t order)
+{
+	atomic_thread_fence((memory_order)order);
+}
+
+#endif /* EAI_OSAL_ATOMIC_H */
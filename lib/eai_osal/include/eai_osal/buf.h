@@ -0,0 +1,151 @@
+#ifndef EAI_OSAL_BUF_H
+#define EAI_OSAL_BUF_H
+
+#include <eai_osal/types.h>
+#include <eai_osal/mempool.h>
+#include <stdatomic.h>
+
+/*
+ * Reference-counted data buffers, after Zephyr's net_buf.
+ *
+ * A buffer is one eai_osal_mempool_t block: this header, then data_size
+ * bytes of storage. The valid bytes are [data, data + len). Space in
+ * front of them (headroom) lets a layer prepend a header with
+ * eai_buf_push(), without moving the payload. Space after them
+ * (tailroom) is filled with eai_buf_add().
+ *
+ * Passing a buffer hands over a reference, not the bytes. Each holder
+ * calls eai_buf_unref() when done, and the last one returns the block to
+ * its pool. A shared buffer (ref > 1) must be treated as read-only.
+ *
+ * Longer payloads are chained through frags. A chain is owned through
+ * its head: when the head's last reference goes, every fragment loses
+ * the reference the chain held on it.
+ */
+
+typedef struct eai_buf_pool eai_buf_pool_t;
+
+typedef struct eai_buf {
+	struct eai_buf *frags; /**< Next fragment in the chain, or NULL */
+	uint8_t *data;         /**< Start of valid data */
+	uint16_t len;          /**< Bytes of valid data */
+	uint16_t size;         /**< Bytes of storage */
+	eai_buf_pool_t *_pool;
+	atomic_uint _ref;
+	uint8_t *_storage;
+} eai_buf_t;
+
+struct eai_buf_pool {
+	eai_osal_mempool_t _blocks;
+	uint16_t _data_size;
+};
+
+/** Bytes of pool storage one buffer of data_size bytes takes. */
+#define EAI_BUF_BLOCK_SIZE(data_size)                                     \
+	((sizeof(eai_buf_t) + (data_size) + sizeof(void *) - 1) &          \
+	 ~(sizeof(void *) - 1))
+
+/** Static storage for n_bufs buffers of data_size bytes each. */
+#define EAI_BUF_POOL_STORAGE_DEFINE(name, n_bufs, data_size) \
+	EAI_OSAL_MEMPOOL_BUF_DEFINE(name, EAI_BUF_BLOCK_SIZE(data_size), n_bufs)
+
+/* ── Pools ──────────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Initialize a buffer pool.
+ *
+ * @param pool      Pool to initialize.
+ * @param n_bufs    Number of buffers.
+ * @param data_size Bytes of storage per buffer (1-65535).
+ * @param storage   Storage from EAI_BUF_POOL_STORAGE_DEFINE with the same
+ *                  n_bufs and data_size.
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM on bad arguments.
+ */
+eai_osal_status_t eai_buf_pool_create(eai_buf_pool_t *pool, uint32_t n_bufs,
+				      size_t data_size, void *storage);
+eai_osal_status_t eai_buf_pool_destroy(eai_buf_pool_t *pool);
+
+/** @brief Read the pool's usage counters (see eai_osal_mempool_get_stats()). */
+eai_osal_status_t eai_buf_pool_get_stats(eai_buf_pool_t *pool,
+					 eai_osal_mempool_stats_t *stats);
+
+/* ── Buffers ────────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Take an empty buffer with one reference, no headroom and no frags.
+ *
+ * @param timeout_ms Time to wait for a free buffer (EAI_OSAL_NO_WAIT,
+ *                   EAI_OSAL_WAIT_FOREVER).
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if the pool stayed empty.
+ */
+eai_osal_status_t eai_buf_alloc(eai_buf_pool_t *pool, eai_buf_t **buf,
+				uint32_t timeout_ms);
+
+/** @brief Take another reference. Returns buf. */
+eai_buf_t *eai_buf_ref(eai_buf_t *buf);
+
+/**
+ * @brief Drop a reference. The last one frees the buffer and drops the
+ * chain's reference on each fragment. NULL is ignored.
+ */
+void eai_buf_unref(eai_buf_t *buf);
+
+/**
+ * @brief Reserve headroom in an empty buffer.
+ *
+ * @return EAI_OSAL_OK, EAI_OSAL_ERROR if the buffer holds data,
+ *         EAI_OSAL_INVALID_PARAM if headroom exceeds the tailroom.
+ */
+eai_osal_status_t eai_buf_reserve(eai_buf_t *buf, size_t headroom);
+
+/** @brief Bytes free in front of data. */
+size_t eai_buf_headroom(const eai_buf_t *buf);
+
+/** @brief Bytes free after data + len. */
+size_t eai_buf_tailroom(const eai_buf_t *buf);
+
+/**
+ * @brief Extend the data at the end by len bytes.
+ *
+ * @return Start of the added bytes, NULL if the tailroom is too small.
+ */
+void *eai_buf_add(eai_buf_t *buf, size_t len);
+
+/** @brief Append a copy of mem. EAI_OSAL_NO_MEMORY if it doesn't fit. */
+eai_osal_status_t eai_buf_add_mem(eai_buf_t *buf, const void *mem, size_t len);
+
+/**
+ * @brief Extend the data at the front by len bytes of headroom.
+ *
+ * @return New data pointer, NULL if the headroom is too small.
+ */
+void *eai_buf_push(eai_buf_t *buf, size_t len);
+
+/**
+ * @brief Remove len bytes from the front of the data.
+ *
+ * @return New data pointer, NULL if len exceeds the data.
+ */
+void *eai_buf_pull(eai_buf_t *buf, size_t len);
+
+/* ── Fragment chains ────────────────────────────────────────────────────── */
+
+/**
+ * @brief Append frag (and any chain behind it) to the end of head's chain.
+ *
+ * The chain takes over the caller's reference on frag.
+ */
+void eai_buf_frag_add(eai_buf_t *head, eai_buf_t *frag);
+
+/** @brief Total data bytes across the chain starting at buf. */
+size_t eai_buf_chain_len(const eai_buf_t *buf);
+
+/**
+ * @brief Copy up to len bytes, starting offset bytes into the chain.
+ *
+ * @return Bytes copied.
+ */
+size_t eai_buf_linearize(const eai_buf_t *buf, void *dst, size_t offset,
+			 size_t len);
+
+#endif /* EAI_OSAL_BUF_H */
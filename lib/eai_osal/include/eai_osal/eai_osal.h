@@ -6,10 +6,20 @@
 #include <eai_osal/semaphore.h>
 #include <eai_osal/thread.h>
 #include <eai_osal/queue.h>
+#include <eai_osal/pipe.h>
+#include <eai_osal/pqueue.h>
 #include <eai_osal/timer.h>
 #include <eai_osal/event.h>
 #include <eai_osal/critical.h>
 #include <eai_osal/time.h>
 #include <eai_osal/workqueue.h>
+#include <eai_osal/spsc.h>
+#include <eai_osal/mempool.h>
+#include <eai_osal/buf.h>
+#include <eai_osal/poll.h>
+#include <eai_osal/rwlock.h>
+#include <eai_osal/atomic.h>
+#include <eai_osal/stats.h>
+#include <eai_osal/task.h>
 
 #endif /* EAI_OSAL_H */
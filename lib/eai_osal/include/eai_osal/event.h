@@ -4,6 +4,9 @@
 #include <eai_osal/types.h>
 
 eai_osal_status_t eai_osal_event_create(eai_osal_event_t *event);
+/* name keys the CONFIG_EAI_OSAL_STATS record (stats.h); NULL = unlisted */
+eai_osal_status_t eai_osal_event_create_named(eai_osal_event_t *event,
+					      const char *name);
 eai_osal_status_t eai_osal_event_destroy(eai_osal_event_t *event);
 eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits);
 eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
@@ -0,0 +1,78 @@
+#ifndef EAI_OSAL_MEMPOOL_H
+#define EAI_OSAL_MEMPOOL_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Fixed-size block pool (slab) over caller-provided storage.
+ *
+ * alloc and free are O(1) and never touch the heap. An alloc that finds
+ * the pool empty may wait for a free, up to its timeout. Zephyr maps the
+ * pool onto a k_mem_slab. FreeRTOS keeps a free list under the OSAL
+ * critical section, plus a counting semaphore for waiters. POSIX pops
+ * blocks off a lock-free Treiber stack, gated by an OSAL semaphore that
+ * counts free blocks.
+ *
+ * block_size must be a non-zero multiple of sizeof(void *), and the
+ * buffer must be pointer-aligned; EAI_OSAL_MEMPOOL_BUF_DEFINE takes care
+ * of both.
+ */
+
+/** Static, suitably aligned storage for n_blocks blocks of block_size bytes. */
+#define EAI_OSAL_MEMPOOL_BUF_DEFINE(name, block_size, n_blocks) \
+	static uint8_t name[(block_size) * (n_blocks)]          \
+		__attribute__((aligned(sizeof(void *))))
+
+/**
+ * @brief Initialize a pool over caller-provided storage.
+ *
+ * @param pool       Pool to initialize.
+ * @param block_size Bytes per block; a non-zero multiple of sizeof(void *).
+ * @param n_blocks   Number of blocks (at least 1).
+ * @param buffer     Pointer-aligned storage of block_size * n_blocks bytes.
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM on bad arguments,
+ *         EAI_OSAL_NO_MEMORY if backend resources are unavailable.
+ */
+eai_osal_status_t eai_osal_mempool_create(eai_osal_mempool_t *pool,
+					  size_t block_size, uint32_t n_blocks,
+					  void *buffer);
+
+/**
+ * @brief Release the pool's resources. Blocks still allocated become invalid.
+ */
+eai_osal_status_t eai_osal_mempool_destroy(eai_osal_mempool_t *pool);
+
+/**
+ * @brief Take one block.
+ *
+ * @param pool       Pool to allocate from.
+ * @param block      Set to the block on success.
+ * @param timeout_ms Time to wait for a free block (EAI_OSAL_NO_WAIT,
+ *                   EAI_OSAL_WAIT_FOREVER).
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if no block became free.
+ */
+eai_osal_status_t eai_osal_mempool_alloc(eai_osal_mempool_t *pool, void **block,
+					 uint32_t timeout_ms);
+
+/**
+ * @brief Return a block to its pool, waking one waiting alloc.
+ *
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM if block is not a block of
+ *         this pool. Freeing a block twice is not detected.
+ */
+eai_osal_status_t eai_osal_mempool_free(eai_osal_mempool_t *pool, void *block);
+
+/**
+ * @brief Read a pool's usage counters.
+ *
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM if pool or stats is NULL.
+ */
+eai_osal_status_t eai_osal_mempool_get_stats(eai_osal_mempool_t *pool,
+					     eai_osal_mempool_stats_t *stats);
+
+/**
+ * @brief Clear failures and restart high_water from the blocks in use.
+ */
+eai_osal_status_t eai_osal_mempool_reset_stats(eai_osal_mempool_t *pool);
+
+#endif /* EAI_OSAL_MEMPOOL_H */
@@ -4,6 +4,9 @@
 #include <eai_osal/types.h>
 
 eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex);
+/* name keys the CONFIG_EAI_OSAL_STATS record (stats.h); NULL = unlisted */
+eai_osal_status_t eai_osal_mutex_create_named(eai_osal_mutex_t *mutex,
+					      const char *name);
 eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex);
 eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_ms);
 eai_osal_status_t eai_osal_mutex_unlock(eai_osal_mutex_t *mutex);
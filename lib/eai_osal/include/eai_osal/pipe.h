@@ -0,0 +1,79 @@
+#ifndef EAI_OSAL_PIPE_H
+#define EAI_OSAL_PIPE_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Byte pipe.
+ *
+ * A byte stream through caller-provided storage, for data that has no
+ * message boundaries or whose messages vary in size: a 20-byte write
+ * takes 20 bytes of the pipe, not a slot sized for the largest message.
+ * Reads and writes may move fewer bytes than asked for and report the
+ * count they did move.
+ *
+ * A reader waits until the pipe holds the pipe's threshold (or all it
+ * asked for, if less), so a trickle of small writes doesn't wake it once
+ * per write. A pipe has one writer and one reader at a time; threads that
+ * share a side must take turns.
+ *
+ * Zephyr maps the pipe onto a k_pipe and FreeRTOS onto a stream buffer
+ * over the same storage. A stream buffer keeps one byte of it free, so on
+ * FreeRTOS the pipe holds size - 1 bytes. On POSIX it is a lock-free SPSC
+ * ring, and a transfer that doesn't have to wait takes no lock and makes
+ * no syscall.
+ */
+
+/**
+ * @brief Create a pipe over caller-provided storage.
+ *
+ * @param pipe      Pipe to create.
+ * @param buffer    Storage of size bytes.
+ * @param size      Bytes of storage.
+ * @param threshold Bytes a read waits for, from 1 to what the pipe holds.
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM on bad arguments,
+ *         EAI_OSAL_ERROR if its semaphores can't be created (POSIX).
+ */
+eai_osal_status_t eai_osal_pipe_create(eai_osal_pipe_t *pipe, void *buffer,
+				       size_t size, size_t threshold);
+eai_osal_status_t eai_osal_pipe_destroy(eai_osal_pipe_t *pipe);
+
+/**
+ * @brief Write len bytes, waiting for space as needed.
+ *
+ * With EAI_OSAL_NO_WAIT this writes what fits.
+ *
+ * @param pipe       Pipe.
+ * @param data       Bytes to write.
+ * @param len        Number of bytes.
+ * @param written    Optional; receives the number of bytes written.
+ * @param timeout_ms Overall time limit for the whole write.
+ * @return EAI_OSAL_OK if all len bytes were written, EAI_OSAL_TIMEOUT if
+ *         the timeout expired first (*written tells how many went in).
+ */
+eai_osal_status_t eai_osal_pipe_write(eai_osal_pipe_t *pipe, const void *data,
+				      size_t len, size_t *written,
+				      uint32_t timeout_ms);
+
+/**
+ * @brief Wait for the threshold, then read up to len bytes.
+ *
+ * @param pipe       Pipe.
+ * @param data       Storage for len bytes.
+ * @param len        Most bytes to read.
+ * @param read       Receives the number of bytes read.
+ * @param timeout_ms Time to wait for min(len, threshold) bytes.
+ * @return EAI_OSAL_OK once that many were read, EAI_OSAL_TIMEOUT if the
+ *         pipe held fewer when the timeout expired (those are still read).
+ */
+eai_osal_status_t eai_osal_pipe_read(eai_osal_pipe_t *pipe, void *data,
+				     size_t len, size_t *read,
+				     uint32_t timeout_ms);
+
+/** @brief Bytes in the pipe (a snapshot when called concurrently). */
+size_t eai_osal_pipe_count(eai_osal_pipe_t *pipe);
+
+/** @brief Free bytes in the pipe (a snapshot when called concurrently). */
+size_t eai_osal_pipe_space(eai_osal_pipe_t *pipe);
+
+#endif /* EAI_OSAL_PIPE_H */
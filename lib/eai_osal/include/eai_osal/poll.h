@@ -0,0 +1,61 @@
+#ifndef EAI_OSAL_POLL_H
+#define EAI_OSAL_POLL_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Wait on several objects at once.
+ *
+ * eai_osal_poll() blocks until at least one entry is ready, or the
+ * timeout passes. Readiness is only reported, never consumed: the caller
+ * follows up with a EAI_OSAL_NO_WAIT take, recv or event_wait. That call
+ * can still come back empty if another consumer got there first, so
+ * callers loop.
+ *
+ * Zephyr maps sems and queues onto k_poll events. Event groups, and every
+ * object on FreeRTOS and POSIX, keep a list of pollers instead: a give,
+ * send or set wakes every poller registered on the object. When nobody is
+ * polling, the notify costs one pointer check.
+ */
+
+typedef enum {
+	EAI_OSAL_POLL_SEM_AVAILABLE,  /**< Semaphore count > 0 */
+	EAI_OSAL_POLL_QUEUE_NOT_EMPTY, /**< Queue holds a message */
+	EAI_OSAL_POLL_EVENT_BITS,     /**< Any of bits set in the event group */
+} eai_osal_poll_type_t;
+
+typedef struct eai_osal_poll_event {
+	eai_osal_poll_type_t type;
+	union {
+		eai_osal_sem_t *sem;
+		eai_osal_queue_t *queue;
+		eai_osal_event_t *event;
+	};
+	uint32_t bits;             /**< EAI_OSAL_POLL_EVENT_BITS only */
+	bool ready;                /**< Set by eai_osal_poll() */
+	eai_osal_poll_priv_t _priv;
+} eai_osal_poll_event_t;
+
+/** Initializers for eai_osal_poll_event_t array entries. */
+#define EAI_OSAL_POLL_SEM(s) \
+	{ .type = EAI_OSAL_POLL_SEM_AVAILABLE, .sem = (s) }
+#define EAI_OSAL_POLL_QUEUE(q) \
+	{ .type = EAI_OSAL_POLL_QUEUE_NOT_EMPTY, .queue = (q) }
+#define EAI_OSAL_POLL_EVENT(e, b) \
+	{ .type = EAI_OSAL_POLL_EVENT_BITS, .event = (e), .bits = (b) }
+
+/**
+ * @brief Wait until at least one of events[] is ready.
+ *
+ * @param events     Entries to wait on; each one's ready flag is updated.
+ * @param n          Number of entries (at least 1; on Zephyr at most
+ *                   CONFIG_EAI_OSAL_POLL_MAX_EVENTS).
+ * @param timeout_ms Time to wait (EAI_OSAL_NO_WAIT, EAI_OSAL_WAIT_FOREVER).
+ * @return EAI_OSAL_OK if any entry is ready, EAI_OSAL_TIMEOUT if none
+ *         became ready, EAI_OSAL_INVALID_PARAM on a NULL object, zero
+ *         event bits or an unknown type.
+ */
+eai_osal_status_t eai_osal_poll(eai_osal_poll_event_t *events, size_t n,
+				uint32_t timeout_ms);
+
+#endif /* EAI_OSAL_POLL_H */
@@ -0,0 +1,82 @@
+#ifndef EAI_OSAL_PQUEUE_H
+#define EAI_OSAL_PQUEUE_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Priority message queue.
+ *
+ * Like eai_osal_queue_t, but every message is sent at one of
+ * EAI_OSAL_PQUEUE_LEVELS priority levels. recv always returns the oldest
+ * message of the highest non-empty level, so an urgent message never
+ * waits behind a backlog of bulk ones.
+ *
+ * Each level is an intrusive FIFO of slot indices, and a bitmap records
+ * the non-empty levels, so send and recv are O(1) whatever the fill
+ * level. Both hold a per-queue mutex for the list update and the copy,
+ * and only touch a semaphore when a thread on the other side is asleep.
+ * Any number of threads may send and receive. Not callable from ISRs.
+ */
+
+/** Number of priority levels; 0 is lowest. */
+#define EAI_OSAL_PQUEUE_LEVELS 8
+
+/** Bytes of storage eai_osal_pqueue_create() needs (uint32_t-aligned). */
+#define EAI_OSAL_PQUEUE_BUF_SIZE(msg_size, max_msgs) \
+	((size_t)(max_msgs) * (sizeof(uint32_t) + (size_t)(msg_size)))
+
+typedef struct eai_osal_pqueue {
+	uint32_t *_next;          /* per-slot link, then the messages */
+	uint8_t *_msgs;
+	size_t _msg_size;
+	uint32_t _max_msgs;
+	uint32_t _free;           /* head of the free-slot stack */
+	uint32_t _head[EAI_OSAL_PQUEUE_LEVELS];
+	uint32_t _tail[EAI_OSAL_PQUEUE_LEVELS];
+	uint32_t _ready;          /* bit p set while level p is non-empty */
+	uint32_t _count;
+	uint32_t _rx_waiting;     /* receivers parked on _items_sig */
+	uint32_t _tx_waiting;     /* senders parked on _spaces_sig */
+	eai_osal_mutex_t _lock;
+	eai_osal_sem_t _items_sig;  /* wake tokens for receivers */
+	eai_osal_sem_t _spaces_sig; /* wake tokens for senders */
+} eai_osal_pqueue_t;
+
+/**
+ * @brief Initialize a priority queue over caller-provided storage.
+ *
+ * @param pq       Queue to initialize.
+ * @param msg_size Size of one message in bytes.
+ * @param max_msgs Capacity in messages, across all levels.
+ * @param buffer   EAI_OSAL_PQUEUE_BUF_SIZE(msg_size, max_msgs) bytes.
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM on bad arguments,
+ *         EAI_OSAL_ERROR if the semaphores can't be created.
+ */
+eai_osal_status_t eai_osal_pqueue_create(eai_osal_pqueue_t *pq, size_t msg_size,
+					 uint32_t max_msgs, void *buffer);
+eai_osal_status_t eai_osal_pqueue_destroy(eai_osal_pqueue_t *pq);
+
+/**
+ * @brief Send a message at a priority level.
+ *
+ * @param prio       0 (lowest) to EAI_OSAL_PQUEUE_LEVELS - 1.
+ * @param timeout_ms Time to wait for a free slot.
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if full, EAI_OSAL_INVALID_PARAM.
+ */
+eai_osal_status_t eai_osal_pqueue_send(eai_osal_pqueue_t *pq, const void *msg,
+				       uint8_t prio, uint32_t timeout_ms);
+
+/**
+ * @brief Receive the oldest message of the highest non-empty level.
+ *
+ * @param prio       Optional; receives the message's level.
+ * @param timeout_ms Time to wait for a message.
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if empty, EAI_OSAL_INVALID_PARAM.
+ */
+eai_osal_status_t eai_osal_pqueue_recv(eai_osal_pqueue_t *pq, void *msg,
+				       uint8_t *prio, uint32_t timeout_ms);
+
+/** @brief Number of queued messages, across all levels. */
+uint32_t eai_osal_pqueue_count(eai_osal_pqueue_t *pq);
+
+#endif /* EAI_OSAL_PQUEUE_H */
@@ -5,10 +5,122 @@
 
 eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size,
 					uint32_t max_msgs, void *buffer);
+/* name keys the CONFIG_EAI_OSAL_STATS record (stats.h); NULL = unlisted */
+eai_osal_status_t eai_osal_queue_create_named(eai_osal_queue_t *queue,
+					      size_t msg_size, uint32_t max_msgs,
+					      void *buffer, const char *name);
 eai_osal_status_t eai_osal_queue_destroy(eai_osal_queue_t *queue);
 eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
 				      uint32_t timeout_ms);
 eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
 				      uint32_t timeout_ms);
 
+/*
+ * Batched transfer. Moves several messages per call so bursty producers
+ * and consumers pay the queue's locking and wakeup cost once per batch
+ * instead of once per message. On POSIX a batch is copied under one lock
+ * acquisition with one wakeup; on Zephyr and FreeRTOS it is a loop over the
+ * kernel queue that only the first message of each round waits in.
+ */
+
+/**
+ * @brief Send count messages, waiting for space as needed.
+ *
+ * @param queue      Queue.
+ * @param msgs       count messages of msg_size bytes, back to back.
+ * @param count      Number of messages to send.
+ * @param sent       Optional; receives the number actually sent.
+ * @param timeout_ms Overall time limit for the whole batch.
+ * @return EAI_OSAL_OK if all were sent, EAI_OSAL_TIMEOUT if the timeout
+ *         expired first (*sent tells how many went in, in order).
+ */
+eai_osal_status_t eai_osal_queue_send_many(eai_osal_queue_t *queue,
+					   const void *msgs, uint32_t count,
+					   uint32_t *sent, uint32_t timeout_ms);
+
+/**
+ * @brief Wait for at least one message, then take all queued up to max_msgs.
+ *
+ * @param queue      Queue.
+ * @param msgs       Storage for max_msgs messages.
+ * @param max_msgs   Capacity of msgs in messages.
+ * @param received   Receives the number of messages copied out.
+ * @param timeout_ms Time to wait for the first message.
+ * @return EAI_OSAL_OK if at least one message was received,
+ *         EAI_OSAL_TIMEOUT if the queue stayed empty.
+ */
+eai_osal_status_t eai_osal_queue_recv_many(eai_osal_queue_t *queue, void *msgs,
+					   uint32_t max_msgs, uint32_t *received,
+					   uint32_t timeout_ms);
+
+/**
+ * @brief Keep receiving until max_msgs are collected or the timeout expires.
+ *
+ * Drain mode for consumers that prefer full batches: messages arriving
+ * during the wait are appended to msgs.
+ *
+ * @return EAI_OSAL_OK if max_msgs were received, EAI_OSAL_TIMEOUT otherwise
+ *         (*received may still be non-zero).
+ */
+eai_osal_status_t eai_osal_queue_drain(eai_osal_queue_t *queue, void *msgs,
+				       uint32_t max_msgs, uint32_t *received,
+				       uint32_t timeout_ms);
+
+/*
+ * Zero-copy access. A producer reserves the next slot, builds the message
+ * in place and commits it; a consumer peeks at the oldest message, uses it
+ * in place and releases it. At most one reservation and one peek may be
+ * outstanding per queue at a time.
+ *
+ * On backends whose kernel queue has no in-place access (Zephyr k_msgq,
+ * FreeRTOS queues), the slot is a per-queue staging buffer: commit performs
+ * the send (blocking up to the reserve timeout) and peek performs the
+ * receive. Only the POSIX backend is copy-free. Nothing is allocated on
+ * these calls: FreeRTOS allocates the staging buffers with the queue, and
+ * Zephyr embeds CONFIG_EAI_OSAL_QUEUE_STAGE_SIZE bytes per side in
+ * eai_osal_queue_t (0 by default, which disables reserve/peek there).
+ */
+
+/**
+ * @brief Reserve the next free slot for a message built in place.
+ *
+ * @param queue      Queue.
+ * @param slot       Receives a pointer to msg_size bytes of writable storage.
+ * @param timeout_ms Time to wait for a free slot.
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if full, EAI_OSAL_ERROR if a
+ *         reservation is already outstanding, EAI_OSAL_NO_MEMORY if
+ *         messages do not fit the Zephyr staging buffer.
+ */
+eai_osal_status_t eai_osal_queue_reserve(eai_osal_queue_t *queue, void **slot,
+					 uint32_t timeout_ms);
+
+/**
+ * @brief Publish the slot returned by eai_osal_queue_reserve().
+ *
+ * @return EAI_OSAL_OK, EAI_OSAL_ERROR if slot is not the outstanding
+ *         reservation, EAI_OSAL_TIMEOUT if a staging backend could not
+ *         send within the reserve timeout (the message is dropped).
+ */
+eai_osal_status_t eai_osal_queue_commit(eai_osal_queue_t *queue, void *slot);
+
+/**
+ * @brief Access the oldest message in place without dequeuing it.
+ *
+ * @param queue      Queue.
+ * @param slot       Receives a pointer to the message (msg_size bytes).
+ * @param timeout_ms Time to wait for a message.
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if empty, EAI_OSAL_ERROR if a peek
+ *         is already outstanding, EAI_OSAL_NO_MEMORY if messages do not
+ *         fit the Zephyr staging buffer.
+ */
+eai_osal_status_t eai_osal_queue_peek(eai_osal_queue_t *queue, void **slot,
+				      uint32_t timeout_ms);
+
+/**
+ * @brief Dequeue the message returned by eai_osal_queue_peek().
+ *
+ * @return EAI_OSAL_OK, EAI_OSAL_ERROR if slot is not the outstanding peek.
+ */
+eai_osal_status_t eai_osal_queue_release(eai_osal_queue_t *queue, void *slot);
+
 #endif /* EAI_OSAL_QUEUE_H */
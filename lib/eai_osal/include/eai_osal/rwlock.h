@@ -0,0 +1,42 @@
+#ifndef EAI_OSAL_RWLOCK_H
+#define EAI_OSAL_RWLOCK_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Reader-writer lock with writer preference.
+ *
+ * Any number of readers can hold the lock at the same time, or one
+ * writer can. Once a writer is waiting, new readers queue behind it, so a
+ * steady stream of readers can't starve an update. Readers that already
+ * hold the lock finish first.
+ *
+ * The lock is not recursive. A reader that takes it again while a writer
+ * waits deadlocks, and a read hold can't be upgraded to a write hold.
+ * Unlock from the thread that locked.
+ */
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *rwlock);
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *rwlock);
+
+/**
+ * @brief Take a shared (read) hold.
+ *
+ * @param timeout_ms Time to wait (EAI_OSAL_NO_WAIT, EAI_OSAL_WAIT_FOREVER).
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT while a writer holds or waits.
+ */
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *rwlock,
+					    uint32_t timeout_ms);
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *rwlock);
+
+/**
+ * @brief Take the exclusive (write) hold.
+ *
+ * @param timeout_ms Time to wait (EAI_OSAL_NO_WAIT, EAI_OSAL_WAIT_FOREVER).
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT while readers or a writer hold it.
+ */
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *rwlock,
+					     uint32_t timeout_ms);
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *rwlock);
+
+#endif /* EAI_OSAL_RWLOCK_H */
@@ -5,6 +5,9 @@
 
 eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 				      uint32_t limit);
+/* name keys the CONFIG_EAI_OSAL_STATS record (stats.h); NULL = unlisted */
+eai_osal_status_t eai_osal_sem_create_named(eai_osal_sem_t *sem, uint32_t initial,
+					    uint32_t limit, const char *name);
 eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem);
 eai_osal_status_t eai_osal_sem_give(eai_osal_sem_t *sem);
 eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms);
@@ -0,0 +1,104 @@
+#ifndef EAI_OSAL_SPSC_H
+#define EAI_OSAL_SPSC_H
+
+#include <eai_osal/types.h>
+#include <stdatomic.h>
+
+/*
+ * Lock-free single-producer / single-consumer ring.
+ *
+ * Exactly one thread may push and exactly one thread may pop. Indices are
+ * free-running C11 atomics published with release/acquire ordering, so the
+ * non-blocking paths never take a lock or make a syscall. Capacity must be
+ * a power of two.
+ *
+ * Rings created with blocking = true can also wait for data or space. The
+ * waiting side parks on an OSAL semaphore, and the other side gives that
+ * semaphore only when it sees a waiter. An uncontended push or pop stays
+ * wait-free.
+ */
+
+#if defined(CONFIG_EAI_OSAL_BACKEND_POSIX)
+/* Keep producer and consumer indices on separate cache lines on hosts */
+#define EAI_OSAL_SPSC_ALIGN _Alignas(64)
+#else
+#define EAI_OSAL_SPSC_ALIGN
+#endif
+
+typedef struct {
+	uint8_t *_buf;
+	size_t _elem_size;
+	uint32_t _mask;           /* capacity - 1 */
+	bool _blocking;
+	eai_osal_sem_t _data_sem; /* consumer parks here when empty */
+	eai_osal_sem_t _space_sem; /* producer parks here when full */
+
+	EAI_OSAL_SPSC_ALIGN atomic_uint _head; /* written by producer */
+	atomic_bool _rx_waiting;
+	uint32_t _tail_cache;     /* producer's last view of _tail */
+
+	EAI_OSAL_SPSC_ALIGN atomic_uint _tail; /* written by consumer */
+	atomic_bool _tx_waiting;
+	uint32_t _head_cache;     /* consumer's last view of _head */
+} eai_osal_spsc_ring_t;
+
+/**
+ * @brief Initialize an SPSC ring over caller-provided storage.
+ *
+ * @param ring      Ring to initialize.
+ * @param elem_size Size of one element in bytes.
+ * @param capacity  Number of elements; must be a power of two.
+ * @param buffer    Storage of elem_size * capacity bytes.
+ * @param blocking  Create semaphores so push/pop may wait with a timeout.
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM on bad arguments.
+ */
+eai_osal_status_t eai_osal_spsc_create(eai_osal_spsc_ring_t *ring,
+				       size_t elem_size, uint32_t capacity,
+				       void *buffer, bool blocking);
+eai_osal_status_t eai_osal_spsc_destroy(eai_osal_spsc_ring_t *ring);
+
+/**
+ * @brief Push one element (producer only).
+ *
+ * @param timeout_ms Time to wait for space; must be EAI_OSAL_NO_WAIT on
+ *                   non-blocking rings.
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if full.
+ */
+eai_osal_status_t eai_osal_spsc_push(eai_osal_spsc_ring_t *ring,
+				     const void *elem, uint32_t timeout_ms);
+
+/**
+ * @brief Pop one element (consumer only).
+ *
+ * @param timeout_ms Time to wait for data; must be EAI_OSAL_NO_WAIT on
+ *                   non-blocking rings.
+ * @return EAI_OSAL_OK, EAI_OSAL_TIMEOUT if empty.
+ */
+eai_osal_status_t eai_osal_spsc_pop(eai_osal_spsc_ring_t *ring, void *elem,
+				    uint32_t timeout_ms);
+
+/**
+ * @brief Push up to n elements without blocking (producer only).
+ *
+ * Copies in at most two memcpy segments and publishes them with a single
+ * index update.
+ *
+ * @return Number of elements written.
+ */
+uint32_t eai_osal_spsc_write(eai_osal_spsc_ring_t *ring, const void *elems,
+			     uint32_t n);
+
+/**
+ * @brief Pop up to n elements without blocking (consumer only).
+ *
+ * @return Number of elements read.
+ */
+uint32_t eai_osal_spsc_read(eai_osal_spsc_ring_t *ring, void *elems, uint32_t n);
+
+/** @brief Elements currently queued (a snapshot when called concurrently). */
+uint32_t eai_osal_spsc_count(eai_osal_spsc_ring_t *ring);
+
+/** @brief Free slots (a snapshot when called concurrently). */
+uint32_t eai_osal_spsc_space(eai_osal_spsc_ring_t *ring);
+
+#endif /* EAI_OSAL_SPSC_H */
@@ -0,0 +1,88 @@
+#ifndef EAI_OSAL_STATS_H
+#define EAI_OSAL_STATS_H
+
+#include <eai_osal/types.h>
+
+/*
+ * Wait-time statistics for mutexes, semaphores, queues, and events.
+ *
+ * Built only with CONFIG_EAI_OSAL_STATS. Every object then counts its
+ * successful acquires (lock, take, send/recv, wait) and how long each one
+ * blocked, using atomics in the object itself — no lock is shared between
+ * objects. Objects created with a name (eai_osal_mutex_create_named() and
+ * friends) are also listed in a registry for eai_osal_stats_foreach();
+ * destroy them before their memory goes away. Unnamed objects still count
+ * but are not listed.
+ *
+ * With the option off, objects carry no counters and these calls compile
+ * to nothing.
+ */
+
+typedef enum {
+	EAI_OSAL_STATS_MUTEX,
+	EAI_OSAL_STATS_SEM,
+	EAI_OSAL_STATS_QUEUE,
+	EAI_OSAL_STATS_EVENT,
+} eai_osal_stats_kind_t;
+
+#ifdef CONFIG_EAI_OSAL_STATS
+
+/**
+ * Snapshot of one object's counters.
+ *
+ * hist[0] counts acquires that waited under 1 us (including those that
+ * did not block at all); hist[i] counts waits in [2^(i-1), 2^i) us, and
+ * the last bucket everything longer.
+ */
+typedef struct {
+	const char *name;
+	eai_osal_stats_kind_t kind;
+	uint32_t acquires;      /**< Successful acquires */
+	uint32_t contended;     /**< Acquires that had to block */
+	uint64_t wait_total_us; /**< Time spent blocked, summed */
+	uint32_t wait_max_us;   /**< Longest single wait */
+	uint32_t hist[EAI_OSAL_STATS_BUCKETS];
+} eai_osal_stats_t;
+
+/** Called once per registered object with a snapshot of its counters. */
+typedef void (*eai_osal_stats_cb_t)(const eai_osal_stats_t *stats, void *arg);
+
+/**
+ * @brief Visit every named object's counters.
+ *
+ * cb runs without any OSAL lock held and may block or print. Objects
+ * created or destroyed during the walk may be missed or visited twice.
+ *
+ * @param cb  Callback, invoked once per object.
+ * @param arg Passed through to cb.
+ */
+void eai_osal_stats_foreach(eai_osal_stats_cb_t cb, void *arg);
+
+/**
+ * @brief Zero the counters of every named object.
+ */
+void eai_osal_stats_reset(void);
+
+/**
+ * @brief Short name for an object kind ("mutex", "sem", "queue", "event").
+ */
+const char *eai_osal_stats_kind_str(eai_osal_stats_kind_t kind);
+
+#else
+
+typedef struct eai_osal_stats eai_osal_stats_t;
+typedef void (*eai_osal_stats_cb_t)(const eai_osal_stats_t *stats, void *arg);
+
+static inline void eai_osal_stats_foreach(eai_osal_stats_cb_t cb, void *arg)
+{
+	(void)cb;
+	(void)arg;
+}
+
+static inline void eai_osal_stats_reset(void)
+{
+}
+
+#endif /* CONFIG_EAI_OSAL_STATS */
+
+#endif /* EAI_OSAL_STATS_H */
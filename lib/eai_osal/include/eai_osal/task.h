@@ -0,0 +1,216 @@
+#ifndef EAI_OSAL_TASK_H
+#define EAI_OSAL_TASK_H
+
+#include <eai_osal/types.h>
+#include <eai_osal/atomic.h>
+#include <eai_osal/event.h>
+#include <eai_osal/poll.h>
+#include <eai_osal/queue.h>
+#include <eai_osal/semaphore.h>
+#include <eai_osal/workqueue.h>
+
+/*
+ * Stackless tasks on work queues.
+ *
+ * A task is a function that runs in steps on a work queue thread. Where a
+ * thread would block, a task awaits instead: the step returns, and once
+ * the semaphore, queue or event is ready or the time is up, the next step
+ * picks up right after the await. Nothing waits on a stack in between, so
+ * any number of tasks can share one work queue thread, at the cost of an
+ * eai_osal_task_t each.
+ *
+ *	static void blink(eai_osal_task_t *task)
+ *	{
+ *		EAI_OSAL_TASK_BEGIN(task);
+ *		for (;;) {
+ *			led_toggle();
+ *			EAI_OSAL_TASK_SLEEP(task, 500);
+ *		}
+ *		EAI_OSAL_TASK_END(task);
+ *	}
+ *
+ * Resumption is a switch on the line of the last await, as in
+ * protothreads, which brings rules:
+ *  - Locals don't survive an await. Keep state in a struct that embeds
+ *    the task (or behind eai_osal_task_arg()).
+ *  - One await per source line, and none inside a switch of the task's
+ *    own.
+ *  - A step must not block; it holds up every task on its queue.
+ *  - A sleep or await that ends on a full work queue resumes once there
+ *    is room, retried every millisecond or tick; a yield that finds it
+ *    full carries straight on.
+ *
+ * A task runs only on the work queue it was started on, one step at a
+ * time. It finishes at EAI_OSAL_TASK_END() or on any return that isn't
+ * an await, and may then be started again. Await timeouts span the whole
+ * await, however many times a racing consumer forces it to park again.
+ */
+
+typedef struct eai_osal_task eai_osal_task_t;
+
+/** Task body, written between EAI_OSAL_TASK_BEGIN() and EAI_OSAL_TASK_END(). */
+typedef void (*eai_osal_task_fn_t)(eai_osal_task_t *task);
+
+struct eai_osal_task {
+	eai_osal_task_fn_t _fn;
+	void *_arg;
+	eai_osal_workqueue_t *_wq;    /* NULL = system work queue */
+	uint32_t _line;               /* where the next step resumes, 0 = top */
+	eai_osal_atomic_t _state;     /* OSAL_TASK_* in task.c */
+	uint32_t _start_ms;           /* when the current await began */
+	uint32_t _timeout_ms;
+	eai_osal_poll_event_t _entry; /* what the current await parks on */
+	eai_osal_work_poll_t _poll;   /* resumes a parked await */
+	eai_osal_dwork_t _sleep;      /* resumes a sleep */
+	eai_osal_work_t _step;        /* first step and yields */
+};
+
+/**
+ * @brief Initialize a task.
+ *
+ * @param task Task to initialize.
+ * @param fn   Task body.
+ * @param arg  Returned by eai_osal_task_arg().
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM if task or fn is NULL,
+ *         EAI_OSAL_NO_MEMORY if its timers can't be created (FreeRTOS).
+ */
+eai_osal_status_t eai_osal_task_init(eai_osal_task_t *task,
+				     eai_osal_task_fn_t fn, void *arg);
+
+/**
+ * @brief Run a task from the top on a work queue.
+ *
+ * @param task Initialized task that isn't running.
+ * @param wq   Work queue to run on, or NULL for the system work queue.
+ * @return EAI_OSAL_OK, EAI_OSAL_ERROR if the task is still running or the
+ *         first step can't be queued, EAI_OSAL_INVALID_PARAM if task is NULL.
+ */
+eai_osal_status_t eai_osal_task_start(eai_osal_task_t *task,
+				      eai_osal_workqueue_t *wq);
+
+/** @brief True once a started task has finished. */
+bool eai_osal_task_is_done(const eai_osal_task_t *task);
+
+static inline void *eai_osal_task_arg(eai_osal_task_t *task)
+{
+	return task->_arg;
+}
+
+/* ── Task body macros ─────────────────────────────────────────────────── */
+
+/* Resume points are case labels that the first pass falls into */
+#if defined(__has_attribute)
+#if __has_attribute(fallthrough)
+#define OSAL_TASK_FALLTHROUGH __attribute__((fallthrough))
+#endif
+#endif
+#ifndef OSAL_TASK_FALLTHROUGH
+#define OSAL_TASK_FALLTHROUGH do { } while (0)
+#endif
+
+#define EAI_OSAL_TASK_BEGIN(task) \
+	switch ((task)->_line) {  \
+	case 0:
+
+#define EAI_OSAL_TASK_END(task) \
+	}                        \
+	(task)->_line = 0
+
+/** Finish the task here. */
+#define EAI_OSAL_TASK_EXIT(task) \
+	do {                     \
+		(task)->_line = 0; \
+		return;            \
+	} while (0)
+
+/** Let the other work on the queue run, then carry on. */
+#define EAI_OSAL_TASK_YIELD(task)             \
+	do {                                  \
+		(task)->_line = __LINE__;     \
+		if (osal_task_yield(task)) {  \
+			return;               \
+		}                             \
+		OSAL_TASK_FALLTHROUGH;        \
+	case __LINE__:;                       \
+	} while (0)
+
+/** Carry on after ms milliseconds; 0 yields. */
+#define EAI_OSAL_TASK_SLEEP(task, ms)               \
+	do {                                        \
+		(task)->_line = __LINE__;           \
+		if (osal_task_sleep((task), (ms))) { \
+			return;                     \
+		}                                   \
+		OSAL_TASK_FALLTHROUGH;              \
+	case __LINE__:;                             \
+	} while (0)
+
+/**
+ * Take a semaphore; ret (an eai_osal_status_t lvalue) gets
+ * eai_osal_sem_take()'s result.
+ */
+#define EAI_OSAL_TASK_AWAIT_SEM(task, sem, timeout_ms, ret)                     \
+	do {                                                                    \
+		osal_task_await_begin((task), (timeout_ms));                    \
+		(task)->_line = __LINE__;                                       \
+		OSAL_TASK_FALLTHROUGH;                                          \
+	case __LINE__:                                                          \
+		(ret) = eai_osal_sem_take((sem), EAI_OSAL_NO_WAIT);             \
+		if ((ret) == EAI_OSAL_TIMEOUT &&                                \
+		    ((ret) = osal_task_park_sem((task), (sem))) == EAI_OSAL_OK) { \
+			return;                                                 \
+		}                                                               \
+	} while (0)
+
+/**
+ * Receive from a queue into msg; ret gets eai_osal_queue_recv()'s result.
+ * The copy happens in the task's own step, so msg may point at a local.
+ */
+#define EAI_OSAL_TASK_AWAIT_QUEUE(task, queue, msg, timeout_ms, ret)            \
+	do {                                                                    \
+		osal_task_await_begin((task), (timeout_ms));                    \
+		(task)->_line = __LINE__;                                       \
+		OSAL_TASK_FALLTHROUGH;                                          \
+	case __LINE__:                                                          \
+		(ret) = eai_osal_queue_recv((queue), (msg), EAI_OSAL_NO_WAIT);  \
+		if ((ret) == EAI_OSAL_TIMEOUT &&                                \
+		    ((ret) = osal_task_park_queue((task), (queue))) == EAI_OSAL_OK) { \
+			return;                                                 \
+		}                                                               \
+	} while (0)
+
+/**
+ * Wait for event bits, as eai_osal_event_wait(); actual (uint32_t *, may
+ * be NULL) gets the bits seen, ret the result.
+ */
+#define EAI_OSAL_TASK_AWAIT_EVENT(task, event, bits, wait_all, actual, timeout_ms, ret) \
+	do {                                                                    \
+		osal_task_await_begin((task), (timeout_ms));                    \
+		(task)->_line = __LINE__;                                       \
+		OSAL_TASK_FALLTHROUGH;                                          \
+	case __LINE__:                                                          \
+		(ret) = eai_osal_event_wait((event), (bits), (wait_all), (actual), \
+					    EAI_OSAL_NO_WAIT);                  \
+		if ((ret) == EAI_OSAL_TIMEOUT &&                                \
+		    ((ret) = osal_task_park_event((task), (event), (bits),      \
+						  (wait_all))) == EAI_OSAL_OK) { \
+			return;                                                 \
+		}                                                               \
+	} while (0)
+
+/*
+ * Macro plumbing (task.c). The park helpers return EAI_OSAL_OK once the
+ * task is parked and its step must return, EAI_OSAL_TIMEOUT when the
+ * await's time is up, or EAI_OSAL_ERROR if it can't be parked.
+ */
+bool osal_task_yield(eai_osal_task_t *task);
+bool osal_task_sleep(eai_osal_task_t *task, uint32_t ms);
+void osal_task_await_begin(eai_osal_task_t *task, uint32_t timeout_ms);
+eai_osal_status_t osal_task_park_sem(eai_osal_task_t *task, eai_osal_sem_t *sem);
+eai_osal_status_t osal_task_park_queue(eai_osal_task_t *task,
+				       eai_osal_queue_t *queue);
+eai_osal_status_t osal_task_park_event(eai_osal_task_t *task,
+				       eai_osal_event_t *event, uint32_t bits,
+				       bool wait_all);
+
+#endif /* EAI_OSAL_TASK_H */
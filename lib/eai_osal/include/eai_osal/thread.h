@@ -12,7 +12,68 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 					 uint8_t priority);
 eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 				       uint32_t timeout_ms);
+/*
+ * Pin a thread to the CPUs in cpu_mask (bit n = CPU n). Bits past the
+ * CPU count are ignored; no usable CPU is EAI_OSAL_INVALID_PARAM. Where
+ * a running thread can't be re-pinned, only a mask covering every CPU
+ * succeeds (as a no-op) and anything narrower is EAI_OSAL_ERROR.
+ */
+eai_osal_status_t eai_osal_thread_set_affinity(eai_osal_thread_t *thread,
+					       uint32_t cpu_mask);
 void eai_osal_thread_sleep(uint32_t ms);
 void eai_osal_thread_yield(void);
 
+/*
+ * CPU and stack use of OSAL-created threads.
+ *
+ * A thread is listed from eai_osal_thread_create() until its entry
+ * function returns. Fields the kernel does not track read 0:
+ *
+ * - Zephyr: runtime needs CONFIG_THREAD_RUNTIME_STATS, switches
+ *   CONFIG_SCHED_THREAD_USAGE_ANALYSIS, and stack_used CONFIG_INIT_STACKS
+ *   with CONFIG_THREAD_STACK_INFO (CONFIG_EAI_OSAL_THREAD_STATS selects
+ *   them all).
+ * - FreeRTOS: runtime needs configGENERATE_RUN_TIME_STATS and
+ *   configUSE_TRACE_FACILITY; switches are not counted.
+ * - POSIX: Linux only. Reads the thread's CPU clock and context switch
+ *   counters, and paints its stack when it starts.
+ */
+
+#define EAI_OSAL_THREAD_NAME_MAX 16
+
+/** Snapshot of one thread's CPU and stack use. */
+typedef struct {
+	char name[EAI_OSAL_THREAD_NAME_MAX];
+	uint64_t runtime_ns; /**< CPU time consumed so far */
+	uint32_t switches;   /**< Times the thread was switched in */
+	size_t stack_size;   /**< Stack size in bytes */
+	size_t stack_used;   /**< Most stack ever in use (high-water mark), bytes */
+} eai_osal_thread_stats_t;
+
+/** Called once per listed thread with a snapshot of its stats. */
+typedef void (*eai_osal_thread_stats_cb_t)(const eai_osal_thread_stats_t *stats,
+					   void *arg);
+
+/**
+ * @brief Read one thread's CPU and stack use.
+ *
+ * @param thread Thread created with eai_osal_thread_create().
+ * @param stats  Filled in on success.
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM on NULL arguments, or
+ *         EAI_OSAL_ERROR once the thread's entry function has returned.
+ */
+eai_osal_status_t eai_osal_thread_get_stats(eai_osal_thread_t *thread,
+					    eai_osal_thread_stats_t *stats);
+
+/**
+ * @brief Visit every listed OSAL thread.
+ *
+ * cb runs without any OSAL lock held and may block or print. Threads
+ * created or exiting during the walk may be missed or visited twice.
+ *
+ * @param cb  Callback, invoked once per thread.
+ * @param arg Passed through to cb.
+ */
+void eai_osal_thread_foreach(eai_osal_thread_stats_cb_t cb, void *arg);
+
 #endif /* EAI_OSAL_THREAD_H */
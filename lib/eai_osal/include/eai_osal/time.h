@@ -4,7 +4,19 @@
 #include <eai_osal/types.h>
 
 uint32_t eai_osal_time_get_ms(void);
+uint64_t eai_osal_time_get_us(void);
+uint64_t eai_osal_time_get_ns(void);
 uint64_t eai_osal_time_get_ticks(void);
 uint32_t eai_osal_time_ticks_to_ms(uint64_t ticks);
 
+/*
+ * Free-running cycle counter for timing short intervals: the cheapest
+ * read each backend has (CPU/system timer cycles on Zephyr and FreeRTOS,
+ * CLOCK_MONOTONIC ns on POSIX). Wraps at 32 bits — take the difference
+ * of two reads, then convert. On ESP32 the count is per core, so take
+ * both reads from the same task without migrating.
+ */
+uint32_t eai_osal_cycle_get(void);
+uint64_t eai_osal_cycles_to_ns(uint32_t cycles);
+
 #endif /* EAI_OSAL_TIME_H */
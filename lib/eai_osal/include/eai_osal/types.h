@@ -25,6 +25,42 @@ typedef void (*eai_osal_thread_entry_t)(void *arg);
 /** Work item callback. Invoked from the work queue's thread context. */
 typedef void (*eai_osal_work_cb_t)(void *arg);
 
+/** Work queue counters, see eai_osal_workqueue_get_stats(). */
+typedef struct {
+	uint32_t depth;          /**< Capacity in items, 0 = unbounded */
+	uint32_t pending;        /**< Items queued and not yet started */
+	uint32_t high_water;     /**< Most items ever queued at once */
+	uint32_t rejected;       /**< Submits refused because the queue was full */
+	uint32_t max_latency_us; /**< Longest submit-to-start delay */
+} eai_osal_workqueue_stats_t;
+
+/** Block pool counters, see eai_osal_mempool_get_stats(). */
+typedef struct {
+	uint32_t block_size; /**< Bytes per block */
+	uint32_t n_blocks;   /**< Blocks in the pool */
+	uint32_t used;       /**< Blocks currently allocated */
+	uint32_t high_water; /**< Most blocks ever allocated at once */
+	uint32_t failures;   /**< Allocs that timed out on an empty pool */
+} eai_osal_mempool_stats_t;
+
+#ifdef CONFIG_EAI_OSAL_STATS
+/** Wait-time histogram buckets, see eai_osal_stats_t. */
+#define EAI_OSAL_STATS_BUCKETS 20
+
+/* Per-object wait counters embedded in each sync object (stats.c) */
+struct osal_stats_rec {
+	const char *name;
+	struct osal_stats_rec *next; /* registry link, named objects only */
+	uint8_t kind;                /* eai_osal_stats_kind_t */
+	uint32_t acquires;
+	uint32_t contended;
+	uint32_t wait_total_lo;      /* 64-bit total as two atomic words */
+	uint32_t wait_total_hi;
+	uint32_t wait_max_us;
+	uint32_t hist[EAI_OSAL_STATS_BUCKETS];
+};
+#endif
+
 /* Backend type dispatch — pulls in eai_osal_mutex_t, eai_osal_sem_t, etc. */
 #if defined(CONFIG_EAI_OSAL_BACKEND_ZEPHYR)
 #include "../../src/zephyr/types.h"
@@ -2,6 +2,41 @@
 #define EAI_OSAL_WORKQUEUE_H
 
 #include <eai_osal/types.h>
+#include <eai_osal/pqueue.h>
+#include <eai_osal/poll.h>
+
+/*
+ * Work queues on POSIX and FreeRTOS copy {callback, arg} into a bounded
+ * queue: a submit that finds it full is rejected with EAI_OSAL_TIMEOUT
+ * (or, with eai_osal_work_submit_timeout(), waits for room first), by
+ * every submit variant. Zephyr links the
+ * k_work item itself into an unbounded list, so depth is ignored there and
+ * submits are never rejected for lack of room.
+ *
+ * Delayed work whose delay ends on a full queue isn't dropped: POSIX and
+ * FreeRTOS retry it from its timer every millisecond or tick until it
+ * fits, and eai_osal_dwork_cancel() stops the retries too. The stats
+ * count it as one rejected submit, however many retries it takes.
+ *
+ * Every work queue, including the system one, keeps counters that cost
+ * a few atomic ops per item. On Zephyr they cover eai_osal_work_t only,
+ * not delayed or triggered work.
+ *
+ * POSIX and FreeRTOS queues are eai_osal_pqueue_t priority queues: work
+ * submitted with eai_osal_work_submit_prio() at a higher level runs
+ * before everything queued below it, and plain submits and delayed work
+ * go in at EAI_OSAL_WORK_PRIO_DEFAULT. Zephyr's k_work queues are strict
+ * FIFO, so there the level is ignored; give urgent work its own
+ * higher-priority work queue instead.
+ */
+
+/** Depth of the system work queue and of eai_osal_workqueue_create() queues. */
+#ifndef EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH
+#define EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH 16
+#endif
+
+/** Level of plain submits; levels run 0 (lowest) to EAI_OSAL_PQUEUE_LEVELS - 1. */
+#define EAI_OSAL_WORK_PRIO_DEFAULT 0
 
 /**
  * @brief Initialize a work item.
@@ -19,7 +54,11 @@ eai_osal_status_t eai_osal_work_init(eai_osal_work_t *work,
  * @brief Submit work to the system work queue.
  *
  * @param work Work item to submit.
- * @return EAI_OSAL_OK if submitted, EAI_OSAL_ERROR if already pending.
+ * @return EAI_OSAL_OK if submitted (on Zephyr, also if it was already
+ *         queued), EAI_OSAL_TIMEOUT if the queue is full (POSIX, FreeRTOS),
+ *         EAI_OSAL_INVALID_PARAM if work is NULL, EAI_OSAL_ERROR if the
+ *         system queue could not be started or, on Zephyr, the item is
+ *         being cancelled.
  */
 eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work);
 
@@ -28,11 +67,43 @@ eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work);
  *
  * @param work Work item to submit.
  * @param wq   Target work queue.
- * @return EAI_OSAL_OK if submitted, EAI_OSAL_ERROR if already pending.
+ * @return EAI_OSAL_OK if submitted (on Zephyr, also if it was already
+ *         queued), EAI_OSAL_TIMEOUT if the queue is full (POSIX, FreeRTOS),
+ *         EAI_OSAL_INVALID_PARAM on NULL args, EAI_OSAL_ERROR on Zephyr if
+ *         the item is being cancelled or the queue is draining.
  */
 eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
 					  eai_osal_workqueue_t *wq);
 
+/**
+ * @brief Submit work, waiting up to timeout_ms for room in the queue.
+ *
+ * @param work       Work item to submit.
+ * @param wq         Target work queue, or NULL for the system work queue.
+ * @param timeout_ms Time to wait for room (EAI_OSAL_NO_WAIT, EAI_OSAL_WAIT_FOREVER).
+ * @return EAI_OSAL_OK if submitted, EAI_OSAL_TIMEOUT if the queue stayed
+ *         full, EAI_OSAL_INVALID_PARAM if work is NULL.
+ */
+eai_osal_status_t eai_osal_work_submit_timeout(eai_osal_work_t *work,
+					       eai_osal_workqueue_t *wq,
+					       uint32_t timeout_ms);
+
+/**
+ * @brief Submit work ahead of everything queued at a lower level.
+ *
+ * Items at the same level run in submit order. Like eai_osal_work_submit(),
+ * this never waits for room.
+ *
+ * @param work Work item to submit.
+ * @param wq   Target work queue, or NULL for the system work queue.
+ * @param prio Level, EAI_OSAL_WORK_PRIO_DEFAULT to EAI_OSAL_PQUEUE_LEVELS - 1.
+ * @return EAI_OSAL_OK if submitted, EAI_OSAL_TIMEOUT if the queue is full,
+ *         EAI_OSAL_INVALID_PARAM if work is NULL or prio is out of range.
+ */
+eai_osal_status_t eai_osal_work_submit_prio(eai_osal_work_t *work,
+					    eai_osal_workqueue_t *wq,
+					    uint8_t prio);
+
 /**
  * @brief Initialize a delayed work item.
  *
@@ -48,9 +119,15 @@ eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
 /**
  * @brief Submit delayed work to the system work queue.
  *
+ * Submitting an item that is still waiting restarts its delay on POSIX
+ * and FreeRTOS; Zephyr keeps the deadline it already has.
+ *
  * @param dwork    Delayed work item.
  * @param delay_ms Delay in milliseconds before execution.
- * @return EAI_OSAL_OK if submitted, EAI_OSAL_ERROR if already pending.
+ * @return EAI_OSAL_OK if scheduled, EAI_OSAL_INVALID_PARAM if dwork is
+ *         NULL, EAI_OSAL_ERROR if the system queue or the POSIX timer
+ *         service could not be started, EAI_OSAL_NO_MEMORY if the POSIX
+ *         timer heap is full.
  */
 eai_osal_status_t eai_osal_dwork_submit(eai_osal_dwork_t *dwork,
 					uint32_t delay_ms);
@@ -61,7 +138,10 @@ eai_osal_status_t eai_osal_dwork_submit(eai_osal_dwork_t *dwork,
  * @param dwork    Delayed work item.
  * @param wq       Target work queue.
  * @param delay_ms Delay in milliseconds before execution.
- * @return EAI_OSAL_OK if submitted, EAI_OSAL_ERROR if already pending.
+ * @return EAI_OSAL_OK if scheduled, EAI_OSAL_INVALID_PARAM on NULL args,
+ *         EAI_OSAL_ERROR if the POSIX timer service could not be started
+ *         or, on Zephyr, the item is being cancelled, EAI_OSAL_NO_MEMORY
+ *         if the POSIX timer heap is full.
  */
 eai_osal_status_t eai_osal_dwork_submit_to(eai_osal_dwork_t *dwork,
 					   eai_osal_workqueue_t *wq,
@@ -75,6 +155,57 @@ eai_osal_status_t eai_osal_dwork_submit_to(eai_osal_dwork_t *dwork,
  */
 eai_osal_status_t eai_osal_dwork_cancel(eai_osal_dwork_t *dwork);
 
+/*
+ * Triggered work runs its callback once on a work queue, as soon as any of
+ * a set of poll entries is ready or a timeout passes, like Zephyr's
+ * k_work_poll. No thread blocks in the meantime. When the callback runs,
+ * every entry's ready flag is fresh; none set means the timeout passed.
+ * Readiness is reported, not consumed, as with eai_osal_poll().
+ *
+ * The entries must stay valid until the callback starts or cancel
+ * succeeds. Zephyr copies them into k_poll events, so there n is at most
+ * CONFIG_EAI_OSAL_POLL_MAX_EVENTS. On POSIX and FreeRTOS a trigger that
+ * finds the queue full is retried from a timer every millisecond or tick
+ * until it fits, as delayed work is.
+ */
+
+/**
+ * @brief Initialize a triggered work item.
+ *
+ * @param wp       Triggered work item to initialize.
+ * @param callback Function to call when it fires.
+ * @param arg      Argument passed to callback.
+ * @return EAI_OSAL_OK, EAI_OSAL_INVALID_PARAM if wp or callback is NULL,
+ *         EAI_OSAL_NO_MEMORY if its timer can't be created (FreeRTOS).
+ */
+eai_osal_status_t eai_osal_work_poll_init(eai_osal_work_poll_t *wp,
+					  eai_osal_work_cb_t callback,
+					  void *arg);
+
+/**
+ * @brief Arm triggered work on a set of poll entries.
+ *
+ * @param wp         Initialized triggered work item, not already armed.
+ * @param wq         Target work queue, or NULL for the system work queue.
+ * @param events     Entries to watch, as for eai_osal_poll().
+ * @param n          Number of entries (at least 1).
+ * @param timeout_ms Time after which the callback runs anyway.
+ * @return EAI_OSAL_OK if armed, EAI_OSAL_ERROR if it is still armed or
+ *         queued, EAI_OSAL_INVALID_PARAM on bad entries.
+ */
+eai_osal_status_t eai_osal_work_poll_submit(eai_osal_work_poll_t *wp,
+					    eai_osal_workqueue_t *wq,
+					    eai_osal_poll_event_t *events,
+					    size_t n, uint32_t timeout_ms);
+
+/**
+ * @brief Disarm triggered work before it fires.
+ *
+ * @return EAI_OSAL_OK if disarmed, EAI_OSAL_ERROR if it was not armed or
+ *         has already been queued (its callback will still run).
+ */
+eai_osal_status_t eai_osal_work_poll_cancel(eai_osal_work_poll_t *wp);
+
 /**
  * @brief Create a custom work queue with its own thread.
  *
@@ -91,4 +222,95 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 					    size_t stack_size,
 					    uint8_t priority);
 
+/**
+ * @brief Create a custom work queue that holds up to depth pending items.
+ *
+ * @param wq         Work queue to initialize.
+ * @param name       Thread name (for debug).
+ * @param stack      Stack defined via EAI_OSAL_THREAD_STACK_DEFINE.
+ * @param stack_size Stack size via EAI_OSAL_THREAD_STACK_SIZEOF.
+ * @param priority   OSAL priority (0-31, higher = higher priority).
+ * @param depth      Queue capacity in items (ignored on Zephyr).
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM on NULL args or
+ *         zero depth, EAI_OSAL_NO_MEMORY if the queue can't be allocated.
+ */
+eai_osal_status_t eai_osal_workqueue_create_with_depth(eai_osal_workqueue_t *wq,
+						       const char *name,
+						       void *stack,
+						       size_t stack_size,
+						       uint8_t priority,
+						       uint32_t depth);
+
+/**
+ * @brief Read a work queue's counters.
+ *
+ * @param wq    Work queue, or NULL for the system work queue.
+ * @param stats Filled with the current counters.
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM if stats is NULL.
+ */
+eai_osal_status_t eai_osal_workqueue_get_stats(eai_osal_workqueue_t *wq,
+					       eai_osal_workqueue_stats_t *stats);
+
+/**
+ * @brief Clear rejected and max latency, and restart high_water from pending.
+ *
+ * @param wq Work queue, or NULL for the system work queue.
+ * @return EAI_OSAL_OK on success.
+ */
+eai_osal_status_t eai_osal_workqueue_reset_stats(eai_osal_workqueue_t *wq);
+
+/*
+ * Work queue pools. A pool runs submitted eai_osal_work_t items on
+ * n_workers threads, so one slow item does not hold up the rest and
+ * independent items run in parallel on multi-core hosts. Items run in no
+ * particular order, but an item never runs concurrently with itself:
+ * submitting an item that is already queued is a no-op, and submitting one
+ * that is running queues it to run again (on the same pool) after its
+ * callback returns. Don't submit one item to both a pool and a plain work
+ * queue.
+ *
+ * POSIX gives each worker a deque and lets idle workers steal. Zephyr runs
+ * one k_work_q per worker (at most CONFIG_EAI_OSAL_WQ_POOL_MAX_WORKERS)
+ * and spreads submissions round-robin. FreeRTOS runs n_workers tasks on
+ * one shared queue.
+ */
+
+/**
+ * @brief Create a pool of worker threads.
+ *
+ * @param pool       Pool to initialize.
+ * @param n_workers  Number of worker threads (at least 1).
+ * @param name       Thread name (for debug).
+ * @param stacks     n_workers stacks via EAI_OSAL_THREAD_STACK_ARRAY_DEFINE.
+ * @param stack_size Size of one stack via EAI_OSAL_THREAD_STACK_SIZEOF(stacks[0]).
+ * @param priority   OSAL priority (0-31, higher = higher priority).
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM on bad args,
+ *         EAI_OSAL_NO_MEMORY or EAI_OSAL_ERROR if resources are unavailable.
+ */
+eai_osal_status_t eai_osal_workqueue_pool_create(eai_osal_workqueue_pool_t *pool,
+						 uint32_t n_workers,
+						 const char *name,
+						 void *stacks,
+						 size_t stack_size,
+						 uint8_t priority);
+
+/**
+ * @brief Finish queued work, then stop and release the pool's workers.
+ *
+ * @param pool Pool to destroy. No submissions may race with destroy.
+ * @return EAI_OSAL_OK on success, EAI_OSAL_INVALID_PARAM if pool is NULL.
+ */
+eai_osal_status_t eai_osal_workqueue_pool_destroy(eai_osal_workqueue_pool_t *pool);
+
+/**
+ * @brief Submit work to a pool.
+ *
+ * @param work Work item to submit.
+ * @param pool Target pool.
+ * @return EAI_OSAL_OK if queued or already pending, EAI_OSAL_TIMEOUT if the
+ *         pool's queue is full (FreeRTOS).
+ */
+eai_osal_status_t eai_osal_work_submit_to_pool(eai_osal_work_t *work,
+					       eai_osal_workqueue_pool_t *pool);
+
 #endif /* EAI_OSAL_WORKQUEUE_H */
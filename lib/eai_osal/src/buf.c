@@ -0,0 +1,195 @@
+#include <eai_osal/buf.h>
+#include <string.h>
+
+/*
+ * Backend-independent buffers — see include/eai_osal/buf.h.
+ *
+ * The header sits at the start of its pool block and the storage follows
+ * it. The reference count is a C11 atomic. The decrement that reaches zero
+ * is acq_rel, so every holder's accesses happen before the block goes back
+ * to the pool. Chains are released iteratively, so a long chain doesn't
+ * recurse.
+ */
+
+eai_osal_status_t eai_buf_pool_create(eai_buf_pool_t *pool, uint32_t n_bufs,
+				      size_t data_size, void *storage)
+{
+	if (pool == NULL || data_size == 0 || data_size > UINT16_MAX) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pool->_data_size = (uint16_t)data_size;
+	return eai_osal_mempool_create(&pool->_blocks, EAI_BUF_BLOCK_SIZE(data_size),
+				       n_bufs, storage);
+}
+
+eai_osal_status_t eai_buf_pool_destroy(eai_buf_pool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return eai_osal_mempool_destroy(&pool->_blocks);
+}
+
+eai_osal_status_t eai_buf_pool_get_stats(eai_buf_pool_t *pool,
+					 eai_osal_mempool_stats_t *stats)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return eai_osal_mempool_get_stats(&pool->_blocks, stats);
+}
+
+eai_osal_status_t eai_buf_alloc(eai_buf_pool_t *pool, eai_buf_t **buf,
+				uint32_t timeout_ms)
+{
+	if (pool == NULL || buf == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	void *block;
+	eai_osal_status_t ret = eai_osal_mempool_alloc(&pool->_blocks, &block,
+						       timeout_ms);
+	if (ret != EAI_OSAL_OK) {
+		return ret;
+	}
+
+	eai_buf_t *b = (eai_buf_t *)block;
+
+	b->frags = NULL;
+	b->_storage = (uint8_t *)(b + 1);
+	b->data = b->_storage;
+	b->len = 0;
+	b->size = pool->_data_size;
+	b->_pool = pool;
+	atomic_init(&b->_ref, 1);
+
+	*buf = b;
+	return EAI_OSAL_OK;
+}
+
+eai_buf_t *eai_buf_ref(eai_buf_t *buf)
+{
+	atomic_fetch_add_explicit(&buf->_ref, 1, memory_order_relaxed);
+	return buf;
+}
+
+void eai_buf_unref(eai_buf_t *buf)
+{
+	while (buf != NULL &&
+	       atomic_fetch_sub_explicit(&buf->_ref, 1, memory_order_acq_rel) == 1) {
+		eai_buf_t *next = buf->frags;
+
+		eai_osal_mempool_free(&buf->_pool->_blocks, buf);
+		buf = next;
+	}
+}
+
+eai_osal_status_t eai_buf_reserve(eai_buf_t *buf, size_t headroom)
+{
+	if (buf->len != 0) {
+		return EAI_OSAL_ERROR;
+	}
+	if (headroom > (size_t)(buf->_storage + buf->size - buf->data)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	buf->data += headroom;
+	return EAI_OSAL_OK;
+}
+
+size_t eai_buf_headroom(const eai_buf_t *buf)
+{
+	return (size_t)(buf->data - buf->_storage);
+}
+
+size_t eai_buf_tailroom(const eai_buf_t *buf)
+{
+	return buf->size - eai_buf_headroom(buf) - buf->len;
+}
+
+void *eai_buf_add(eai_buf_t *buf, size_t len)
+{
+	if (len > eai_buf_tailroom(buf)) {
+		return NULL;
+	}
+
+	uint8_t *tail = buf->data + buf->len;
+
+	buf->len += (uint16_t)len;
+	return tail;
+}
+
+eai_osal_status_t eai_buf_add_mem(eai_buf_t *buf, const void *mem, size_t len)
+{
+	void *dst = eai_buf_add(buf, len);
+
+	if (dst == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+	memcpy(dst, mem, len);
+	return EAI_OSAL_OK;
+}
+
+void *eai_buf_push(eai_buf_t *buf, size_t len)
+{
+	if (len > eai_buf_headroom(buf)) {
+		return NULL;
+	}
+	buf->data -= len;
+	buf->len += (uint16_t)len;
+	return buf->data;
+}
+
+void *eai_buf_pull(eai_buf_t *buf, size_t len)
+{
+	if (len > buf->len) {
+		return NULL;
+	}
+	buf->data += len;
+	buf->len -= (uint16_t)len;
+	return buf->data;
+}
+
+/* ── Fragment chains ──────────────────────────────────────────────────── */
+
+void eai_buf_frag_add(eai_buf_t *head, eai_buf_t *frag)
+{
+	while (head->frags != NULL) {
+		head = head->frags;
+	}
+	head->frags = frag;
+}
+
+size_t eai_buf_chain_len(const eai_buf_t *buf)
+{
+	size_t total = 0;
+
+	for (; buf != NULL; buf = buf->frags) {
+		total += buf->len;
+	}
+	return total;
+}
+
+size_t eai_buf_linearize(const eai_buf_t *buf, void *dst, size_t offset,
+			 size_t len)
+{
+	uint8_t *out = (uint8_t *)dst;
+	size_t copied = 0;
+
+	for (; buf != NULL && copied < len; buf = buf->frags) {
+		if (offset >= buf->len) {
+			offset -= buf->len;
+			continue;
+		}
+
+		size_t n = buf->len - offset;
+
+		if (n > len - copied) {
+			n = len - copied;
+		}
+		memcpy(out + copied, buf->data + offset, n);
+		copied += n;
+		offset = 0;
+	}
+	return copied;
+}
@@ -1,15 +1,24 @@
 #include <eai_osal/event.h>
 #include "internal.h"
+#include "../stats_internal.h"
 
 eai_osal_status_t eai_osal_event_create(eai_osal_event_t *event)
+{
+	return eai_osal_event_create_named(event, NULL);
+}
+
+eai_osal_status_t eai_osal_event_create_named(eai_osal_event_t *event,
+					      const char *name)
 {
 	if (event == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	event->_pollers = NULL;
 	event->_handle = xEventGroupCreate();
 	if (event->_handle == NULL) {
 		return EAI_OSAL_NO_MEMORY;
 	}
+	OSAL_STATS_INIT(event, EAI_OSAL_STATS_EVENT, name);
 	return EAI_OSAL_OK;
 }
 
@@ -18,6 +27,7 @@ eai_osal_status_t eai_osal_event_destroy(eai_osal_event_t *event)
 	if (event == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(event);
 	if (event->_handle != NULL) {
 		vEventGroupDelete(event->_handle);
 		event->_handle = NULL;
@@ -31,6 +41,7 @@ eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits)
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	xEventGroupSetBits(event->_handle, (EventBits_t)bits);
+	osal_poll_notify(&event->_pollers);
 	return EAI_OSAL_OK;
 }
 
@@ -42,12 +53,24 @@ eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
+	TickType_t ticks = osal_ticks(timeout_ms);
+	uint32_t t0 = 0;
+
+	/* Stats: only a wait that has to block is timed */
+	if (OSAL_STATS_ENABLED && ticks != 0) {
+		EventBits_t now = xEventGroupGetBits(event->_handle);
+
+		if (wait_all ? (now & bits) != bits : (now & bits) == 0) {
+			t0 = OSAL_STATS_STAMP();
+		}
+	}
+
 	EventBits_t result = xEventGroupWaitBits(
 		event->_handle,
 		(EventBits_t)bits,
 		pdFALSE, /* xClearOnExit = no auto-clear */
 		wait_all ? pdTRUE : pdFALSE,
-		osal_ticks(timeout_ms));
+		ticks);
 
 	/* Check if the requested bits are actually set */
 	if (wait_all) {
@@ -59,6 +82,7 @@ eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 			return EAI_OSAL_TIMEOUT;
 		}
 	}
+	OSAL_STATS_RECORD(event, t0);
 
 	if (actual != NULL) {
 		*actual = (uint32_t)(result & bits);
@@ -2,7 +2,9 @@
 #define EAI_OSAL_FREERTOS_INTERNAL_H
 
 #include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
 #include <eai_osal/types.h>
+#include <eai_osal/poll.h>
 
 static inline TickType_t osal_ticks(uint32_t ms)
 {
@@ -27,4 +29,30 @@ static inline UBaseType_t osal_priority(uint8_t prio)
 	return 1 + (prio * (configMAX_PRIORITIES - 2)) / 31;
 }
 
+/* Wrapping microsecond clock for wait-time stats (stats_internal.h) */
+static inline uint32_t osal_now_us(void)
+{
+	return (uint32_t)esp_timer_get_time();
+}
+
+/*
+ * eai_osal_poll() support (poll.c): semaphores, queues, and event groups
+ * call osal_poll_notify() on their _pollers list after any change that
+ * can make them ready.
+ */
+void osal_poll_notify(struct osal_poll_node *volatile *pollers);
+
+/*
+ * Poll entry helpers, shared with triggered work (workqueue.c). scan
+ * refreshes each entry's ready flag; any_ready only reads, for callers
+ * that may race the entries' owner. register/unregister take poll_lock,
+ * and register fences after linking, as osal_poll_notify() expects.
+ */
+bool osal_poll_valid(const eai_osal_poll_event_t *events, size_t n);
+bool osal_poll_scan(eai_osal_poll_event_t *events, size_t n);
+bool osal_poll_any_ready(const eai_osal_poll_event_t *events, size_t n);
+void osal_poll_register(eai_osal_poll_event_t *events, size_t n,
+			struct osal_poller *poller);
+void osal_poll_unregister(eai_osal_poll_event_t *events, size_t n);
+
 #endif /* EAI_OSAL_FREERTOS_INTERNAL_H */
@@ -0,0 +1,140 @@
+#include <eai_osal/mempool.h>
+#include <eai_osal/critical.h>
+#include "internal.h"
+
+/*
+ * FreeRTOS block pool. Free blocks are linked through their first word
+ * and the list is only touched inside the OSAL critical section, which is
+ * a few instructions long. _avail counts free blocks: free pushes before
+ * it gives and alloc takes before it pops, so a successful take always
+ * finds a block on the list.
+ */
+
+eai_osal_status_t eai_osal_mempool_create(eai_osal_mempool_t *pool,
+					  size_t block_size, uint32_t n_blocks,
+					  void *buffer)
+{
+	if (pool == NULL || buffer == NULL || n_blocks == 0 || block_size == 0 ||
+	    block_size % sizeof(void *) != 0 ||
+	    (uintptr_t)buffer % sizeof(void *) != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pool->_avail = xSemaphoreCreateCounting(n_blocks, n_blocks);
+	if (pool->_avail == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+
+	pool->_buf = (uint8_t *)buffer;
+	pool->_block_size = block_size;
+	pool->_n_blocks = n_blocks;
+	pool->_used = 0;
+	pool->_high_water = 0;
+	pool->_failures = 0;
+
+	/* Link back to front, so a fresh pool hands blocks out in address order */
+	pool->_free = NULL;
+	for (uint32_t i = n_blocks; i > 0; i--) {
+		void **blk = (void **)(pool->_buf + (size_t)(i - 1) * block_size);
+
+		*blk = pool->_free;
+		pool->_free = blk;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_destroy(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (pool->_avail != NULL) {
+		vSemaphoreDelete(pool->_avail);
+		pool->_avail = NULL;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_alloc(eai_osal_mempool_t *pool, void **block,
+					 uint32_t timeout_ms)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	if (xSemaphoreTake(pool->_avail, osal_ticks(timeout_ms)) != pdTRUE) {
+		eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+		pool->_failures++;
+		eai_osal_critical_exit(key);
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+	void **blk = (void **)pool->_free;
+
+	pool->_free = *blk;
+	if (++pool->_used > pool->_high_water) {
+		pool->_high_water = pool->_used;
+	}
+	eai_osal_critical_exit(key);
+
+	*block = blk;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_free(eai_osal_mempool_t *pool, void *block)
+{
+	if (pool == NULL || block == NULL || (uint8_t *)block < pool->_buf) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	size_t off = (size_t)((uint8_t *)block - pool->_buf);
+
+	if (off % pool->_block_size != 0 ||
+	    off / pool->_block_size >= pool->_n_blocks) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	*(void **)block = pool->_free;
+	pool->_free = block;
+	pool->_used--;
+	eai_osal_critical_exit(key);
+
+	xSemaphoreGive(pool->_avail);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_get_stats(eai_osal_mempool_t *pool,
+					     eai_osal_mempool_stats_t *stats)
+{
+	if (pool == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	stats->block_size = (uint32_t)pool->_block_size;
+	stats->n_blocks = pool->_n_blocks;
+	stats->used = pool->_used;
+	stats->high_water = pool->_high_water;
+	stats->failures = pool->_failures;
+	eai_osal_critical_exit(key);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_reset_stats(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	pool->_failures = 0;
+	pool->_high_water = pool->_used;
+	eai_osal_critical_exit(key);
+	return EAI_OSAL_OK;
+}
@@ -1,7 +1,14 @@
 #include <eai_osal/mutex.h>
 #include "internal.h"
+#include "../stats_internal.h"
 
 eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex)
+{
+	return eai_osal_mutex_create_named(mutex, NULL);
+}
+
+eai_osal_status_t eai_osal_mutex_create_named(eai_osal_mutex_t *mutex,
+					      const char *name)
 {
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
@@ -10,6 +17,7 @@ eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex)
 	if (mutex->_handle == NULL) {
 		return EAI_OSAL_NO_MEMORY;
 	}
+	OSAL_STATS_INIT(mutex, EAI_OSAL_STATS_MUTEX, name);
 	return EAI_OSAL_OK;
 }
 
@@ -18,6 +26,7 @@ eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex)
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(mutex);
 	if (mutex->_handle != NULL) {
 		vSemaphoreDelete(mutex->_handle);
 		mutex->_handle = NULL;
@@ -30,7 +39,19 @@ eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	if (xSemaphoreTakeRecursive(mutex->_handle, osal_ticks(timeout_ms)) == pdTRUE) {
+	TickType_t ticks = osal_ticks(timeout_ms);
+	uint32_t t0 = 0;
+
+	/* Stats: try first, so only a lock that blocks is timed */
+	if (OSAL_STATS_ENABLED && ticks != 0) {
+		if (xSemaphoreTakeRecursive(mutex->_handle, 0) == pdTRUE) {
+			OSAL_STATS_RECORD(mutex, t0);
+			return EAI_OSAL_OK;
+		}
+		t0 = OSAL_STATS_STAMP();
+	}
+	if (xSemaphoreTakeRecursive(mutex->_handle, ticks) == pdTRUE) {
+		OSAL_STATS_RECORD(mutex, t0);
 		return EAI_OSAL_OK;
 	}
 	return EAI_OSAL_TIMEOUT;
@@ -0,0 +1,112 @@
+#include <eai_osal/pipe.h>
+#include "internal.h"
+#include "freertos/task.h"
+
+/*
+ * Byte pipe on a static stream buffer. A stream buffer sends and receives
+ * once per call, so both directions loop against one TimeOut_t. A receive
+ * only blocks on an empty buffer and returns when the trigger level is
+ * reached, so the read sets the trigger to what it still needs each time
+ * round; only the reader touches it.
+ */
+
+eai_osal_status_t eai_osal_pipe_create(eai_osal_pipe_t *pipe, void *buffer,
+				       size_t size, size_t threshold)
+{
+	/* The stream buffer keeps one byte free */
+	if (pipe == NULL || buffer == NULL || size < 2 ||
+	    threshold == 0 || threshold >= size) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	pipe->_handle = xStreamBufferCreateStatic(size, threshold, (uint8_t *)buffer,
+						  &pipe->_impl);
+	if (pipe->_handle == NULL) {
+		return EAI_OSAL_ERROR;
+	}
+	pipe->_threshold = threshold;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_pipe_destroy(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (pipe->_handle != NULL) {
+		vStreamBufferDelete(pipe->_handle);
+		pipe->_handle = NULL;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_pipe_write(eai_osal_pipe_t *pipe, const void *data,
+				      size_t len, size_t *written,
+				      uint32_t timeout_ms)
+{
+	if (pipe == NULL || (data == NULL && len > 0)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	const uint8_t *src = data;
+	TickType_t ticks = osal_ticks(timeout_ms);
+	TimeOut_t start;
+	size_t done = 0;
+
+	vTaskSetTimeOutState(&start);
+	while (done < len) {
+		done += xStreamBufferSend(pipe->_handle, src + done, len - done, ticks);
+		if (done < len &&
+		    (ticks == 0 || xTaskCheckForTimeOut(&start, &ticks) != pdFALSE)) {
+			break;
+		}
+	}
+
+	if (written != NULL) {
+		*written = done;
+	}
+	return done == len ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+}
+
+eai_osal_status_t eai_osal_pipe_read(eai_osal_pipe_t *pipe, void *data,
+				     size_t len, size_t *read,
+				     uint32_t timeout_ms)
+{
+	if (pipe == NULL || (data == NULL && len > 0) || read == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint8_t *dst = data;
+	size_t need = len < pipe->_threshold ? len : pipe->_threshold;
+	TickType_t ticks = osal_ticks(timeout_ms);
+	TimeOut_t start;
+	size_t done;
+
+	vTaskSetTimeOutState(&start);
+	done = xStreamBufferReceive(pipe->_handle, dst, len, 0);
+	while (done < need && ticks != 0 &&
+	       xTaskCheckForTimeOut(&start, &ticks) == pdFALSE) {
+		xStreamBufferSetTriggerLevel(pipe->_handle, need - done);
+		done += xStreamBufferReceive(pipe->_handle, dst + done, len - done,
+					     ticks);
+	}
+	xStreamBufferSetTriggerLevel(pipe->_handle, pipe->_threshold);
+
+	*read = done;
+	return done >= need ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+}
+
+size_t eai_osal_pipe_count(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return 0;
+	}
+	return xStreamBufferBytesAvailable(pipe->_handle);
+}
+
+size_t eai_osal_pipe_space(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return 0;
+	}
+	return xStreamBufferSpacesAvailable(pipe->_handle);
+}
@@ -0,0 +1,220 @@
+#include <eai_osal/poll.h>
+#include <eai_osal/critical.h>
+#include "internal.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+
+/*
+ * FreeRTOS poll.
+ *
+ * Queue sets can't carry event groups, and a queue or semaphore can belong
+ * to only one set. So each object keeps its own list of pollers, the same
+ * way the POSIX backend does. A poller parks on a static binary semaphore
+ * on its stack. osal_poll_notify() wakes every poller on the list, which
+ * for a blocked caller gives its semaphore, and each poller rescans.
+ * Triggered work (workqueue.c) lists itself the same way.
+ *
+ * The lists are guarded by poll_lock, a FreeRTOS mutex rather than the
+ * OSAL spinlock, because the notifier calls xSemaphoreGive() while it
+ * walks the list. No wakeup is lost: the poller links its nodes before it
+ * scans, and the notifier reads the list after it changes the object.
+ */
+
+struct poll_waiter {
+	struct osal_poller poller; /* must stay first — wake hook casts back */
+	SemaphoreHandle_t wake;
+	StaticSemaphore_t wake_buf;
+};
+
+static StaticSemaphore_t poll_lock_buf;
+static SemaphoreHandle_t poll_lock;
+
+static void poll_lock_take(void)
+{
+	if (poll_lock == NULL) {
+		eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+		if (poll_lock == NULL) {
+			poll_lock = xSemaphoreCreateMutexStatic(&poll_lock_buf);
+		}
+		eai_osal_critical_exit(key);
+	}
+	xSemaphoreTake(poll_lock, portMAX_DELAY);
+}
+
+static void poll_lock_give(void)
+{
+	xSemaphoreGive(poll_lock);
+}
+
+static void waiter_wake(struct osal_poller *poller)
+{
+	xSemaphoreGive(((struct poll_waiter *)poller)->wake);
+}
+
+void osal_poll_notify(struct osal_poll_node *volatile *pollers)
+{
+	__sync_synchronize();
+	if (*pollers == NULL) {
+		return;
+	}
+
+	poll_lock_take();
+	for (struct osal_poll_node *n = *pollers; n != NULL; n = n->_next) {
+		n->_poller->_wake(n->_poller);
+	}
+	poll_lock_give();
+}
+
+static struct osal_poll_node *volatile *entry_list(eai_osal_poll_event_t *ev)
+{
+	switch (ev->type) {
+	case EAI_OSAL_POLL_SEM_AVAILABLE:
+		return &ev->sem->_pollers;
+	case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+		return &ev->queue->_pollers;
+	default:
+		return &ev->event->_pollers;
+	}
+}
+
+static bool entry_valid(const eai_osal_poll_event_t *ev)
+{
+	switch (ev->type) {
+	case EAI_OSAL_POLL_SEM_AVAILABLE:
+		return ev->sem != NULL;
+	case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+		return ev->queue != NULL;
+	case EAI_OSAL_POLL_EVENT_BITS:
+		return ev->event != NULL && ev->bits != 0;
+	default:
+		return false;
+	}
+}
+
+static bool entry_ready(const eai_osal_poll_event_t *ev)
+{
+	switch (ev->type) {
+	case EAI_OSAL_POLL_SEM_AVAILABLE:
+		return uxSemaphoreGetCount(ev->sem->_handle) > 0;
+	case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+		return uxQueueMessagesWaiting(ev->queue->_handle) > 0;
+	default:
+		return (xEventGroupGetBits(ev->event->_handle) &
+			(EventBits_t)ev->bits) != 0;
+	}
+}
+
+bool osal_poll_valid(const eai_osal_poll_event_t *events, size_t n)
+{
+	if (events == NULL || n == 0) {
+		return false;
+	}
+	for (size_t i = 0; i < n; i++) {
+		if (!entry_valid(&events[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool osal_poll_scan(eai_osal_poll_event_t *events, size_t n)
+{
+	bool any = false;
+
+	for (size_t i = 0; i < n; i++) {
+		events[i].ready = entry_ready(&events[i]);
+		any |= events[i].ready;
+	}
+	return any;
+}
+
+bool osal_poll_any_ready(const eai_osal_poll_event_t *events, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		if (entry_ready(&events[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void osal_poll_register(eai_osal_poll_event_t *events, size_t n,
+			struct osal_poller *poller)
+{
+	poll_lock_take();
+	for (size_t i = 0; i < n; i++) {
+		struct osal_poll_node *volatile *list = entry_list(&events[i]);
+		struct osal_poll_node *node = &events[i]._priv;
+
+		node->_poller = poller;
+		node->_next = *list;
+		*list = node;
+	}
+	poll_lock_give();
+	__sync_synchronize();
+}
+
+void osal_poll_unregister(eai_osal_poll_event_t *events, size_t n)
+{
+	poll_lock_take();
+	for (size_t i = 0; i < n; i++) {
+		struct osal_poll_node *volatile *list = entry_list(&events[i]);
+		struct osal_poll_node *node = &events[i]._priv;
+		struct osal_poll_node *prev = NULL;
+		struct osal_poll_node *cur = *list;
+
+		while (cur != node) {
+			prev = cur;
+			cur = cur->_next;
+		}
+		if (prev != NULL) {
+			prev->_next = node->_next;
+		} else {
+			*list = node->_next;
+		}
+	}
+	poll_lock_give();
+}
+
+eai_osal_status_t eai_osal_poll(eai_osal_poll_event_t *events, size_t n,
+				uint32_t timeout_ms)
+{
+	if (!osal_poll_valid(events, n)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	if (osal_poll_scan(events, n)) {
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	struct poll_waiter waiter = { .poller._wake = waiter_wake };
+
+	waiter.wake = xSemaphoreCreateBinaryStatic(&waiter.wake_buf);
+
+	TimeOut_t start;
+	TickType_t wait = osal_ticks(timeout_ms);
+	eai_osal_status_t ret = EAI_OSAL_TIMEOUT;
+
+	vTaskSetTimeOutState(&start);
+	osal_poll_register(events, n, &waiter.poller);
+	for (;;) {
+		if (osal_poll_scan(events, n)) {
+			ret = EAI_OSAL_OK;
+			break;
+		}
+		/* Updates wait to the time left; portMAX_DELAY never expires */
+		if (xTaskCheckForTimeOut(&start, &wait) == pdTRUE) {
+			break;
+		}
+		xSemaphoreTake(waiter.wake, wait);
+	}
+	osal_poll_unregister(events, n);
+
+	vSemaphoreDelete(waiter.wake);
+	return ret;
+}
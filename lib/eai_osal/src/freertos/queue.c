@@ -1,8 +1,61 @@
 #include <eai_osal/queue.h>
+#include <eai_osal/critical.h>
 #include "internal.h"
+#include "freertos/task.h"
+#include "../stats_internal.h"
+
+/*
+ * Blocking send/receive for every queue operation. With stats on, try
+ * without waiting first so that only a call that blocks is timed.
+ */
+static BaseType_t queue_put(eai_osal_queue_t *queue, const void *msg,
+			    TickType_t ticks)
+{
+	uint32_t t0 = 0;
+
+	if (OSAL_STATS_ENABLED && ticks != 0) {
+		if (xQueueSend(queue->_handle, msg, 0) == pdTRUE) {
+			OSAL_STATS_RECORD(queue, t0);
+			osal_poll_notify(&queue->_pollers);
+			return pdTRUE;
+		}
+		t0 = OSAL_STATS_STAMP();
+	}
+	if (xQueueSend(queue->_handle, msg, ticks) != pdTRUE) {
+		return pdFALSE;
+	}
+	OSAL_STATS_RECORD(queue, t0);
+	osal_poll_notify(&queue->_pollers);
+	return pdTRUE;
+}
+
+static BaseType_t queue_get(eai_osal_queue_t *queue, void *msg, TickType_t ticks)
+{
+	uint32_t t0 = 0;
+
+	if (OSAL_STATS_ENABLED && ticks != 0) {
+		if (xQueueReceive(queue->_handle, msg, 0) == pdTRUE) {
+			OSAL_STATS_RECORD(queue, t0);
+			return pdTRUE;
+		}
+		t0 = OSAL_STATS_STAMP();
+	}
+	if (xQueueReceive(queue->_handle, msg, ticks) != pdTRUE) {
+		return pdFALSE;
+	}
+	OSAL_STATS_RECORD(queue, t0);
+	return pdTRUE;
+}
 
 eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size,
 					uint32_t max_msgs, void *buffer)
+{
+	return eai_osal_queue_create_named(queue, msg_size, max_msgs, buffer, NULL);
+}
+
+eai_osal_status_t eai_osal_queue_create_named(eai_osal_queue_t *queue,
+					      size_t msg_size, uint32_t max_msgs,
+					      void *buffer, const char *name)
 {
 	if (queue == NULL || buffer == NULL || msg_size == 0 || max_msgs == 0) {
 		return EAI_OSAL_INVALID_PARAM;
@@ -15,6 +68,21 @@ eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size
 	if (queue->_handle == NULL) {
 		return EAI_OSAL_NO_MEMORY;
 	}
+	/* Both reserve/peek staging buffers, one pointer-aligned stride apart */
+	size_t stride = (msg_size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+	queue->_wr_stage = pvPortMalloc(2 * stride);
+	if (queue->_wr_stage == NULL) {
+		vQueueDelete(queue->_handle);
+		queue->_handle = NULL;
+		return EAI_OSAL_NO_MEMORY;
+	}
+	queue->_rd_stage = (uint8_t *)queue->_wr_stage + stride;
+	queue->_msg_size = msg_size;
+	queue->_wr_timeout_ms = 0;
+	queue->_wr_busy = false;
+	queue->_rd_busy = false;
+	OSAL_STATS_INIT(queue, EAI_OSAL_STATS_QUEUE, name);
 	return EAI_OSAL_OK;
 }
 
@@ -23,10 +91,14 @@ eai_osal_status_t eai_osal_queue_destroy(eai_osal_queue_t *queue)
 	if (queue == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(queue);
 	if (queue->_handle != NULL) {
 		vQueueDelete(queue->_handle);
 		queue->_handle = NULL;
 	}
+	vPortFree(queue->_wr_stage);
+	queue->_wr_stage = NULL;
+	queue->_rd_stage = NULL;
 	return EAI_OSAL_OK;
 }
 
@@ -36,7 +108,7 @@ eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
 	if (queue == NULL || msg == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	if (xQueueSend(queue->_handle, msg, osal_ticks(timeout_ms)) == pdTRUE) {
+	if (queue_put(queue, msg, osal_ticks(timeout_ms)) == pdTRUE) {
 		return EAI_OSAL_OK;
 	}
 	return EAI_OSAL_TIMEOUT;
@@ -48,8 +120,225 @@ eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
 	if (queue == NULL || msg == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	if (xQueueReceive(queue->_handle, msg, osal_ticks(timeout_ms)) == pdTRUE) {
+	if (queue_get(queue, msg, osal_ticks(timeout_ms)) == pdTRUE) {
 		return EAI_OSAL_OK;
 	}
 	return EAI_OSAL_TIMEOUT;
 }
+
+/*
+ * Batched transfer — FreeRTOS queues have no multi-message call. The first
+ * message of each round blocks for what is left of the timeout (tracked
+ * with xTaskCheckForTimeOut); the rest of the burst goes through with a
+ * zero timeout. Suspending the scheduler around the burst is not an option
+ * because xQueueSend may yield to a woken receiver.
+ */
+
+static uint32_t put_burst(eai_osal_queue_t *queue, const uint8_t *src,
+			  uint32_t n)
+{
+	uint32_t done = 0;
+
+	while (done < n &&
+	       xQueueSend(queue->_handle, src + done * queue->_msg_size, 0) == pdTRUE) {
+		done++;
+	}
+	if (done > 0) {
+		osal_poll_notify(&queue->_pollers);
+	}
+	return done;
+}
+
+static uint32_t get_burst(eai_osal_queue_t *queue, uint8_t *dst, uint32_t n)
+{
+	uint32_t done = 0;
+
+	while (done < n &&
+	       xQueueReceive(queue->_handle, dst + done * queue->_msg_size, 0) == pdTRUE) {
+		done++;
+	}
+	return done;
+}
+
+/* Remaining wait for the next blocking round; 0 once the timeout is spent */
+static void batch_remaining(TimeOut_t *start, TickType_t *wait)
+{
+	if (*wait != 0 && xTaskCheckForTimeOut(start, wait) != pdFALSE) {
+		*wait = 0;
+	}
+}
+
+eai_osal_status_t eai_osal_queue_send_many(eai_osal_queue_t *queue,
+					   const void *msgs, uint32_t count,
+					   uint32_t *sent, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || count == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	const uint8_t *src = (const uint8_t *)msgs;
+	TickType_t wait = osal_ticks(timeout_ms);
+	TimeOut_t start;
+	uint32_t done = 0;
+
+	vTaskSetTimeOutState(&start);
+
+	while (done < count) {
+		if (queue_put(queue, src + done * queue->_msg_size,
+			      wait) != pdTRUE) {
+			break;
+		}
+		done++;
+		done += put_burst(queue, src + done * queue->_msg_size,
+				  count - done);
+		batch_remaining(&start, &wait);
+	}
+
+	if (sent != NULL) {
+		*sent = done;
+	}
+	return done == count ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+}
+
+/* Shared by recv_many (fill = false) and drain (fill = true) */
+static eai_osal_status_t recv_batch(eai_osal_queue_t *queue, void *msgs,
+				    uint32_t max_msgs, uint32_t *received,
+				    uint32_t timeout_ms, bool fill)
+{
+	if (queue == NULL || msgs == NULL || max_msgs == 0 || received == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint8_t *dst = (uint8_t *)msgs;
+	TickType_t wait = osal_ticks(timeout_ms);
+	TimeOut_t start;
+	uint32_t done = 0;
+	bool timed_out = false;
+
+	vTaskSetTimeOutState(&start);
+
+	while (done < max_msgs) {
+		if (queue_get(queue, dst + done * queue->_msg_size,
+			      wait) != pdTRUE) {
+			timed_out = true;
+			break;
+		}
+		done++;
+		done += get_burst(queue, dst + done * queue->_msg_size,
+				  max_msgs - done);
+		if (!fill) {
+			break;
+		}
+		batch_remaining(&start, &wait);
+	}
+
+	*received = done;
+	return timed_out ? EAI_OSAL_TIMEOUT : EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_recv_many(eai_osal_queue_t *queue, void *msgs,
+					   uint32_t max_msgs, uint32_t *received,
+					   uint32_t timeout_ms)
+{
+	return recv_batch(queue, msgs, max_msgs, received, timeout_ms, false);
+}
+
+eai_osal_status_t eai_osal_queue_drain(eai_osal_queue_t *queue, void *msgs,
+				       uint32_t max_msgs, uint32_t *received,
+				       uint32_t timeout_ms)
+{
+	return recv_batch(queue, msgs, max_msgs, received, timeout_ms, true);
+}
+
+/*
+ * Zero-copy access — FreeRTOS queues have no in-place API, so reserve/peek
+ * hand out the staging buffers allocated with the queue, commit does the
+ * xQueueSend and peek does the xQueueReceive.
+ */
+
+/* Claim one side of the queue; false if already claimed */
+static bool side_claim(bool *busy)
+{
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+	bool claimed = !*busy;
+
+	*busy = true;
+	eai_osal_critical_exit(key);
+	return claimed;
+}
+
+static void side_release(bool *busy)
+{
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	*busy = false;
+	eai_osal_critical_exit(key);
+}
+
+eai_osal_status_t eai_osal_queue_reserve(eai_osal_queue_t *queue, void **slot,
+					 uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!side_claim(&queue->_wr_busy)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	if (timeout_ms == EAI_OSAL_NO_WAIT &&
+	    uxQueueSpacesAvailable(queue->_handle) == 0) {
+		side_release(&queue->_wr_busy);
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	queue->_wr_timeout_ms = timeout_ms;
+	*slot = queue->_wr_stage;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_commit(eai_osal_queue_t *queue, void *slot)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!queue->_wr_busy || slot != queue->_wr_stage) {
+		return EAI_OSAL_ERROR;
+	}
+
+	BaseType_t sent = queue_put(queue, slot,
+				    osal_ticks(queue->_wr_timeout_ms));
+
+	side_release(&queue->_wr_busy);
+	return sent == pdTRUE ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+}
+
+eai_osal_status_t eai_osal_queue_peek(eai_osal_queue_t *queue, void **slot,
+				      uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!side_claim(&queue->_rd_busy)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	if (queue_get(queue, queue->_rd_stage, osal_ticks(timeout_ms)) != pdTRUE) {
+		side_release(&queue->_rd_busy);
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	*slot = queue->_rd_stage;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_release(eai_osal_queue_t *queue, void *slot)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!queue->_rd_busy || slot != queue->_rd_stage) {
+		return EAI_OSAL_ERROR;
+	}
+	side_release(&queue->_rd_busy);
+	return EAI_OSAL_OK;
+}
@@ -0,0 +1,180 @@
+#include <eai_osal/rwlock.h>
+#include "internal.h"
+
+/*
+ * FreeRTOS reader-writer lock.
+ *
+ * FreeRTOS has no rwlock, so the counts live under a short-held mutex and
+ * waiting is done on two semaphores. Whoever releases the lock hands it
+ * on under _lock: to one queued writer through _write_sem, or to every
+ * queued reader at once through _read_sem. The counts are updated for
+ * the waiters before they wake. A waiter that times out retakes _lock and
+ * checks for a hand-off that raced its timeout before it gives up.
+ */
+
+/* Let every queued reader in (_lock held, no writer) */
+static void grant_readers(eai_osal_rwlock_t *rwlock)
+{
+	rwlock->_readers += rwlock->_readers_waiting;
+	while (rwlock->_readers_waiting > 0) {
+		xSemaphoreGive(rwlock->_read_sem);
+		rwlock->_readers_waiting--;
+	}
+}
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	rwlock->_readers = 0;
+	rwlock->_readers_waiting = 0;
+	rwlock->_writers_waiting = 0;
+	rwlock->_writer = false;
+	rwlock->_lock = xSemaphoreCreateMutex();
+	rwlock->_read_sem = xSemaphoreCreateCounting(0xffff, 0);
+	rwlock->_write_sem = xSemaphoreCreateBinary();
+	if (rwlock->_lock == NULL || rwlock->_read_sem == NULL ||
+	    rwlock->_write_sem == NULL) {
+		eai_osal_rwlock_destroy(rwlock);
+		return EAI_OSAL_NO_MEMORY;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (rwlock->_write_sem != NULL) {
+		vSemaphoreDelete(rwlock->_write_sem);
+		rwlock->_write_sem = NULL;
+	}
+	if (rwlock->_read_sem != NULL) {
+		vSemaphoreDelete(rwlock->_read_sem);
+		rwlock->_read_sem = NULL;
+	}
+	if (rwlock->_lock != NULL) {
+		vSemaphoreDelete(rwlock->_lock);
+		rwlock->_lock = NULL;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *rwlock,
+					    uint32_t timeout_ms)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	xSemaphoreTake(rwlock->_lock, portMAX_DELAY);
+	if (!rwlock->_writer && rwlock->_writers_waiting == 0) {
+		rwlock->_readers++;
+		xSemaphoreGive(rwlock->_lock);
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		xSemaphoreGive(rwlock->_lock);
+		return EAI_OSAL_TIMEOUT;
+	}
+	rwlock->_readers_waiting++;
+	xSemaphoreGive(rwlock->_lock);
+
+	if (xSemaphoreTake(rwlock->_read_sem, osal_ticks(timeout_ms)) == pdTRUE) {
+		return EAI_OSAL_OK; /* counted in _readers by grant_readers() */
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_TIMEOUT;
+
+	xSemaphoreTake(rwlock->_lock, portMAX_DELAY);
+	if (xSemaphoreTake(rwlock->_read_sem, 0) == pdTRUE) {
+		ret = EAI_OSAL_OK;
+	} else {
+		rwlock->_readers_waiting--;
+	}
+	xSemaphoreGive(rwlock->_lock);
+	return ret;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_OK;
+
+	xSemaphoreTake(rwlock->_lock, portMAX_DELAY);
+	if (rwlock->_readers == 0) {
+		ret = EAI_OSAL_ERROR;
+	} else if (--rwlock->_readers == 0 && rwlock->_writers_waiting > 0) {
+		rwlock->_writers_waiting--;
+		rwlock->_writer = true;
+		xSemaphoreGive(rwlock->_write_sem);
+	}
+	xSemaphoreGive(rwlock->_lock);
+	return ret;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *rwlock,
+					     uint32_t timeout_ms)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	xSemaphoreTake(rwlock->_lock, portMAX_DELAY);
+	if (!rwlock->_writer && rwlock->_readers == 0) {
+		rwlock->_writer = true;
+		xSemaphoreGive(rwlock->_lock);
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		xSemaphoreGive(rwlock->_lock);
+		return EAI_OSAL_TIMEOUT;
+	}
+	rwlock->_writers_waiting++;
+	xSemaphoreGive(rwlock->_lock);
+
+	if (xSemaphoreTake(rwlock->_write_sem, osal_ticks(timeout_ms)) == pdTRUE) {
+		return EAI_OSAL_OK; /* _writer was set by whoever handed off */
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_TIMEOUT;
+
+	xSemaphoreTake(rwlock->_lock, portMAX_DELAY);
+	if (xSemaphoreTake(rwlock->_write_sem, 0) == pdTRUE) {
+		ret = EAI_OSAL_OK;
+	} else if (--rwlock->_writers_waiting == 0 && !rwlock->_writer) {
+		/* Readers held back for us alone can go now */
+		grant_readers(rwlock);
+	}
+	xSemaphoreGive(rwlock->_lock);
+	return ret;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_OK;
+
+	xSemaphoreTake(rwlock->_lock, portMAX_DELAY);
+	if (!rwlock->_writer) {
+		ret = EAI_OSAL_ERROR;
+	} else if (rwlock->_writers_waiting > 0) {
+		/* Stays write-held; ownership passes to the next writer */
+		rwlock->_writers_waiting--;
+		xSemaphoreGive(rwlock->_write_sem);
+	} else {
+		rwlock->_writer = false;
+		grant_readers(rwlock);
+	}
+	xSemaphoreGive(rwlock->_lock);
+	return ret;
+}
@@ -1,17 +1,26 @@
 #include <eai_osal/semaphore.h>
 #include "internal.h"
+#include "../stats_internal.h"
 
 eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 				      uint32_t limit)
+{
+	return eai_osal_sem_create_named(sem, initial, limit, NULL);
+}
+
+eai_osal_status_t eai_osal_sem_create_named(eai_osal_sem_t *sem, uint32_t initial,
+					    uint32_t limit, const char *name)
 {
 	if (sem == NULL || limit == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	sem->_limit = limit;
+	sem->_pollers = NULL;
 	sem->_handle = xSemaphoreCreateCounting(limit, initial);
 	if (sem->_handle == NULL) {
 		return EAI_OSAL_NO_MEMORY;
 	}
+	OSAL_STATS_INIT(sem, EAI_OSAL_STATS_SEM, name);
 	return EAI_OSAL_OK;
 }
 
@@ -20,6 +29,7 @@ eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(sem);
 	if (sem->_handle != NULL) {
 		vSemaphoreDelete(sem->_handle);
 		sem->_handle = NULL;
@@ -33,6 +43,7 @@ eai_osal_status_t eai_osal_sem_give(eai_osal_sem_t *sem)
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	if (xSemaphoreGive(sem->_handle) == pdTRUE) {
+		osal_poll_notify(&sem->_pollers);
 		return EAI_OSAL_OK;
 	}
 	/* Semaphore at limit — give failed */
@@ -44,7 +55,19 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	if (xSemaphoreTake(sem->_handle, osal_ticks(timeout_ms)) == pdTRUE) {
+	TickType_t ticks = osal_ticks(timeout_ms);
+	uint32_t t0 = 0;
+
+	/* Stats: try first, so only a take that blocks is timed */
+	if (OSAL_STATS_ENABLED && ticks != 0) {
+		if (xSemaphoreTake(sem->_handle, 0) == pdTRUE) {
+			OSAL_STATS_RECORD(sem, t0);
+			return EAI_OSAL_OK;
+		}
+		t0 = OSAL_STATS_STAMP();
+	}
+	if (xSemaphoreTake(sem->_handle, ticks) == pdTRUE) {
+		OSAL_STATS_RECORD(sem, t0);
 		return EAI_OSAL_OK;
 	}
 	return EAI_OSAL_TIMEOUT;
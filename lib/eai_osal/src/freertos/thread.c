@@ -1,11 +1,146 @@
 #include <eai_osal/thread.h>
+#include <eai_osal/critical.h>
 #include "internal.h"
+#include <string.h>
+
+/* ── Stats registry ──────────────────────────────────────────────────── */
+
+/*
+ * A thread is listed from create until its entry function returns, and
+ * stats are read with registry_lock held, so the task they are read from
+ * has not deleted itself yet. registry_lock is a FreeRTOS mutex, not the
+ * OSAL spinlock, because uxTaskGetStackHighWaterMark() walks the stack.
+ */
+static StaticSemaphore_t registry_lock_buf;
+static SemaphoreHandle_t registry_lock;
+static eai_osal_thread_t *registry;
+
+static void registry_lock_take(void)
+{
+	if (registry_lock == NULL) {
+		eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+		if (registry_lock == NULL) {
+			registry_lock = xSemaphoreCreateMutexStatic(&registry_lock_buf);
+		}
+		eai_osal_critical_exit(key);
+	}
+	xSemaphoreTake(registry_lock, portMAX_DELAY);
+}
+
+static void registry_lock_give(void)
+{
+	xSemaphoreGive(registry_lock);
+}
+
+static void registry_remove(eai_osal_thread_t *thread)
+{
+	registry_lock_take();
+	for (eai_osal_thread_t **it = &registry; *it != NULL; it = &(*it)->_next) {
+		if (*it == thread) {
+			*it = thread->_next;
+			break;
+		}
+	}
+	registry_lock_give();
+}
+
+#if configGENERATE_RUN_TIME_STATS && configUSE_TRACE_FACILITY
+/* The 32-bit run-time counter ticks in esp_timer microseconds by default */
+static uint64_t run_time_ns(uint32_t count)
+{
+#ifdef CONFIG_FREERTOS_RUN_TIME_COUNTER_CLK_CPU_CLK
+	return (uint64_t)count * 1000 / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+#else
+	return (uint64_t)count * 1000;
+#endif
+}
+#endif
+
+/* Fill *out from a listed thread (registry_lock held) */
+static void thread_snapshot(const eai_osal_thread_t *thread,
+			    eai_osal_thread_stats_t *out)
+{
+	memset(out, 0, sizeof(*out));
+	out->stack_size = thread->_stack_size;
+	if (thread->_handle == NULL) {
+		return; /* xTaskCreate() has not returned yet */
+	}
+
+	strncpy(out->name, pcTaskGetName(thread->_handle), sizeof(out->name) - 1);
+
+	size_t free_bytes = uxTaskGetStackHighWaterMark(thread->_handle) *
+			    sizeof(StackType_t);
+
+	out->stack_used = free_bytes < out->stack_size ? out->stack_size - free_bytes : 0;
+
+#if configGENERATE_RUN_TIME_STATS && configUSE_TRACE_FACILITY
+	TaskStatus_t status;
+
+	/* Passing a state skips the state lookup */
+	vTaskGetInfo(thread->_handle, &status, pdFALSE, eRunning);
+	out->runtime_ns = run_time_ns(status.ulRunTimeCounter);
+#endif
+}
+
+eai_osal_status_t eai_osal_thread_get_stats(eai_osal_thread_t *thread,
+					    eai_osal_thread_stats_t *stats)
+{
+	if (thread == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_ERROR;
+
+	registry_lock_take();
+	for (eai_osal_thread_t *it = registry; it != NULL; it = it->_next) {
+		if (it == thread) {
+			thread_snapshot(thread, stats);
+			ret = EAI_OSAL_OK;
+			break;
+		}
+	}
+	registry_lock_give();
+	return ret;
+}
+
+void eai_osal_thread_foreach(eai_osal_thread_stats_cb_t cb, void *arg)
+{
+	eai_osal_thread_stats_t snap;
+
+	if (cb == NULL) {
+		return;
+	}
+
+	/* Re-walk to the i-th entry each round, as eai_osal_stats_foreach() does */
+	for (uint32_t i = 0;; i++) {
+		registry_lock_take();
+
+		eai_osal_thread_t *thread = registry;
+
+		for (uint32_t j = 0; j < i && thread != NULL; j++) {
+			thread = thread->_next;
+		}
+		if (thread != NULL) {
+			thread_snapshot(thread, &snap);
+		}
+		registry_lock_give();
+
+		if (thread == NULL) {
+			break;
+		}
+		cb(&snap, arg);
+	}
+}
+
+/* ── Threads ─────────────────────────────────────────────────────────── */
 
 static void thread_trampoline(void *arg)
 {
 	eai_osal_thread_t *thread = (eai_osal_thread_t *)arg;
 
 	thread->_entry(thread->_entry_arg);
+	registry_remove(thread);
 
 	/* Signal join semaphore before self-deleting */
 	if (thread->_join_sem != NULL) {
@@ -31,6 +166,8 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 
 	thread->_entry = entry;
 	thread->_entry_arg = arg;
+	thread->_handle = NULL;
+	thread->_stack_size = stack_size;
 
 	/* Create join semaphore (binary, starts at 0) */
 	thread->_join_sem = xSemaphoreCreateBinary();
@@ -43,13 +180,27 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 	 * The stack parameter is for API compatibility but the size
 	 * (in bytes) is passed to FreeRTOS which converts to words.
 	 */
+	TaskHandle_t handle = NULL;
+
+	/* Listed first, so a thread that returns at once is unlisted again */
+	registry_lock_take();
+	thread->_next = registry;
+	registry = thread;
+	registry_lock_give();
+
 	BaseType_t ret = xTaskCreate(thread_trampoline,
 				     name ? name : "osal",
 				     stack_size / sizeof(StackType_t),
 				     thread,
 				     osal_priority(priority),
-				     &thread->_handle);
+				     &handle);
+
+	registry_lock_take();
+	thread->_handle = handle;
+	registry_lock_give();
+
 	if (ret != pdPASS) {
+		registry_remove(thread);
 		vSemaphoreDelete(thread->_join_sem);
 		thread->_join_sem = NULL;
 		return EAI_OSAL_NO_MEMORY;
@@ -75,6 +226,26 @@ eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 	return EAI_OSAL_TIMEOUT;
 }
 
+/*
+ * IDF FreeRTOS fixes a task's core at creation (xTaskCreatePinnedToCore);
+ * it can't be re-pinned once running.
+ */
+eai_osal_status_t eai_osal_thread_set_affinity(eai_osal_thread_t *thread,
+					       uint32_t cpu_mask)
+{
+	if (thread == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t all = (1u << portNUM_PROCESSORS) - 1;
+
+	cpu_mask &= all;
+	if (cpu_mask == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return cpu_mask == all ? EAI_OSAL_OK : EAI_OSAL_ERROR;
+}
+
 void eai_osal_thread_sleep(uint32_t ms)
 {
 	vTaskDelay(pdMS_TO_TICKS(ms));
@@ -1,12 +1,26 @@
 #include <eai_osal/time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
 
 uint32_t eai_osal_time_get_ms(void)
 {
 	return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
 }
 
+/* esp_timer counts microseconds since boot */
+uint64_t eai_osal_time_get_us(void)
+{
+	return (uint64_t)esp_timer_get_time();
+}
+
+uint64_t eai_osal_time_get_ns(void)
+{
+	return (uint64_t)esp_timer_get_time() * 1000ULL;
+}
+
 uint64_t eai_osal_time_get_ticks(void)
 {
 	return (uint64_t)xTaskGetTickCount();
@@ -16,3 +30,14 @@ uint32_t eai_osal_time_ticks_to_ms(uint64_t ticks)
 {
 	return (uint32_t)(ticks * portTICK_PERIOD_MS);
 }
+
+/* CPU cycle count register of the calling core — don't compare across cores */
+uint32_t eai_osal_cycle_get(void)
+{
+	return (uint32_t)esp_cpu_get_cycle_count();
+}
+
+uint64_t eai_osal_cycles_to_ns(uint32_t cycles)
+{
+	return (uint64_t)cycles * 1000ULL / esp_rom_get_cpu_ticks_per_us();
+}
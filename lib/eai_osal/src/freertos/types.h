@@ -13,25 +13,93 @@
 #include "freertos/queue.h"
 #include "freertos/timers.h"
 #include "freertos/event_groups.h"
+#include "freertos/stream_buffer.h"
 
-typedef struct { SemaphoreHandle_t _handle; } eai_osal_mutex_t;
+/*
+ * What a poll entry wakes: a blocked eai_osal_poll() call (poll.c) or an
+ * armed eai_osal_work_poll_t (workqueue.c). Called with poll_lock held.
+ */
+struct osal_poller {
+	void (*_wake)(struct osal_poller *poller);
+};
+
+/* eai_osal_poll() registration, one per poll entry, listed on its object */
+typedef struct osal_poll_node {
+	struct osal_poll_node *_next;
+	struct osal_poller *_poller;
+} eai_osal_poll_priv_t;
+
+typedef struct {
+	SemaphoreHandle_t _handle;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
+} eai_osal_mutex_t;
 
 typedef struct {
 	SemaphoreHandle_t _handle;
 	uint32_t _limit;
+	struct osal_poll_node *volatile _pollers; /* eai_osal_poll() waiters */
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
 } eai_osal_sem_t;
 
-typedef struct {
+typedef struct eai_osal_thread {
 	TaskHandle_t _handle;
 	SemaphoreHandle_t _join_sem;
 	eai_osal_thread_entry_t _entry;
 	void *_entry_arg;
+	struct eai_osal_thread *_next; /* stats registry (thread.c) */
+	size_t _stack_size;
 } eai_osal_thread_t;
 
 typedef struct {
 	QueueHandle_t _handle;
+	/* reserve/commit and peek/release staging (FreeRTOS queues copy) */
+	size_t _msg_size;
+	void *_wr_stage;
+	void *_rd_stage;
+	uint32_t _wr_timeout_ms;
+	bool _wr_busy;
+	bool _rd_busy;
+	struct osal_poll_node *volatile _pollers;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
 } eai_osal_queue_t;
 
+/* Byte pipe — a static stream buffer over the caller's storage */
+typedef struct {
+	StreamBufferHandle_t _handle;
+	StaticStreamBuffer_t _impl;
+	size_t _threshold;
+} eai_osal_pipe_t;
+
+/* Reader-writer lock — counts under _lock, hand-offs via semaphores (rwlock.c) */
+typedef struct {
+	SemaphoreHandle_t _lock;
+	SemaphoreHandle_t _read_sem;  /* one give per queued reader let in */
+	SemaphoreHandle_t _write_sem; /* hand-off to one queued writer */
+	uint32_t _readers;
+	uint32_t _readers_waiting;
+	uint32_t _writers_waiting;
+	bool _writer;
+} eai_osal_rwlock_t;
+
+/* Block pool — free list linked through the free blocks themselves */
+typedef struct {
+	uint8_t *_buf;
+	size_t _block_size;
+	uint32_t _n_blocks;
+	void *_free;                /* free-list head, OSAL critical section */
+	SemaphoreHandle_t _avail;   /* counts free blocks; alloc waits here */
+	/* Counters (eai_osal_mempool_get_stats), OSAL critical section */
+	uint32_t _used;
+	uint32_t _high_water;
+	uint32_t _failures;
+} eai_osal_mempool_t;
+
 typedef struct {
 	TimerHandle_t _handle;
 	eai_osal_timer_cb_t _cb;
@@ -39,7 +107,13 @@ typedef struct {
 	uint32_t _period_ms;
 } eai_osal_timer_t;
 
-typedef struct { EventGroupHandle_t _handle; } eai_osal_event_t;
+typedef struct {
+	EventGroupHandle_t _handle;
+	struct osal_poll_node *volatile _pollers;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
+} eai_osal_event_t;
 
 typedef unsigned int eai_osal_critical_key_t;
 
@@ -47,6 +121,7 @@ typedef unsigned int eai_osal_critical_key_t;
 typedef struct {
 	eai_osal_work_cb_t _cb;
 	void *_cb_arg;
+	volatile uint8_t _state; /* pool pending/running bits (critical section) */
 } eai_osal_work_t;
 
 /* Delayed work — uses a timer to defer submission */
@@ -55,14 +130,48 @@ typedef struct {
 	void *_cb_arg;
 	TimerHandle_t _timer;
 	void *_target_wq; /* eai_osal_workqueue_t*, NULL = system */
+	volatile bool _retrying; /* expired on a full queue, reject counted */
 } eai_osal_dwork_t;
 
-/* Work queue — task that processes {cb, arg} items from a FreeRTOS queue */
+/*
+ * Triggered work — listed on its poll entries' objects like a blocked
+ * eai_osal_poll() caller, plus a timer for the timeout and retries
+ */
+struct eai_osal_poll_event;
+
+typedef struct {
+	struct osal_poller _poller; /* must stay first — wake hook casts back */
+	eai_osal_work_cb_t _cb;
+	void *_cb_arg;
+	struct eai_osal_poll_event *_events;
+	size_t _n;
+	void *_wq;               /* eai_osal_workqueue_t*, resolved at submit */
+	TimerHandle_t _timer;
+	TimeOut_t _start;
+	TickType_t _wait;        /* time left from _start, portMAX_DELAY = none */
+	volatile uint8_t _state; /* WP_* in workqueue.c, OSAL critical section */
+} eai_osal_work_poll_t;
+
+/* Work queue — task that processes {cb, arg} items from a priority queue */
+struct eai_osal_pqueue;
+
 typedef struct {
 	TaskHandle_t _task;
-	QueueHandle_t _queue;
+	struct eai_osal_pqueue *_queue; /* allocated with its storage at create */
+	uint32_t _depth;
+	/* Counters (eai_osal_workqueue_get_stats), OSAL critical section */
+	uint32_t _high_water;
+	uint32_t _rejected;
+	uint32_t _max_latency_us;
 } eai_osal_workqueue_t;
 
+/* Work queue pool — n tasks receiving eai_osal_work_t* from one queue */
+typedef struct {
+	QueueHandle_t _queue;
+	SemaphoreHandle_t _exited; /* given by each task as it stops */
+	uint32_t _n_workers;
+} eai_osal_workqueue_pool_t;
+
 /*
  * Thread stacks on FreeRTOS/ESP-IDF are allocated by the kernel.
  * These macros exist for API compatibility — the stack array is not
@@ -71,5 +180,7 @@ typedef struct {
 #define EAI_OSAL_THREAD_STACK_DEFINE(name, size) \
 	static uint8_t name[size] __attribute__((unused))
 #define EAI_OSAL_THREAD_STACK_SIZEOF(name) sizeof(name)
+#define EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(name, n, size) \
+	static uint8_t name[n][size] __attribute__((unused))
 
 #endif /* EAI_OSAL_FREERTOS_TYPES_H */
@@ -1,4 +1,6 @@
 #include <eai_osal/workqueue.h>
+#include <eai_osal/critical.h>
+#include <eai_osal/pqueue.h>
 #include "internal.h"
 #include <string.h>
 
@@ -6,18 +8,24 @@
  * FreeRTOS work queue implementation.
  *
  * FreeRTOS has no native work queue. We implement it as:
- * - A FreeRTOS task that blocks on a queue
- * - Work items are {callback, arg} pairs sent to the queue
- * - Delayed work uses a FreeRTOS timer that enqueues on expiry
+ * - A FreeRTOS task that blocks on an OSAL priority queue
+ * - Work items are {callback, arg} pairs sent to the queue, and run
+ *   highest level first
+ * - Delayed work uses a FreeRTOS timer that enqueues on expiry, or
+ *   retries a tick later while the queue is full
+ * - Triggered work lists itself on poll entries, and enqueues when one
+ *   becomes ready or its timer expires
  *
- * The system work queue is lazily initialized on first use.
+ * The system work queue is lazily initialized on first use. Items carry
+ * their enqueue tick, so queueing latency has tick resolution.
  */
 
-#define WQ_DEPTH 16
+#define TICK_US (1000000u / configTICK_RATE_HZ)
 
 struct wq_item {
 	eai_osal_work_cb_t cb;
 	void *arg;
+	TickType_t queued;
 };
 
 /* ── System work queue (lazy init) ────────────────────────────────────── */
@@ -31,7 +39,17 @@ static void wq_task(void *arg)
 	struct wq_item item;
 
 	for (;;) {
-		if (xQueueReceive(wq->_queue, &item, portMAX_DELAY) == pdTRUE) {
+		if (eai_osal_pqueue_recv(wq->_queue, &item, NULL,
+					 EAI_OSAL_WAIT_FOREVER) == EAI_OSAL_OK) {
+			uint32_t waited = (uint32_t)(xTaskGetTickCount() - item.queued) *
+					  TICK_US;
+			eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+			if (waited > wq->_max_latency_us) {
+				wq->_max_latency_us = waited;
+			}
+			eai_osal_critical_exit(key);
+
 			if (item.cb != NULL) {
 				item.cb(item.arg);
 			}
@@ -39,19 +57,48 @@ static void wq_task(void *arg)
 	}
 }
 
+static eai_osal_status_t wq_queue_create(eai_osal_workqueue_t *wq,
+					 uint32_t depth)
+{
+	/* The queue's storage follows the queue in the same allocation */
+	wq->_queue = pvPortMalloc(sizeof(eai_osal_pqueue_t) +
+				  EAI_OSAL_PQUEUE_BUF_SIZE(sizeof(struct wq_item),
+							   depth));
+	if (wq->_queue == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+	if (eai_osal_pqueue_create(wq->_queue, sizeof(struct wq_item), depth,
+				   wq->_queue + 1) != EAI_OSAL_OK) {
+		vPortFree(wq->_queue);
+		wq->_queue = NULL;
+		return EAI_OSAL_NO_MEMORY;
+	}
+	wq->_depth = depth;
+	wq->_high_water = 0;
+	wq->_rejected = 0;
+	wq->_max_latency_us = 0;
+	return EAI_OSAL_OK;
+}
+
+static void wq_queue_delete(eai_osal_workqueue_t *wq)
+{
+	eai_osal_pqueue_destroy(wq->_queue);
+	vPortFree(wq->_queue);
+	wq->_queue = NULL;
+}
+
 static eai_osal_workqueue_t *get_sys_wq(void)
 {
 	if (!sys_wq_ready) {
-		sys_wq._queue = xQueueCreate(WQ_DEPTH, sizeof(struct wq_item));
-		if (sys_wq._queue == NULL) {
+		if (wq_queue_create(&sys_wq, EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH) !=
+		    EAI_OSAL_OK) {
 			return NULL;
 		}
 		BaseType_t ret = xTaskCreate(wq_task, "sys_wq", 4096,
 					     &sys_wq, tskIDLE_PRIORITY + 1,
 					     &sys_wq._task);
 		if (ret != pdPASS) {
-			vQueueDelete(sys_wq._queue);
-			sys_wq._queue = NULL;
+			wq_queue_delete(&sys_wq);
 			return NULL;
 		}
 		sys_wq_ready = true;
@@ -70,18 +117,37 @@ eai_osal_status_t eai_osal_work_init(eai_osal_work_t *work,
 	}
 	work->_cb = callback;
 	work->_cb_arg = arg;
+	work->_state = 0;
 	return EAI_OSAL_OK;
 }
 
-static eai_osal_status_t submit_to_queue(QueueHandle_t q,
-					 eai_osal_work_cb_t cb, void *arg)
+/*
+ * EAI_OSAL_NO_WAIT is used from the timer service task (delayed work),
+ * which must not block. The queue can drain between the send and the
+ * count read, so high_water may read low under contention, never high.
+ * Delayed and triggered work retry a full queue with retry set, so an
+ * item that is held up counts as one reject however many attempts it takes.
+ */
+static bool submit_to_queue(eai_osal_workqueue_t *wq, eai_osal_work_cb_t cb,
+			    void *arg, uint8_t prio, uint32_t timeout_ms,
+			    bool retry)
 {
-	struct wq_item item = { .cb = cb, .arg = arg };
+	struct wq_item item = { .cb = cb, .arg = arg,
+				.queued = xTaskGetTickCount() };
+	bool sent = eai_osal_pqueue_send(wq->_queue, &item, prio,
+					 timeout_ms) == EAI_OSAL_OK;
+	uint32_t n = sent ? eai_osal_pqueue_count(wq->_queue) : 0;
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
 
-	if (xQueueSend(q, &item, 0) == pdTRUE) {
-		return EAI_OSAL_OK;
+	if (!sent) {
+		if (!retry) {
+			wq->_rejected++;
+		}
+	} else if (n > wq->_high_water) {
+		wq->_high_water = n;
 	}
-	return EAI_OSAL_ERROR;
+	eai_osal_critical_exit(key);
+	return sent;
 }
 
 eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
@@ -94,7 +160,9 @@ eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
 	if (wq == NULL) {
 		return EAI_OSAL_ERROR;
 	}
-	return submit_to_queue(wq->_queue, work->_cb, work->_cb_arg);
+	return submit_to_queue(wq, work->_cb, work->_cb_arg,
+			       EAI_OSAL_WORK_PRIO_DEFAULT, EAI_OSAL_NO_WAIT, false) ?
+	       EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
 }
 
 eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
@@ -103,11 +171,49 @@ eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
 	if (work == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return submit_to_queue(wq->_queue, work->_cb, work->_cb_arg);
+	return submit_to_queue(wq, work->_cb, work->_cb_arg,
+			       EAI_OSAL_WORK_PRIO_DEFAULT, EAI_OSAL_NO_WAIT, false) ?
+	       EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+}
+
+eai_osal_status_t eai_osal_work_submit_timeout(eai_osal_work_t *work,
+					       eai_osal_workqueue_t *wq,
+					       uint32_t timeout_ms)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	return submit_to_queue(wq, work->_cb, work->_cb_arg,
+			       EAI_OSAL_WORK_PRIO_DEFAULT, timeout_ms, false) ?
+	       EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+}
+
+eai_osal_status_t eai_osal_work_submit_prio(eai_osal_work_t *work,
+					    eai_osal_workqueue_t *wq,
+					    uint8_t prio)
+{
+	if (work == NULL || prio >= EAI_OSAL_PQUEUE_LEVELS) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	return submit_to_queue(wq, work->_cb, work->_cb_arg, prio,
+			       EAI_OSAL_NO_WAIT, false) ? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
 }
 
 /* ── Delayed work ─────────────────────────────────────────────────────── */
 
+/* In the timer service task; a full queue counts one reject, then retries */
 static void dwork_timer_cb(TimerHandle_t xTimer)
 {
 	eai_osal_dwork_t *dwork = (eai_osal_dwork_t *)pvTimerGetTimerID(xTimer);
@@ -116,9 +222,19 @@ static void dwork_timer_cb(TimerHandle_t xTimer)
 	if (wq == NULL) {
 		wq = get_sys_wq();
 	}
-	if (wq != NULL) {
-		submit_to_queue(wq->_queue, dwork->_cb, dwork->_cb_arg);
+	if (wq == NULL) {
+		return;
 	}
+	bool retry = dwork->_retrying;
+
+	dwork->_retrying = false;
+	if (submit_to_queue(wq, dwork->_cb, dwork->_cb_arg,
+			    EAI_OSAL_WORK_PRIO_DEFAULT, EAI_OSAL_NO_WAIT,
+			    retry)) {
+		return;
+	}
+	dwork->_retrying = true;
+	xTimerChangePeriod(dwork->_timer, 1, 0);
 }
 
 eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
@@ -131,6 +247,7 @@ eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
 	dwork->_cb = callback;
 	dwork->_cb_arg = arg;
 	dwork->_target_wq = NULL;
+	dwork->_retrying = false;
 
 	dwork->_timer = xTimerCreate("dwork",
 				     pdMS_TO_TICKS(1000), /* placeholder */
@@ -150,6 +267,7 @@ eai_osal_status_t eai_osal_dwork_submit(eai_osal_dwork_t *dwork,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	dwork->_target_wq = NULL;
+	dwork->_retrying = false;
 	xTimerChangePeriod(dwork->_timer, pdMS_TO_TICKS(delay_ms), portMAX_DELAY);
 	xTimerStart(dwork->_timer, portMAX_DELAY);
 	return EAI_OSAL_OK;
@@ -163,6 +281,7 @@ eai_osal_status_t eai_osal_dwork_submit_to(eai_osal_dwork_t *dwork,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	dwork->_target_wq = wq;
+	dwork->_retrying = false;
 	xTimerChangePeriod(dwork->_timer, pdMS_TO_TICKS(delay_ms), portMAX_DELAY);
 	xTimerStart(dwork->_timer, portMAX_DELAY);
 	return EAI_OSAL_OK;
@@ -179,6 +298,200 @@ eai_osal_status_t eai_osal_dwork_cancel(eai_osal_dwork_t *dwork)
 	return EAI_OSAL_ERROR;
 }
 
+/* ── Triggered work ───────────────────────────────────────────────────── */
+
+/*
+ * Same scheme as the POSIX backend. An armed item is listed on its
+ * entries' objects, like a blocked eai_osal_poll() caller, and for a
+ * finite timeout its one-shot timer runs. The first wake or expiry moves
+ * it from ARMED to FIRED and queues wp_run(); later ones do nothing.
+ * wp_run() takes it off the lists, stops the timer and rescans; with
+ * nothing ready and time left the wake was spurious (a stale expiry, or
+ * another consumer got there first) and it arms again.
+ *
+ * A wake that lands while submit is still listing the entries is parked
+ * as ARMING_WOKEN and acted on at the end of submit. A trigger that finds
+ * the queue full goes to RETRY and the timer tries again a tick later.
+ * Wakes run with poll_lock held and expiries in the timer service task,
+ * so neither waits for room in the timer command queue; a retry is lost
+ * only if that queue is full too.
+ *
+ * State changes are short, so they go under the OSAL critical section.
+ */
+enum {
+	WP_IDLE,
+	WP_ARMING,
+	WP_ARMING_WOKEN,
+	WP_ARMED,
+	WP_FIRED,
+	WP_RETRY,
+	WP_CANCELLING,
+};
+
+static bool wp_cas(eai_osal_work_poll_t *wp, uint8_t from, uint8_t to)
+{
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+	bool ok = wp->_state == from;
+
+	if (ok) {
+		wp->_state = to;
+	}
+	eai_osal_critical_exit(key);
+	return ok;
+}
+
+static void wp_run(void *arg);
+
+/*
+ * Queue wp_run() for an item that just went FIRED. retry is set when it
+ * comes back from RETRY, whose first attempt already counted the reject.
+ */
+static void wp_queue(eai_osal_work_poll_t *wp, TickType_t block, bool retry)
+{
+	if (submit_to_queue(wp->_wq, wp_run, wp, EAI_OSAL_WORK_PRIO_DEFAULT,
+			    EAI_OSAL_NO_WAIT, retry)) {
+		return;
+	}
+	wp->_state = WP_RETRY;
+	xTimerChangePeriod(wp->_timer, 1, block);
+}
+
+static void wp_trigger(eai_osal_work_poll_t *wp)
+{
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+	bool fired = false;
+
+	if (wp->_state == WP_ARMED) {
+		wp->_state = WP_FIRED;
+		fired = true;
+	} else if (wp->_state == WP_ARMING) {
+		wp->_state = WP_ARMING_WOKEN;
+	}
+	eai_osal_critical_exit(key);
+
+	if (fired) {
+		wp_queue(wp, 0, false);
+	}
+}
+
+/* Entry wake, with poll_lock held */
+static void wp_wake(struct osal_poller *poller)
+{
+	wp_trigger((eai_osal_work_poll_t *)poller); /* _poller is first */
+}
+
+/* Timeout or retry, in the timer service task */
+static void wp_timer_cb(TimerHandle_t timer)
+{
+	eai_osal_work_poll_t *wp = (eai_osal_work_poll_t *)pvTimerGetTimerID(timer);
+
+	if (wp_cas(wp, WP_RETRY, WP_FIRED)) {
+		wp_queue(wp, 0, true);
+	} else {
+		wp_trigger(wp);
+	}
+}
+
+static void wp_arm(eai_osal_work_poll_t *wp)
+{
+	wp->_state = WP_ARMING;
+	osal_poll_register(wp->_events, wp->_n, &wp->_poller);
+	if (wp->_wait != portMAX_DELAY) {
+		xTimerChangePeriod(wp->_timer, wp->_wait > 0 ? wp->_wait : 1,
+				   portMAX_DELAY);
+	}
+
+	if (!wp_cas(wp, WP_ARMING, WP_ARMED)) {
+		wp->_state = WP_FIRED; /* woken while listing */
+		wp_queue(wp, portMAX_DELAY, false);
+	} else if (osal_poll_any_ready(wp->_events, wp->_n)) {
+		wp_trigger(wp);
+	}
+}
+
+static void wp_run(void *arg)
+{
+	eai_osal_work_poll_t *wp = (eai_osal_work_poll_t *)arg;
+
+	xTimerStop(wp->_timer, portMAX_DELAY);
+	osal_poll_unregister(wp->_events, wp->_n);
+
+	/* Updates _start and _wait to the time left; portMAX_DELAY never expires */
+	if (!osal_poll_scan(wp->_events, wp->_n) &&
+	    xTaskCheckForTimeOut(&wp->_start, &wp->_wait) == pdFALSE) {
+		wp_arm(wp);
+		return;
+	}
+	wp->_state = WP_IDLE;
+	wp->_cb(wp->_cb_arg);
+}
+
+eai_osal_status_t eai_osal_work_poll_init(eai_osal_work_poll_t *wp,
+					  eai_osal_work_cb_t callback,
+					  void *arg)
+{
+	if (wp == NULL || callback == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	wp->_poller._wake = wp_wake;
+	wp->_cb = callback;
+	wp->_cb_arg = arg;
+	wp->_events = NULL;
+	wp->_n = 0;
+	wp->_wq = NULL;
+	wp->_state = WP_IDLE;
+
+	wp->_timer = xTimerCreate("wpoll",
+				  pdMS_TO_TICKS(1000), /* placeholder */
+				  pdFALSE,             /* one-shot */
+				  wp,                  /* timer ID */
+				  wp_timer_cb);
+	if (wp->_timer == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_poll_submit(eai_osal_work_poll_t *wp,
+					    eai_osal_workqueue_t *wq,
+					    eai_osal_poll_event_t *events,
+					    size_t n, uint32_t timeout_ms)
+{
+	if (wp == NULL || !osal_poll_valid(events, n)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	if (!wp_cas(wp, WP_IDLE, WP_ARMING)) {
+		return EAI_OSAL_ERROR;
+	}
+	wp->_events = events;
+	wp->_n = n;
+	wp->_wq = wq;
+	wp->_wait = osal_ticks(timeout_ms);
+	vTaskSetTimeOutState(&wp->_start);
+	wp_arm(wp);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_poll_cancel(eai_osal_work_poll_t *wp)
+{
+	if (wp == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!wp_cas(wp, WP_ARMED, WP_CANCELLING)) {
+		return EAI_OSAL_ERROR;
+	}
+	xTimerStop(wp->_timer, portMAX_DELAY);
+	osal_poll_unregister(wp->_events, wp->_n);
+	wp->_state = WP_IDLE;
+	return EAI_OSAL_OK;
+}
+
 /* ── Custom work queue ────────────────────────────────────────────────── */
 
 eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
@@ -187,13 +500,26 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 					    size_t stack_size,
 					    uint8_t priority)
 {
-	if (wq == NULL || stack == NULL || stack_size == 0) {
+	return eai_osal_workqueue_create_with_depth(wq, name, stack, stack_size,
+						    priority,
+						    EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH);
+}
+
+eai_osal_status_t eai_osal_workqueue_create_with_depth(eai_osal_workqueue_t *wq,
+						       const char *name,
+						       void *stack,
+						       size_t stack_size,
+						       uint8_t priority,
+						       uint32_t depth)
+{
+	if (wq == NULL || stack == NULL || stack_size == 0 || depth == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
-	wq->_queue = xQueueCreate(WQ_DEPTH, sizeof(struct wq_item));
-	if (wq->_queue == NULL) {
-		return EAI_OSAL_NO_MEMORY;
+	eai_osal_status_t status = wq_queue_create(wq, depth);
+
+	if (status != EAI_OSAL_OK) {
+		return status;
 	}
 
 	BaseType_t ret = xTaskCreate(wq_task,
@@ -203,10 +529,53 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 				     osal_priority(priority),
 				     &wq->_task);
 	if (ret != pdPASS) {
-		vQueueDelete(wq->_queue);
-		wq->_queue = NULL;
+		wq_queue_delete(wq);
 		return EAI_OSAL_NO_MEMORY;
 	}
 
 	return EAI_OSAL_OK;
 }
+
+/* ── Counters ─────────────────────────────────────────────────────────── */
+
+eai_osal_status_t eai_osal_workqueue_get_stats(eai_osal_workqueue_t *wq,
+					       eai_osal_workqueue_stats_t *stats)
+{
+	if (stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	uint32_t pending = eai_osal_pqueue_count(wq->_queue);
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	stats->depth = wq->_depth;
+	stats->pending = pending;
+	stats->high_water = wq->_high_water;
+	stats->rejected = wq->_rejected;
+	stats->max_latency_us = wq->_max_latency_us;
+	eai_osal_critical_exit(key);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_workqueue_reset_stats(eai_osal_workqueue_t *wq)
+{
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	uint32_t pending = eai_osal_pqueue_count(wq->_queue);
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	wq->_high_water = pending;
+	wq->_rejected = 0;
+	wq->_max_latency_us = 0;
+	eai_osal_critical_exit(key);
+	return EAI_OSAL_OK;
+}
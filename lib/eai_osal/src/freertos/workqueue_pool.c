@@ -0,0 +1,149 @@
+#include <eai_osal/workqueue.h>
+#include <eai_osal/critical.h>
+#include "internal.h"
+
+/*
+ * FreeRTOS work queue pool.
+ *
+ * n_workers tasks block on one shared queue of eai_osal_work_t pointers,
+ * so whichever task is free picks up the next item. Each item carries
+ * PENDING/RUNNING bits, updated in a critical section: an item is queued
+ * at most once, and an item submitted while running is re-queued by the
+ * task running it after the callback returns, so it never runs
+ * concurrently with itself. Destroy queues one NULL per task behind the
+ * outstanding work.
+ */
+
+#define POOL_DEPTH 32
+
+#define WORK_PENDING 1u
+#define WORK_RUNNING 2u
+
+static void pool_task(void *arg)
+{
+	eai_osal_workqueue_pool_t *pool = (eai_osal_workqueue_pool_t *)arg;
+	eai_osal_work_t *work;
+
+	for (;;) {
+		if (xQueueReceive(pool->_queue, &work, portMAX_DELAY) != pdTRUE) {
+			continue;
+		}
+		if (work == NULL) {
+			break;
+		}
+
+		bool again;
+
+		do {
+			eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+			work->_state = WORK_RUNNING;
+			eai_osal_critical_exit(key);
+
+			work->_cb(work->_cb_arg);
+
+			key = eai_osal_critical_enter();
+			again = (work->_state & WORK_PENDING) != 0;
+			work->_state = again ? WORK_PENDING : 0;
+			eai_osal_critical_exit(key);
+
+			/* Re-queue behind other work; run it again here if full */
+		} while (again && xQueueSend(pool->_queue, &work, 0) != pdTRUE);
+	}
+
+	xSemaphoreGive(pool->_exited);
+	vTaskDelete(NULL);
+}
+
+/* Stop the first n tasks after they finish queued work */
+static void pool_stop(eai_osal_workqueue_pool_t *pool, uint32_t n)
+{
+	eai_osal_work_t *stop = NULL;
+
+	for (uint32_t i = 0; i < n; i++) {
+		xQueueSend(pool->_queue, &stop, portMAX_DELAY);
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		xSemaphoreTake(pool->_exited, portMAX_DELAY);
+	}
+	vSemaphoreDelete(pool->_exited);
+	vQueueDelete(pool->_queue);
+	pool->_exited = NULL;
+	pool->_queue = NULL;
+	pool->_n_workers = 0;
+}
+
+eai_osal_status_t eai_osal_workqueue_pool_create(eai_osal_workqueue_pool_t *pool,
+						 uint32_t n_workers,
+						 const char *name,
+						 void *stacks,
+						 size_t stack_size,
+						 uint8_t priority)
+{
+	if (pool == NULL || n_workers == 0 || stacks == NULL || stack_size == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pool->_queue = xQueueCreate(POOL_DEPTH, sizeof(eai_osal_work_t *));
+	if (pool->_queue == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+	pool->_exited = xSemaphoreCreateCounting(n_workers, 0);
+	if (pool->_exited == NULL) {
+		vQueueDelete(pool->_queue);
+		pool->_queue = NULL;
+		return EAI_OSAL_NO_MEMORY;
+	}
+
+	for (uint32_t i = 0; i < n_workers; i++) {
+		BaseType_t ret = xTaskCreate(pool_task,
+					     name ? name : "wq_pool",
+					     stack_size / sizeof(StackType_t),
+					     pool,
+					     osal_priority(priority),
+					     NULL);
+		if (ret != pdPASS) {
+			pool_stop(pool, i);
+			return EAI_OSAL_NO_MEMORY;
+		}
+	}
+
+	pool->_n_workers = n_workers;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_workqueue_pool_destroy(eai_osal_workqueue_pool_t *pool)
+{
+	if (pool == NULL || pool->_queue == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	pool_stop(pool, pool->_n_workers);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_submit_to_pool(eai_osal_work_t *work,
+					       eai_osal_workqueue_pool_t *pool)
+{
+	if (work == NULL || pool == NULL || pool->_queue == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+	uint8_t state = work->_state;
+
+	work->_state = state | WORK_PENDING;
+	eai_osal_critical_exit(key);
+
+	if (state & (WORK_PENDING | WORK_RUNNING)) {
+		/* Already queued, or its task re-queues it after the callback */
+		return EAI_OSAL_OK;
+	}
+
+	if (xQueueSend(pool->_queue, &work, 0) != pdTRUE) {
+		key = eai_osal_critical_enter();
+		work->_state &= ~WORK_PENDING;
+		eai_osal_critical_exit(key);
+		return EAI_OSAL_TIMEOUT;
+	}
+	return EAI_OSAL_OK;
+}
@@ -1,21 +1,33 @@
 #include <eai_osal/event.h>
 #include "internal.h"
+#include "../stats_internal.h"
+
+/* Portable pthread path; Linux builds use event_futex.c */
+#if !EAI_OSAL_POSIX_FUTEX
 
 eai_osal_status_t eai_osal_event_create(eai_osal_event_t *event)
+{
+	return eai_osal_event_create_named(event, NULL);
+}
+
+eai_osal_status_t eai_osal_event_create_named(eai_osal_event_t *event,
+					      const char *name)
 {
 	if (event == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
 	event->_bits = 0;
+	atomic_init(&event->_pollers, NULL);
 
 	if (pthread_mutex_init(&event->_lock, NULL) != 0) {
 		return EAI_OSAL_ERROR;
 	}
-	if (pthread_cond_init(&event->_cond, NULL) != 0) {
+	if (osal_cond_init(&event->_cond) != 0) {
 		pthread_mutex_destroy(&event->_lock);
 		return EAI_OSAL_ERROR;
 	}
+	OSAL_STATS_INIT(event, EAI_OSAL_STATS_EVENT, name);
 	return EAI_OSAL_OK;
 }
 
@@ -24,6 +36,7 @@ eai_osal_status_t eai_osal_event_destroy(eai_osal_event_t *event)
 	if (event == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(event);
 	pthread_cond_destroy(&event->_cond);
 	pthread_mutex_destroy(&event->_lock);
 	return EAI_OSAL_OK;
@@ -36,11 +49,20 @@ eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits)
 	}
 	pthread_mutex_lock(&event->_lock);
 	event->_bits |= bits;
-	pthread_cond_broadcast(&event->_cond);
+	osal_cond_broadcast(&event->_cond);
 	pthread_mutex_unlock(&event->_lock);
+	osal_poll_notify(&event->_pollers);
 	return EAI_OSAL_OK;
 }
 
+bool osal_event_ready(eai_osal_event_t *event, uint32_t bits)
+{
+	pthread_mutex_lock(&event->_lock);
+	bool ready = (event->_bits & bits) != 0;
+	pthread_mutex_unlock(&event->_lock);
+	return ready;
+}
+
 eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 				      bool wait_all, uint32_t *actual,
 				      uint32_t timeout_ms)
@@ -55,6 +77,12 @@ eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 	#define BITS_MET(ev, b, all) \
 		((all) ? (((ev)->_bits & (b)) == (b)) : (((ev)->_bits & (b)) != 0))
 
+	uint32_t t0 = 0;
+
+	if (timeout_ms != EAI_OSAL_NO_WAIT && !BITS_MET(event, bits, wait_all)) {
+		t0 = OSAL_STATS_STAMP();
+	}
+
 	if (timeout_ms == EAI_OSAL_NO_WAIT) {
 		if (!BITS_MET(event, bits, wait_all)) {
 			pthread_mutex_unlock(&event->_lock);
@@ -62,12 +90,12 @@ eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 		}
 	} else if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
 		while (!BITS_MET(event, bits, wait_all)) {
-			pthread_cond_wait(&event->_cond, &event->_lock);
+			osal_cond_wait(&event->_cond, &event->_lock);
 		}
 	} else {
 		struct timespec ts = osal_timespec(timeout_ms);
 		while (!BITS_MET(event, bits, wait_all)) {
-			int ret = pthread_cond_timedwait(&event->_cond,
+			int ret = osal_cond_timedwait(&event->_cond,
 							 &event->_lock, &ts);
 			if (ret != 0) {
 				pthread_mutex_unlock(&event->_lock);
@@ -78,6 +106,7 @@ eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 
 	#undef BITS_MET
 
+	OSAL_STATS_RECORD(event, t0);
 	if (actual != NULL) {
 		*actual = event->_bits & bits;
 	}
@@ -95,3 +124,5 @@ eai_osal_status_t eai_osal_event_clear(eai_osal_event_t *event, uint32_t bits)
 	pthread_mutex_unlock(&event->_lock);
 	return EAI_OSAL_OK;
 }
+
+#endif /* !EAI_OSAL_POSIX_FUTEX */
@@ -0,0 +1,201 @@
+#include <eai_osal/event.h>
+#include "internal.h"
+#include "futex.h"
+#include "../stats_internal.h"
+
+/*
+ * Futex event group (Linux).
+ *
+ * The bit word is read and updated with atomics, so a wait that is
+ * already satisfied and a set with nobody waiting never touch the lock.
+ * A waiter that has to block links a node on its stack into _waitq and
+ * parks on the node's own futex word. Set walks the queue and wakes only
+ * the waiters whose masks are now satisfied, handing each the bits it
+ * saw — a clear racing the wakeup can't send it back to sleep.
+ *
+ * _nwait is bumped before a waiter's last look at the bits and read after
+ * set's update, both sequentially consistent, so set either sees the
+ * waiter or the waiter sees the bits.
+ */
+#if EAI_OSAL_POSIX_FUTEX
+
+struct osal_event_waiter {
+	struct osal_event_waiter *next;
+	uint32_t bits;
+	bool wait_all;
+	uint32_t actual;  /* matching bits at wake time */
+	atomic_uint done; /* futex word: 0 = parked, 1 = satisfied */
+};
+
+static bool bits_met(uint32_t have, uint32_t want, bool all)
+{
+	return all ? (have & want) == want : (have & want) != 0;
+}
+
+eai_osal_status_t eai_osal_event_create(eai_osal_event_t *event)
+{
+	return eai_osal_event_create_named(event, NULL);
+}
+
+eai_osal_status_t eai_osal_event_create_named(eai_osal_event_t *event,
+					      const char *name)
+{
+	if (event == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	atomic_init(&event->_bits, 0);
+	atomic_init(&event->_lock, 0);
+	atomic_init(&event->_nwait, 0);
+	event->_waitq = NULL;
+	atomic_init(&event->_pollers, NULL);
+	OSAL_STATS_INIT(event, EAI_OSAL_STATS_EVENT, name);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_event_destroy(eai_osal_event_t *event)
+{
+	if (event == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	OSAL_STATS_DEINIT(event);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits)
+{
+	if (event == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	atomic_fetch_or(&event->_bits, bits);
+	osal_poll_notify(&event->_pollers);
+	if (atomic_load(&event->_nwait) == 0) {
+		return EAI_OSAL_OK;
+	}
+
+	osal_flock(&event->_lock);
+
+	uint32_t now = atomic_load(&event->_bits);
+	struct osal_event_waiter **link = &event->_waitq;
+
+	while (*link != NULL) {
+		struct osal_event_waiter *w = *link;
+
+		if (!bits_met(now, w->bits, w->wait_all)) {
+			link = &w->next;
+			continue;
+		}
+		*link = w->next;
+		atomic_fetch_sub(&event->_nwait, 1);
+		w->actual = now & w->bits;
+		/*
+		 * Once done is set the waiter may return and reuse its stack;
+		 * a wake landing on a reused address is only spurious.
+		 */
+		atomic_store_explicit(&w->done, 1, memory_order_release);
+		osal_futex_wake(&w->done, 1);
+	}
+
+	osal_funlock(&event->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
+				      bool wait_all, uint32_t *actual,
+				      uint32_t timeout_ms)
+{
+	if (event == NULL || bits == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t t0 = 0;
+	uint32_t now = atomic_load(&event->_bits);
+
+	if (bits_met(now, bits, wait_all)) {
+		OSAL_STATS_RECORD(event, t0);
+		if (actual != NULL) {
+			*actual = now & bits;
+		}
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	t0 = OSAL_STATS_STAMP();
+
+	struct osal_event_waiter w = {
+		.bits = bits,
+		.wait_all = wait_all,
+	};
+
+	atomic_init(&w.done, 0);
+
+	osal_flock(&event->_lock);
+	atomic_fetch_add(&event->_nwait, 1);
+	now = atomic_load(&event->_bits);
+	if (bits_met(now, bits, wait_all)) {
+		atomic_fetch_sub(&event->_nwait, 1);
+		osal_funlock(&event->_lock);
+		OSAL_STATS_RECORD(event, t0);
+		if (actual != NULL) {
+			*actual = now & bits;
+		}
+		return EAI_OSAL_OK;
+	}
+	w.next = event->_waitq;
+	event->_waitq = &w;
+	osal_funlock(&event->_lock);
+
+	struct timespec ts;
+	const struct timespec *deadline = NULL;
+
+	if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		ts = osal_timespec(timeout_ms);
+		deadline = &ts;
+	}
+
+	while (atomic_load_explicit(&w.done, memory_order_acquire) == 0) {
+		if (osal_futex_wait(&w.done, 0, deadline) != ETIMEDOUT) {
+			continue;
+		}
+
+		/* Timed out — unlink unless a set got here first */
+		osal_flock(&event->_lock);
+		if (atomic_load_explicit(&w.done, memory_order_acquire) == 0) {
+			struct osal_event_waiter **link = &event->_waitq;
+
+			while (*link != &w) {
+				link = &(*link)->next;
+			}
+			*link = w.next;
+			atomic_fetch_sub(&event->_nwait, 1);
+			osal_funlock(&event->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+		osal_funlock(&event->_lock);
+	}
+
+	OSAL_STATS_RECORD(event, t0);
+	if (actual != NULL) {
+		*actual = w.actual;
+	}
+	return EAI_OSAL_OK;
+}
+
+bool osal_event_ready(eai_osal_event_t *event, uint32_t bits)
+{
+	return (atomic_load(&event->_bits) & bits) != 0;
+}
+
+eai_osal_status_t eai_osal_event_clear(eai_osal_event_t *event, uint32_t bits)
+{
+	if (event == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	atomic_fetch_and(&event->_bits, ~bits);
+	return EAI_OSAL_OK;
+}
+
+#endif /* EAI_OSAL_POSIX_FUTEX */
@@ -0,0 +1,165 @@
+#ifndef EAI_OSAL_POSIX_FUTEX_H
+#define EAI_OSAL_POSIX_FUTEX_H
+
+/*
+ * Linux futex primitives for the POSIX backend (EAI_OSAL_POSIX_FUTEX).
+ *
+ * Every word is process-private. Uncontended lock/unlock and signals with
+ * no parked waiter stay in user space; a syscall is made only to park or
+ * to wake a thread known to be parked.
+ */
+
+#include <eai_osal/types.h>
+#include "internal.h"
+
+#if EAI_OSAL_POSIX_FUTEX
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Park while *word == val, until woken or the absolute CLOCK_MONOTONIC
+ * deadline passes (NULL = forever) — osal_timespec() on Linux. Returns 0 on wake, ETIMEDOUT, or
+ * EAGAIN/EINTR — callers re-check their condition in a loop either way.
+ */
+static inline int osal_futex_wait(atomic_uint *word, uint32_t val,
+				  const struct timespec *deadline)
+{
+	if (syscall(SYS_futex, word, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+		    val, deadline, NULL, FUTEX_BITSET_MATCH_ANY) == 0) {
+		return 0;
+	}
+	return errno;
+}
+
+/* Wake up to n threads parked on word */
+static inline void osal_futex_wake(atomic_uint *word, int n)
+{
+	syscall(SYS_futex, word, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, n);
+}
+
+/* ── Lock ─────────────────────────────────────────────────────────────── */
+
+/*
+ * Three-state lock word: 0 = free, 1 = held, 2 = held with (possibly)
+ * parked waiters. Unlock only enters the kernel from state 2.
+ */
+static inline void osal_flock(atomic_uint *lock)
+{
+	unsigned int c = 0;
+
+	if (atomic_compare_exchange_strong_explicit(lock, &c, 1,
+						    memory_order_acquire,
+						    memory_order_relaxed)) {
+		return;
+	}
+	if (c != 2) {
+		c = atomic_exchange_explicit(lock, 2, memory_order_acquire);
+	}
+	while (c != 0) {
+		osal_futex_wait(lock, 2, NULL);
+		c = atomic_exchange_explicit(lock, 2, memory_order_acquire);
+	}
+}
+
+static inline void osal_funlock(atomic_uint *lock)
+{
+	if (atomic_exchange_explicit(lock, 0, memory_order_release) == 2) {
+		osal_futex_wake(lock, 1);
+	}
+}
+
+/* ── Condition ────────────────────────────────────────────────────────── */
+
+/*
+ * Condition variable over an osal_flock() lock, with a FIFO of parked
+ * waiters. Each waiter parks on a word in a node on its own stack; signal
+ * unlinks one node and wakes exactly that thread, so a signal or broadcast
+ * with nobody parked is just a NULL check. All calls need the lock held —
+ * including signal, which also keeps a woken node alive until the waiter
+ * has relocked.
+ */
+struct osal_fcond_node {
+	struct osal_fcond_node *next;
+	atomic_uint woken;
+};
+
+static inline void osal_fcond_init(osal_fcond_t *cond)
+{
+	cond->_head = NULL;
+	cond->_tail = NULL;
+}
+
+/* Returns 0 once signalled, or ETIMEDOUT at the deadline. Relocks either way. */
+static inline int osal_fcond_wait(osal_fcond_t *cond, atomic_uint *lock,
+				  const struct timespec *deadline)
+{
+	struct osal_fcond_node node = { .next = NULL };
+
+	atomic_init(&node.woken, 0);
+	if (cond->_tail != NULL) {
+		cond->_tail->next = &node;
+	} else {
+		cond->_head = &node;
+	}
+	cond->_tail = &node;
+	osal_funlock(lock);
+
+	while (atomic_load_explicit(&node.woken, memory_order_acquire) == 0) {
+		if (osal_futex_wait(&node.woken, 0, deadline) == ETIMEDOUT) {
+			break;
+		}
+	}
+
+	osal_flock(lock);
+	if (atomic_load_explicit(&node.woken, memory_order_relaxed) != 0) {
+		return 0;
+	}
+
+	/* Timed out and still queued — unlink */
+	struct osal_fcond_node *prev = NULL;
+	struct osal_fcond_node *n = cond->_head;
+
+	while (n != &node) {
+		prev = n;
+		n = n->next;
+	}
+	if (prev != NULL) {
+		prev->next = node.next;
+	} else {
+		cond->_head = node.next;
+	}
+	if (cond->_tail == &node) {
+		cond->_tail = prev;
+	}
+	return ETIMEDOUT;
+}
+
+static inline void osal_fcond_signal(osal_fcond_t *cond)
+{
+	struct osal_fcond_node *node = cond->_head;
+
+	if (node == NULL) {
+		return;
+	}
+	cond->_head = node->next;
+	if (cond->_head == NULL) {
+		cond->_tail = NULL;
+	}
+	atomic_store_explicit(&node->woken, 1, memory_order_release);
+	osal_futex_wake(&node->woken, 1);
+}
+
+static inline void osal_fcond_broadcast(osal_fcond_t *cond)
+{
+	while (cond->_head != NULL) {
+		osal_fcond_signal(cond);
+	}
+}
+
+#endif /* EAI_OSAL_POSIX_FUTEX */
+
+#endif /* EAI_OSAL_POSIX_FUTEX_H */
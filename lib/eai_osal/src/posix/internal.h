@@ -2,18 +2,101 @@
 #define EAI_OSAL_POSIX_INTERNAL_H
 
 #include <eai_osal/types.h>
+#include <eai_osal/poll.h>
+#include <errno.h>
 #include <time.h>
 
 /*
- * Compute absolute timespec for pthread_cond_timedwait / pthread_mutex_timedlock.
- * Uses CLOCK_REALTIME because macOS doesn't support pthread_condattr_setclock
- * with CLOCK_MONOTONIC.
+ * Timed waits run on CLOCK_MONOTONIC, so a wall-clock step (NTP, manual
+ * set) can't stretch or cut short a timeout. Condvars must be created with
+ * osal_cond_init() to match. macOS lacks pthread_condattr_setclock, so
+ * there condvars and deadlines stay on CLOCK_REALTIME.
  */
+#if defined(__APPLE__)
+#define OSAL_COND_CLOCK CLOCK_REALTIME
+#else
+#define OSAL_COND_CLOCK CLOCK_MONOTONIC
+#endif
+
+/* glibc 2.30+ can time a mutex lock against CLOCK_MONOTONIC */
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 30)
+#define OSAL_HAVE_MUTEX_CLOCKLOCK 1
+#endif
+#endif
+
+/*
+ * Virtual time (vtime.c, CONFIG_EAI_OSAL_VIRTUAL_TIME). The clock below
+ * reads simulated time, and every OSAL wait parks through osal_vt_wait()
+ * so the clock can tell when all threads are blocked. The backend counts
+ * each thread it starts with osal_vt_thread_add() before pthread_create(),
+ * and calls osal_vt_thread_exit() as the thread's last act, or when
+ * pthread_create() fails.
+ */
+#define OSAL_VT_FOREVER UINT64_MAX
+
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+uint64_t osal_vt_now_ns(void);
+void osal_vt_thread_add(void);
+void osal_vt_thread_exit(void);
+
+/*
+ * Park until osal_vt_wake(key) or the virtual deadline. lock, if not
+ * NULL, is held on entry, released while parked and retaken. Returns 0 or
+ * ETIMEDOUT; callers re-check their condition either way.
+ */
+int osal_vt_wait(const void *key, pthread_mutex_t *lock, uint64_t deadline_ns);
+void osal_vt_wake(const void *key, bool all);
+
+/* Lock mutex, parking while it is held; osal_vt_wake(mutex) on unlock */
+int osal_vt_mutex_lock(pthread_mutex_t *mutex, uint64_t deadline_ns);
+#else
+static inline void osal_vt_thread_add(void) {}
+static inline void osal_vt_thread_exit(void) {}
+#endif
+
+static inline int osal_cond_init(pthread_cond_t *cond)
+{
+#if defined(__APPLE__)
+	return pthread_cond_init(cond, NULL);
+#else
+	pthread_condattr_t attr;
+	int ret;
+
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, OSAL_COND_CLOCK);
+	ret = pthread_cond_init(cond, &attr);
+	pthread_condattr_destroy(&attr);
+	return ret;
+#endif
+}
+
+/* CLOCK_MONOTONIC in nanoseconds — timebase for absolute deadlines. */
+static inline uint64_t osal_mono_ns(void)
+{
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+	return osal_vt_now_ns();
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* Absolute OSAL_COND_CLOCK deadline ms from now, for timed waits */
 static inline struct timespec osal_timespec(uint32_t ms)
 {
 	struct timespec ts;
 
-	clock_gettime(CLOCK_REALTIME, &ts);
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+	uint64_t now = osal_vt_now_ns();
+
+	ts.tv_sec = (time_t)(now / 1000000000ULL);
+	ts.tv_nsec = (long)(now % 1000000000ULL);
+#else
+	clock_gettime(OSAL_COND_CLOCK, &ts);
+#endif
 	ts.tv_sec += ms / 1000;
 	ts.tv_nsec += (long)(ms % 1000) * 1000000L;
 	if (ts.tv_nsec >= 1000000000L) {
@@ -23,4 +106,109 @@ static inline struct timespec osal_timespec(uint32_t ms)
 	return ts;
 }
 
+/*
+ * Condvar waits and wakes. Every backend wait goes through these, so
+ * virtual time can see it; otherwise they are the pthread calls.
+ */
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+static inline int osal_cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock)
+{
+	return osal_vt_wait(cond, lock, OSAL_VT_FOREVER);
+}
+
+static inline int osal_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *lock,
+				      const struct timespec *ts)
+{
+	return osal_vt_wait(cond, lock,
+			    (uint64_t)ts->tv_sec * 1000000000ULL + (uint64_t)ts->tv_nsec);
+}
+
+static inline void osal_cond_signal(pthread_cond_t *cond)
+{
+	osal_vt_wake(cond, false);
+}
+
+static inline void osal_cond_broadcast(pthread_cond_t *cond)
+{
+	osal_vt_wake(cond, true);
+}
+#else
+#define osal_cond_wait      pthread_cond_wait
+#define osal_cond_timedwait pthread_cond_timedwait
+#define osal_cond_signal    pthread_cond_signal
+#define osal_cond_broadcast pthread_cond_broadcast
+#endif
+
+/* Wrapping microsecond clock for wait-time stats (stats_internal.h) */
+static inline uint32_t osal_now_us(void)
+{
+	return (uint32_t)(osal_mono_ns() / 1000);
+}
+
+/*
+ * Thread setup (thread.c). OSAL threads, work queue threads, and pool
+ * workers call osal_thread_setup() first thing on their own thread, so
+ * the entry function never runs with the creator's scheduling. Names are
+ * copied at create time, truncated to what Linux keeps.
+ */
+#define OSAL_THREAD_NAME_LEN 16
+#define OSAL_PRIO_INHERIT    0xFF /* keep the creator's policy and priority */
+
+static inline void osal_thread_name_copy(char *dst, const char *name)
+{
+	size_t i = 0;
+
+	if (name != NULL) {
+		for (; i < OSAL_THREAD_NAME_LEN - 1 && name[i] != '\0'; i++) {
+			dst[i] = name[i];
+		}
+	}
+	dst[i] = '\0';
+}
+
+void osal_thread_setup(const char *name, uint8_t priority);
+
+/*
+ * eai_osal_poll() support (poll.c). Every object kind that can be polled
+ * keeps a _pollers list, and calls osal_poll_notify() on it after any
+ * change that can make it ready. osal_*_ready() report readiness without
+ * consuming anything.
+ */
+void osal_poll_notify(_Atomic(struct osal_poll_node *) *pollers);
+bool osal_sem_ready(eai_osal_sem_t *sem);
+bool osal_queue_ready(eai_osal_queue_t *queue);
+bool osal_event_ready(eai_osal_event_t *event, uint32_t bits);
+
+/*
+ * Poll entry helpers, shared with triggered work (workqueue.c). scan
+ * refreshes each entry's ready flag; any_ready only reads, for callers
+ * that may race the entries' owner. register/unregister take poll_lock,
+ * and register fences after linking, as osal_poll_notify() expects.
+ */
+bool osal_poll_valid(const eai_osal_poll_event_t *events, size_t n);
+bool osal_poll_scan(eai_osal_poll_event_t *events, size_t n);
+bool osal_poll_any_ready(const eai_osal_poll_event_t *events, size_t n);
+void osal_poll_register(eai_osal_poll_event_t *events, size_t n,
+			struct osal_poller *poller);
+void osal_poll_unregister(eai_osal_poll_event_t *events, size_t n);
+
+/*
+ * Timer service hooks for OSAL-internal timers (timer.c).
+ *
+ * An expiry hook runs on the service thread with the service lock held,
+ * instead of a user callback with the lock released. It must not block or
+ * call timer APIs. In exchange, arming and stopping under the same lock is
+ * atomic with respect to expiry: once osal_timer_stop_locked() returns, the
+ * hook will not run for the previous arming.
+ */
+typedef void (*osal_timer_expire_t)(eai_osal_timer_t *timer);
+
+void osal_timer_init_internal(eai_osal_timer_t *timer, osal_timer_expire_t expire);
+void osal_timer_svc_lock(void);
+void osal_timer_svc_unlock(void);
+eai_osal_status_t osal_timer_start_locked(eai_osal_timer_t *timer,
+					  uint32_t initial_ms,
+					  uint32_t period_ms);
+bool osal_timer_stop_locked(eai_osal_timer_t *timer);
+
 #endif /* EAI_OSAL_POSIX_INTERNAL_H */
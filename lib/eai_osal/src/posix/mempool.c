@@ -0,0 +1,170 @@
+#include <eai_osal/mempool.h>
+#include <eai_osal/semaphore.h>
+#include <stdlib.h>
+
+/*
+ * POSIX block pool.
+ *
+ * Free blocks sit on a Treiber stack of block indices. The links live in a
+ * side array rather than in the blocks, so a popper reading the link of a
+ * block another thread has just taken never races with that thread's
+ * writes. _top carries a tag bumped on every update, so a pop that read a
+ * stale link loses its CAS instead of corrupting the stack (ABA).
+ *
+ * _free_sem counts free blocks. Free pushes before it gives and alloc
+ * takes before it pops, so a successful take guarantees the pop finds a
+ * block. On Linux the semaphore is a futex word, so neither side makes a
+ * syscall unless an alloc has to wait.
+ */
+
+#define TOP_IDX(top) ((uint32_t)(top))
+#define TOP_TAG(top) ((uint32_t)((top) >> 32))
+#define TOP_MAKE(tag, idx) (((uint64_t)(tag) << 32) | (idx))
+
+static void stack_push(eai_osal_mempool_t *pool, uint32_t idx)
+{
+	uint64_t top = atomic_load_explicit(&pool->_top, memory_order_relaxed);
+	uint64_t next;
+
+	do {
+		atomic_store_explicit(&pool->_next[idx], TOP_IDX(top),
+				      memory_order_relaxed);
+		next = TOP_MAKE(TOP_TAG(top) + 1, idx + 1);
+	} while (!atomic_compare_exchange_weak_explicit(&pool->_top, &top, next,
+							memory_order_release,
+							memory_order_relaxed));
+}
+
+/* Only called with a _free_sem token in hand, so the stack is non-empty */
+static uint32_t stack_pop(eai_osal_mempool_t *pool)
+{
+	uint64_t top = atomic_load_explicit(&pool->_top, memory_order_acquire);
+	uint64_t next;
+
+	do {
+		uint32_t link = atomic_load_explicit(&pool->_next[TOP_IDX(top) - 1],
+						     memory_order_relaxed);
+
+		next = TOP_MAKE(TOP_TAG(top) + 1, link);
+	} while (!atomic_compare_exchange_weak_explicit(&pool->_top, &top, next,
+							memory_order_acquire,
+							memory_order_acquire));
+	return TOP_IDX(top) - 1;
+}
+
+eai_osal_status_t eai_osal_mempool_create(eai_osal_mempool_t *pool,
+					  size_t block_size, uint32_t n_blocks,
+					  void *buffer)
+{
+	if (pool == NULL || buffer == NULL || n_blocks == 0 || block_size == 0 ||
+	    block_size % sizeof(void *) != 0 ||
+	    (uintptr_t)buffer % sizeof(void *) != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pool->_next = malloc(n_blocks * sizeof(atomic_uint));
+	if (pool->_next == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+	if (eai_osal_sem_create(&pool->_free_sem, n_blocks, n_blocks) != EAI_OSAL_OK) {
+		free(pool->_next);
+		pool->_next = NULL;
+		return EAI_OSAL_ERROR;
+	}
+
+	pool->_buf = (uint8_t *)buffer;
+	pool->_block_size = block_size;
+	pool->_n_blocks = n_blocks;
+
+	/* Block 0 on top, so a fresh pool hands blocks out in address order */
+	for (uint32_t i = 0; i < n_blocks; i++) {
+		atomic_init(&pool->_next[i], i + 2 <= n_blocks ? i + 2 : 0);
+	}
+	atomic_init(&pool->_top, TOP_MAKE(0, 1));
+	atomic_init(&pool->_used, 0);
+	atomic_init(&pool->_high_water, 0);
+	atomic_init(&pool->_failures, 0);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_destroy(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	eai_osal_sem_destroy(&pool->_free_sem);
+	free(pool->_next);
+	pool->_next = NULL;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_alloc(eai_osal_mempool_t *pool, void **block,
+					 uint32_t timeout_ms)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	if (eai_osal_sem_take(&pool->_free_sem, timeout_ms) != EAI_OSAL_OK) {
+		atomic_fetch_add_explicit(&pool->_failures, 1, memory_order_relaxed);
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	uint32_t idx = stack_pop(pool);
+	unsigned int used = atomic_fetch_add_explicit(&pool->_used, 1,
+						      memory_order_relaxed) + 1;
+	unsigned int hw = atomic_load_explicit(&pool->_high_water,
+					       memory_order_relaxed);
+
+	while (used > hw &&
+	       !atomic_compare_exchange_weak_explicit(&pool->_high_water, &hw, used,
+						      memory_order_relaxed,
+						      memory_order_relaxed)) {
+	}
+
+	*block = pool->_buf + (size_t)idx * pool->_block_size;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_free(eai_osal_mempool_t *pool, void *block)
+{
+	if (pool == NULL || block == NULL || (uint8_t *)block < pool->_buf) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	size_t off = (size_t)((uint8_t *)block - pool->_buf);
+
+	if (off % pool->_block_size != 0 ||
+	    off / pool->_block_size >= pool->_n_blocks) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	atomic_fetch_sub_explicit(&pool->_used, 1, memory_order_relaxed);
+	stack_push(pool, (uint32_t)(off / pool->_block_size));
+	eai_osal_sem_give(&pool->_free_sem);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_get_stats(eai_osal_mempool_t *pool,
+					     eai_osal_mempool_stats_t *stats)
+{
+	if (pool == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	stats->block_size = (uint32_t)pool->_block_size;
+	stats->n_blocks = pool->_n_blocks;
+	stats->used = atomic_load(&pool->_used);
+	stats->high_water = atomic_load(&pool->_high_water);
+	stats->failures = atomic_load(&pool->_failures);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_reset_stats(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	atomic_store(&pool->_failures, 0);
+	atomic_store(&pool->_high_water, atomic_load(&pool->_used));
+	return EAI_OSAL_OK;
+}
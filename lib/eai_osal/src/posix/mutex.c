@@ -1,9 +1,20 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_mutex_clocklock */
+#endif
+
 #include <eai_osal/mutex.h>
 #include "internal.h"
+#include "../stats_internal.h"
 #include <errno.h>
 #include <unistd.h>
 
 eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex)
+{
+	return eai_osal_mutex_create_named(mutex, NULL);
+}
+
+eai_osal_status_t eai_osal_mutex_create_named(eai_osal_mutex_t *mutex,
+					      const char *name)
 {
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
@@ -16,7 +27,11 @@ eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex)
 	int ret = pthread_mutex_init(&mutex->_handle, &attr);
 	pthread_mutexattr_destroy(&attr);
 
-	return ret == 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
+	if (ret != 0) {
+		return EAI_OSAL_ERROR;
+	}
+	OSAL_STATS_INIT(mutex, EAI_OSAL_STATS_MUTEX, name);
+	return EAI_OSAL_OK;
 }
 
 eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex)
@@ -24,6 +39,7 @@ eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex)
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(mutex);
 	pthread_mutex_destroy(&mutex->_handle);
 	return EAI_OSAL_OK;
 }
@@ -34,16 +50,72 @@ eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
+	uint32_t t0 = 0;
+
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+	/* A blocked lock parks in virtual time, so a sleeping owner can't stall the clock */
+	if (pthread_mutex_trylock(&mutex->_handle) == 0) {
+		OSAL_STATS_RECORD(mutex, t0);
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+	t0 = OSAL_STATS_STAMP();
+
+	uint64_t deadline = timeout_ms == EAI_OSAL_WAIT_FOREVER
+		? OSAL_VT_FOREVER
+		: osal_mono_ns() + (uint64_t)timeout_ms * 1000000ULL;
+
+	if (osal_vt_mutex_lock(&mutex->_handle, deadline) != 0) {
+		return EAI_OSAL_TIMEOUT;
+	}
+	OSAL_STATS_RECORD(mutex, t0);
+	return EAI_OSAL_OK;
+#endif
+
 	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
-		return pthread_mutex_lock(&mutex->_handle) == 0
-			? EAI_OSAL_OK : EAI_OSAL_ERROR;
+		/* Stats: try first, so only a lock that blocks is timed */
+		if (OSAL_STATS_ENABLED &&
+		    pthread_mutex_trylock(&mutex->_handle) == 0) {
+			OSAL_STATS_RECORD(mutex, t0);
+			return EAI_OSAL_OK;
+		}
+		t0 = OSAL_STATS_STAMP();
+		if (pthread_mutex_lock(&mutex->_handle) != 0) {
+			return EAI_OSAL_ERROR;
+		}
+		OSAL_STATS_RECORD(mutex, t0);
+		return EAI_OSAL_OK;
 	}
 
 	if (timeout_ms == EAI_OSAL_NO_WAIT) {
-		return pthread_mutex_trylock(&mutex->_handle) == 0
-			? EAI_OSAL_OK : EAI_OSAL_TIMEOUT;
+		if (pthread_mutex_trylock(&mutex->_handle) != 0) {
+			return EAI_OSAL_TIMEOUT;
+		}
+		OSAL_STATS_RECORD(mutex, t0);
+		return EAI_OSAL_OK;
+	}
+
+#ifdef OSAL_HAVE_MUTEX_CLOCKLOCK
+	if (pthread_mutex_trylock(&mutex->_handle) == 0) {
+		OSAL_STATS_RECORD(mutex, t0);
+		return EAI_OSAL_OK;
 	}
+	t0 = OSAL_STATS_STAMP();
 
+	struct timespec ts = osal_timespec(timeout_ms);
+	int ret = pthread_mutex_clocklock(&mutex->_handle, CLOCK_MONOTONIC, &ts);
+
+	if (ret == ETIMEDOUT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+	if (ret != 0) {
+		return EAI_OSAL_ERROR;
+	}
+	OSAL_STATS_RECORD(mutex, t0);
+	return EAI_OSAL_OK;
+#else
 	/*
 	 * macOS lacks pthread_mutex_timedlock. Use trylock + sleep loop.
 	 * 1ms resolution is fine for test timeouts (50-200ms).
@@ -52,12 +124,17 @@ eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_
 
 	while (waited < timeout_ms) {
 		if (pthread_mutex_trylock(&mutex->_handle) == 0) {
+			OSAL_STATS_RECORD(mutex, t0);
 			return EAI_OSAL_OK;
 		}
+		if (t0 == 0) {
+			t0 = OSAL_STATS_STAMP();
+		}
 		usleep(1000); /* 1ms */
 		waited++;
 	}
 	return EAI_OSAL_TIMEOUT;
+#endif
 }
 
 eai_osal_status_t eai_osal_mutex_unlock(eai_osal_mutex_t *mutex)
@@ -65,6 +142,11 @@ eai_osal_status_t eai_osal_mutex_unlock(eai_osal_mutex_t *mutex)
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return pthread_mutex_unlock(&mutex->_handle) == 0
-		? EAI_OSAL_OK : EAI_OSAL_ERROR;
+	if (pthread_mutex_unlock(&mutex->_handle) != 0) {
+		return EAI_OSAL_ERROR;
+	}
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+	osal_vt_wake(&mutex->_handle, false);
+#endif
+	return EAI_OSAL_OK;
 }
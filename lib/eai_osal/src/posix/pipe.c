@@ -0,0 +1,288 @@
+#include <eai_osal/pipe.h>
+#include <eai_osal/semaphore.h>
+#include <eai_osal/time.h>
+#include <string.h>
+
+/*
+ * Byte pipe as a lock-free SPSC ring, in the manner of spsc.c.
+ *
+ * _head and _tail count bytes modulo 2 * _size, so head - tail tells a
+ * full ring from an empty one without a separate count, and the counters
+ * never wrap unevenly whatever the size. Each side publishes its counter
+ * with release ordering and reads the other's with acquire.
+ *
+ * A side that must wait posts how much it needs in its _*_want, fences,
+ * and looks again before parking on its semaphore. The other side fences
+ * after publishing and gives the semaphore only once the waiter's need is
+ * met, so a reader waiting for its threshold isn't woken by each small
+ * write. One of the two always sees the other, so no wakeup is lost; a
+ * stale give costs one extra look.
+ *
+ * A writer waits for (size - threshold) / 2 + 1 bytes of space at most.
+ * The reader can only be waiting while the pipe holds less than the
+ * threshold, which leaves more space than that, so the two sides are
+ * never both parked.
+ */
+
+static size_t pipe_fill(const eai_osal_pipe_t *pipe, size_t head, size_t tail)
+{
+	return head >= tail ? head - tail : head + 2 * pipe->_size - tail;
+}
+
+static size_t pipe_advance(const eai_osal_pipe_t *pipe, size_t pos, size_t n)
+{
+	pos += n;
+	return pos >= 2 * pipe->_size ? pos - 2 * pipe->_size : pos;
+}
+
+static size_t pipe_offset(const eai_osal_pipe_t *pipe, size_t pos)
+{
+	return pos >= pipe->_size ? pos - pipe->_size : pos;
+}
+
+eai_osal_status_t eai_osal_pipe_create(eai_osal_pipe_t *pipe, void *buffer,
+				       size_t size, size_t threshold)
+{
+	if (pipe == NULL || buffer == NULL || size == 0 || size > SIZE_MAX / 2 ||
+	    threshold == 0 || threshold > size) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pipe->_buf = (uint8_t *)buffer;
+	pipe->_size = size;
+	pipe->_threshold = threshold;
+	atomic_init(&pipe->_head, 0);
+	atomic_init(&pipe->_tail, 0);
+	atomic_init(&pipe->_rx_want, 0);
+	atomic_init(&pipe->_tx_want, 0);
+
+	if (eai_osal_sem_create(&pipe->_rx_sem, 0, 1) != EAI_OSAL_OK) {
+		return EAI_OSAL_ERROR;
+	}
+	if (eai_osal_sem_create(&pipe->_tx_sem, 0, 1) != EAI_OSAL_OK) {
+		eai_osal_sem_destroy(&pipe->_rx_sem);
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_pipe_destroy(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	eai_osal_sem_destroy(&pipe->_tx_sem);
+	eai_osal_sem_destroy(&pipe->_rx_sem);
+	return EAI_OSAL_OK;
+}
+
+/* ── Waiting ──────────────────────────────────────────────────────────── */
+
+/* Time budget of one call; the clock is only read once it has to wait */
+struct pipe_timeout {
+	uint32_t timeout_ms;
+	uint32_t start;
+	bool started;
+};
+
+static size_t rx_avail(eai_osal_pipe_t *pipe)
+{
+	return pipe_fill(pipe, atomic_load_explicit(&pipe->_head, memory_order_acquire),
+			 atomic_load_explicit(&pipe->_tail, memory_order_relaxed));
+}
+
+static size_t tx_avail(eai_osal_pipe_t *pipe)
+{
+	return pipe->_size -
+	       pipe_fill(pipe, atomic_load_explicit(&pipe->_head, memory_order_relaxed),
+			 atomic_load_explicit(&pipe->_tail, memory_order_acquire));
+}
+
+/*
+ * Park on sem until avail(pipe) reaches want or the budget runs out.
+ * Returns false once the budget has run out; true means look again.
+ */
+static bool pipe_park(eai_osal_pipe_t *pipe, atomic_size_t *want_slot,
+		      size_t want, eai_osal_sem_t *sem,
+		      size_t (*avail)(eai_osal_pipe_t *), struct pipe_timeout *t)
+{
+	uint32_t wait_ms = t->timeout_ms;
+
+	if (t->timeout_ms == EAI_OSAL_NO_WAIT) {
+		return false;
+	}
+	if (t->timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		uint32_t now = eai_osal_time_get_ms();
+
+		if (!t->started) {
+			t->start = now;
+			t->started = true;
+		}
+		if (now - t->start >= t->timeout_ms) {
+			return false;
+		}
+		wait_ms = t->timeout_ms - (now - t->start);
+	}
+
+	atomic_store_explicit(want_slot, want, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	if (avail(pipe) < want) {
+		(void)eai_osal_sem_take(sem, wait_ms);
+	}
+	atomic_store_explicit(want_slot, 0, memory_order_relaxed);
+	return true;
+}
+
+/* Give sem if the other side is parked and now has what it waits for */
+static void pipe_wake(eai_osal_pipe_t *pipe, atomic_size_t *want_slot,
+		      eai_osal_sem_t *sem, size_t (*avail)(eai_osal_pipe_t *))
+{
+	atomic_thread_fence(memory_order_seq_cst);
+
+	size_t want = atomic_load_explicit(want_slot, memory_order_relaxed);
+
+	if (want != 0 && avail(pipe) >= want &&
+	    atomic_compare_exchange_strong_explicit(want_slot, &want, 0,
+						    memory_order_relaxed,
+						    memory_order_relaxed)) {
+		eai_osal_sem_give(sem);
+	}
+}
+
+/* ── Copying ──────────────────────────────────────────────────────────── */
+
+/* Copy in what fits of n bytes, two memcpys at most (writer only) */
+static size_t pipe_put(eai_osal_pipe_t *pipe, const uint8_t *src, size_t n)
+{
+	size_t head = atomic_load_explicit(&pipe->_head, memory_order_relaxed);
+	size_t tail = atomic_load_explicit(&pipe->_tail, memory_order_acquire);
+	size_t space = pipe->_size - pipe_fill(pipe, head, tail);
+
+	if (n > space) {
+		n = space;
+	}
+	if (n == 0) {
+		return 0;
+	}
+
+	size_t off = pipe_offset(pipe, head);
+	size_t first = pipe->_size - off;
+
+	if (first > n) {
+		first = n;
+	}
+	memcpy(pipe->_buf + off, src, first);
+	memcpy(pipe->_buf, src + first, n - first);
+
+	atomic_store_explicit(&pipe->_head, pipe_advance(pipe, head, n),
+			      memory_order_release);
+	pipe_wake(pipe, &pipe->_rx_want, &pipe->_rx_sem, rx_avail);
+	return n;
+}
+
+/* Copy out up to n bytes (reader only) */
+static size_t pipe_get(eai_osal_pipe_t *pipe, uint8_t *dst, size_t n)
+{
+	size_t tail = atomic_load_explicit(&pipe->_tail, memory_order_relaxed);
+	size_t head = atomic_load_explicit(&pipe->_head, memory_order_acquire);
+	size_t fill = pipe_fill(pipe, head, tail);
+
+	if (n > fill) {
+		n = fill;
+	}
+	if (n == 0) {
+		return 0;
+	}
+
+	size_t off = pipe_offset(pipe, tail);
+	size_t first = pipe->_size - off;
+
+	if (first > n) {
+		first = n;
+	}
+	memcpy(dst, pipe->_buf + off, first);
+	memcpy(dst + first, pipe->_buf, n - first);
+
+	atomic_store_explicit(&pipe->_tail, pipe_advance(pipe, tail, n),
+			      memory_order_release);
+	pipe_wake(pipe, &pipe->_tx_want, &pipe->_tx_sem, tx_avail);
+	return n;
+}
+
+/* ── Transfer ─────────────────────────────────────────────────────────── */
+
+eai_osal_status_t eai_osal_pipe_write(eai_osal_pipe_t *pipe, const void *data,
+				      size_t len, size_t *written,
+				      uint32_t timeout_ms)
+{
+	if (pipe == NULL || (data == NULL && len > 0)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	const uint8_t *src = (const uint8_t *)data;
+	struct pipe_timeout t = { .timeout_ms = timeout_ms };
+	size_t batch = (pipe->_size - pipe->_threshold) / 2 + 1;
+	eai_osal_status_t ret = EAI_OSAL_OK;
+	size_t done = pipe_put(pipe, src, len);
+
+	while (done < len) {
+		size_t want = len - done < batch ? len - done : batch;
+
+		if (!pipe_park(pipe, &pipe->_tx_want, want, &pipe->_tx_sem,
+			       tx_avail, &t)) {
+			ret = EAI_OSAL_TIMEOUT;
+			break;
+		}
+		done += pipe_put(pipe, src + done, len - done);
+	}
+
+	if (written != NULL) {
+		*written = done;
+	}
+	return ret;
+}
+
+eai_osal_status_t eai_osal_pipe_read(eai_osal_pipe_t *pipe, void *data,
+				     size_t len, size_t *read,
+				     uint32_t timeout_ms)
+{
+	if (pipe == NULL || (data == NULL && len > 0) || read == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	struct pipe_timeout t = { .timeout_ms = timeout_ms };
+	size_t need = len < pipe->_threshold ? len : pipe->_threshold;
+	eai_osal_status_t ret = EAI_OSAL_OK;
+
+	while (rx_avail(pipe) < need) {
+		if (!pipe_park(pipe, &pipe->_rx_want, need, &pipe->_rx_sem,
+			       rx_avail, &t)) {
+			ret = EAI_OSAL_TIMEOUT;
+			break;
+		}
+	}
+
+	*read = pipe_get(pipe, (uint8_t *)data, len);
+	return ret;
+}
+
+size_t eai_osal_pipe_count(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return 0;
+	}
+	size_t tail = atomic_load_explicit(&pipe->_tail, memory_order_acquire);
+	size_t head = atomic_load_explicit(&pipe->_head, memory_order_acquire);
+	size_t fill = pipe_fill(pipe, head, tail);
+
+	/* The writer may have refilled past our stale tail */
+	return fill > pipe->_size ? pipe->_size : fill;
+}
+
+size_t eai_osal_pipe_space(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return 0;
+	}
+	return pipe->_size - eai_osal_pipe_count(pipe);
+}
@@ -0,0 +1,207 @@
+#include <eai_osal/poll.h>
+#include <eai_osal/semaphore.h>
+#include "internal.h"
+
+/*
+ * POSIX poll.
+ *
+ * Each eai_osal_poll() call parks on a binary semaphore in a poll_waiter
+ * on its stack. While it waits, each entry's _priv node is linked into its
+ * object's _pollers list. Only poll_lock guards the lists.
+ * osal_poll_notify() wakes every listed poller, which for a waiter gives
+ * its semaphore, and the poller rescans. A spurious give only costs one
+ * extra scan. Triggered work (workqueue.c) lists itself the same way.
+ *
+ * No wakeup is lost. The poller links its nodes, fences, then scans. A
+ * notifier changes the object's state, fences, then loads _pollers. Either
+ * the scan sees the new state, or the notifier sees the node.
+ *
+ * Lock order is object lock -> poll_lock, because queues notify with
+ * their lock held. Scans take object locks without poll_lock held.
+ */
+
+struct poll_waiter {
+	struct osal_poller poller; /* must stay first — wake hook casts back */
+	eai_osal_sem_t wake;
+};
+
+static pthread_mutex_t poll_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void waiter_wake(struct osal_poller *poller)
+{
+	eai_osal_sem_give(&((struct poll_waiter *)poller)->wake);
+}
+
+void osal_poll_notify(_Atomic(struct osal_poll_node *) *pollers)
+{
+	atomic_thread_fence(memory_order_seq_cst);
+	if (atomic_load_explicit(pollers, memory_order_relaxed) == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&poll_lock);
+	for (struct osal_poll_node *n = atomic_load_explicit(pollers, memory_order_relaxed);
+	     n != NULL; n = n->_next) {
+		n->_poller->_wake(n->_poller);
+	}
+	pthread_mutex_unlock(&poll_lock);
+}
+
+static _Atomic(struct osal_poll_node *) *entry_list(eai_osal_poll_event_t *ev)
+{
+	switch (ev->type) {
+	case EAI_OSAL_POLL_SEM_AVAILABLE:
+		return &ev->sem->_pollers;
+	case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+		return &ev->queue->_pollers;
+	default:
+		return &ev->event->_pollers;
+	}
+}
+
+static bool entry_valid(const eai_osal_poll_event_t *ev)
+{
+	switch (ev->type) {
+	case EAI_OSAL_POLL_SEM_AVAILABLE:
+		return ev->sem != NULL;
+	case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+		return ev->queue != NULL;
+	case EAI_OSAL_POLL_EVENT_BITS:
+		return ev->event != NULL && ev->bits != 0;
+	default:
+		return false;
+	}
+}
+
+static bool entry_ready(const eai_osal_poll_event_t *ev)
+{
+	switch (ev->type) {
+	case EAI_OSAL_POLL_SEM_AVAILABLE:
+		return osal_sem_ready(ev->sem);
+	case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+		return osal_queue_ready(ev->queue);
+	default:
+		return osal_event_ready(ev->event, ev->bits);
+	}
+}
+
+bool osal_poll_valid(const eai_osal_poll_event_t *events, size_t n)
+{
+	if (events == NULL || n == 0) {
+		return false;
+	}
+	for (size_t i = 0; i < n; i++) {
+		if (!entry_valid(&events[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool osal_poll_scan(eai_osal_poll_event_t *events, size_t n)
+{
+	bool any = false;
+
+	for (size_t i = 0; i < n; i++) {
+		events[i].ready = entry_ready(&events[i]);
+		any |= events[i].ready;
+	}
+	return any;
+}
+
+bool osal_poll_any_ready(const eai_osal_poll_event_t *events, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		if (entry_ready(&events[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void osal_poll_register(eai_osal_poll_event_t *events, size_t n,
+			struct osal_poller *poller)
+{
+	pthread_mutex_lock(&poll_lock);
+	for (size_t i = 0; i < n; i++) {
+		_Atomic(struct osal_poll_node *) *list = entry_list(&events[i]);
+		struct osal_poll_node *node = &events[i]._priv;
+
+		node->_poller = poller;
+		node->_next = atomic_load_explicit(list, memory_order_relaxed);
+		atomic_store_explicit(list, node, memory_order_relaxed);
+	}
+	pthread_mutex_unlock(&poll_lock);
+	atomic_thread_fence(memory_order_seq_cst);
+}
+
+void osal_poll_unregister(eai_osal_poll_event_t *events, size_t n)
+{
+	pthread_mutex_lock(&poll_lock);
+	for (size_t i = 0; i < n; i++) {
+		_Atomic(struct osal_poll_node *) *list = entry_list(&events[i]);
+		struct osal_poll_node *node = &events[i]._priv;
+		struct osal_poll_node *prev = NULL;
+		struct osal_poll_node *cur = atomic_load_explicit(list, memory_order_relaxed);
+
+		while (cur != node) {
+			prev = cur;
+			cur = cur->_next;
+		}
+		if (prev != NULL) {
+			prev->_next = node->_next;
+		} else {
+			atomic_store_explicit(list, node->_next, memory_order_relaxed);
+		}
+	}
+	pthread_mutex_unlock(&poll_lock);
+}
+
+eai_osal_status_t eai_osal_poll(eai_osal_poll_event_t *events, size_t n,
+				uint32_t timeout_ms)
+{
+	if (!osal_poll_valid(events, n)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	if (osal_poll_scan(events, n)) {
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	struct poll_waiter waiter = { .poller._wake = waiter_wake };
+
+	if (eai_osal_sem_create(&waiter.wake, 0, 1) != EAI_OSAL_OK) {
+		return EAI_OSAL_ERROR;
+	}
+
+	uint64_t deadline = osal_mono_ns() + (uint64_t)timeout_ms * 1000000ULL;
+	eai_osal_status_t ret = EAI_OSAL_TIMEOUT;
+
+	osal_poll_register(events, n, &waiter.poller);
+	for (;;) {
+		if (osal_poll_scan(events, n)) {
+			ret = EAI_OSAL_OK;
+			break;
+		}
+
+		uint32_t wait = EAI_OSAL_WAIT_FOREVER;
+
+		if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+			uint64_t now = osal_mono_ns();
+
+			if (now >= deadline) {
+				break;
+			}
+			/* Round up, so the last wait doesn't end just short */
+			wait = (uint32_t)((deadline - now + 999999) / 1000000);
+		}
+		eai_osal_sem_take(&waiter.wake, wait);
+	}
+	osal_poll_unregister(events, n);
+
+	eai_osal_sem_destroy(&waiter.wake);
+	return ret;
+}
@@ -1,9 +1,127 @@
 #include <eai_osal/queue.h>
 #include "internal.h"
+#include "futex.h"
+#include "../stats_internal.h"
 #include <string.h>
 
+/*
+ * Lock and condition primitives: futex-backed on Linux (futex.h), where a
+ * signal with no parked waiter makes no syscall; pthread elsewhere.
+ * Timed waits take an absolute osal_timespec() deadline.
+ */
+#if EAI_OSAL_POSIX_FUTEX
+
+typedef osal_fcond_t queue_cond_t;
+
+static bool queue_sync_init(eai_osal_queue_t *queue)
+{
+	atomic_init(&queue->_lock, 0);
+	osal_fcond_init(&queue->_not_full);
+	osal_fcond_init(&queue->_not_empty);
+	return true;
+}
+
+static void queue_sync_destroy(eai_osal_queue_t *queue)
+{
+	(void)queue;
+}
+
+static void queue_lock(eai_osal_queue_t *queue)
+{
+	osal_flock(&queue->_lock);
+}
+
+static void queue_unlock(eai_osal_queue_t *queue)
+{
+	osal_funlock(&queue->_lock);
+}
+
+/* ts NULL = forever. Returns non-zero on timeout, lock held either way. */
+static int queue_cond_wait(eai_osal_queue_t *queue, queue_cond_t *cond,
+			   const struct timespec *ts)
+{
+	return osal_fcond_wait(cond, &queue->_lock, ts);
+}
+
+static void queue_signal(queue_cond_t *cond)
+{
+	osal_fcond_signal(cond);
+}
+
+static void queue_broadcast(queue_cond_t *cond)
+{
+	osal_fcond_broadcast(cond);
+}
+
+#else
+
+typedef pthread_cond_t queue_cond_t;
+
+static bool queue_sync_init(eai_osal_queue_t *queue)
+{
+	if (pthread_mutex_init(&queue->_lock, NULL) != 0) {
+		return false;
+	}
+	if (osal_cond_init(&queue->_not_full) != 0) {
+		pthread_mutex_destroy(&queue->_lock);
+		return false;
+	}
+	if (osal_cond_init(&queue->_not_empty) != 0) {
+		pthread_cond_destroy(&queue->_not_full);
+		pthread_mutex_destroy(&queue->_lock);
+		return false;
+	}
+	return true;
+}
+
+static void queue_sync_destroy(eai_osal_queue_t *queue)
+{
+	pthread_cond_destroy(&queue->_not_empty);
+	pthread_cond_destroy(&queue->_not_full);
+	pthread_mutex_destroy(&queue->_lock);
+}
+
+static void queue_lock(eai_osal_queue_t *queue)
+{
+	pthread_mutex_lock(&queue->_lock);
+}
+
+static void queue_unlock(eai_osal_queue_t *queue)
+{
+	pthread_mutex_unlock(&queue->_lock);
+}
+
+/* ts NULL = forever. Returns non-zero on timeout, lock held either way. */
+static int queue_cond_wait(eai_osal_queue_t *queue, queue_cond_t *cond,
+			   const struct timespec *ts)
+{
+	if (ts == NULL) {
+		return osal_cond_wait(cond, &queue->_lock);
+	}
+	return osal_cond_timedwait(cond, &queue->_lock, ts);
+}
+
+static void queue_signal(queue_cond_t *cond)
+{
+	osal_cond_signal(cond);
+}
+
+static void queue_broadcast(queue_cond_t *cond)
+{
+	osal_cond_broadcast(cond);
+}
+
+#endif /* EAI_OSAL_POSIX_FUTEX */
+
 eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size,
 					uint32_t max_msgs, void *buffer)
+{
+	return eai_osal_queue_create_named(queue, msg_size, max_msgs, buffer, NULL);
+}
+
+eai_osal_status_t eai_osal_queue_create_named(eai_osal_queue_t *queue,
+					      size_t msg_size, uint32_t max_msgs,
+					      void *buffer, const char *name)
 {
 	if (queue == NULL || buffer == NULL || msg_size == 0 || max_msgs == 0) {
 		return EAI_OSAL_INVALID_PARAM;
@@ -15,19 +133,14 @@ eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size
 	queue->_head = 0;
 	queue->_tail = 0;
 	queue->_count = 0;
+	queue->_wr_busy = false;
+	queue->_rd_busy = false;
+	atomic_init(&queue->_pollers, NULL);
 
-	if (pthread_mutex_init(&queue->_lock, NULL) != 0) {
-		return EAI_OSAL_ERROR;
-	}
-	if (pthread_cond_init(&queue->_not_full, NULL) != 0) {
-		pthread_mutex_destroy(&queue->_lock);
-		return EAI_OSAL_ERROR;
-	}
-	if (pthread_cond_init(&queue->_not_empty, NULL) != 0) {
-		pthread_cond_destroy(&queue->_not_full);
-		pthread_mutex_destroy(&queue->_lock);
+	if (!queue_sync_init(queue)) {
 		return EAI_OSAL_ERROR;
 	}
+	OSAL_STATS_INIT(queue, EAI_OSAL_STATS_QUEUE, name);
 	return EAI_OSAL_OK;
 }
 
@@ -36,47 +149,185 @@ eai_osal_status_t eai_osal_queue_destroy(eai_osal_queue_t *queue)
 	if (queue == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	pthread_cond_destroy(&queue->_not_empty);
-	pthread_cond_destroy(&queue->_not_full);
-	pthread_mutex_destroy(&queue->_lock);
+	OSAL_STATS_DEINIT(queue);
+	queue_sync_destroy(queue);
 	return EAI_OSAL_OK;
 }
 
-eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
-				      uint32_t timeout_ms)
+/*
+ * An outstanding reservation owns the head slot and an outstanding peek
+ * owns the tail slot, so plain send/recv wait behind them to keep FIFO
+ * order intact.
+ */
+static bool send_blocked(const eai_osal_queue_t *queue)
 {
-	if (queue == NULL || msg == NULL) {
-		return EAI_OSAL_INVALID_PARAM;
-	}
+	return queue->_count >= queue->_max_msgs || queue->_wr_busy;
+}
 
-	pthread_mutex_lock(&queue->_lock);
+static bool recv_blocked(const eai_osal_queue_t *queue)
+{
+	return queue->_count == 0 || queue->_rd_busy;
+}
+
+/*
+ * Wait (lock held) until !blocked(queue). Finite timeouts wait until the
+ * absolute deadline ts, so batch calls can wait repeatedly against one
+ * deadline. Unlocks on timeout. Every queue operation waits through here,
+ * so this is where a successful wait is counted for stats.
+ */
+static eai_osal_status_t queue_wait_until(eai_osal_queue_t *queue,
+					  queue_cond_t *cond,
+					  bool (*blocked)(const eai_osal_queue_t *),
+					  uint32_t timeout_ms,
+					  const struct timespec *ts)
+{
+	uint32_t t0 = 0;
+
+	if (timeout_ms != EAI_OSAL_NO_WAIT && blocked(queue)) {
+		t0 = OSAL_STATS_STAMP();
+	}
 
 	if (timeout_ms == EAI_OSAL_NO_WAIT) {
-		if (queue->_count >= queue->_max_msgs) {
-			pthread_mutex_unlock(&queue->_lock);
+		if (blocked(queue)) {
+			queue_unlock(queue);
 			return EAI_OSAL_TIMEOUT;
 		}
 	} else if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
-		while (queue->_count >= queue->_max_msgs) {
-			pthread_cond_wait(&queue->_not_full, &queue->_lock);
+		while (blocked(queue)) {
+			queue_cond_wait(queue, cond, NULL);
 		}
 	} else {
-		struct timespec ts = osal_timespec(timeout_ms);
-		while (queue->_count >= queue->_max_msgs) {
-			int ret = pthread_cond_timedwait(&queue->_not_full,
-							 &queue->_lock, &ts);
-			if (ret != 0) {
-				pthread_mutex_unlock(&queue->_lock);
+		while (blocked(queue)) {
+			if (queue_cond_wait(queue, cond, ts) != 0) {
+				queue_unlock(queue);
 				return EAI_OSAL_TIMEOUT;
 			}
 		}
 	}
+	OSAL_STATS_RECORD(queue, t0);
+	return EAI_OSAL_OK;
+}
 
-	memcpy(queue->_buf + queue->_head * queue->_msg_size, msg, queue->_msg_size);
+static struct timespec queue_deadline(uint32_t timeout_ms)
+{
+	struct timespec ts = {0};
+
+	if (timeout_ms != EAI_OSAL_NO_WAIT && timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		ts = osal_timespec(timeout_ms);
+	}
+	return ts;
+}
+
+static eai_osal_status_t queue_wait(eai_osal_queue_t *queue, queue_cond_t *cond,
+				    bool (*blocked)(const eai_osal_queue_t *),
+				    uint32_t timeout_ms)
+{
+	struct timespec ts = queue_deadline(timeout_ms);
+
+	return queue_wait_until(queue, cond, blocked, timeout_ms, &ts);
+}
+
+static uint8_t *head_slot(const eai_osal_queue_t *queue)
+{
+	return queue->_buf + queue->_head * queue->_msg_size;
+}
+
+static uint8_t *tail_slot(const eai_osal_queue_t *queue)
+{
+	return queue->_buf + queue->_tail * queue->_msg_size;
+}
+
+/* Publish the head slot (lock held) */
+static void push_head(eai_osal_queue_t *queue)
+{
 	queue->_head = (queue->_head + 1) % queue->_max_msgs;
 	queue->_count++;
-	pthread_cond_signal(&queue->_not_empty);
-	pthread_mutex_unlock(&queue->_lock);
+	queue_signal(&queue->_not_empty);
+	osal_poll_notify(&queue->_pollers);
+}
+
+/* Free the tail slot (lock held) */
+static void pop_tail(eai_osal_queue_t *queue)
+{
+	queue->_tail = (queue->_tail + 1) % queue->_max_msgs;
+	queue->_count--;
+	queue_signal(&queue->_not_full);
+}
+
+/* Wake waiters on cond after n slots changed state (lock held) */
+static void wake_batch(queue_cond_t *cond, uint32_t n)
+{
+	if (n == 1) {
+		queue_signal(cond);
+	} else if (n > 1) {
+		queue_broadcast(cond);
+	}
+}
+
+/* Copy up to n messages in at the head, two memcpys at most (lock held) */
+static uint32_t push_many(eai_osal_queue_t *queue, const uint8_t *src, uint32_t n)
+{
+	uint32_t room = queue->_max_msgs - queue->_count;
+	uint32_t first = queue->_max_msgs - queue->_head;
+
+	if (n > room) {
+		n = room;
+	}
+	if (first > n) {
+		first = n;
+	}
+	memcpy(head_slot(queue), src, first * queue->_msg_size);
+	memcpy(queue->_buf, src + first * queue->_msg_size,
+	       (n - first) * queue->_msg_size);
+
+	queue->_head = (queue->_head + n) % queue->_max_msgs;
+	queue->_count += n;
+	wake_batch(&queue->_not_empty, n);
+	if (n > 0) {
+		osal_poll_notify(&queue->_pollers);
+	}
+	return n;
+}
+
+/* Copy up to n messages out from the tail (lock held) */
+static uint32_t pop_many(eai_osal_queue_t *queue, uint8_t *dst, uint32_t n)
+{
+	uint32_t first = queue->_max_msgs - queue->_tail;
+
+	if (n > queue->_count) {
+		n = queue->_count;
+	}
+	if (first > n) {
+		first = n;
+	}
+	memcpy(dst, tail_slot(queue), first * queue->_msg_size);
+	memcpy(dst + first * queue->_msg_size, queue->_buf,
+	       (n - first) * queue->_msg_size);
+
+	queue->_tail = (queue->_tail + n) % queue->_max_msgs;
+	queue->_count -= n;
+	wake_batch(&queue->_not_full, n);
+	return n;
+}
+
+eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
+				      uint32_t timeout_ms)
+{
+	if (queue == NULL || msg == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	queue_lock(queue);
+
+	eai_osal_status_t ret = queue_wait(queue, &queue->_not_full,
+					   send_blocked, timeout_ms);
+	if (ret != EAI_OSAL_OK) {
+		return ret;
+	}
+
+	memcpy(head_slot(queue), msg, queue->_msg_size);
+	push_head(queue);
+	queue_unlock(queue);
 	return EAI_OSAL_OK;
 }
 
@@ -87,33 +338,209 @@ eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
-	pthread_mutex_lock(&queue->_lock);
+	queue_lock(queue);
 
-	if (timeout_ms == EAI_OSAL_NO_WAIT) {
-		if (queue->_count == 0) {
-			pthread_mutex_unlock(&queue->_lock);
-			return EAI_OSAL_TIMEOUT;
+	eai_osal_status_t ret = queue_wait(queue, &queue->_not_empty,
+					   recv_blocked, timeout_ms);
+	if (ret != EAI_OSAL_OK) {
+		return ret;
+	}
+
+	memcpy(msg, tail_slot(queue), queue->_msg_size);
+	pop_tail(queue);
+	queue_unlock(queue);
+	return EAI_OSAL_OK;
+}
+
+/* ── Batched transfer ─────────────────────────────────────────────────── */
+
+eai_osal_status_t eai_osal_queue_send_many(eai_osal_queue_t *queue,
+					   const void *msgs, uint32_t count,
+					   uint32_t *sent, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || count == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	const uint8_t *src = (const uint8_t *)msgs;
+	struct timespec ts = queue_deadline(timeout_ms);
+	eai_osal_status_t ret = EAI_OSAL_OK;
+	uint32_t done = 0;
+
+	queue_lock(queue);
+
+	while (done < count) {
+		ret = queue_wait_until(queue, &queue->_not_full, send_blocked,
+				       timeout_ms, &ts);
+		if (ret != EAI_OSAL_OK) {
+			break;
 		}
-	} else if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
-		while (queue->_count == 0) {
-			pthread_cond_wait(&queue->_not_empty, &queue->_lock);
+		done += push_many(queue, src + done * queue->_msg_size,
+				  count - done);
+	}
+
+	if (ret == EAI_OSAL_OK) {
+		queue_unlock(queue);
+	}
+	if (sent != NULL) {
+		*sent = done;
+	}
+	return ret;
+}
+
+/* Shared by recv_many (fill = false) and drain (fill = true) */
+static eai_osal_status_t recv_batch(eai_osal_queue_t *queue, void *msgs,
+				    uint32_t max_msgs, uint32_t *received,
+				    uint32_t timeout_ms, bool fill)
+{
+	if (queue == NULL || msgs == NULL || max_msgs == 0 || received == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint8_t *dst = (uint8_t *)msgs;
+	struct timespec ts = queue_deadline(timeout_ms);
+	eai_osal_status_t ret = EAI_OSAL_OK;
+	uint32_t done = 0;
+
+	queue_lock(queue);
+
+	while (done < max_msgs) {
+		ret = queue_wait_until(queue, &queue->_not_empty, recv_blocked,
+				       timeout_ms, &ts);
+		if (ret != EAI_OSAL_OK) {
+			break;
 		}
-	} else {
-		struct timespec ts = osal_timespec(timeout_ms);
-		while (queue->_count == 0) {
-			int ret = pthread_cond_timedwait(&queue->_not_empty,
-							 &queue->_lock, &ts);
-			if (ret != 0) {
-				pthread_mutex_unlock(&queue->_lock);
-				return EAI_OSAL_TIMEOUT;
-			}
+		done += pop_many(queue, dst + done * queue->_msg_size,
+				 max_msgs - done);
+		if (!fill) {
+			break;
 		}
 	}
 
-	memcpy(msg, queue->_buf + queue->_tail * queue->_msg_size, queue->_msg_size);
-	queue->_tail = (queue->_tail + 1) % queue->_max_msgs;
-	queue->_count--;
-	pthread_cond_signal(&queue->_not_full);
-	pthread_mutex_unlock(&queue->_lock);
+	if (ret == EAI_OSAL_OK) {
+		queue_unlock(queue);
+	}
+	*received = done;
+	return ret;
+}
+
+eai_osal_status_t eai_osal_queue_recv_many(eai_osal_queue_t *queue, void *msgs,
+					   uint32_t max_msgs, uint32_t *received,
+					   uint32_t timeout_ms)
+{
+	return recv_batch(queue, msgs, max_msgs, received, timeout_ms, false);
+}
+
+eai_osal_status_t eai_osal_queue_drain(eai_osal_queue_t *queue, void *msgs,
+				       uint32_t max_msgs, uint32_t *received,
+				       uint32_t timeout_ms)
+{
+	return recv_batch(queue, msgs, max_msgs, received, timeout_ms, true);
+}
+
+/* ── Zero-copy access ─────────────────────────────────────────────────── */
+
+eai_osal_status_t eai_osal_queue_reserve(eai_osal_queue_t *queue, void **slot,
+					 uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	queue_lock(queue);
+
+	if (queue->_wr_busy) {
+		queue_unlock(queue);
+		return EAI_OSAL_ERROR;
+	}
+
+	eai_osal_status_t ret = queue_wait(queue, &queue->_not_full,
+					   send_blocked, timeout_ms);
+	if (ret != EAI_OSAL_OK) {
+		return ret;
+	}
+
+	queue->_wr_busy = true;
+	*slot = head_slot(queue);
+	queue_unlock(queue);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_commit(eai_osal_queue_t *queue, void *slot)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	queue_lock(queue);
+
+	if (!queue->_wr_busy || slot != head_slot(queue)) {
+		queue_unlock(queue);
+		return EAI_OSAL_ERROR;
+	}
+
+	queue->_wr_busy = false;
+	push_head(queue);
+	/* Senders parked behind the reservation */
+	queue_broadcast(&queue->_not_full);
+	queue_unlock(queue);
 	return EAI_OSAL_OK;
 }
+
+eai_osal_status_t eai_osal_queue_peek(eai_osal_queue_t *queue, void **slot,
+				      uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	queue_lock(queue);
+
+	if (queue->_rd_busy) {
+		queue_unlock(queue);
+		return EAI_OSAL_ERROR;
+	}
+
+	eai_osal_status_t ret = queue_wait(queue, &queue->_not_empty,
+					   recv_blocked, timeout_ms);
+	if (ret != EAI_OSAL_OK) {
+		return ret;
+	}
+
+	queue->_rd_busy = true;
+	*slot = tail_slot(queue);
+	queue_unlock(queue);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_release(eai_osal_queue_t *queue, void *slot)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	queue_lock(queue);
+
+	if (!queue->_rd_busy || slot != tail_slot(queue)) {
+		queue_unlock(queue);
+		return EAI_OSAL_ERROR;
+	}
+
+	queue->_rd_busy = false;
+	pop_tail(queue);
+	/* Receivers parked behind the peek */
+	queue_broadcast(&queue->_not_empty);
+	if (queue->_count > 0) {
+		osal_poll_notify(&queue->_pollers);
+	}
+	queue_unlock(queue);
+	return EAI_OSAL_OK;
+}
+
+bool osal_queue_ready(eai_osal_queue_t *queue)
+{
+	queue_lock(queue);
+	bool ready = !recv_blocked(queue);
+	queue_unlock(queue);
+	return ready;
+}
@@ -0,0 +1,158 @@
+#include <eai_osal/rwlock.h>
+#include "internal.h"
+
+/*
+ * Portable pthread path; Linux builds use rwlock_futex.c.
+ *
+ * pthread_rwlock_t is not used: glibc prefers readers by default, and its
+ * timed variants wait on CLOCK_REALTIME. Readers wait on _readers_cv
+ * while a writer holds or waits. Writers wait on _writers_cv until the
+ * lock is free.
+ */
+#if !EAI_OSAL_POSIX_FUTEX
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	rwlock->_readers = 0;
+	rwlock->_writers_waiting = 0;
+	rwlock->_writer = false;
+
+	if (pthread_mutex_init(&rwlock->_lock, NULL) != 0) {
+		return EAI_OSAL_ERROR;
+	}
+	if (osal_cond_init(&rwlock->_readers_cv) != 0) {
+		pthread_mutex_destroy(&rwlock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	if (osal_cond_init(&rwlock->_writers_cv) != 0) {
+		pthread_cond_destroy(&rwlock->_readers_cv);
+		pthread_mutex_destroy(&rwlock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	pthread_cond_destroy(&rwlock->_writers_cv);
+	pthread_cond_destroy(&rwlock->_readers_cv);
+	pthread_mutex_destroy(&rwlock->_lock);
+	return EAI_OSAL_OK;
+}
+
+/* Wait on cv under _lock; false once the deadline passes */
+static bool rw_wait(eai_osal_rwlock_t *rwlock, pthread_cond_t *cv,
+		    uint32_t timeout_ms, const struct timespec *ts)
+{
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return false;
+	}
+	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
+		osal_cond_wait(cv, &rwlock->_lock);
+		return true;
+	}
+	return osal_cond_timedwait(cv, &rwlock->_lock, ts) == 0;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *rwlock,
+					    uint32_t timeout_ms)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	struct timespec ts = osal_timespec(timeout_ms);
+
+	pthread_mutex_lock(&rwlock->_lock);
+	while (rwlock->_writer || rwlock->_writers_waiting > 0) {
+		if (!rw_wait(rwlock, &rwlock->_readers_cv, timeout_ms, &ts)) {
+			pthread_mutex_unlock(&rwlock->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	rwlock->_readers++;
+	pthread_mutex_unlock(&rwlock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&rwlock->_lock);
+	if (rwlock->_readers == 0) {
+		pthread_mutex_unlock(&rwlock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	if (--rwlock->_readers == 0 && rwlock->_writers_waiting > 0) {
+		osal_cond_signal(&rwlock->_writers_cv);
+	}
+	pthread_mutex_unlock(&rwlock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *rwlock,
+					     uint32_t timeout_ms)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	struct timespec ts = osal_timespec(timeout_ms);
+
+	pthread_mutex_lock(&rwlock->_lock);
+	rwlock->_writers_waiting++;
+	while (rwlock->_writer || rwlock->_readers > 0) {
+		if (!rw_wait(rwlock, &rwlock->_writers_cv, timeout_ms, &ts)) {
+			/*
+			 * Readers held back for us alone can go now. A signal
+			 * that raced our timeout passes to the next writer.
+			 */
+			if (--rwlock->_writers_waiting == 0) {
+				if (!rwlock->_writer) {
+					osal_cond_broadcast(&rwlock->_readers_cv);
+				}
+			} else if (!rwlock->_writer && rwlock->_readers == 0) {
+				osal_cond_signal(&rwlock->_writers_cv);
+			}
+			pthread_mutex_unlock(&rwlock->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	rwlock->_writers_waiting--;
+	rwlock->_writer = true;
+	pthread_mutex_unlock(&rwlock->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&rwlock->_lock);
+	if (!rwlock->_writer) {
+		pthread_mutex_unlock(&rwlock->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	rwlock->_writer = false;
+	if (rwlock->_writers_waiting > 0) {
+		osal_cond_signal(&rwlock->_writers_cv);
+	} else {
+		osal_cond_broadcast(&rwlock->_readers_cv);
+	}
+	pthread_mutex_unlock(&rwlock->_lock);
+	return EAI_OSAL_OK;
+}
+
+#endif /* !EAI_OSAL_POSIX_FUTEX */
@@ -0,0 +1,222 @@
+#include <eai_osal/rwlock.h>
+#include "internal.h"
+#include "futex.h"
+
+/*
+ * Futex reader-writer lock (Linux). The whole lock is one word:
+ *
+ *	bits  0-14  read holds
+ *	bits 15-29  writers waiting
+ *	bit  30     PARKED: someone may be asleep on the word
+ *	bit  31     WRITER: a writer holds the lock
+ *
+ * Readers and writers get in with a single CAS when nothing is in their
+ * way. A read_lock, while there is no writer and none waiting, never
+ * writes anything but its own count, so readers on different cores don't
+ * serialize on a mutex.
+ *
+ * A thread about to sleep sets PARKED and then waits on the exact value
+ * it saw. Whoever clears PARKED wakes every sleeper. The clear changes
+ * the word, so a sleeper that has not reached the kernel yet fails its
+ * compare and looks again. Sleepers that still can't go set PARKED again.
+ * Waking everyone costs a stampede, but only on the contended path of a
+ * read-mostly lock.
+ */
+#if EAI_OSAL_POSIX_FUTEX
+
+#define RW_READER      1u
+#define RW_READERS     0x00007fffu
+#define RW_WAITER      (1u << 15)
+#define RW_WAITERS     0x3fff8000u
+#define RW_PARKED      (1u << 30)
+#define RW_WRITER      (1u << 31)
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	atomic_init(&rwlock->_state, 0);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return EAI_OSAL_OK;
+}
+
+/*
+ * Set PARKED if needed and sleep until the word moves on from s. Returns
+ * false once the deadline has passed; the caller reloads either way.
+ */
+static bool rw_park(eai_osal_rwlock_t *rwlock, unsigned int s,
+		    const struct timespec *deadline)
+{
+	if (!(s & RW_PARKED)) {
+		if (!atomic_compare_exchange_strong_explicit(&rwlock->_state, &s,
+							     s | RW_PARKED,
+							     memory_order_relaxed,
+							     memory_order_relaxed)) {
+			return true; /* word moved; look again */
+		}
+		s |= RW_PARKED;
+	}
+	return osal_futex_wait(&rwlock->_state, s, deadline) != ETIMEDOUT;
+}
+
+/* Callers clear PARKED in the same CAS that releases, then wake everyone */
+static void rw_wake_all(eai_osal_rwlock_t *rwlock)
+{
+	osal_futex_wake(&rwlock->_state, INT32_MAX);
+}
+
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *rwlock,
+					    uint32_t timeout_ms)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	unsigned int s = atomic_load_explicit(&rwlock->_state, memory_order_relaxed);
+	struct timespec ts;
+	const struct timespec *deadline = NULL;
+
+	for (;;) {
+		if (!(s & (RW_WRITER | RW_WAITERS))) {
+			if (atomic_compare_exchange_weak_explicit(&rwlock->_state, &s,
+								  s + RW_READER,
+								  memory_order_acquire,
+								  memory_order_relaxed)) {
+				return EAI_OSAL_OK;
+			}
+			continue;
+		}
+		if (timeout_ms == EAI_OSAL_NO_WAIT) {
+			return EAI_OSAL_TIMEOUT;
+		}
+		if (deadline == NULL && timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+			ts = osal_timespec(timeout_ms);
+			deadline = &ts;
+		}
+		if (!rw_park(rwlock, s, deadline)) {
+			return EAI_OSAL_TIMEOUT;
+		}
+		s = atomic_load_explicit(&rwlock->_state, memory_order_relaxed);
+	}
+}
+
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	unsigned int s = atomic_load_explicit(&rwlock->_state, memory_order_relaxed);
+	unsigned int n;
+
+	do {
+		if ((s & RW_READERS) == 0) {
+			return EAI_OSAL_ERROR;
+		}
+		n = s - RW_READER;
+		/* The last reader out lets the sleepers (a writer) retry */
+		if ((n & RW_READERS) == 0) {
+			n &= ~RW_PARKED;
+		}
+	} while (!atomic_compare_exchange_weak_explicit(&rwlock->_state, &s, n,
+							memory_order_release,
+							memory_order_relaxed));
+
+	if ((s & RW_PARKED) && !(n & RW_PARKED)) {
+		rw_wake_all(rwlock);
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *rwlock,
+					     uint32_t timeout_ms)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	unsigned int s = 0;
+
+	if (atomic_compare_exchange_strong_explicit(&rwlock->_state, &s, RW_WRITER,
+						    memory_order_acquire,
+						    memory_order_relaxed)) {
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	struct timespec ts;
+	const struct timespec *deadline = NULL;
+
+	if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		ts = osal_timespec(timeout_ms);
+		deadline = &ts;
+	}
+
+	/* Count ourselves as waiting: from here new readers queue behind us */
+	s = atomic_fetch_add_explicit(&rwlock->_state, RW_WAITER,
+				      memory_order_relaxed) + RW_WAITER;
+	for (;;) {
+		if (!(s & (RW_WRITER | RW_READERS))) {
+			if (atomic_compare_exchange_weak_explicit(&rwlock->_state, &s,
+								  (s - RW_WAITER) | RW_WRITER,
+								  memory_order_acquire,
+								  memory_order_relaxed)) {
+				return EAI_OSAL_OK;
+			}
+			continue;
+		}
+		if (!rw_park(rwlock, s, deadline)) {
+			break;
+		}
+		s = atomic_load_explicit(&rwlock->_state, memory_order_relaxed);
+	}
+
+	/* Timed out: stop counting as waiting, and let held-back readers retry */
+	unsigned int n;
+
+	s = atomic_load_explicit(&rwlock->_state, memory_order_relaxed);
+	do {
+		n = (s - RW_WAITER) & ~RW_PARKED;
+	} while (!atomic_compare_exchange_weak_explicit(&rwlock->_state, &s, n,
+							memory_order_relaxed,
+							memory_order_relaxed));
+	if (s & RW_PARKED) {
+		rw_wake_all(rwlock);
+	}
+	return EAI_OSAL_TIMEOUT;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	unsigned int s = atomic_load_explicit(&rwlock->_state, memory_order_relaxed);
+
+	do {
+		if (!(s & RW_WRITER)) {
+			return EAI_OSAL_ERROR;
+		}
+	} while (!atomic_compare_exchange_weak_explicit(&rwlock->_state, &s,
+							s & ~(RW_WRITER | RW_PARKED),
+							memory_order_release,
+							memory_order_relaxed));
+
+	if (s & RW_PARKED) {
+		rw_wake_all(rwlock);
+	}
+	return EAI_OSAL_OK;
+}
+
+#endif /* EAI_OSAL_POSIX_FUTEX */
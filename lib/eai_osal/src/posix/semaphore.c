@@ -1,8 +1,18 @@
 #include <eai_osal/semaphore.h>
 #include "internal.h"
+#include "../stats_internal.h"
+
+/* Portable pthread path; Linux builds use semaphore_futex.c */
+#if !EAI_OSAL_POSIX_FUTEX
 
 eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 				      uint32_t limit)
+{
+	return eai_osal_sem_create_named(sem, initial, limit, NULL);
+}
+
+eai_osal_status_t eai_osal_sem_create_named(eai_osal_sem_t *sem, uint32_t initial,
+					    uint32_t limit, const char *name)
 {
 	if (sem == NULL || limit == 0) {
 		return EAI_OSAL_INVALID_PARAM;
@@ -10,14 +20,16 @@ eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 
 	sem->_count = initial;
 	sem->_limit = limit;
+	atomic_init(&sem->_pollers, NULL);
 
 	if (pthread_mutex_init(&sem->_lock, NULL) != 0) {
 		return EAI_OSAL_ERROR;
 	}
-	if (pthread_cond_init(&sem->_cond, NULL) != 0) {
+	if (osal_cond_init(&sem->_cond) != 0) {
 		pthread_mutex_destroy(&sem->_lock);
 		return EAI_OSAL_ERROR;
 	}
+	OSAL_STATS_INIT(sem, EAI_OSAL_STATS_SEM, name);
 	return EAI_OSAL_OK;
 }
 
@@ -26,6 +38,7 @@ eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(sem);
 	pthread_cond_destroy(&sem->_cond);
 	pthread_mutex_destroy(&sem->_lock);
 	return EAI_OSAL_OK;
@@ -40,13 +53,22 @@ eai_osal_status_t eai_osal_sem_give(eai_osal_sem_t *sem)
 	pthread_mutex_lock(&sem->_lock);
 	if (sem->_count < sem->_limit) {
 		sem->_count++;
-		pthread_cond_signal(&sem->_cond);
+		osal_cond_signal(&sem->_cond);
 	}
 	/* At limit — silently ignore, matching FreeRTOS behavior */
 	pthread_mutex_unlock(&sem->_lock);
+	osal_poll_notify(&sem->_pollers);
 	return EAI_OSAL_OK;
 }
 
+bool osal_sem_ready(eai_osal_sem_t *sem)
+{
+	pthread_mutex_lock(&sem->_lock);
+	bool ready = sem->_count > 0;
+	pthread_mutex_unlock(&sem->_lock);
+	return ready;
+}
+
 eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 {
 	if (sem == NULL) {
@@ -55,9 +77,12 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 
 	pthread_mutex_lock(&sem->_lock);
 
+	uint32_t t0 = 0;
+
 	if (timeout_ms == EAI_OSAL_NO_WAIT) {
 		if (sem->_count > 0) {
 			sem->_count--;
+			OSAL_STATS_RECORD(sem, t0);
 			pthread_mutex_unlock(&sem->_lock);
 			return EAI_OSAL_OK;
 		}
@@ -65,11 +90,16 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 		return EAI_OSAL_TIMEOUT;
 	}
 
+	if (sem->_count == 0) {
+		t0 = OSAL_STATS_STAMP();
+	}
+
 	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
 		while (sem->_count == 0) {
-			pthread_cond_wait(&sem->_cond, &sem->_lock);
+			osal_cond_wait(&sem->_cond, &sem->_lock);
 		}
 		sem->_count--;
+		OSAL_STATS_RECORD(sem, t0);
 		pthread_mutex_unlock(&sem->_lock);
 		return EAI_OSAL_OK;
 	}
@@ -78,13 +108,16 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 	struct timespec ts = osal_timespec(timeout_ms);
 
 	while (sem->_count == 0) {
-		int ret = pthread_cond_timedwait(&sem->_cond, &sem->_lock, &ts);
+		int ret = osal_cond_timedwait(&sem->_cond, &sem->_lock, &ts);
 		if (ret != 0) {
 			pthread_mutex_unlock(&sem->_lock);
 			return EAI_OSAL_TIMEOUT;
 		}
 	}
 	sem->_count--;
+	OSAL_STATS_RECORD(sem, t0);
 	pthread_mutex_unlock(&sem->_lock);
 	return EAI_OSAL_OK;
 }
+
+#endif /* !EAI_OSAL_POSIX_FUTEX */
@@ -0,0 +1,130 @@
+#include <eai_osal/semaphore.h>
+#include "internal.h"
+#include "futex.h"
+#include "../stats_internal.h"
+
+/*
+ * Futex semaphore (Linux). The count itself is the futex word: take
+ * decrements it with a CAS and only parks when it is zero; give
+ * increments it and only wakes when a taker has announced itself in
+ * _waiters. Counter updates and the waiter check are sequentially
+ * consistent so a give can't miss a taker about to park.
+ */
+#if EAI_OSAL_POSIX_FUTEX
+
+eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
+				      uint32_t limit)
+{
+	return eai_osal_sem_create_named(sem, initial, limit, NULL);
+}
+
+eai_osal_status_t eai_osal_sem_create_named(eai_osal_sem_t *sem, uint32_t initial,
+					    uint32_t limit, const char *name)
+{
+	if (sem == NULL || limit == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	atomic_init(&sem->_count, initial);
+	atomic_init(&sem->_waiters, 0);
+	atomic_init(&sem->_pollers, NULL);
+	sem->_limit = limit;
+	OSAL_STATS_INIT(sem, EAI_OSAL_STATS_SEM, name);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
+{
+	if (sem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	OSAL_STATS_DEINIT(sem);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_sem_give(eai_osal_sem_t *sem)
+{
+	if (sem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	unsigned int c = atomic_load(&sem->_count);
+
+	do {
+		if (c >= sem->_limit) {
+			/* At limit — silently ignore, matching FreeRTOS behavior */
+			return EAI_OSAL_OK;
+		}
+	} while (!atomic_compare_exchange_weak(&sem->_count, &c, c + 1));
+
+	if (atomic_load(&sem->_waiters) != 0) {
+		osal_futex_wake(&sem->_count, 1);
+	}
+	osal_poll_notify(&sem->_pollers);
+	return EAI_OSAL_OK;
+}
+
+bool osal_sem_ready(eai_osal_sem_t *sem)
+{
+	return atomic_load(&sem->_count) > 0;
+}
+
+static bool sem_try_take(eai_osal_sem_t *sem)
+{
+	unsigned int c = atomic_load(&sem->_count);
+
+	while (c > 0) {
+		if (atomic_compare_exchange_weak(&sem->_count, &c, c - 1)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
+{
+	if (sem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t t0 = 0;
+
+	if (sem_try_take(sem)) {
+		OSAL_STATS_RECORD(sem, t0);
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	t0 = OSAL_STATS_STAMP();
+
+	struct timespec ts;
+	const struct timespec *deadline = NULL;
+
+	if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		ts = osal_timespec(timeout_ms);
+		deadline = &ts;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_OK;
+
+	atomic_fetch_add(&sem->_waiters, 1);
+	while (!sem_try_take(sem)) {
+		if (osal_futex_wait(&sem->_count, 0, deadline) == ETIMEDOUT) {
+			/* Last look: a give may have raced the timeout */
+			if (!sem_try_take(sem)) {
+				ret = EAI_OSAL_TIMEOUT;
+			}
+			break;
+		}
+	}
+	atomic_fetch_sub(&sem->_waiters, 1);
+
+	if (ret == EAI_OSAL_OK) {
+		OSAL_STATS_RECORD(sem, t0);
+	}
+	return ret;
+}
+
+#endif /* EAI_OSAL_POSIX_FUTEX */
@@ -1,20 +1,327 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_setname_np, pthread_setaffinity_np */
+#endif
+
 #include <eai_osal/thread.h>
 #include "internal.h"
+#include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <sched.h>
+#include <sys/resource.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+/*
+ * Priority mapping. OSAL priorities 0-31 (higher = more urgent):
+ *
+ * - CONFIG_EAI_OSAL_POSIX_RT_PRIO_MIN (default 16) and above run
+ *   real-time, SCHED_FIFO (SCHED_RR with CONFIG_EAI_OSAL_POSIX_SCHED_RR),
+ *   spread linearly over the policy's priority range.
+ * - Below that, and whenever the process may not use real-time
+ *   scheduling (no CAP_SYS_NICE or RLIMIT_RTPRIO), threads run
+ *   SCHED_OTHER with a nice value from +10 (OSAL 0) through 0 (OSAL 15/16)
+ *   to -10 (OSAL 31). If raising priority is refused too (RLIMIT_NICE),
+ *   negative nice values are clamped to 0.
+ *
+ * Nice values are per thread on Linux only; elsewhere the SCHED_OTHER
+ * band leaves priority as inherited.
+ */
+#ifndef CONFIG_EAI_OSAL_POSIX_RT_PRIO_MIN
+#define CONFIG_EAI_OSAL_POSIX_RT_PRIO_MIN 16
+#endif
+
+#ifdef CONFIG_EAI_OSAL_POSIX_SCHED_RR
+#define OSAL_RT_POLICY SCHED_RR
+#else
+#define OSAL_RT_POLICY SCHED_FIFO
+#endif
+
+static bool set_rt_priority(uint8_t priority)
+{
+	const int lo = CONFIG_EAI_OSAL_POSIX_RT_PRIO_MIN;
+	int min = sched_get_priority_min(OSAL_RT_POLICY);
+	int max = sched_get_priority_max(OSAL_RT_POLICY);
+	struct sched_param sp = { .sched_priority = min };
+
+	if (lo < 31) {
+		sp.sched_priority += ((int)priority - lo) * (max - min) / (31 - lo);
+	}
+	return pthread_setschedparam(pthread_self(), OSAL_RT_POLICY, &sp) == 0;
+}
+
+static void set_nice(uint8_t priority)
+{
+	struct sched_param sp = { .sched_priority = 0 };
+
+	/* Leave any real-time policy inherited from the creator */
+	pthread_setschedparam(pthread_self(), SCHED_OTHER, &sp);
+
+#if defined(__linux__)
+	int nice = 10 - ((int)priority * 20 + 15) / 31;
+
+	/* who = 0 is the calling thread on Linux */
+	if (setpriority(PRIO_PROCESS, 0, nice) != 0 && nice < 0) {
+		setpriority(PRIO_PROCESS, 0, 0);
+	}
+#endif
+}
+
+void osal_thread_setup(const char *name, uint8_t priority)
+{
+	if (name != NULL && name[0] != '\0') {
+#if defined(__APPLE__)
+		pthread_setname_np(name);
+#else
+		pthread_setname_np(pthread_self(), name);
+#endif
+	}
+
+	if (priority > 31) {
+		return; /* OSAL_PRIO_INHERIT */
+	}
+	if (priority >= CONFIG_EAI_OSAL_POSIX_RT_PRIO_MIN && set_rt_priority(priority)) {
+		return;
+	}
+	set_nice(priority);
+}
+
+/* ── Stats registry ──────────────────────────────────────────────────── */
+
+/*
+ * A thread is listed from create until its entry function returns, so a
+ * listed thread still has its CPU clock, its /proc entry and its stack.
+ * Stats are read with registry_lock held.
+ *
+ * On Linux each thread fills its unused stack with STACK_PAINT as it
+ * starts. stack_used is then the distance from the top of the stack down
+ * to the lowest byte that no longer holds the paint.
+ */
+#define STACK_PAINT 0xa5
+
+/* The scan reads another thread's stack, below its frames and redzones */
+#if defined(__has_attribute)
+#if __has_attribute(no_sanitize)
+#define OSAL_NO_SANITIZE __attribute__((no_sanitize("address", "thread")))
+#endif
+#endif
+#ifndef OSAL_NO_SANITIZE
+#define OSAL_NO_SANITIZE
+#endif
+
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static eai_osal_thread_t *registry;
+
+static void registry_add(eai_osal_thread_t *thread)
+{
+	pthread_mutex_lock(&registry_lock);
+	thread->_next = registry;
+	registry = thread;
+	pthread_mutex_unlock(&registry_lock);
+}
+
+static void registry_remove(eai_osal_thread_t *thread)
+{
+	pthread_mutex_lock(&registry_lock);
+	for (eai_osal_thread_t **it = &registry; *it != NULL; it = &(*it)->_next) {
+		if (*it == thread) {
+			*it = thread->_next;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&registry_lock);
+}
+
+#if defined(__linux__)
+/* Paint the stack below this frame, leaving headroom for the frame itself */
+OSAL_NO_SANITIZE __attribute__((noinline))
+static void stack_paint(eai_osal_thread_t *thread)
+{
+	pthread_attr_t attr;
+	void *lo;
+	size_t size;
+
+	if (pthread_getattr_np(pthread_self(), &attr) != 0) {
+		return;
+	}
+	int ret = pthread_attr_getstack(&attr, &lo, &size);
+
+	pthread_attr_destroy(&attr);
+	if (ret != 0) {
+		return;
+	}
+
+	volatile uint8_t *p = lo;
+	uint8_t *end = (uint8_t *)__builtin_frame_address(0) - 1024;
+
+	while ((uint8_t *)p < end) {
+		*p++ = STACK_PAINT;
+	}
+
+	pthread_mutex_lock(&registry_lock);
+	thread->_stack_lo = lo;
+	thread->_stack_size = size;
+	pthread_mutex_unlock(&registry_lock);
+}
+
+OSAL_NO_SANITIZE
+static size_t stack_used(const eai_osal_thread_t *thread)
+{
+	const volatile uint8_t *p = thread->_stack_lo;
+	const uint8_t *top = thread->_stack_lo + thread->_stack_size;
+
+	if (p == NULL) {
+		return 0;
+	}
+	while ((const uint8_t *)p < top && *p == STACK_PAINT) {
+		p++;
+	}
+	return (size_t)(top - (const uint8_t *)p);
+}
+
+/* Voluntary plus involuntary switches: one per time it was switched back in */
+static uint32_t ctx_switches(const eai_osal_thread_t *thread)
+{
+	if (thread->_tid == (int)syscall(SYS_gettid)) {
+		struct rusage ru;
+
+		return getrusage(RUSAGE_THREAD, &ru) == 0
+			? (uint32_t)(ru.ru_nvcsw + ru.ru_nivcsw) : 0;
+	}
+
+	char path[48];
+	char line[96];
+	unsigned long n;
+	uint32_t total = 0;
+
+	snprintf(path, sizeof(path), "/proc/self/task/%d/status", thread->_tid);
+
+	FILE *f = fopen(path, "r");
+
+	if (f == NULL) {
+		return 0;
+	}
+	while (fgets(line, sizeof(line), f) != NULL) {
+		if (sscanf(line, "voluntary_ctxt_switches: %lu", &n) == 1 ||
+		    sscanf(line, "nonvoluntary_ctxt_switches: %lu", &n) == 1) {
+			total += (uint32_t)n;
+		}
+	}
+	fclose(f);
+	return total;
+}
+#endif
+
+static void thread_started(eai_osal_thread_t *thread)
+{
+#if defined(__linux__)
+	clockid_t clock;
+	int tid = (int)syscall(SYS_gettid);
+	bool have_clock = pthread_getcpuclockid(pthread_self(), &clock) == 0;
+
+	pthread_mutex_lock(&registry_lock);
+	thread->_tid = have_clock ? tid : 0;
+	thread->_cpu_clock = clock;
+	pthread_mutex_unlock(&registry_lock);
+
+	stack_paint(thread);
+#else
+	(void)thread;
+#endif
+}
+
+/* Fill *out from a listed thread (registry_lock held) */
+static void thread_snapshot(const eai_osal_thread_t *thread,
+			    eai_osal_thread_stats_t *out)
+{
+	memset(out, 0, sizeof(*out));
+	osal_thread_name_copy(out->name, thread->_name);
+	out->stack_size = thread->_stack_size;
+
+#if defined(__linux__)
+	struct timespec ts;
+
+	if (thread->_tid == 0) {
+		return; /* not running yet */
+	}
+	if (clock_gettime(thread->_cpu_clock, &ts) == 0) {
+		out->runtime_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+	}
+	out->switches = ctx_switches(thread);
+	out->stack_used = stack_used(thread);
+#endif
+}
+
+eai_osal_status_t eai_osal_thread_get_stats(eai_osal_thread_t *thread,
+					    eai_osal_thread_stats_t *stats)
+{
+	if (thread == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_ERROR;
+
+	pthread_mutex_lock(&registry_lock);
+	for (eai_osal_thread_t *it = registry; it != NULL; it = it->_next) {
+		if (it == thread) {
+			thread_snapshot(thread, stats);
+			ret = EAI_OSAL_OK;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&registry_lock);
+	return ret;
+}
+
+void eai_osal_thread_foreach(eai_osal_thread_stats_cb_t cb, void *arg)
+{
+	eai_osal_thread_stats_t snap;
+
+	if (cb == NULL) {
+		return;
+	}
+
+	/* Re-walk to the i-th entry each round, as eai_osal_stats_foreach() does */
+	for (uint32_t i = 0;; i++) {
+		pthread_mutex_lock(&registry_lock);
+
+		eai_osal_thread_t *thread = registry;
+
+		for (uint32_t j = 0; j < i && thread != NULL; j++) {
+			thread = thread->_next;
+		}
+		if (thread != NULL) {
+			thread_snapshot(thread, &snap);
+		}
+		pthread_mutex_unlock(&registry_lock);
+
+		if (thread == NULL) {
+			break;
+		}
+		cb(&snap, arg);
+	}
+}
+
+/* ── Threads ─────────────────────────────────────────────────────────── */
 
 static void *thread_trampoline(void *arg)
 {
 	eai_osal_thread_t *thread = (eai_osal_thread_t *)arg;
 
+	osal_thread_setup(thread->_name, thread->_priority);
+	thread_started(thread);
 	thread->_entry(thread->_entry_arg);
+	registry_remove(thread);
 
 	/* Signal join waiters */
 	pthread_mutex_lock(&thread->_join_lock);
 	thread->_done = true;
-	pthread_cond_broadcast(&thread->_join_cond);
+	osal_cond_broadcast(&thread->_join_cond);
 	pthread_mutex_unlock(&thread->_join_lock);
 
+	/* After the broadcast, which already counts the woken joiner */
+	osal_vt_thread_exit();
 	return NULL;
 }
 
@@ -26,8 +333,6 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 					 size_t stack_size,
 					 uint8_t priority)
 {
-	(void)name;
-
 	if (thread == NULL || entry == NULL || stack == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
@@ -38,32 +343,37 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 	thread->_entry = entry;
 	thread->_entry_arg = arg;
 	thread->_done = false;
+	thread->_priority = priority;
+	osal_thread_name_copy(thread->_name, name);
+	thread->_tid = 0;
+	thread->_stack_lo = NULL;
+	thread->_stack_size = stack_size < 16384 ? 16384 : stack_size;
 
 	if (pthread_mutex_init(&thread->_join_lock, NULL) != 0) {
 		return EAI_OSAL_ERROR;
 	}
-	if (pthread_cond_init(&thread->_join_cond, NULL) != 0) {
+	if (osal_cond_init(&thread->_join_cond) != 0) {
 		pthread_mutex_destroy(&thread->_join_lock);
 		return EAI_OSAL_ERROR;
 	}
 
 	pthread_attr_t attr;
 	pthread_attr_init(&attr);
-	pthread_attr_setstacksize(&attr, stack_size < 16384 ? 16384 : stack_size);
+	pthread_attr_setstacksize(&attr, thread->_stack_size);
 
+	registry_add(thread);
+	osal_vt_thread_add();
 	int ret = pthread_create(&thread->_handle, &attr, thread_trampoline, thread);
 	pthread_attr_destroy(&attr);
 
 	if (ret != 0) {
+		osal_vt_thread_exit();
+		registry_remove(thread);
 		pthread_cond_destroy(&thread->_join_cond);
 		pthread_mutex_destroy(&thread->_join_lock);
 		return EAI_OSAL_ERROR;
 	}
 
-	/* Best-effort priority setting — no error if insufficient privileges */
-	struct sched_param sp = { .sched_priority = 0 };
-	pthread_setschedparam(thread->_handle, SCHED_OTHER, &sp);
-
 	return EAI_OSAL_OK;
 }
 
@@ -78,13 +388,13 @@ eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 
 	if (timeout_ms == EAI_OSAL_WAIT_FOREVER) {
 		while (!thread->_done) {
-			pthread_cond_wait(&thread->_join_cond,
+			osal_cond_wait(&thread->_join_cond,
 					  &thread->_join_lock);
 		}
 	} else {
 		struct timespec ts = osal_timespec(timeout_ms);
 		while (!thread->_done) {
-			int ret = pthread_cond_timedwait(&thread->_join_cond,
+			int ret = osal_cond_timedwait(&thread->_join_cond,
 							 &thread->_join_lock,
 							 &ts);
 			if (ret != 0) {
@@ -101,9 +411,42 @@ eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 	return EAI_OSAL_OK;
 }
 
+eai_osal_status_t eai_osal_thread_set_affinity(eai_osal_thread_t *thread,
+					       uint32_t cpu_mask)
+{
+	if (thread == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+#if defined(__linux__)
+	long ncpu = sysconf(_SC_NPROCESSORS_CONF);
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	for (int cpu = 0; cpu < 32 && cpu < ncpu; cpu++) {
+		if (cpu_mask & (1u << cpu)) {
+			CPU_SET(cpu, &set);
+		}
+	}
+	if (CPU_COUNT(&set) == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return pthread_setaffinity_np(thread->_handle, sizeof(set), &set) == 0
+		? EAI_OSAL_OK : EAI_OSAL_ERROR;
+#else
+	/* macOS has affinity hints only, no way to pin */
+	(void)cpu_mask;
+	return EAI_OSAL_ERROR;
+#endif
+}
+
 void eai_osal_thread_sleep(uint32_t ms)
 {
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+	osal_vt_wait(NULL, NULL, osal_mono_ns() + (uint64_t)ms * 1000000ULL);
+#else
 	usleep((useconds_t)ms * 1000);
+#endif
 }
 
 void eai_osal_thread_yield(void)
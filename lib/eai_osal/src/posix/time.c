@@ -1,30 +1,46 @@
 #include <eai_osal/time.h>
-#include <time.h>
+#include "internal.h"
 
 /*
  * POSIX time — uses CLOCK_MONOTONIC for monotonic uptime.
  * Ticks are microseconds for reasonable precision without overflow.
+ * The cycle counter is the low 32 bits of the nanosecond clock: a vDSO
+ * read on Linux, and needs no calibration.
  */
 
 #define TICKS_PER_MS 1000 /* 1 tick = 1 microsecond */
 
 uint32_t eai_osal_time_get_ms(void)
 {
-	struct timespec ts;
+	return (uint32_t)(osal_mono_ns() / 1000000ULL);
+}
 
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+uint64_t eai_osal_time_get_us(void)
+{
+	return osal_mono_ns() / 1000ULL;
 }
 
-uint64_t eai_osal_time_get_ticks(void)
+uint64_t eai_osal_time_get_ns(void)
 {
-	struct timespec ts;
+	return osal_mono_ns();
+}
 
-	clock_gettime(CLOCK_MONOTONIC, &ts);
-	return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+uint64_t eai_osal_time_get_ticks(void)
+{
+	return osal_mono_ns() / 1000ULL;
 }
 
 uint32_t eai_osal_time_ticks_to_ms(uint64_t ticks)
 {
 	return (uint32_t)(ticks / TICKS_PER_MS);
 }
+
+uint32_t eai_osal_cycle_get(void)
+{
+	return (uint32_t)osal_mono_ns();
+}
+
+uint64_t eai_osal_cycles_to_ns(uint32_t cycles)
+{
+	return cycles;
+}
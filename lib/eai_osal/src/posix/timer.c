@@ -1,65 +1,299 @@
 #include <eai_osal/timer.h>
 #include "internal.h"
+#include <stdlib.h>
 
-static void *timer_thread_func(void *arg)
+/*
+ * POSIX timer implementation.
+ *
+ * All timers share one lazily started service thread, the host equivalent
+ * of the Zephyr system clock or the FreeRTOS timer task. Armed timers sit
+ * in a binary min-heap keyed on absolute CLOCK_MONOTONIC deadlines, so
+ * arming and stopping are O(log n) and the thread count stays at one no
+ * matter how many timers exist.
+ *
+ * Periodic timers advance their deadline by exactly one period from the
+ * previous deadline (not from the time the callback returned), so the
+ * firing phase does not drift with callback runtime. If the service falls
+ * more than a period behind, missed expiries are skipped rather than
+ * fired back-to-back.
+ *
+ * Callbacks run on the service thread with the service lock released. A
+ * slow callback delays other timers, as it would on the RTOS backends.
+ */
+
+#define HEAP_INIT_CAP 16
+
+static struct {
+	pthread_once_t once;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;      /* heap top changed */
+	pthread_cond_t idle;      /* callback finished */
+	pthread_t thread;
+	bool thread_alive;
+	eai_osal_timer_t **heap;
+	uint32_t len;
+	uint32_t cap;
+	eai_osal_timer_t *current; /* timer whose callback is running */
+} svc = {
+	.once = PTHREAD_ONCE_INIT,
+};
+
+static void svc_init(void)
+{
+	pthread_mutex_init(&svc.lock, NULL);
+
+	osal_cond_init(&svc.cond);
+	pthread_cond_init(&svc.idle, NULL);
+}
+
+/* ── Deadline heap (service lock held) ────────────────────────────────── */
+
+static void heap_place(uint32_t idx, eai_osal_timer_t *timer)
+{
+	svc.heap[idx] = timer;
+	timer->_heap_idx = (int32_t)idx;
+}
+
+static void heap_sift_up(uint32_t idx)
+{
+	eai_osal_timer_t *timer = svc.heap[idx];
+
+	while (idx > 0) {
+		uint32_t parent = (idx - 1) / 2;
+
+		if (svc.heap[parent]->_deadline_ns <= timer->_deadline_ns) {
+			break;
+		}
+		heap_place(idx, svc.heap[parent]);
+		idx = parent;
+	}
+	heap_place(idx, timer);
+}
+
+static void heap_sift_down(uint32_t idx)
+{
+	eai_osal_timer_t *timer = svc.heap[idx];
+
+	for (;;) {
+		uint32_t child = 2 * idx + 1;
+
+		if (child >= svc.len) {
+			break;
+		}
+		if (child + 1 < svc.len &&
+		    svc.heap[child + 1]->_deadline_ns < svc.heap[child]->_deadline_ns) {
+			child++;
+		}
+		if (timer->_deadline_ns <= svc.heap[child]->_deadline_ns) {
+			break;
+		}
+		heap_place(idx, svc.heap[child]);
+		idx = child;
+	}
+	heap_place(idx, timer);
+}
+
+static eai_osal_status_t heap_insert(eai_osal_timer_t *timer)
 {
-	eai_osal_timer_t *timer = (eai_osal_timer_t *)arg;
+	if (svc.len == svc.cap) {
+		uint32_t cap = svc.cap ? svc.cap * 2 : HEAP_INIT_CAP;
+		eai_osal_timer_t **heap = realloc(svc.heap, cap * sizeof(*heap));
+
+		if (heap == NULL) {
+			return EAI_OSAL_NO_MEMORY;
+		}
+		svc.heap = heap;
+		svc.cap = cap;
+	}
+	svc.heap[svc.len] = timer;
+	heap_sift_up(svc.len++);
+	return EAI_OSAL_OK;
+}
 
-	pthread_mutex_lock(&timer->_lock);
+static void heap_remove(eai_osal_timer_t *timer)
+{
+	uint32_t idx = (uint32_t)timer->_heap_idx;
+	eai_osal_timer_t *last = svc.heap[--svc.len];
 
-	/* Wait for first start signal */
-	while (!timer->_running && !timer->_destroy) {
-		pthread_cond_wait(&timer->_cond, &timer->_lock);
+	timer->_heap_idx = -1;
+	if (last == timer) {
+		return;
 	}
+	heap_place(idx, last);
+	if (idx > 0 && svc.heap[(idx - 1) / 2]->_deadline_ns > last->_deadline_ns) {
+		heap_sift_up(idx);
+	} else {
+		heap_sift_down(idx);
+	}
+}
+
+/* ── Service thread ───────────────────────────────────────────────────── */
+
+static void svc_wait_until(uint64_t deadline_ns)
+{
+	struct timespec ts;
 
-	while (!timer->_destroy) {
-		if (!timer->_running) {
-			pthread_cond_wait(&timer->_cond, &timer->_lock);
+#if defined(__APPLE__) && !defined(CONFIG_EAI_OSAL_VIRTUAL_TIME)
+	/*
+	 * macOS lacks pthread_condattr_setclock. Convert the remaining
+	 * monotonic time into a CLOCK_REALTIME deadline; the caller re-checks
+	 * the heap against the monotonic clock after every wakeup.
+	 */
+	uint64_t now = osal_mono_ns();
+	uint64_t rem = deadline_ns > now ? deadline_ns - now : 0;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	rem += (uint64_t)ts.tv_nsec;
+	ts.tv_sec += (time_t)(rem / 1000000000ULL);
+	ts.tv_nsec = (long)(rem % 1000000000ULL);
+#else
+	ts.tv_sec = (time_t)(deadline_ns / 1000000000ULL);
+	ts.tv_nsec = (long)(deadline_ns % 1000000000ULL);
+#endif
+	osal_cond_timedwait(&svc.cond, &svc.lock, &ts);
+}
+
+static void *svc_thread_func(void *arg)
+{
+	(void)arg;
+
+	pthread_mutex_lock(&svc.lock);
+
+	for (;;) {
+		if (svc.len == 0) {
+			osal_cond_wait(&svc.cond, &svc.lock);
 			continue;
 		}
 
-		/* Determine wait: initial_ms for first fire, period_ms after */
-		uint32_t wait_ms;
-		if (timer->_initial_ms > 0) {
-			wait_ms = timer->_initial_ms;
-		} else {
-			wait_ms = timer->_period_ms;
+		eai_osal_timer_t *timer = svc.heap[0];
+		uint64_t now = osal_mono_ns();
+
+		if (timer->_deadline_ns > now) {
+			svc_wait_until(timer->_deadline_ns);
+			continue;
 		}
 
-		struct timespec ts = osal_timespec(wait_ms);
-		pthread_cond_timedwait(&timer->_cond, &timer->_lock, &ts);
+		heap_remove(timer);
 
-		if (timer->_destroy) {
-			break;
+		/* Re-arm periodic timers on the original phase */
+		if (timer->_period_ns > 0) {
+			timer->_deadline_ns += timer->_period_ns;
+			if (timer->_deadline_ns <= now) {
+				uint64_t behind = now - timer->_deadline_ns;
+
+				timer->_deadline_ns += (behind / timer->_period_ns + 1) *
+						       timer->_period_ns;
+			}
+			/* Heap only grows, so the popped slot is still free */
+			heap_insert(timer);
 		}
-		if (!timer->_running) {
+
+		/* Internal timers expire under the lock (see internal.h) */
+		if (timer->_expire != NULL) {
+			timer->_expire(timer);
 			continue;
 		}
 
 		/* Fire callback with lock released */
 		eai_osal_timer_cb_t cb = timer->_cb;
 		void *cb_arg = timer->_cb_arg;
-		pthread_mutex_unlock(&timer->_lock);
+
+		svc.current = timer;
+		pthread_mutex_unlock(&svc.lock);
 
 		if (cb != NULL) {
 			cb(cb_arg);
 		}
 
-		pthread_mutex_lock(&timer->_lock);
-
-		/* After initial fire: switch to repeat period or stop */
-		if (timer->_initial_ms > 0) {
-			timer->_initial_ms = 0;
-			if (timer->_period_ms == 0) {
-				timer->_running = false;
-			}
-		}
+		pthread_mutex_lock(&svc.lock);
+		svc.current = NULL;
+		osal_cond_broadcast(&svc.idle);
 	}
 
-	pthread_mutex_unlock(&timer->_lock);
 	return NULL;
 }
 
+static eai_osal_status_t svc_ensure_thread(void)
+{
+	if (svc.thread_alive) {
+		return EAI_OSAL_OK;
+	}
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+	osal_vt_thread_add();
+	int ret = pthread_create(&svc.thread, &attr, svc_thread_func, NULL);
+	pthread_attr_destroy(&attr);
+
+	if (ret != 0) {
+		osal_vt_thread_exit();
+		return EAI_OSAL_ERROR;
+	}
+	svc.thread_alive = true;
+	return EAI_OSAL_OK;
+}
+
+/* ── Internal API (internal.h) ────────────────────────────────────────── */
+
+void osal_timer_init_internal(eai_osal_timer_t *timer, osal_timer_expire_t expire)
+{
+	pthread_once(&svc.once, svc_init);
+
+	timer->_cb = NULL;
+	timer->_cb_arg = NULL;
+	timer->_expire = expire;
+	timer->_deadline_ns = 0;
+	timer->_period_ns = 0;
+	timer->_heap_idx = -1;
+}
+
+void osal_timer_svc_lock(void)
+{
+	pthread_mutex_lock(&svc.lock);
+}
+
+void osal_timer_svc_unlock(void)
+{
+	pthread_mutex_unlock(&svc.lock);
+}
+
+eai_osal_status_t osal_timer_start_locked(eai_osal_timer_t *timer,
+					  uint32_t initial_ms,
+					  uint32_t period_ms)
+{
+	eai_osal_status_t ret = svc_ensure_thread();
+
+	if (ret != EAI_OSAL_OK) {
+		return ret;
+	}
+
+	if (timer->_heap_idx >= 0) {
+		heap_remove(timer);
+	}
+	timer->_deadline_ns = osal_mono_ns() + (uint64_t)initial_ms * 1000000ULL;
+	timer->_period_ns = (uint64_t)period_ms * 1000000ULL;
+
+	ret = heap_insert(timer);
+	if (ret == EAI_OSAL_OK && timer->_heap_idx == 0) {
+		/* New earliest deadline — service must shorten its wait */
+		osal_cond_signal(&svc.cond);
+	}
+	return ret;
+}
+
+bool osal_timer_stop_locked(eai_osal_timer_t *timer)
+{
+	if (timer->_heap_idx < 0) {
+		return false;
+	}
+	heap_remove(timer);
+	return true;
+}
+
+/* ── Public API ───────────────────────────────────────────────────────── */
+
 eai_osal_status_t eai_osal_timer_create(eai_osal_timer_t *timer,
 					eai_osal_timer_cb_t callback,
 					void *arg)
@@ -68,22 +302,14 @@ eai_osal_status_t eai_osal_timer_create(eai_osal_timer_t *timer,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
+	pthread_once(&svc.once, svc_init);
+
 	timer->_cb = callback;
 	timer->_cb_arg = arg;
-	timer->_initial_ms = 0;
-	timer->_period_ms = 0;
-	timer->_running = false;
-	timer->_destroy = false;
-	timer->_thread_alive = false;
-
-	if (pthread_mutex_init(&timer->_lock, NULL) != 0) {
-		return EAI_OSAL_ERROR;
-	}
-	if (pthread_cond_init(&timer->_cond, NULL) != 0) {
-		pthread_mutex_destroy(&timer->_lock);
-		return EAI_OSAL_ERROR;
-	}
-
+	timer->_expire = NULL;
+	timer->_deadline_ns = 0;
+	timer->_period_ns = 0;
+	timer->_heap_idx = -1;
 	return EAI_OSAL_OK;
 }
 
@@ -93,19 +319,17 @@ eai_osal_status_t eai_osal_timer_destroy(eai_osal_timer_t *timer)
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
-	pthread_mutex_lock(&timer->_lock);
-	timer->_destroy = true;
-	timer->_running = false;
-	pthread_cond_signal(&timer->_cond);
-	bool alive = timer->_thread_alive;
-	pthread_mutex_unlock(&timer->_lock);
-
-	if (alive) {
-		pthread_join(timer->_thread, NULL);
+	pthread_mutex_lock(&svc.lock);
+	if (timer->_heap_idx >= 0) {
+		heap_remove(timer);
 	}
 
-	pthread_cond_destroy(&timer->_cond);
-	pthread_mutex_destroy(&timer->_lock);
+	/* Don't return while the callback may still touch the timer's owner */
+	while (svc.current == timer &&
+	       !(svc.thread_alive && pthread_equal(pthread_self(), svc.thread))) {
+		osal_cond_wait(&svc.idle, &svc.lock);
+	}
+	pthread_mutex_unlock(&svc.lock);
 	return EAI_OSAL_OK;
 }
 
@@ -117,26 +341,11 @@ eai_osal_status_t eai_osal_timer_start(eai_osal_timer_t *timer,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
-	pthread_mutex_lock(&timer->_lock);
-	timer->_initial_ms = initial_ms;
-	timer->_period_ms = period_ms;
-	timer->_running = true;
-	timer->_destroy = false;
-
-	if (!timer->_thread_alive) {
-		int ret = pthread_create(&timer->_thread, NULL,
-					 timer_thread_func, timer);
-		if (ret != 0) {
-			timer->_running = false;
-			pthread_mutex_unlock(&timer->_lock);
-			return EAI_OSAL_ERROR;
-		}
-		timer->_thread_alive = true;
-	}
-
-	pthread_cond_signal(&timer->_cond);
-	pthread_mutex_unlock(&timer->_lock);
-	return EAI_OSAL_OK;
+	pthread_mutex_lock(&svc.lock);
+	eai_osal_status_t ret = osal_timer_start_locked(timer, initial_ms,
+							period_ms);
+	pthread_mutex_unlock(&svc.lock);
+	return ret;
 }
 
 eai_osal_status_t eai_osal_timer_stop(eai_osal_timer_t *timer)
@@ -144,10 +353,9 @@ eai_osal_status_t eai_osal_timer_stop(eai_osal_timer_t *timer)
 	if (timer == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	pthread_mutex_lock(&timer->_lock);
-	timer->_running = false;
-	pthread_cond_signal(&timer->_cond);
-	pthread_mutex_unlock(&timer->_lock);
+	pthread_mutex_lock(&svc.lock);
+	osal_timer_stop_locked(timer);
+	pthread_mutex_unlock(&svc.lock);
 	return EAI_OSAL_OK;
 }
 
@@ -156,8 +364,8 @@ bool eai_osal_timer_is_running(eai_osal_timer_t *timer)
 	if (timer == NULL) {
 		return false;
 	}
-	pthread_mutex_lock(&timer->_lock);
-	bool running = timer->_running;
-	pthread_mutex_unlock(&timer->_lock);
+	pthread_mutex_lock(&svc.lock);
+	bool running = timer->_heap_idx >= 0;
+	pthread_mutex_unlock(&svc.lock);
 	return running;
 }
@@ -8,90 +8,255 @@
  */
 
 #include <pthread.h>
+#include <stdatomic.h>
+
+/*
+ * On Linux, semaphores, events, and queues park on futexes directly
+ * (futex.h) instead of pthread mutex/condvar pairs. Other hosts, or
+ * Linux builds with CONFIG_EAI_OSAL_POSIX_NO_FUTEX, keep the portable
+ * pthread path, as do virtual-time builds, which must see every wait.
+ */
+#if defined(__linux__) && !defined(CONFIG_EAI_OSAL_POSIX_NO_FUTEX) && \
+	!defined(CONFIG_EAI_OSAL_VIRTUAL_TIME)
+#define EAI_OSAL_POSIX_FUTEX 1
+#else
+#define EAI_OSAL_POSIX_FUTEX 0
+#endif
+
+#if EAI_OSAL_POSIX_FUTEX
+/* Futex condition: FIFO of parked waiters, guarded by its lock (futex.h) */
+struct osal_fcond_node;
+
+typedef struct {
+	struct osal_fcond_node *_head;
+	struct osal_fcond_node *_tail;
+} osal_fcond_t;
+
+/* Parked eai_osal_event_wait() caller, lives on its stack (event_futex.c) */
+struct osal_event_waiter;
+#endif
+
+/*
+ * What a poll entry wakes: a blocked eai_osal_poll() call (poll.c) or an
+ * armed eai_osal_work_poll_t (workqueue.c). Called with poll_lock held.
+ */
+struct osal_poller {
+	void (*_wake)(struct osal_poller *poller);
+};
+
+/* eai_osal_poll() registration, one per poll entry, listed on its object */
+typedef struct osal_poll_node {
+	struct osal_poll_node *_next;
+	struct osal_poller *_poller;
+} eai_osal_poll_priv_t;
 
 typedef struct {
 	pthread_mutex_t _handle;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
 } eai_osal_mutex_t;
 
 typedef struct {
+#if EAI_OSAL_POSIX_FUTEX
+	atomic_uint _count;   /* futex word */
+	atomic_uint _waiters; /* takers parked or about to park */
+#else
 	pthread_mutex_t _lock;
 	pthread_cond_t _cond;
 	uint32_t _count;
+#endif
+	_Atomic(struct osal_poll_node *) _pollers; /* eai_osal_poll() waiters */
 	uint32_t _limit;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
 } eai_osal_sem_t;
 
-typedef struct {
+typedef struct eai_osal_thread {
 	pthread_t _handle;
 	eai_osal_thread_entry_t _entry;
 	void *_entry_arg;
 	pthread_mutex_t _join_lock;
 	pthread_cond_t _join_cond;
 	bool _done;
+	uint8_t _priority;
+	char _name[16];
+	/* Stats registry (thread.c), guarded by its lock */
+	struct eai_osal_thread *_next;
+	int _tid;                 /* kernel thread id, 0 until started */
+	clockid_t _cpu_clock;
+	const uint8_t *_stack_lo; /* painted stack, NULL if not painted */
+	size_t _stack_size;
 } eai_osal_thread_t;
 
 typedef struct {
+#if EAI_OSAL_POSIX_FUTEX
+	atomic_uint _lock;
+	osal_fcond_t _not_full;
+	osal_fcond_t _not_empty;
+#else
 	pthread_mutex_t _lock;
 	pthread_cond_t _not_full;
 	pthread_cond_t _not_empty;
+#endif
 	uint8_t *_buf;
 	size_t _msg_size;
 	uint32_t _max_msgs;
 	uint32_t _head;
 	uint32_t _tail;
 	uint32_t _count;
+	bool _wr_busy; /* head slot reserved, not yet committed */
+	bool _rd_busy; /* tail slot peeked, not yet released */
+	_Atomic(struct osal_poll_node *) _pollers;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
 } eai_osal_queue_t;
 
+/*
+ * Byte pipe — lock-free SPSC ring (pipe.c). _head and _tail run modulo
+ * twice the size, so a full pipe and an empty one differ. A side that has
+ * to wait posts what it waits for in its _*_want and parks on its sem.
+ */
 typedef struct {
-	pthread_t _thread;
+	uint8_t *_buf;
+	size_t _size;
+	size_t _threshold;
+	eai_osal_sem_t _rx_sem;
+	eai_osal_sem_t _tx_sem;
+
+	_Alignas(64) atomic_size_t _head; /* written by the writer */
+	atomic_size_t _rx_want;           /* bytes the parked reader needs, 0 = none */
+
+	_Alignas(64) atomic_size_t _tail; /* written by the reader */
+	atomic_size_t _tx_want;           /* space the parked writer needs, 0 = none */
+} eai_osal_pipe_t;
+
+typedef struct {
+#if EAI_OSAL_POSIX_FUTEX
+	atomic_uint _state; /* futex word: readers, waiting writers, flags (rwlock_futex.c) */
+#else
 	pthread_mutex_t _lock;
-	pthread_cond_t _cond;
+	pthread_cond_t _readers_cv;
+	pthread_cond_t _writers_cv;
+	uint32_t _readers;         /* read holds */
+	uint32_t _writers_waiting;
+	bool _writer;
+#endif
+} eai_osal_rwlock_t;
+
+/*
+ * Block pool — Treiber stack of free block indices (mempool.c). _top packs
+ * an ABA tag in the high word over index + 1 (0 = empty) in the low word.
+ */
+typedef struct {
+	uint8_t *_buf;
+	size_t _block_size;
+	uint32_t _n_blocks;
+	atomic_uint *_next;         /* per-block free-list link, index + 1 */
+	_Atomic uint64_t _top;
+	eai_osal_sem_t _free_sem;   /* counts free blocks; alloc waits here */
+	atomic_uint _used;
+	atomic_uint _high_water;
+	atomic_uint _failures;
+} eai_osal_mempool_t;
+
+/*
+ * Timer — armed in the shared timer service's deadline heap (timer.c).
+ * All fields are protected by the service lock.
+ */
+typedef struct eai_osal_timer {
 	eai_osal_timer_cb_t _cb;
 	void *_cb_arg;
-	uint32_t _initial_ms;
-	uint32_t _period_ms;
-	bool _running;
-	bool _destroy;
-	bool _thread_alive;
+	/* OSAL-internal expiry hook, run under the service lock (internal.h) */
+	void (*_expire)(struct eai_osal_timer *timer);
+	uint64_t _deadline_ns; /* absolute CLOCK_MONOTONIC expiry */
+	uint64_t _period_ns;   /* 0 = one-shot */
+	int32_t _heap_idx;     /* slot in the service heap, -1 = not armed */
 } eai_osal_timer_t;
 
 typedef struct {
+#if EAI_OSAL_POSIX_FUTEX
+	atomic_uint _bits;
+	atomic_uint _lock;                  /* guards _waitq */
+	atomic_uint _nwait;                 /* entries on _waitq */
+	struct osal_event_waiter *_waitq;
+#else
 	pthread_mutex_t _lock;
 	pthread_cond_t _cond;
 	uint32_t _bits;
+#endif
+	_Atomic(struct osal_poll_node *) _pollers;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
 } eai_osal_event_t;
 
 typedef unsigned int eai_osal_critical_key_t;
 
 /* Work item — submitted to a work queue */
-typedef struct {
+typedef struct eai_osal_work {
 	eai_osal_work_cb_t _cb;
 	void *_cb_arg;
+	/* Pool bookkeeping (workqueue_pool.c) */
+	atomic_uint _state;          /* pending/running bits */
+	struct eai_osal_work *_next; /* pool injection list link */
 } eai_osal_work_t;
 
 /* Forward declaration for delayed work target */
 struct eai_osal_workqueue;
 
-/* Delayed work — uses a timer thread to defer submission */
+/* Delayed work — a timer in the shared timer service enqueues on expiry */
 typedef struct {
+	eai_osal_timer_t _timer; /* must stay first — expiry hook casts back */
 	eai_osal_work_cb_t _cb;
 	void *_cb_arg;
-	pthread_t _timer_thread;
-	pthread_mutex_t _lock;
-	pthread_cond_t _cond;
-	uint32_t _delay_ms;
 	void *_target_wq; /* eai_osal_workqueue_t*, NULL = system */
-	bool _pending;
-	bool _cancel;
-	bool _thread_alive;
+	bool _retrying;   /* expired on a full queue, reject already counted */
 } eai_osal_dwork_t;
 
-/* Work queue — thread that processes {cb, arg} items from an internal queue */
+/*
+ * Triggered work — listed on its poll entries' objects like a blocked
+ * eai_osal_poll() caller, plus a service timer for the timeout
+ */
+struct eai_osal_poll_event;
+
+typedef struct {
+	eai_osal_timer_t _timer; /* must stay first — expiry hook casts back */
+	struct osal_poller _poller;
+	eai_osal_work_cb_t _cb;
+	void *_cb_arg;
+	struct eai_osal_poll_event *_events;
+	size_t _n;
+	struct eai_osal_workqueue *_wq;
+	uint64_t _deadline_ns; /* UINT64_MAX = no timeout */
+	atomic_int _state;     /* WP_* in workqueue.c */
+} eai_osal_work_poll_t;
+
+/* Work queue — thread that processes {cb, arg} items from a priority queue */
+struct eai_osal_pqueue;
+
 typedef struct eai_osal_workqueue {
 	pthread_t _thread;
-	eai_osal_queue_t _queue;
-	uint8_t _buf[16 * (sizeof(eai_osal_work_cb_t) + sizeof(void *))];
+	uint8_t _priority;
+	char _name[16];
+	struct eai_osal_pqueue *_queue; /* allocated with its storage at create */
+	uint32_t _depth;
+	/* Counters (eai_osal_workqueue_get_stats) */
+	atomic_uint _pending;
+	atomic_uint _high_water;
+	atomic_uint _rejected;
+	atomic_uint _max_latency_us;
 } eai_osal_workqueue_t;
 
+/* Work queue pool — workers and deques live in workqueue_pool.c */
+struct osal_wq_pool;
+
+typedef struct {
+	struct osal_wq_pool *_impl;
+} eai_osal_workqueue_pool_t;
+
 /*
  * Thread stacks on POSIX are allocated by pthread.
  * These macros exist for API compatibility — the stack array is not used.
@@ -99,5 +264,7 @@ typedef struct eai_osal_workqueue {
 #define EAI_OSAL_THREAD_STACK_DEFINE(name, size) \
 	static uint8_t name[size] __attribute__((unused))
 #define EAI_OSAL_THREAD_STACK_SIZEOF(name) sizeof(name)
+#define EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(name, n, size) \
+	static uint8_t name[n][size] __attribute__((unused))
 
 #endif /* EAI_OSAL_POSIX_TYPES_H */
@@ -0,0 +1,203 @@
+#include "internal.h"
+
+/*
+ * Virtual time (CONFIG_EAI_OSAL_VIRTUAL_TIME).
+ *
+ * osal_mono_ns() reads a simulated clock that starts at zero and only
+ * moves when every OSAL thread is parked in osal_vt_wait(). It then jumps
+ * straight to the earliest deadline and times out the waiters due at it.
+ * A timer, a dwork delay or a 2 s sleep costs no real time, and a run
+ * gives the same timestamps every time.
+ *
+ * running counts OSAL threads that are not parked: the main thread, plus
+ * every thread the backend starts (osal_vt_thread_add()). A wake credits
+ * the waiter's running slot while the waker still holds the lock. So
+ * between a give and the woken thread actually running, the clock can't
+ * see everyone parked and run ahead of it.
+ *
+ * Waiters park on their own condvar under vt.lock. The object's condvar
+ * is only a key that osal_vt_wake() matches. Lock order is object lock,
+ * then vt.lock.
+ *
+ * A thread blocked outside the OSAL, in usleep() or read() for example,
+ * still counts as running. Virtual time stands still until it comes
+ * back.
+ */
+
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+
+struct vt_waiter {
+	struct vt_waiter *next;
+	const void *key;      /* NULL for a plain sleep */
+	uint64_t deadline_ns; /* OSAL_VT_FOREVER = no timeout */
+	pthread_cond_t wake;
+	bool woken;
+	bool timed_out;
+};
+
+static struct {
+	pthread_mutex_t lock;
+	_Atomic uint64_t now_ns;
+	unsigned int running;
+	struct vt_waiter *head; /* parked threads, in the order they parked */
+} vt = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.running = 1, /* the main thread */
+};
+
+uint64_t osal_vt_now_ns(void)
+{
+	return atomic_load_explicit(&vt.now_ns, memory_order_acquire);
+}
+
+/* ── Waiter list (vt.lock held) ───────────────────────────────────────── */
+
+static void waiter_append(struct vt_waiter *w)
+{
+	struct vt_waiter **link = &vt.head;
+
+	while (*link != NULL) {
+		link = &(*link)->next;
+	}
+	w->next = NULL;
+	*link = w;
+}
+
+/* Unlink w, mark it runnable and give its running slot back */
+static void waiter_release(struct vt_waiter **link, bool timed_out)
+{
+	struct vt_waiter *w = *link;
+
+	*link = w->next;
+	w->woken = true;
+	w->timed_out = timed_out;
+	vt.running++;
+	pthread_cond_signal(&w->wake);
+}
+
+/* Everyone is parked: jump to the earliest deadline and time out its waiters */
+static void advance_if_idle(void)
+{
+	if (vt.running > 0) {
+		return;
+	}
+
+	uint64_t next = OSAL_VT_FOREVER;
+
+	for (struct vt_waiter *w = vt.head; w != NULL; w = w->next) {
+		if (w->deadline_ns < next) {
+			next = w->deadline_ns;
+		}
+	}
+	if (next == OSAL_VT_FOREVER) {
+		return; /* deadlocked; real time would hang here too */
+	}
+	if (next > osal_vt_now_ns()) {
+		atomic_store_explicit(&vt.now_ns, next, memory_order_release);
+	}
+
+	struct vt_waiter **link = &vt.head;
+
+	while (*link != NULL) {
+		if ((*link)->deadline_ns <= next) {
+			waiter_release(link, true);
+		} else {
+			link = &(*link)->next;
+		}
+	}
+}
+
+/* ── Internal API (internal.h) ────────────────────────────────────────── */
+
+void osal_vt_thread_add(void)
+{
+	pthread_mutex_lock(&vt.lock);
+	vt.running++;
+	pthread_mutex_unlock(&vt.lock);
+}
+
+void osal_vt_thread_exit(void)
+{
+	pthread_mutex_lock(&vt.lock);
+	vt.running--;
+	advance_if_idle();
+	pthread_mutex_unlock(&vt.lock);
+}
+
+/* Park until woken or timed out (vt.lock held); true on timeout */
+static bool vt_park(const void *key, uint64_t deadline_ns, pthread_mutex_t *lock)
+{
+	struct vt_waiter w = {
+		.key = key,
+		.deadline_ns = deadline_ns,
+	};
+
+	pthread_cond_init(&w.wake, NULL);
+	waiter_append(&w);
+	if (lock != NULL) {
+		pthread_mutex_unlock(lock);
+	}
+	vt.running--;
+	advance_if_idle();
+	while (!w.woken) {
+		pthread_cond_wait(&w.wake, &vt.lock);
+	}
+	pthread_cond_destroy(&w.wake);
+	return w.timed_out;
+}
+
+int osal_vt_wait(const void *key, pthread_mutex_t *lock, uint64_t deadline_ns)
+{
+	bool timed_out = true;
+
+	pthread_mutex_lock(&vt.lock);
+	if (deadline_ns > osal_vt_now_ns()) {
+		timed_out = vt_park(key, deadline_ns, lock);
+	} else if (lock != NULL) {
+		pthread_mutex_unlock(lock);
+	}
+	pthread_mutex_unlock(&vt.lock);
+
+	if (lock != NULL) {
+		pthread_mutex_lock(lock);
+	}
+	return timed_out ? ETIMEDOUT : 0;
+}
+
+int osal_vt_mutex_lock(pthread_mutex_t *mutex, uint64_t deadline_ns)
+{
+	int ret = 0;
+
+	pthread_mutex_lock(&vt.lock);
+	/* The owner's unlock wakes us under vt.lock, so no unlock is missed */
+	while (pthread_mutex_trylock(mutex) != 0) {
+		if (deadline_ns <= osal_vt_now_ns() ||
+		    vt_park(mutex, deadline_ns, NULL)) {
+			ret = ETIMEDOUT;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&vt.lock);
+	return ret;
+}
+
+void osal_vt_wake(const void *key, bool all)
+{
+	pthread_mutex_lock(&vt.lock);
+
+	struct vt_waiter **link = &vt.head;
+
+	while (*link != NULL) {
+		if ((*link)->key == key) {
+			waiter_release(link, false);
+			if (!all) {
+				break;
+			}
+		} else {
+			link = &(*link)->next;
+		}
+	}
+	pthread_mutex_unlock(&vt.lock);
+}
+
+#endif /* CONFIG_EAI_OSAL_VIRTUAL_TIME */
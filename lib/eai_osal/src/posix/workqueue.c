@@ -1,23 +1,41 @@
 #include <eai_osal/workqueue.h>
-#include <eai_osal/queue.h>
+#include <eai_osal/pqueue.h>
 #include "internal.h"
+#include <stdlib.h>
 #include <string.h>
 
 /*
  * POSIX work queue implementation.
  *
- * Same pattern as FreeRTOS: a thread blocks on an internal OSAL queue,
- * processing {callback, arg} pairs. System work queue is lazily initialized.
- * Delayed work uses a timer thread that enqueues on expiry.
+ * Same pattern as FreeRTOS: a thread blocks on an internal OSAL priority
+ * queue, processing {callback, arg} pairs highest level first. System work
+ * queue is lazily initialized. Delayed work rides the shared timer service
+ * and enqueues on expiry; triggered work also listens on its poll entries.
+ *
+ * Each item carries its enqueue time so the worker can track the longest
+ * submit-to-start delay. Counters are atomics: submitters and the worker
+ * never share a lock for them.
  */
 
-#define WQ_DEPTH 16
-
 struct wq_item {
 	eai_osal_work_cb_t cb;
 	void *arg;
+	uint64_t queued_ns;
 };
 
+/* ── Counters ─────────────────────────────────────────────────────────── */
+
+static void counter_max(atomic_uint *counter, unsigned int val)
+{
+	unsigned int cur = atomic_load_explicit(counter, memory_order_relaxed);
+
+	while (val > cur &&
+	       !atomic_compare_exchange_weak_explicit(counter, &cur, val,
+						      memory_order_relaxed,
+						      memory_order_relaxed)) {
+	}
+}
+
 /* ── System work queue (lazy init) ────────────────────────────────────── */
 
 static eai_osal_workqueue_t sys_wq;
@@ -28,36 +46,80 @@ static void *wq_task(void *arg)
 	eai_osal_workqueue_t *wq = (eai_osal_workqueue_t *)arg;
 	struct wq_item item;
 
+	osal_thread_setup(wq->_name, wq->_priority);
+
+	/*
+	 * One item per receive, not a batch: an urgent item submitted while
+	 * a batch ran would wait behind the rest of that batch.
+	 */
 	for (;;) {
-		if (eai_osal_queue_recv(&wq->_queue, &item,
-					EAI_OSAL_WAIT_FOREVER) == EAI_OSAL_OK) {
-			if (item.cb != NULL) {
-				item.cb(item.arg);
-			}
+		if (eai_osal_pqueue_recv(wq->_queue, &item, NULL,
+					 EAI_OSAL_WAIT_FOREVER) != EAI_OSAL_OK) {
+			continue;
+		}
+		atomic_fetch_sub_explicit(&wq->_pending, 1, memory_order_relaxed);
+
+		uint64_t waited = osal_mono_ns() - item.queued_ns;
+
+		counter_max(&wq->_max_latency_us, (unsigned int)(waited / 1000));
+		if (item.cb != NULL) {
+			item.cb(item.arg);
 		}
 	}
 	return NULL;
 }
 
-static eai_osal_workqueue_t *get_sys_wq(void)
+/* Queue storage and thread */
+static eai_osal_status_t wq_start(eai_osal_workqueue_t *wq, uint32_t depth,
+				  size_t stack_size, const char *name,
+				  uint8_t priority)
 {
-	if (!sys_wq_ready) {
-		eai_osal_status_t ret = eai_osal_queue_create(
-			&sys_wq._queue, sizeof(struct wq_item),
-			WQ_DEPTH, sys_wq._buf);
-		if (ret != EAI_OSAL_OK) {
-			return NULL;
-		}
+	osal_thread_name_copy(wq->_name, name);
+	wq->_priority = priority;
+
+	/* The queue's storage follows the queue in the same allocation */
+	wq->_queue = malloc(sizeof(eai_osal_pqueue_t) +
+			    EAI_OSAL_PQUEUE_BUF_SIZE(sizeof(struct wq_item), depth));
+	if (wq->_queue == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+	wq->_depth = depth;
+	atomic_init(&wq->_pending, 0);
+	atomic_init(&wq->_high_water, 0);
+	atomic_init(&wq->_rejected, 0);
+	atomic_init(&wq->_max_latency_us, 0);
+
+	eai_osal_status_t ret = eai_osal_pqueue_create(
+		wq->_queue, sizeof(struct wq_item), depth, wq->_queue + 1);
+	if (ret != EAI_OSAL_OK) {
+		free(wq->_queue);
+		wq->_queue = NULL;
+		return ret;
+	}
 
-		pthread_attr_t attr;
-		pthread_attr_init(&attr);
-		pthread_attr_setstacksize(&attr, 65536);
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, stack_size);
 
-		int rc = pthread_create(&sys_wq._thread, &attr, wq_task, &sys_wq);
-		pthread_attr_destroy(&attr);
+	osal_vt_thread_add();
+	int rc = pthread_create(&wq->_thread, &attr, wq_task, wq);
+	pthread_attr_destroy(&attr);
+
+	if (rc != 0) {
+		osal_vt_thread_exit();
+		eai_osal_pqueue_destroy(wq->_queue);
+		free(wq->_queue);
+		wq->_queue = NULL;
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
 
-		if (rc != 0) {
-			eai_osal_queue_destroy(&sys_wq._queue);
+static eai_osal_workqueue_t *get_sys_wq(void)
+{
+	if (!sys_wq_ready) {
+		if (wq_start(&sys_wq, EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH, 65536,
+			     "sysworkq", OSAL_PRIO_INHERIT) != EAI_OSAL_OK) {
 			return NULL;
 		}
 		sys_wq_ready = true;
@@ -76,15 +138,40 @@ eai_osal_status_t eai_osal_work_init(eai_osal_work_t *work,
 	}
 	work->_cb = callback;
 	work->_cb_arg = arg;
+	atomic_init(&work->_state, 0);
+	work->_next = NULL;
 	return EAI_OSAL_OK;
 }
 
-static eai_osal_status_t submit_to_queue(eai_osal_queue_t *q,
-					 eai_osal_work_cb_t cb, void *arg)
+/*
+ * A rejected submit counts in _rejected. Delayed and triggered work that
+ * expire on a full queue retry from their timer with retry set, so an item
+ * that is held up counts once however many attempts it takes.
+ */
+static eai_osal_status_t submit_to_queue(eai_osal_workqueue_t *wq,
+					 eai_osal_work_cb_t cb, void *arg,
+					 uint8_t prio, uint32_t timeout_ms,
+					 bool retry)
 {
 	struct wq_item item = { .cb = cb, .arg = arg };
 
-	return eai_osal_queue_send(q, &item, EAI_OSAL_NO_WAIT);
+	/* Count before the send so the worker never sees pending underflow */
+	unsigned int n = atomic_fetch_add_explicit(&wq->_pending, 1,
+						   memory_order_relaxed) + 1;
+
+	item.queued_ns = osal_mono_ns();
+	eai_osal_status_t ret = eai_osal_pqueue_send(wq->_queue, &item, prio,
+						     timeout_ms);
+	if (ret != EAI_OSAL_OK) {
+		atomic_fetch_sub_explicit(&wq->_pending, 1, memory_order_relaxed);
+		if (!retry) {
+			atomic_fetch_add_explicit(&wq->_rejected, 1,
+						  memory_order_relaxed);
+		}
+		return ret;
+	}
+	counter_max(&wq->_high_water, n < wq->_depth ? n : wq->_depth);
+	return EAI_OSAL_OK;
 }
 
 eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
@@ -97,7 +184,8 @@ eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
 	if (wq == NULL) {
 		return EAI_OSAL_ERROR;
 	}
-	return submit_to_queue(&wq->_queue, work->_cb, work->_cb_arg);
+	return submit_to_queue(wq, work->_cb, work->_cb_arg,
+			       EAI_OSAL_WORK_PRIO_DEFAULT, EAI_OSAL_NO_WAIT, false);
 }
 
 eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
@@ -106,37 +194,84 @@ eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
 	if (work == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return submit_to_queue(&wq->_queue, work->_cb, work->_cb_arg);
+	return submit_to_queue(wq, work->_cb, work->_cb_arg,
+			       EAI_OSAL_WORK_PRIO_DEFAULT, EAI_OSAL_NO_WAIT, false);
 }
 
-/* ── Delayed work ─────────────────────────────────────────────────────── */
+eai_osal_status_t eai_osal_work_submit_timeout(eai_osal_work_t *work,
+					       eai_osal_workqueue_t *wq,
+					       uint32_t timeout_ms)
+{
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	return submit_to_queue(wq, work->_cb, work->_cb_arg,
+			       EAI_OSAL_WORK_PRIO_DEFAULT, timeout_ms, false);
+}
 
-static void *dwork_timer_thread(void *arg)
+eai_osal_status_t eai_osal_work_submit_prio(eai_osal_work_t *work,
+					    eai_osal_workqueue_t *wq,
+					    uint8_t prio)
 {
-	eai_osal_dwork_t *dwork = (eai_osal_dwork_t *)arg;
+	if (work == NULL || prio >= EAI_OSAL_PQUEUE_LEVELS) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	return submit_to_queue(wq, work->_cb, work->_cb_arg, prio,
+			       EAI_OSAL_NO_WAIT, false);
+}
 
-	pthread_mutex_lock(&dwork->_lock);
-	struct timespec ts = osal_timespec(dwork->_delay_ms);
-	pthread_cond_timedwait(&dwork->_cond, &dwork->_lock, &ts);
+/* ── Delayed work ─────────────────────────────────────────────────────── */
+
+/*
+ * Each dwork embeds an internal timer in the shared timer service, whose
+ * deadline heap is the delay queue for every work queue. The expiry hook
+ * enqueues under the service lock, so submit/cancel and expiry serialize
+ * on that lock: after cancel returns, the work was either already queued
+ * or will not be queued by the previous submission. An expiry that finds
+ * the queue full restarts the timer for DWORK_RETRY_MS and tries again,
+ * so cancel stops the retries too. _retrying, also under the lock, keeps
+ * the retries of one expiry from counting as more than one reject.
+ */
+#define DWORK_RETRY_MS 1
 
-	bool cancelled = dwork->_cancel;
-	eai_osal_work_cb_t cb = dwork->_cb;
-	void *cb_arg = dwork->_cb_arg;
+static void dwork_expire(eai_osal_timer_t *timer)
+{
+	eai_osal_dwork_t *dwork = (eai_osal_dwork_t *)timer;
 	eai_osal_workqueue_t *wq = (eai_osal_workqueue_t *)dwork->_target_wq;
-	dwork->_pending = false;
-	dwork->_thread_alive = false;
-	pthread_mutex_unlock(&dwork->_lock);
 
-	if (!cancelled) {
-		if (wq == NULL) {
-			wq = get_sys_wq();
-		}
-		if (wq != NULL) {
-			submit_to_queue(&wq->_queue, cb, cb_arg);
-		}
+	if (wq == NULL) {
+		wq = get_sys_wq();
 	}
-
-	return NULL;
+	if (wq == NULL) {
+		return;
+	}
+	/*
+	 * Never block under the service lock; a full queue counts a reject.
+	 * Clear _retrying before the enqueue: once the item is queued the
+	 * dwork may be reused by whoever its callback wakes.
+	 */
+	bool retry = dwork->_retrying;
+
+	dwork->_retrying = false;
+	if (submit_to_queue(wq, dwork->_cb, dwork->_cb_arg,
+			    EAI_OSAL_WORK_PRIO_DEFAULT, EAI_OSAL_NO_WAIT,
+			    retry) == EAI_OSAL_OK) {
+		return;
+	}
+	dwork->_retrying = true;
+	osal_timer_start_locked(&dwork->_timer, DWORK_RETRY_MS, 0);
 }
 
 eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
@@ -146,53 +281,30 @@ eai_osal_status_t eai_osal_dwork_init(eai_osal_dwork_t *dwork,
 	if (dwork == NULL || callback == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	osal_timer_init_internal(&dwork->_timer, dwork_expire);
 	dwork->_cb = callback;
 	dwork->_cb_arg = arg;
 	dwork->_target_wq = NULL;
-	dwork->_pending = false;
-	dwork->_cancel = false;
-	dwork->_thread_alive = false;
-
-	if (pthread_mutex_init(&dwork->_lock, NULL) != 0) {
-		return EAI_OSAL_ERROR;
-	}
-	if (pthread_cond_init(&dwork->_cond, NULL) != 0) {
-		pthread_mutex_destroy(&dwork->_lock);
-		return EAI_OSAL_ERROR;
-	}
+	dwork->_retrying = false;
 	return EAI_OSAL_OK;
 }
 
-static eai_osal_status_t dwork_start(eai_osal_dwork_t *dwork, uint32_t delay_ms)
+static eai_osal_status_t dwork_start(eai_osal_dwork_t *dwork,
+				     eai_osal_workqueue_t *wq,
+				     uint32_t delay_ms)
 {
-	pthread_mutex_lock(&dwork->_lock);
-
-	/* If a timer thread is still alive from a previous submit, join it */
-	if (dwork->_thread_alive) {
-		pthread_t old = dwork->_timer_thread;
-		dwork->_cancel = true;
-		pthread_cond_signal(&dwork->_cond);
-		pthread_mutex_unlock(&dwork->_lock);
-		pthread_join(old, NULL);
-		pthread_mutex_lock(&dwork->_lock);
-	}
-
-	dwork->_delay_ms = delay_ms;
-	dwork->_pending = true;
-	dwork->_cancel = false;
-
-	pthread_t thread;
-	int ret = pthread_create(&thread, NULL, dwork_timer_thread, dwork);
-	if (ret != 0) {
-		dwork->_pending = false;
-		pthread_mutex_unlock(&dwork->_lock);
+	/* Resolve the system queue outside the service lock */
+	if (wq == NULL && get_sys_wq() == NULL) {
 		return EAI_OSAL_ERROR;
 	}
-	dwork->_timer_thread = thread;
-	dwork->_thread_alive = true;
-	pthread_detach(thread);
-	pthread_mutex_unlock(&dwork->_lock);
-	return EAI_OSAL_OK;
+
+	osal_timer_svc_lock();
+	dwork->_target_wq = wq;
+	dwork->_retrying = false;
+	eai_osal_status_t ret = osal_timer_start_locked(&dwork->_timer,
+							delay_ms, 0);
+	osal_timer_svc_unlock();
+	return ret;
 }
 
 eai_osal_status_t eai_osal_dwork_submit(eai_osal_dwork_t *dwork,
@@ -201,8 +313,7 @@ eai_osal_status_t eai_osal_dwork_submit(eai_osal_dwork_t *dwork,
 	if (dwork == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	dwork->_target_wq = NULL;
-	return dwork_start(dwork, delay_ms);
+	return dwork_start(dwork, NULL, delay_ms);
 }
 
 eai_osal_status_t eai_osal_dwork_submit_to(eai_osal_dwork_t *dwork,
@@ -212,8 +323,7 @@ eai_osal_status_t eai_osal_dwork_submit_to(eai_osal_dwork_t *dwork,
 	if (dwork == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	dwork->_target_wq = wq;
-	return dwork_start(dwork, delay_ms);
+	return dwork_start(dwork, wq, delay_ms);
 }
 
 eai_osal_status_t eai_osal_dwork_cancel(eai_osal_dwork_t *dwork)
@@ -221,10 +331,215 @@ eai_osal_status_t eai_osal_dwork_cancel(eai_osal_dwork_t *dwork)
 	if (dwork == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	pthread_mutex_lock(&dwork->_lock);
-	dwork->_cancel = true;
-	pthread_cond_signal(&dwork->_cond);
-	pthread_mutex_unlock(&dwork->_lock);
+	osal_timer_svc_lock();
+	osal_timer_stop_locked(&dwork->_timer);
+	dwork->_retrying = false;
+	osal_timer_svc_unlock();
+	return EAI_OSAL_OK;
+}
+
+/* ── Triggered work ───────────────────────────────────────────────────── */
+
+/*
+ * An armed item is listed on its entries' objects, like a blocked
+ * eai_osal_poll() caller, and for a finite timeout on the timer service.
+ * The first wake or expiry moves it from ARMED to FIRED and queues
+ * wp_run(); any later one finds it FIRED and does nothing. wp_run() takes
+ * it off the lists and the timer, so nothing can reach it afterwards, then
+ * rescans. With nothing ready and time left, the wake was spurious (a
+ * stale expiry, or another consumer got there first) and it arms again.
+ *
+ * A wake that lands while submit is still listing the entries is parked
+ * as ARMING_WOKEN and acted on at the end of submit. A trigger that finds
+ * the queue full goes to RETRY and the timer tries again in WP_RETRY_MS.
+ */
+enum {
+	WP_IDLE,
+	WP_ARMING,
+	WP_ARMING_WOKEN,
+	WP_ARMED,
+	WP_FIRED,
+	WP_RETRY,
+	WP_CANCELLING,
+};
+
+#define WP_RETRY_MS 1
+
+static void wp_run(void *arg);
+
+/*
+ * Queue wp_run() for an item that just went FIRED. retry is set when it
+ * comes back from RETRY, whose first attempt already counted the reject.
+ */
+static void wp_queue(eai_osal_work_poll_t *wp, bool svc_locked, bool retry)
+{
+	if (submit_to_queue(wp->_wq, wp_run, wp, EAI_OSAL_WORK_PRIO_DEFAULT,
+			    EAI_OSAL_NO_WAIT, retry) == EAI_OSAL_OK) {
+		return;
+	}
+	atomic_store(&wp->_state, WP_RETRY);
+	if (!svc_locked) {
+		osal_timer_svc_lock();
+	}
+	osal_timer_start_locked(&wp->_timer, WP_RETRY_MS, 0);
+	if (!svc_locked) {
+		osal_timer_svc_unlock();
+	}
+}
+
+static void wp_trigger(eai_osal_work_poll_t *wp, bool svc_locked)
+{
+	int state = atomic_load(&wp->_state);
+
+	for (;;) {
+		int next;
+
+		if (state == WP_ARMED) {
+			next = WP_FIRED;
+		} else if (state == WP_ARMING) {
+			next = WP_ARMING_WOKEN;
+		} else {
+			return;
+		}
+		if (atomic_compare_exchange_weak(&wp->_state, &state, next)) {
+			if (next == WP_FIRED) {
+				wp_queue(wp, svc_locked, false);
+			}
+			return;
+		}
+	}
+}
+
+/* Entry wake, with poll_lock held */
+static void wp_wake(struct osal_poller *poller)
+{
+	wp_trigger((eai_osal_work_poll_t *)((char *)poller -
+					    offsetof(eai_osal_work_poll_t, _poller)),
+		   false);
+}
+
+/* Timeout or retry, under the service lock */
+static void wp_expire(eai_osal_timer_t *timer)
+{
+	eai_osal_work_poll_t *wp = (eai_osal_work_poll_t *)timer;
+	int state = WP_RETRY;
+
+	if (atomic_compare_exchange_strong(&wp->_state, &state, WP_FIRED)) {
+		wp_queue(wp, true, true);
+	} else {
+		wp_trigger(wp, true);
+	}
+}
+
+static void wp_arm(eai_osal_work_poll_t *wp)
+{
+	atomic_store(&wp->_state, WP_ARMING);
+	osal_poll_register(wp->_events, wp->_n, &wp->_poller);
+	if (wp->_deadline_ns != UINT64_MAX) {
+		uint64_t now = osal_mono_ns();
+		uint32_t left = 0;
+
+		if (wp->_deadline_ns > now) {
+			/* Round up, so the timer doesn't fire just short */
+			left = (uint32_t)((wp->_deadline_ns - now + 999999) / 1000000);
+		}
+		osal_timer_svc_lock();
+		osal_timer_start_locked(&wp->_timer, left, 0);
+		osal_timer_svc_unlock();
+	}
+
+	int state = WP_ARMING;
+
+	if (!atomic_compare_exchange_strong(&wp->_state, &state, WP_ARMED)) {
+		atomic_store(&wp->_state, WP_FIRED); /* woken while listing */
+		wp_queue(wp, false, false);
+	} else if (osal_poll_any_ready(wp->_events, wp->_n)) {
+		wp_trigger(wp, false);
+	}
+}
+
+static void wp_run(void *arg)
+{
+	eai_osal_work_poll_t *wp = (eai_osal_work_poll_t *)arg;
+
+	osal_timer_svc_lock();
+	osal_timer_stop_locked(&wp->_timer);
+	osal_timer_svc_unlock();
+	osal_poll_unregister(wp->_events, wp->_n);
+
+	if (!osal_poll_scan(wp->_events, wp->_n) &&
+	    wp->_deadline_ns > osal_mono_ns()) {
+		wp_arm(wp);
+		return;
+	}
+	atomic_store(&wp->_state, WP_IDLE);
+	wp->_cb(wp->_cb_arg);
+}
+
+eai_osal_status_t eai_osal_work_poll_init(eai_osal_work_poll_t *wp,
+					  eai_osal_work_cb_t callback,
+					  void *arg)
+{
+	if (wp == NULL || callback == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	osal_timer_init_internal(&wp->_timer, wp_expire);
+	wp->_poller._wake = wp_wake;
+	wp->_cb = callback;
+	wp->_cb_arg = arg;
+	wp->_events = NULL;
+	wp->_n = 0;
+	wp->_wq = NULL;
+	atomic_init(&wp->_state, WP_IDLE);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_poll_submit(eai_osal_work_poll_t *wp,
+					    eai_osal_workqueue_t *wq,
+					    eai_osal_poll_event_t *events,
+					    size_t n, uint32_t timeout_ms)
+{
+	if (wp == NULL || !osal_poll_valid(events, n)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+
+	int state = WP_IDLE;
+
+	if (!atomic_compare_exchange_strong(&wp->_state, &state, WP_ARMING)) {
+		return EAI_OSAL_ERROR;
+	}
+	wp->_events = events;
+	wp->_n = n;
+	wp->_wq = wq;
+	wp->_deadline_ns = timeout_ms == EAI_OSAL_WAIT_FOREVER ?
+			   UINT64_MAX :
+			   osal_mono_ns() + (uint64_t)timeout_ms * 1000000ULL;
+	wp_arm(wp);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_poll_cancel(eai_osal_work_poll_t *wp)
+{
+	if (wp == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	int state = WP_ARMED;
+
+	if (!atomic_compare_exchange_strong(&wp->_state, &state, WP_CANCELLING)) {
+		return EAI_OSAL_ERROR;
+	}
+	osal_timer_svc_lock();
+	osal_timer_stop_locked(&wp->_timer);
+	osal_timer_svc_unlock();
+	osal_poll_unregister(wp->_events, wp->_n);
+	atomic_store(&wp->_state, WP_IDLE);
 	return EAI_OSAL_OK;
 }
 
@@ -236,30 +551,57 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 					    size_t stack_size,
 					    uint8_t priority)
 {
-	(void)name;
-	(void)priority;
+	return eai_osal_workqueue_create_with_depth(wq, name, stack, stack_size,
+						    priority,
+						    EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH);
+}
 
-	if (wq == NULL || stack == NULL || stack_size == 0) {
+eai_osal_status_t eai_osal_workqueue_create_with_depth(eai_osal_workqueue_t *wq,
+						       const char *name,
+						       void *stack,
+						       size_t stack_size,
+						       uint8_t priority,
+						       uint32_t depth)
+{
+	if (wq == NULL || stack == NULL || stack_size == 0 || depth == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	return wq_start(wq, depth, stack_size < 16384 ? 16384 : stack_size,
+			name, priority > 31 ? 31 : priority);
+}
 
-	eai_osal_status_t ret = eai_osal_queue_create(
-		&wq->_queue, sizeof(struct wq_item), WQ_DEPTH, wq->_buf);
-	if (ret != EAI_OSAL_OK) {
-		return ret;
-	}
-
-	pthread_attr_t attr;
-	pthread_attr_init(&attr);
-	pthread_attr_setstacksize(&attr, stack_size < 16384 ? 16384 : stack_size);
-
-	int rc = pthread_create(&wq->_thread, &attr, wq_task, wq);
-	pthread_attr_destroy(&attr);
+/* ── Counters ─────────────────────────────────────────────────────────── */
 
-	if (rc != 0) {
-		eai_osal_queue_destroy(&wq->_queue);
-		return EAI_OSAL_ERROR;
+eai_osal_status_t eai_osal_workqueue_get_stats(eai_osal_workqueue_t *wq,
+					       eai_osal_workqueue_stats_t *stats)
+{
+	if (stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
 	}
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	stats->depth = wq->_depth;
+	stats->pending = atomic_load(&wq->_pending);
+	stats->high_water = atomic_load(&wq->_high_water);
+	stats->rejected = atomic_load(&wq->_rejected);
+	stats->max_latency_us = atomic_load(&wq->_max_latency_us);
+	return EAI_OSAL_OK;
+}
 
+eai_osal_status_t eai_osal_workqueue_reset_stats(eai_osal_workqueue_t *wq)
+{
+	if (wq == NULL) {
+		wq = get_sys_wq();
+		if (wq == NULL) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	atomic_store(&wq->_high_water, atomic_load(&wq->_pending));
+	atomic_store(&wq->_rejected, 0);
+	atomic_store(&wq->_max_latency_us, 0);
 	return EAI_OSAL_OK;
 }
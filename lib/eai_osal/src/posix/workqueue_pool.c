@@ -0,0 +1,456 @@
+#include <eai_osal/workqueue.h>
+#include "internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * POSIX work queue pool — N workers with work stealing.
+ *
+ * Each worker owns a fixed-size Chase-Lev deque. The owner pushes and
+ * takes at the bottom (LIFO, cache-warm); idle workers steal from the top
+ * (oldest first), so one slow item only holds up its own worker. Work
+ * submitted from outside the pool goes on a mutex-protected injection
+ * list; a worker that takes from it also moves a batch into its own deque,
+ * where the other workers can steal it.
+ *
+ * Each eai_osal_work_t carries PENDING and RUNNING bits. An item sits in
+ * at most one deque or list at a time, and an item submitted while it is
+ * running is re-queued only by the worker running it, after the callback
+ * returns — so an item never runs concurrently with itself.
+ *
+ * Idle workers park on a condition variable. They bump _sleepers before a
+ * final re-check, and submitters check _sleepers after publishing work
+ * (both sides fence), so a wakeup cannot be lost.
+ */
+
+#define DEQUE_CAP    256 /* per worker, power of two */
+#define INJECT_BATCH 16  /* extra items moved from the injection list */
+
+#define WORK_PENDING 1u
+#define WORK_RUNNING 2u
+
+struct pool_worker {
+	/* top is CAS'd by thieves, bottom is written by the owner */
+	_Alignas(64) atomic_llong top;
+	_Alignas(64) atomic_llong bottom;
+	_Atomic(eai_osal_work_t *) slots[DEQUE_CAP];
+	struct osal_wq_pool *pool;
+	pthread_t thread;
+	uint32_t seed; /* victim selection */
+};
+
+struct osal_wq_pool {
+	pthread_mutex_t lock; /* injection list, parking, stop */
+	pthread_cond_t wake;
+	eai_osal_work_t *inject_head;
+	eai_osal_work_t *inject_tail;
+	atomic_uint inject_len;
+	atomic_uint sleepers;
+	bool stop;
+	uint32_t live; /* workers started and not yet exited */
+	uint32_t n_workers;
+	struct pool_worker *workers;
+	uint8_t priority;
+	char name[OSAL_THREAD_NAME_LEN];
+};
+
+/* Worker running on this thread, if any — lets callbacks submit locally */
+static _Thread_local struct pool_worker *cur_worker;
+
+/* ── Chase-Lev deque (Lê et al., PPoPP'13 C11 formulation) ────────────── */
+
+/* Owner only. False if full. */
+static bool deque_push(struct pool_worker *w, eai_osal_work_t *work)
+{
+	long long b = atomic_load_explicit(&w->bottom, memory_order_relaxed);
+	long long t = atomic_load_explicit(&w->top, memory_order_acquire);
+
+	if (b - t >= DEQUE_CAP) {
+		return false;
+	}
+	atomic_store_explicit(&w->slots[b & (DEQUE_CAP - 1)], work,
+			      memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&w->bottom, b + 1, memory_order_relaxed);
+	return true;
+}
+
+/* Owner only. Takes the newest item. */
+static eai_osal_work_t *deque_take(struct pool_worker *w)
+{
+	long long b = atomic_load_explicit(&w->bottom, memory_order_relaxed) - 1;
+
+	atomic_store_explicit(&w->bottom, b, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	long long t = atomic_load_explicit(&w->top, memory_order_relaxed);
+	eai_osal_work_t *work = NULL;
+
+	if (t <= b) {
+		work = atomic_load_explicit(&w->slots[b & (DEQUE_CAP - 1)],
+					    memory_order_relaxed);
+		if (t == b) {
+			/* Last item — race thieves for it */
+			if (!atomic_compare_exchange_strong_explicit(
+				    &w->top, &t, t + 1, memory_order_seq_cst,
+				    memory_order_relaxed)) {
+				work = NULL;
+			}
+			atomic_store_explicit(&w->bottom, b + 1,
+					      memory_order_relaxed);
+		}
+	} else {
+		atomic_store_explicit(&w->bottom, b + 1, memory_order_relaxed);
+	}
+	return work;
+}
+
+/* Any thread. Takes the oldest item. */
+static eai_osal_work_t *deque_steal(struct pool_worker *w)
+{
+	long long t = atomic_load_explicit(&w->top, memory_order_acquire);
+
+	atomic_thread_fence(memory_order_seq_cst);
+
+	long long b = atomic_load_explicit(&w->bottom, memory_order_acquire);
+
+	if (t >= b) {
+		return NULL;
+	}
+
+	eai_osal_work_t *work = atomic_load_explicit(
+		&w->slots[t & (DEQUE_CAP - 1)], memory_order_relaxed);
+
+	if (!atomic_compare_exchange_strong_explicit(&w->top, &t, t + 1,
+						     memory_order_seq_cst,
+						     memory_order_relaxed)) {
+		return NULL; /* lost the race; caller moves on */
+	}
+	return work;
+}
+
+static bool deque_empty(struct pool_worker *w)
+{
+	return atomic_load(&w->bottom) <= atomic_load(&w->top);
+}
+
+/* ── Wakeup and injection ─────────────────────────────────────────────── */
+
+static void wake_one(struct osal_wq_pool *pool)
+{
+	atomic_thread_fence(memory_order_seq_cst);
+	if (atomic_load_explicit(&pool->sleepers, memory_order_relaxed) == 0) {
+		return;
+	}
+	pthread_mutex_lock(&pool->lock);
+	osal_cond_signal(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+static void inject_push(struct osal_wq_pool *pool, eai_osal_work_t *work)
+{
+	work->_next = NULL;
+
+	pthread_mutex_lock(&pool->lock);
+	if (pool->inject_tail != NULL) {
+		pool->inject_tail->_next = work;
+	} else {
+		pool->inject_head = work;
+	}
+	pool->inject_tail = work;
+	atomic_fetch_add(&pool->inject_len, 1);
+	pthread_mutex_unlock(&pool->lock);
+
+	wake_one(pool);
+}
+
+/* Take one item from the injection list and move a batch to our deque */
+static eai_osal_work_t *inject_take(struct pool_worker *self)
+{
+	struct osal_wq_pool *pool = self->pool;
+
+	if (atomic_load_explicit(&pool->inject_len, memory_order_relaxed) == 0) {
+		return NULL;
+	}
+
+	pthread_mutex_lock(&pool->lock);
+
+	eai_osal_work_t *first = pool->inject_head;
+	uint32_t moved = 0;
+
+	if (first != NULL) {
+		pool->inject_head = first->_next;
+		while (moved < INJECT_BATCH && pool->inject_head != NULL &&
+		       deque_push(self, pool->inject_head)) {
+			pool->inject_head = pool->inject_head->_next;
+			moved++;
+		}
+		if (pool->inject_head == NULL) {
+			pool->inject_tail = NULL;
+		}
+		atomic_fetch_sub(&pool->inject_len, moved + 1);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	if (moved > 0) {
+		wake_one(pool); /* let an idle worker steal part of the batch */
+	}
+	return first;
+}
+
+/* Queue on the calling worker's deque if it belongs to pool */
+static void enqueue(struct osal_wq_pool *pool, eai_osal_work_t *work)
+{
+	struct pool_worker *self = cur_worker;
+
+	if (self != NULL && self->pool == pool && deque_push(self, work)) {
+		wake_one(pool);
+		return;
+	}
+	inject_push(pool, work);
+}
+
+/* ── Workers ──────────────────────────────────────────────────────────── */
+
+static eai_osal_work_t *steal_any(struct pool_worker *self)
+{
+	struct osal_wq_pool *pool = self->pool;
+
+	/* xorshift32 — start at a random victim so thieves spread out */
+	self->seed ^= self->seed << 13;
+	self->seed ^= self->seed >> 17;
+	self->seed ^= self->seed << 5;
+
+	uint32_t start = self->seed % pool->n_workers;
+
+	for (uint32_t i = 0; i < pool->n_workers; i++) {
+		struct pool_worker *victim =
+			&pool->workers[(start + i) % pool->n_workers];
+
+		if (victim == self) {
+			continue;
+		}
+
+		eai_osal_work_t *work = deque_steal(victim);
+
+		if (work != NULL) {
+			return work;
+		}
+	}
+	return NULL;
+}
+
+static eai_osal_work_t *find_work(struct pool_worker *self)
+{
+	eai_osal_work_t *work = deque_take(self);
+
+	if (work == NULL) {
+		work = inject_take(self);
+	}
+	if (work == NULL) {
+		work = steal_any(self);
+	}
+	return work;
+}
+
+static bool pool_has_work(struct osal_wq_pool *pool)
+{
+	if (atomic_load(&pool->inject_len) > 0) {
+		return true;
+	}
+	for (uint32_t i = 0; i < pool->n_workers; i++) {
+		if (!deque_empty(&pool->workers[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Sleep until woken. Returns false once the pool is stopping and idle. */
+static bool park(struct osal_wq_pool *pool)
+{
+	bool keep_running = true;
+
+	pthread_mutex_lock(&pool->lock);
+	atomic_fetch_add(&pool->sleepers, 1);
+
+	if (!pool_has_work(pool)) {
+		if (pool->stop) {
+			keep_running = false;
+		} else {
+			osal_cond_wait(&pool->wake, &pool->lock);
+		}
+	}
+
+	atomic_fetch_sub(&pool->sleepers, 1);
+	pthread_mutex_unlock(&pool->lock);
+	return keep_running;
+}
+
+static void run_work(struct pool_worker *self, eai_osal_work_t *work)
+{
+	/* PENDING -> RUNNING; submitters treat PENDING as already queued */
+	atomic_store_explicit(&work->_state, WORK_RUNNING, memory_order_release);
+
+	work->_cb(work->_cb_arg);
+
+	unsigned int state = WORK_RUNNING;
+
+	if (!atomic_compare_exchange_strong(&work->_state, &state, 0)) {
+		/* Submitted while running — this worker owns the re-queue */
+		atomic_store(&work->_state, WORK_PENDING);
+		if (!deque_push(self, work)) {
+			inject_push(self->pool, work);
+		}
+	}
+}
+
+static void *worker_main(void *arg)
+{
+	struct pool_worker *self = (struct pool_worker *)arg;
+
+	osal_thread_setup(self->pool->name, self->pool->priority);
+	cur_worker = self;
+
+	for (;;) {
+		eai_osal_work_t *work = find_work(self);
+
+		if (work != NULL) {
+			run_work(self, work);
+		} else if (!park(self->pool)) {
+			break;
+		}
+	}
+
+	cur_worker = NULL;
+
+	pthread_mutex_lock(&self->pool->lock);
+	self->pool->live--;
+	osal_cond_broadcast(&self->pool->wake);
+	pthread_mutex_unlock(&self->pool->lock);
+
+	osal_vt_thread_exit();
+	return NULL;
+}
+
+/* ── Public API ───────────────────────────────────────────────────────── */
+
+static void pool_free(struct osal_wq_pool *pool)
+{
+	pthread_cond_destroy(&pool->wake);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool->workers);
+	free(pool);
+}
+
+/*
+ * Stop and join the first n workers; queued work is finished first.
+ * Waiting on live before pthread_join() keeps the wait visible to
+ * virtual time.
+ */
+static void pool_stop(struct osal_wq_pool *pool, uint32_t n)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = true;
+	osal_cond_broadcast(&pool->wake);
+	while (pool->live > 0) {
+		osal_cond_wait(&pool->wake, &pool->lock);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	for (uint32_t i = 0; i < n; i++) {
+		pthread_join(pool->workers[i].thread, NULL);
+	}
+}
+
+eai_osal_status_t eai_osal_workqueue_pool_create(eai_osal_workqueue_pool_t *pool,
+						 uint32_t n_workers,
+						 const char *name,
+						 void *stacks,
+						 size_t stack_size,
+						 uint8_t priority)
+{
+	if (pool == NULL || n_workers == 0 || stacks == NULL || stack_size == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	struct osal_wq_pool *impl = calloc(1, sizeof(*impl));
+
+	if (impl == NULL) {
+		return EAI_OSAL_NO_MEMORY;
+	}
+
+	size_t workers_size = n_workers * sizeof(struct pool_worker);
+
+	impl->workers = aligned_alloc(_Alignof(struct pool_worker), workers_size);
+	if (impl->workers == NULL) {
+		free(impl);
+		return EAI_OSAL_NO_MEMORY;
+	}
+	memset(impl->workers, 0, workers_size);
+	impl->n_workers = n_workers;
+	impl->priority = priority > 31 ? 31 : priority;
+	osal_thread_name_copy(impl->name, name);
+	pthread_mutex_init(&impl->lock, NULL);
+	pthread_cond_init(&impl->wake, NULL);
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, stack_size < 16384 ? 16384 : stack_size);
+
+	for (uint32_t i = 0; i < n_workers; i++) {
+		struct pool_worker *w = &impl->workers[i];
+
+		w->pool = impl;
+		w->seed = 0x9e3779b9u * (i + 1);
+
+		osal_vt_thread_add();
+		impl->live++;
+		if (pthread_create(&w->thread, &attr, worker_main, w) != 0) {
+			impl->live--;
+			osal_vt_thread_exit();
+			pthread_attr_destroy(&attr);
+			pool_stop(impl, i);
+			pool_free(impl);
+			return EAI_OSAL_ERROR;
+		}
+	}
+	pthread_attr_destroy(&attr);
+
+	pool->_impl = impl;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_workqueue_pool_destroy(eai_osal_workqueue_pool_t *pool)
+{
+	if (pool == NULL || pool->_impl == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	pool_stop(pool->_impl, pool->_impl->n_workers);
+	pool_free(pool->_impl);
+	pool->_impl = NULL;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_submit_to_pool(eai_osal_work_t *work,
+					       eai_osal_workqueue_pool_t *pool)
+{
+	if (work == NULL || pool == NULL || pool->_impl == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	unsigned int state = atomic_load(&work->_state);
+
+	do {
+		if (state & WORK_PENDING) {
+			return EAI_OSAL_OK; /* already queued */
+		}
+	} while (!atomic_compare_exchange_weak(&work->_state, &state,
+					       state | WORK_PENDING));
+
+	if (state & WORK_RUNNING) {
+		return EAI_OSAL_OK; /* its worker re-queues it after the callback */
+	}
+	enqueue(pool->_impl, work);
+	return EAI_OSAL_OK;
+}
@@ -0,0 +1,225 @@
+#include <eai_osal/pqueue.h>
+#include <eai_osal/mutex.h>
+#include <eai_osal/semaphore.h>
+#include <eai_osal/time.h>
+#include <string.h>
+
+/*
+ * Backend-independent priority queue — see include/eai_osal/pqueue.h.
+ *
+ * The lists, the counts and the message copies all live under _lock. A
+ * thread that can't go on counts itself in _rx_waiting or _tx_waiting
+ * and parks on _items_sig or _spaces_sig. Whoever makes progress for it
+ * hands over one token: it takes the waiter off the count and gives the
+ * semaphore once, both under _lock. A send into a queue whose consumer is already awake
+ * doesn't touch a semaphore, so a fast producer doesn't pay a wakeup per
+ * message.
+ *
+ * A woken thread retakes _lock and looks again, because a thread that
+ * never slept may have got there first. A waiter that times out retakes
+ * _lock and checks for a token that raced its timeout before it gives up.
+ * Giving under _lock is what makes that check exact: once the timed-out
+ * waiter holds _lock, a waker that took it off the count has also given
+ * its token, so it never takes itself off a second time.
+ */
+
+#define PQ_NIL UINT32_MAX
+
+/* Tokens outstanding at once are bounded by the threads waiting */
+#define PQ_SIG_LIMIT 0xffff
+
+static uint8_t *slot_msg(eai_osal_pqueue_t *pq, uint32_t slot)
+{
+	return pq->_msgs + (size_t)slot * pq->_msg_size;
+}
+
+eai_osal_status_t eai_osal_pqueue_create(eai_osal_pqueue_t *pq, size_t msg_size,
+					 uint32_t max_msgs, void *buffer)
+{
+	if (pq == NULL || buffer == NULL || msg_size == 0 || max_msgs == 0 ||
+	    max_msgs == PQ_NIL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	pq->_next = (uint32_t *)buffer;
+	pq->_msgs = (uint8_t *)buffer + (size_t)max_msgs * sizeof(uint32_t);
+	pq->_msg_size = msg_size;
+	pq->_max_msgs = max_msgs;
+	pq->_ready = 0;
+	pq->_count = 0;
+	pq->_rx_waiting = 0;
+	pq->_tx_waiting = 0;
+	for (uint32_t p = 0; p < EAI_OSAL_PQUEUE_LEVELS; p++) {
+		pq->_head[p] = PQ_NIL;
+		pq->_tail[p] = PQ_NIL;
+	}
+	for (uint32_t i = 0; i < max_msgs; i++) {
+		pq->_next[i] = i + 1 < max_msgs ? i + 1 : PQ_NIL;
+	}
+	pq->_free = 0;
+
+	if (eai_osal_mutex_create(&pq->_lock) != EAI_OSAL_OK) {
+		return EAI_OSAL_ERROR;
+	}
+	if (eai_osal_sem_create(&pq->_items_sig, 0, PQ_SIG_LIMIT) != EAI_OSAL_OK) {
+		eai_osal_mutex_destroy(&pq->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	if (eai_osal_sem_create(&pq->_spaces_sig, 0, PQ_SIG_LIMIT) != EAI_OSAL_OK) {
+		eai_osal_sem_destroy(&pq->_items_sig);
+		eai_osal_mutex_destroy(&pq->_lock);
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_pqueue_destroy(eai_osal_pqueue_t *pq)
+{
+	if (pq == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	eai_osal_sem_destroy(&pq->_spaces_sig);
+	eai_osal_sem_destroy(&pq->_items_sig);
+	eai_osal_mutex_destroy(&pq->_lock);
+	return EAI_OSAL_OK;
+}
+
+/* Time budget of one call; the clock is only read once it has to wait */
+struct pq_timeout {
+	uint32_t timeout_ms;
+	uint32_t start;
+	bool started;
+};
+
+/*
+ * Park until handed a token or out of time (_lock held on entry and on
+ * return). Returns false once the budget has run out.
+ */
+static bool pq_wait(eai_osal_pqueue_t *pq, eai_osal_sem_t *sig,
+		    uint32_t *waiting, struct pq_timeout *t)
+{
+	uint32_t wait_ms = t->timeout_ms;
+
+	if (t->timeout_ms == EAI_OSAL_NO_WAIT) {
+		return false;
+	}
+	if (t->timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		uint32_t now = eai_osal_time_get_ms();
+
+		if (!t->started) {
+			t->start = now;
+			t->started = true;
+		}
+		if (now - t->start >= t->timeout_ms) {
+			return false;
+		}
+		wait_ms = t->timeout_ms - (now - t->start);
+	}
+
+	(*waiting)++;
+	eai_osal_mutex_unlock(&pq->_lock);
+	eai_osal_status_t ret = eai_osal_sem_take(sig, wait_ms);
+
+	eai_osal_mutex_lock(&pq->_lock, EAI_OSAL_WAIT_FOREVER);
+	if (ret != EAI_OSAL_OK && eai_osal_sem_take(sig, EAI_OSAL_NO_WAIT) != EAI_OSAL_OK) {
+		(*waiting)--; /* no token came; take ourselves off the count */
+	}
+	return true; /* look again; the next pass sees the deadline */
+}
+
+/* Hand one parked waiter its token (_lock held) */
+static void pq_wake_one(uint32_t *waiting, eai_osal_sem_t *sig)
+{
+	if (*waiting == 0) {
+		return;
+	}
+	(*waiting)--;
+	eai_osal_sem_give(sig);
+}
+
+eai_osal_status_t eai_osal_pqueue_send(eai_osal_pqueue_t *pq, const void *msg,
+				       uint8_t prio, uint32_t timeout_ms)
+{
+	if (pq == NULL || msg == NULL || prio >= EAI_OSAL_PQUEUE_LEVELS) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	struct pq_timeout t = { .timeout_ms = timeout_ms };
+
+	eai_osal_mutex_lock(&pq->_lock, EAI_OSAL_WAIT_FOREVER);
+	while (pq->_count == pq->_max_msgs) {
+		if (!pq_wait(pq, &pq->_spaces_sig, &pq->_tx_waiting, &t)) {
+			eai_osal_mutex_unlock(&pq->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+
+	uint32_t slot = pq->_free;
+
+	pq->_free = pq->_next[slot];
+	memcpy(slot_msg(pq, slot), msg, pq->_msg_size);
+	pq->_next[slot] = PQ_NIL;
+	if (pq->_tail[prio] == PQ_NIL) {
+		pq->_head[prio] = slot;
+		pq->_ready |= 1u << prio;
+	} else {
+		pq->_next[pq->_tail[prio]] = slot;
+	}
+	pq->_tail[prio] = slot;
+	pq->_count++;
+
+	pq_wake_one(&pq->_rx_waiting, &pq->_items_sig);
+	eai_osal_mutex_unlock(&pq->_lock);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_pqueue_recv(eai_osal_pqueue_t *pq, void *msg,
+				       uint8_t *prio, uint32_t timeout_ms)
+{
+	if (pq == NULL || msg == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	struct pq_timeout t = { .timeout_ms = timeout_ms };
+
+	eai_osal_mutex_lock(&pq->_lock, EAI_OSAL_WAIT_FOREVER);
+	while (pq->_count == 0) {
+		if (!pq_wait(pq, &pq->_items_sig, &pq->_rx_waiting, &t)) {
+			eai_osal_mutex_unlock(&pq->_lock);
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+
+	uint32_t p = 31 - (uint32_t)__builtin_clz(pq->_ready);
+	uint32_t slot = pq->_head[p];
+
+	pq->_head[p] = pq->_next[slot];
+	if (pq->_head[p] == PQ_NIL) {
+		pq->_tail[p] = PQ_NIL;
+		pq->_ready &= ~(1u << p);
+	}
+	memcpy(msg, slot_msg(pq, slot), pq->_msg_size);
+	pq->_next[slot] = pq->_free;
+	pq->_free = slot;
+	pq->_count--;
+
+	pq_wake_one(&pq->_tx_waiting, &pq->_spaces_sig);
+	eai_osal_mutex_unlock(&pq->_lock);
+	if (prio != NULL) {
+		*prio = (uint8_t)p;
+	}
+	return EAI_OSAL_OK;
+}
+
+uint32_t eai_osal_pqueue_count(eai_osal_pqueue_t *pq)
+{
+	if (pq == NULL) {
+		return 0;
+	}
+
+	eai_osal_mutex_lock(&pq->_lock, EAI_OSAL_WAIT_FOREVER);
+	uint32_t n = pq->_count;
+
+	eai_osal_mutex_unlock(&pq->_lock);
+	return n;
+}
@@ -0,0 +1,308 @@
+#include <eai_osal/spsc.h>
+#include <eai_osal/semaphore.h>
+#include <eai_osal/time.h>
+#include <string.h>
+
+/*
+ * Backend-independent SPSC ring — see include/eai_osal/spsc.h.
+ *
+ * _head and _tail are free-running uint32 counters; the slot index is
+ * counter & _mask and the fill level is head - tail (wraps correctly).
+ * Each side keeps a plain cached copy of the other side's counter and only
+ * reloads the shared atomic when the cache says full/empty, which keeps
+ * cache-line traffic between producer and consumer cores low.
+ *
+ * Blocking handshake (Dekker-style): the waiter sets its _*_waiting flag,
+ * issues a seq_cst fence and re-checks the ring before parking on its
+ * semaphore; the other side publishes its index, fences, and gives the
+ * semaphore only if it observes the flag. At least one side always sees
+ * the other, so no wakeup is lost. A stale give only causes one extra
+ * re-check loop.
+ */
+
+static uint32_t ring_cap(const eai_osal_spsc_ring_t *ring)
+{
+	return ring->_mask + 1;
+}
+
+eai_osal_status_t eai_osal_spsc_create(eai_osal_spsc_ring_t *ring,
+				       size_t elem_size, uint32_t capacity,
+				       void *buffer, bool blocking)
+{
+	if (ring == NULL || buffer == NULL || elem_size == 0 ||
+	    capacity == 0 || (capacity & (capacity - 1)) != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	ring->_buf = (uint8_t *)buffer;
+	ring->_elem_size = elem_size;
+	ring->_mask = capacity - 1;
+	ring->_blocking = blocking;
+	atomic_init(&ring->_head, 0);
+	atomic_init(&ring->_tail, 0);
+	atomic_init(&ring->_rx_waiting, false);
+	atomic_init(&ring->_tx_waiting, false);
+	ring->_tail_cache = 0;
+	ring->_head_cache = 0;
+
+	if (blocking) {
+		if (eai_osal_sem_create(&ring->_data_sem, 0, 1) != EAI_OSAL_OK) {
+			return EAI_OSAL_ERROR;
+		}
+		if (eai_osal_sem_create(&ring->_space_sem, 0, 1) != EAI_OSAL_OK) {
+			eai_osal_sem_destroy(&ring->_data_sem);
+			return EAI_OSAL_ERROR;
+		}
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_spsc_destroy(eai_osal_spsc_ring_t *ring)
+{
+	if (ring == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (ring->_blocking) {
+		eai_osal_sem_destroy(&ring->_space_sem);
+		eai_osal_sem_destroy(&ring->_data_sem);
+	}
+	return EAI_OSAL_OK;
+}
+
+/* ── Index bookkeeping ────────────────────────────────────────────────── */
+
+/* Producer side: free slots, refreshing the cached tail only if needed */
+static uint32_t producer_space(eai_osal_spsc_ring_t *ring, uint32_t head,
+			       uint32_t want)
+{
+	uint32_t space = ring_cap(ring) - (head - ring->_tail_cache);
+
+	if (space < want) {
+		ring->_tail_cache = atomic_load_explicit(&ring->_tail,
+							 memory_order_acquire);
+		space = ring_cap(ring) - (head - ring->_tail_cache);
+	}
+	return space;
+}
+
+/* Consumer side: queued elements, refreshing the cached head only if needed */
+static uint32_t consumer_avail(eai_osal_spsc_ring_t *ring, uint32_t tail,
+			       uint32_t want)
+{
+	uint32_t avail = ring->_head_cache - tail;
+
+	if (avail < want) {
+		ring->_head_cache = atomic_load_explicit(&ring->_head,
+							 memory_order_acquire);
+		avail = ring->_head_cache - tail;
+	}
+	return avail;
+}
+
+static void wake_if_waiting(eai_osal_spsc_ring_t *ring, atomic_bool *waiting,
+			    eai_osal_sem_t *sem)
+{
+	if (!ring->_blocking) {
+		return;
+	}
+	atomic_thread_fence(memory_order_seq_cst);
+	if (atomic_load_explicit(waiting, memory_order_relaxed) &&
+	    atomic_exchange_explicit(waiting, false, memory_order_relaxed)) {
+		eai_osal_sem_give(sem);
+	}
+}
+
+/* ── Bulk non-blocking transfer ───────────────────────────────────────── */
+
+uint32_t eai_osal_spsc_write(eai_osal_spsc_ring_t *ring, const void *elems,
+			     uint32_t n)
+{
+	if (ring == NULL || elems == NULL || n == 0) {
+		return 0;
+	}
+
+	uint32_t head = atomic_load_explicit(&ring->_head, memory_order_relaxed);
+	uint32_t space = producer_space(ring, head, n);
+
+	if (n > space) {
+		n = space;
+	}
+	if (n == 0) {
+		return 0;
+	}
+
+	uint32_t idx = head & ring->_mask;
+	uint32_t first = ring_cap(ring) - idx;
+
+	if (first > n) {
+		first = n;
+	}
+	memcpy(ring->_buf + idx * ring->_elem_size, elems,
+	       first * ring->_elem_size);
+	if (n > first) {
+		memcpy(ring->_buf, (const uint8_t *)elems + first * ring->_elem_size,
+		       (n - first) * ring->_elem_size);
+	}
+
+	atomic_store_explicit(&ring->_head, head + n, memory_order_release);
+	wake_if_waiting(ring, &ring->_rx_waiting, &ring->_data_sem);
+	return n;
+}
+
+uint32_t eai_osal_spsc_read(eai_osal_spsc_ring_t *ring, void *elems, uint32_t n)
+{
+	if (ring == NULL || elems == NULL || n == 0) {
+		return 0;
+	}
+
+	uint32_t tail = atomic_load_explicit(&ring->_tail, memory_order_relaxed);
+	uint32_t avail = consumer_avail(ring, tail, n);
+
+	if (n > avail) {
+		n = avail;
+	}
+	if (n == 0) {
+		return 0;
+	}
+
+	uint32_t idx = tail & ring->_mask;
+	uint32_t first = ring_cap(ring) - idx;
+
+	if (first > n) {
+		first = n;
+	}
+	memcpy(elems, ring->_buf + idx * ring->_elem_size,
+	       first * ring->_elem_size);
+	if (n > first) {
+		memcpy((uint8_t *)elems + first * ring->_elem_size, ring->_buf,
+		       (n - first) * ring->_elem_size);
+	}
+
+	atomic_store_explicit(&ring->_tail, tail + n, memory_order_release);
+	wake_if_waiting(ring, &ring->_tx_waiting, &ring->_space_sem);
+	return n;
+}
+
+/* ── Single element with optional blocking ────────────────────────────── */
+
+/*
+ * Park on sem until ready(ring) or the caller's overall timeout (counted
+ * from start_ms) expires. Returns false on timeout.
+ */
+static bool park(eai_osal_spsc_ring_t *ring, atomic_bool *waiting,
+		 eai_osal_sem_t *sem, bool (*ready)(eai_osal_spsc_ring_t *),
+		 uint32_t start_ms, uint32_t timeout_ms)
+{
+	atomic_store_explicit(waiting, true, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (ready(ring)) {
+		atomic_store_explicit(waiting, false, memory_order_relaxed);
+		return true;
+	}
+
+	uint32_t wait_ms = timeout_ms;
+
+	if (timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		uint32_t elapsed = eai_osal_time_get_ms() - start_ms;
+
+		if (elapsed >= timeout_ms) {
+			atomic_store_explicit(waiting, false, memory_order_relaxed);
+			return false;
+		}
+		wait_ms = timeout_ms - elapsed;
+	}
+
+	eai_osal_status_t ret = eai_osal_sem_take(sem, wait_ms);
+
+	atomic_store_explicit(waiting, false, memory_order_relaxed);
+	return ret == EAI_OSAL_OK || ready(ring);
+}
+
+static bool has_space(eai_osal_spsc_ring_t *ring)
+{
+	uint32_t head = atomic_load_explicit(&ring->_head, memory_order_relaxed);
+
+	return producer_space(ring, head, 1) > 0;
+}
+
+static bool has_data(eai_osal_spsc_ring_t *ring)
+{
+	uint32_t tail = atomic_load_explicit(&ring->_tail, memory_order_relaxed);
+
+	return consumer_avail(ring, tail, 1) > 0;
+}
+
+eai_osal_status_t eai_osal_spsc_push(eai_osal_spsc_ring_t *ring,
+				     const void *elem, uint32_t timeout_ms)
+{
+	if (ring == NULL || elem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t start = 0;
+	bool parked = false;
+
+	while (eai_osal_spsc_write(ring, elem, 1) == 0) {
+		if (timeout_ms == EAI_OSAL_NO_WAIT || !ring->_blocking) {
+			return EAI_OSAL_TIMEOUT;
+		}
+		/* Only read the clock once we actually have to wait */
+		if (!parked) {
+			start = eai_osal_time_get_ms();
+			parked = true;
+		}
+		if (!park(ring, &ring->_tx_waiting, &ring->_space_sem, has_space,
+			  start, timeout_ms)) {
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_spsc_pop(eai_osal_spsc_ring_t *ring, void *elem,
+				    uint32_t timeout_ms)
+{
+	if (ring == NULL || elem == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t start = 0;
+	bool parked = false;
+
+	while (eai_osal_spsc_read(ring, elem, 1) == 0) {
+		if (timeout_ms == EAI_OSAL_NO_WAIT || !ring->_blocking) {
+			return EAI_OSAL_TIMEOUT;
+		}
+		if (!parked) {
+			start = eai_osal_time_get_ms();
+			parked = true;
+		}
+		if (!park(ring, &ring->_rx_waiting, &ring->_data_sem, has_data,
+			  start, timeout_ms)) {
+			return EAI_OSAL_TIMEOUT;
+		}
+	}
+	return EAI_OSAL_OK;
+}
+
+uint32_t eai_osal_spsc_count(eai_osal_spsc_ring_t *ring)
+{
+	if (ring == NULL) {
+		return 0;
+	}
+	uint32_t tail = atomic_load_explicit(&ring->_tail, memory_order_acquire);
+	uint32_t head = atomic_load_explicit(&ring->_head, memory_order_acquire);
+	uint32_t count = head - tail;
+
+	/* The producer may have refilled past our stale tail */
+	return count > ring_cap(ring) ? ring_cap(ring) : count;
+}
+
+uint32_t eai_osal_spsc_space(eai_osal_spsc_ring_t *ring)
+{
+	if (ring == NULL) {
+		return 0;
+	}
+	return ring_cap(ring) - eai_osal_spsc_count(ring);
+}
@@ -0,0 +1,184 @@
+#include <eai_osal/stats.h>
+#include <eai_osal/critical.h>
+
+#ifdef CONFIG_EAI_OSAL_STATS
+
+#include "stats_internal.h"
+
+/*
+ * Counters are updated with relaxed 32-bit atomics on the object's own
+ * record, so concurrent waiters on different objects never touch shared
+ * state. The 64-bit wait total is two words with a carry; a reader racing
+ * a carry can see it one wrap short, which a diagnostic can live with.
+ *
+ * The registry is a singly linked list of named records. It changes only
+ * at create/destroy, under the OSAL critical section. foreach copies one
+ * record at a time under that section and calls back with it released.
+ */
+
+static struct osal_stats_rec *registry;
+
+static void registry_add(struct osal_stats_rec *rec)
+{
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	for (struct osal_stats_rec *it = registry; it != NULL; it = it->next) {
+		if (it == rec) {
+			/* Re-created without a destroy — already listed */
+			eai_osal_critical_exit(key);
+			return;
+		}
+	}
+	rec->next = registry;
+	registry = rec;
+	eai_osal_critical_exit(key);
+}
+
+static void registry_remove(struct osal_stats_rec *rec)
+{
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	for (struct osal_stats_rec **it = &registry; *it != NULL;
+	     it = &(*it)->next) {
+		if (*it == rec) {
+			*it = rec->next;
+			break;
+		}
+	}
+	rec->next = NULL;
+	eai_osal_critical_exit(key);
+}
+
+static void rec_clear(struct osal_stats_rec *rec)
+{
+	__atomic_store_n(&rec->acquires, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&rec->contended, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&rec->wait_total_lo, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&rec->wait_total_hi, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&rec->wait_max_us, 0, __ATOMIC_RELAXED);
+	for (int i = 0; i < EAI_OSAL_STATS_BUCKETS; i++) {
+		__atomic_store_n(&rec->hist[i], 0, __ATOMIC_RELAXED);
+	}
+}
+
+void osal_stats_init(struct osal_stats_rec *rec, eai_osal_stats_kind_t kind,
+		     const char *name)
+{
+	rec->name = name;
+	rec->next = NULL;
+	rec->kind = (uint8_t)kind;
+	rec_clear(rec);
+	if (name != NULL) {
+		registry_add(rec);
+	}
+}
+
+void osal_stats_deinit(struct osal_stats_rec *rec)
+{
+	if (rec->name != NULL) {
+		registry_remove(rec);
+	}
+}
+
+/* floor(log2(us)) + 1, so bucket 0 is "under 1 us" */
+static uint32_t wait_bucket(uint32_t us)
+{
+	uint32_t b = us == 0 ? 0 : 32 - (uint32_t)__builtin_clz(us);
+
+	return b < EAI_OSAL_STATS_BUCKETS ? b : EAI_OSAL_STATS_BUCKETS - 1;
+}
+
+void osal_stats_record(struct osal_stats_rec *rec, uint32_t t0, uint32_t now)
+{
+	uint32_t wait = 0;
+
+	__atomic_fetch_add(&rec->acquires, 1, __ATOMIC_RELAXED);
+	if (t0 != 0) {
+		/* t0 carries a forced low bit, so allow now to trail it by one */
+		wait = (int32_t)(now - t0) > 0 ? now - t0 : 0;
+
+		__atomic_fetch_add(&rec->contended, 1, __ATOMIC_RELAXED);
+		uint32_t lo = __atomic_fetch_add(&rec->wait_total_lo, wait,
+						 __ATOMIC_RELAXED);
+		if (lo + wait < lo) {
+			__atomic_fetch_add(&rec->wait_total_hi, 1, __ATOMIC_RELAXED);
+		}
+
+		uint32_t max = __atomic_load_n(&rec->wait_max_us, __ATOMIC_RELAXED);
+
+		while (wait > max &&
+		       !__atomic_compare_exchange_n(&rec->wait_max_us, &max, wait,
+						    true, __ATOMIC_RELAXED,
+						    __ATOMIC_RELAXED)) {
+		}
+	}
+	__atomic_fetch_add(&rec->hist[wait_bucket(wait)], 1, __ATOMIC_RELAXED);
+}
+
+static void rec_snapshot(const struct osal_stats_rec *rec, eai_osal_stats_t *out)
+{
+	out->name = rec->name;
+	out->kind = (eai_osal_stats_kind_t)rec->kind;
+	out->acquires = __atomic_load_n(&rec->acquires, __ATOMIC_RELAXED);
+	out->contended = __atomic_load_n(&rec->contended, __ATOMIC_RELAXED);
+	out->wait_total_us =
+		((uint64_t)__atomic_load_n(&rec->wait_total_hi, __ATOMIC_RELAXED) << 32) |
+		__atomic_load_n(&rec->wait_total_lo, __ATOMIC_RELAXED);
+	out->wait_max_us = __atomic_load_n(&rec->wait_max_us, __ATOMIC_RELAXED);
+	for (int i = 0; i < EAI_OSAL_STATS_BUCKETS; i++) {
+		out->hist[i] = __atomic_load_n(&rec->hist[i], __ATOMIC_RELAXED);
+	}
+}
+
+void eai_osal_stats_foreach(eai_osal_stats_cb_t cb, void *arg)
+{
+	eai_osal_stats_t snap;
+
+	if (cb == NULL) {
+		return;
+	}
+
+	/* Re-walk to the i-th entry each round; registries are short */
+	for (uint32_t i = 0;; i++) {
+		eai_osal_critical_key_t key = eai_osal_critical_enter();
+		struct osal_stats_rec *rec = registry;
+
+		for (uint32_t j = 0; j < i && rec != NULL; j++) {
+			rec = rec->next;
+		}
+		if (rec != NULL) {
+			rec_snapshot(rec, &snap);
+		}
+		eai_osal_critical_exit(key);
+
+		if (rec == NULL) {
+			break;
+		}
+		cb(&snap, arg);
+	}
+}
+
+void eai_osal_stats_reset(void)
+{
+	eai_osal_critical_key_t key = eai_osal_critical_enter();
+
+	for (struct osal_stats_rec *rec = registry; rec != NULL; rec = rec->next) {
+		rec_clear(rec);
+	}
+	eai_osal_critical_exit(key);
+}
+
+const char *eai_osal_stats_kind_str(eai_osal_stats_kind_t kind)
+{
+	static const char *const names[] = {
+		[EAI_OSAL_STATS_MUTEX] = "mutex",
+		[EAI_OSAL_STATS_SEM]   = "sem",
+		[EAI_OSAL_STATS_QUEUE] = "queue",
+		[EAI_OSAL_STATS_EVENT] = "event",
+	};
+
+	return (unsigned int)kind < sizeof(names) / sizeof(names[0])
+		? names[kind] : "?";
+}
+
+#endif /* CONFIG_EAI_OSAL_STATS */
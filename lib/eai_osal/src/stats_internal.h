@@ -0,0 +1,54 @@
+#ifndef EAI_OSAL_STATS_INTERNAL_H
+#define EAI_OSAL_STATS_INTERNAL_H
+
+/*
+ * Wait-time hooks for the backends (CONFIG_EAI_OSAL_STATS). Include after
+ * the backend's internal.h, which provides osal_now_us().
+ *
+ * A blocking acquire stamps only once it knows it has to wait, and
+ * records after it succeeds:
+ *
+ *	uint32_t t0 = 0;
+ *
+ *	if (must_wait) {
+ *		t0 = OSAL_STATS_STAMP();
+ *	}
+ *	... wait ...
+ *	OSAL_STATS_RECORD(obj, t0);
+ *
+ * t0 == 0 means "did not wait". With stats off the stamp is the constant
+ * 0, the record is a no-op, objects carry no _stats member, and the
+ * compiler drops all of it.
+ */
+
+#include <eai_osal/stats.h>
+
+#ifdef CONFIG_EAI_OSAL_STATS
+
+#define OSAL_STATS_ENABLED 1
+
+void osal_stats_init(struct osal_stats_rec *rec, eai_osal_stats_kind_t kind,
+		     const char *name);
+void osal_stats_deinit(struct osal_stats_rec *rec);
+void osal_stats_record(struct osal_stats_rec *rec, uint32_t t0, uint32_t now);
+
+/* Never 0, so a stamp can't be mistaken for "did not wait" */
+#define OSAL_STATS_STAMP() (osal_now_us() | 1u)
+#define OSAL_STATS_RECORD(obj, t0) \
+	osal_stats_record(&(obj)->_stats, (t0), (t0) != 0 ? osal_now_us() : 0)
+#define OSAL_STATS_INIT(obj, kind, name) \
+	osal_stats_init(&(obj)->_stats, (kind), (name))
+#define OSAL_STATS_DEINIT(obj) osal_stats_deinit(&(obj)->_stats)
+
+#else
+
+#define OSAL_STATS_ENABLED 0
+
+#define OSAL_STATS_STAMP()               0u
+#define OSAL_STATS_RECORD(obj, t0)       ((void)(t0))
+#define OSAL_STATS_INIT(obj, kind, name) ((void)(name))
+#define OSAL_STATS_DEINIT(obj)           ((void)0)
+
+#endif /* CONFIG_EAI_OSAL_STATS */
+
+#endif /* EAI_OSAL_STATS_INTERNAL_H */
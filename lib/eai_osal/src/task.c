@@ -0,0 +1,216 @@
+#include <eai_osal/task.h>
+#include <eai_osal/time.h>
+
+/*
+ * Backend-independent task executor — see include/eai_osal/task.h.
+ *
+ * A step is one call of the task body from a work item callback. An await
+ * tries its NO_WAIT operation at the resume point; when that comes back
+ * empty it parks the task on _poll, armed on the one object with the
+ * await's remaining time, and the step returns. _poll firing just runs
+ * the next step, which tries again, so a consumer that gets there first
+ * costs a second park rather than a lost wakeup. Sleeps park on _sleep
+ * and yields on _step.
+ *
+ * At most one of the three items is pending at a time, and each runs on
+ * the task's own single-threaded work queue, so steps never overlap and
+ * the task's fields need no lock. Only _state is read from other threads.
+ */
+
+enum {
+	OSAL_TASK_IDLE,    /* never started */
+	OSAL_TASK_RUNNING, /* first step queued, or a step in progress */
+	OSAL_TASK_PARKED,  /* stepped out at an await */
+	OSAL_TASK_DONE,
+};
+
+static void task_set_parked(eai_osal_task_t *task, bool parked)
+{
+	eai_osal_atomic_store(&task->_state,
+			      parked ? OSAL_TASK_PARKED : OSAL_TASK_RUNNING,
+			      EAI_OSAL_ATOMIC_RELAXED);
+}
+
+static void task_step(void *arg)
+{
+	eai_osal_task_t *task = arg;
+
+	task_set_parked(task, false);
+	task->_fn(task);
+	if (eai_osal_atomic_load(&task->_state, EAI_OSAL_ATOMIC_RELAXED) ==
+	    OSAL_TASK_RUNNING) {
+		/* Returned without parking: finished */
+		task->_line = 0;
+		eai_osal_atomic_store(&task->_state, OSAL_TASK_DONE,
+				      EAI_OSAL_ATOMIC_RELEASE);
+	}
+}
+
+eai_osal_status_t eai_osal_task_init(eai_osal_task_t *task,
+				     eai_osal_task_fn_t fn, void *arg)
+{
+	if (task == NULL || fn == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	task->_fn = fn;
+	task->_arg = arg;
+	task->_wq = NULL;
+	task->_line = 0;
+	task->_start_ms = 0;
+	task->_timeout_ms = 0;
+	eai_osal_atomic_init(&task->_state, OSAL_TASK_IDLE);
+
+	eai_osal_status_t ret = eai_osal_work_init(&task->_step, task_step, task);
+
+	if (ret == EAI_OSAL_OK) {
+		ret = eai_osal_dwork_init(&task->_sleep, task_step, task);
+	}
+	if (ret == EAI_OSAL_OK) {
+		ret = eai_osal_work_poll_init(&task->_poll, task_step, task);
+	}
+	return ret;
+}
+
+eai_osal_status_t eai_osal_task_start(eai_osal_task_t *task,
+				      eai_osal_workqueue_t *wq)
+{
+	if (task == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t prev = eai_osal_atomic_load(&task->_state, EAI_OSAL_ATOMIC_ACQUIRE);
+
+	if ((prev != OSAL_TASK_IDLE && prev != OSAL_TASK_DONE) ||
+	    !eai_osal_atomic_cas(&task->_state, &prev, OSAL_TASK_RUNNING,
+				 EAI_OSAL_ATOMIC_ACQ_REL)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	task->_wq = wq;
+	task->_line = 0;
+
+	eai_osal_status_t ret = wq != NULL ? eai_osal_work_submit_to(&task->_step, wq)
+					   : eai_osal_work_submit(&task->_step);
+
+	if (ret != EAI_OSAL_OK) {
+		eai_osal_atomic_store(&task->_state, prev, EAI_OSAL_ATOMIC_RELEASE);
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+bool eai_osal_task_is_done(const eai_osal_task_t *task)
+{
+	return task != NULL &&
+	       eai_osal_atomic_load(&task->_state, EAI_OSAL_ATOMIC_ACQUIRE) ==
+		       OSAL_TASK_DONE;
+}
+
+/* ── Macro plumbing ───────────────────────────────────────────────────── */
+
+bool osal_task_yield(eai_osal_task_t *task)
+{
+	task_set_parked(task, true);
+
+	eai_osal_status_t ret = task->_wq != NULL
+					? eai_osal_work_submit_to(&task->_step, task->_wq)
+					: eai_osal_work_submit(&task->_step);
+
+	if (ret != EAI_OSAL_OK) {
+		/* Queue full: carry on without yielding */
+		task_set_parked(task, false);
+		return false;
+	}
+	return true;
+}
+
+bool osal_task_sleep(eai_osal_task_t *task, uint32_t ms)
+{
+	if (ms == 0) {
+		return osal_task_yield(task);
+	}
+
+	task_set_parked(task, true);
+
+	eai_osal_status_t ret = task->_wq != NULL
+					? eai_osal_dwork_submit_to(&task->_sleep, task->_wq, ms)
+					: eai_osal_dwork_submit(&task->_sleep, ms);
+
+	if (ret != EAI_OSAL_OK) {
+		task_set_parked(task, false);
+		return false;
+	}
+	return true;
+}
+
+void osal_task_await_begin(eai_osal_task_t *task, uint32_t timeout_ms)
+{
+	task->_timeout_ms = timeout_ms;
+	if (timeout_ms != EAI_OSAL_NO_WAIT && timeout_ms != EAI_OSAL_WAIT_FOREVER) {
+		task->_start_ms = eai_osal_time_get_ms();
+	}
+}
+
+/* Park on _entry for what is left of the await's timeout */
+static eai_osal_status_t task_park(eai_osal_task_t *task)
+{
+	uint32_t left = task->_timeout_ms;
+
+	if (left == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+	if (left != EAI_OSAL_WAIT_FOREVER) {
+		uint32_t spent = eai_osal_time_get_ms() - task->_start_ms;
+
+		if (spent >= left) {
+			return EAI_OSAL_TIMEOUT;
+		}
+		left -= spent;
+	}
+
+	task_set_parked(task, true);
+	if (eai_osal_work_poll_submit(&task->_poll, task->_wq, &task->_entry, 1,
+				      left) != EAI_OSAL_OK) {
+		task_set_parked(task, false);
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t osal_task_park_sem(eai_osal_task_t *task, eai_osal_sem_t *sem)
+{
+	task->_entry = (eai_osal_poll_event_t)EAI_OSAL_POLL_SEM(sem);
+	return task_park(task);
+}
+
+eai_osal_status_t osal_task_park_queue(eai_osal_task_t *task,
+				       eai_osal_queue_t *queue)
+{
+	task->_entry = (eai_osal_poll_event_t)EAI_OSAL_POLL_QUEUE(queue);
+	return task_park(task);
+}
+
+eai_osal_status_t osal_task_park_event(eai_osal_task_t *task,
+				       eai_osal_event_t *event, uint32_t bits,
+				       bool wait_all)
+{
+	uint32_t watch = bits;
+
+	if (wait_all) {
+		/*
+		 * Poll entries fire on any bit, so watch only the missing ones;
+		 * watching a bit that is already set would wake us straight
+		 * back up. If they all turned up meanwhile, watch them all and
+		 * the next step finds them.
+		 */
+		uint32_t have = 0;
+
+		(void)eai_osal_event_wait(event, bits, false, &have, EAI_OSAL_NO_WAIT);
+		if ((bits & ~have) != 0) {
+			watch = bits & ~have;
+		}
+	}
+	task->_entry = (eai_osal_poll_event_t)EAI_OSAL_POLL_EVENT(event, watch);
+	return task_park(task);
+}
@@ -1,12 +1,21 @@
 #include <eai_osal/event.h>
 #include "internal.h"
+#include "../stats_internal.h"
 
 eai_osal_status_t eai_osal_event_create(eai_osal_event_t *event)
+{
+	return eai_osal_event_create_named(event, NULL);
+}
+
+eai_osal_status_t eai_osal_event_create_named(eai_osal_event_t *event,
+					      const char *name)
 {
 	if (event == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	k_event_init(&event->_impl);
+	event->_pollers = NULL;
+	OSAL_STATS_INIT(event, EAI_OSAL_STATS_EVENT, name);
 	return EAI_OSAL_OK;
 }
 
@@ -15,6 +24,7 @@ eai_osal_status_t eai_osal_event_destroy(eai_osal_event_t *event)
 	if (event == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(event);
 	return EAI_OSAL_OK;
 }
 
@@ -24,6 +34,7 @@ eai_osal_status_t eai_osal_event_set(eai_osal_event_t *event, uint32_t bits)
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	k_event_post(&event->_impl, bits);
+	osal_poll_notify(event);
 	return EAI_OSAL_OK;
 }
 
@@ -35,19 +46,29 @@ eai_osal_status_t eai_osal_event_wait(eai_osal_event_t *event, uint32_t bits,
 		return EAI_OSAL_INVALID_PARAM;
 	}
 
-	uint32_t result;
+	k_timeout_t timeout = osal_timeout(timeout_ms);
+	uint32_t t0 = 0;
+	uint32_t result = 0;
 
-	if (wait_all) {
-		result = k_event_wait_all(&event->_impl, bits, false,
-					  osal_timeout(timeout_ms));
-	} else {
-		result = k_event_wait(&event->_impl, bits, false,
-				      osal_timeout(timeout_ms));
+	/* Stats: try first, so only a wait that blocks is timed */
+	if (OSAL_STATS_ENABLED && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = wait_all
+			? k_event_wait_all(&event->_impl, bits, false, K_NO_WAIT)
+			: k_event_wait(&event->_impl, bits, false, K_NO_WAIT);
+		if (result == 0) {
+			t0 = OSAL_STATS_STAMP();
+		}
+	}
+	if (result == 0) {
+		result = wait_all
+			? k_event_wait_all(&event->_impl, bits, false, timeout)
+			: k_event_wait(&event->_impl, bits, false, timeout);
 	}
 
 	if (result == 0) {
 		return EAI_OSAL_TIMEOUT;
 	}
+	OSAL_STATS_RECORD(event, t0);
 
 	if (actual != NULL) {
 		*actual = result;
@@ -3,6 +3,7 @@
 
 #include <zephyr/kernel.h>
 #include <eai_osal/types.h>
+#include <eai_osal/poll.h>
 
 static inline k_timeout_t osal_timeout(uint32_t ms)
 {
@@ -32,4 +33,32 @@ static inline eai_osal_status_t osal_status(int ret)
 	return EAI_OSAL_ERROR;
 }
 
+/* Wrapping microsecond clock for wait-time stats (stats_internal.h) */
+static inline uint32_t osal_now_us(void)
+{
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+	return (uint32_t)k_cyc_to_us_floor64(k_cycle_get_64());
+#else
+	return (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+#endif
+}
+
+/* Raise the signal of every eai_osal_poll() caller waiting on event (poll.c) */
+void osal_poll_notify(eai_osal_event_t *event);
+
+/*
+ * Poll entry helpers, shared with triggered work (workqueue.c). scan
+ * refreshes each entry's ready flag. build fills kev with an entry per
+ * semaphore or queue and one for signal if any event groups are listed,
+ * and returns how many it used; register lists the event group entries
+ * so that eai_osal_event_set() raises signal.
+ */
+bool osal_poll_valid(const eai_osal_poll_event_t *events, size_t n);
+bool osal_poll_scan(eai_osal_poll_event_t *events, size_t n);
+int osal_poll_build(eai_osal_poll_event_t *events, size_t n,
+		    struct k_poll_event *kev, struct k_poll_signal *signal);
+void osal_poll_register(eai_osal_poll_event_t *events, size_t n,
+			struct k_poll_signal *signal);
+void osal_poll_unregister(eai_osal_poll_event_t *events, size_t n);
+
 #endif /* EAI_OSAL_ZEPHYR_INTERNAL_H */
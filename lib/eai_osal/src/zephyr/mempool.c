@@ -0,0 +1,107 @@
+#include <eai_osal/mempool.h>
+#include "internal.h"
+
+/*
+ * Thin wrapper over k_mem_slab. The slab keeps its own used count;
+ * high_water is tracked here so it doesn't depend on
+ * CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION.
+ */
+
+static void counter_max(atomic_t *counter, atomic_val_t val)
+{
+	atomic_val_t cur = atomic_get(counter);
+
+	while (val > cur && !atomic_cas(counter, cur, val)) {
+		cur = atomic_get(counter);
+	}
+}
+
+eai_osal_status_t eai_osal_mempool_create(eai_osal_mempool_t *pool,
+					  size_t block_size, uint32_t n_blocks,
+					  void *buffer)
+{
+	if (pool == NULL || buffer == NULL || n_blocks == 0 || block_size == 0 ||
+	    block_size % sizeof(void *) != 0 ||
+	    (uintptr_t)buffer % sizeof(void *) != 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	atomic_clear(&pool->_high_water);
+	atomic_clear(&pool->_failures);
+	return osal_status(k_mem_slab_init(&pool->_impl, buffer, block_size,
+					   n_blocks));
+}
+
+eai_osal_status_t eai_osal_mempool_destroy(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_alloc(eai_osal_mempool_t *pool, void **block,
+					 uint32_t timeout_ms)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	/* -ENOMEM (no wait) and -EAGAIN (timed out) both mean still empty */
+	if (k_mem_slab_alloc(&pool->_impl, block, osal_timeout(timeout_ms)) != 0) {
+		atomic_inc(&pool->_failures);
+		return EAI_OSAL_TIMEOUT;
+	}
+	counter_max(&pool->_high_water,
+		    (atomic_val_t)k_mem_slab_num_used_get(&pool->_impl));
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_free(eai_osal_mempool_t *pool, void *block)
+{
+	if (pool == NULL || block == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	const uint8_t *buf = (const uint8_t *)pool->_impl.buffer;
+	size_t block_size = pool->_impl.info.block_size;
+
+	if ((const uint8_t *)block < buf) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	size_t off = (size_t)((const uint8_t *)block - buf);
+
+	if (off % block_size != 0 ||
+	    off / block_size >= pool->_impl.info.num_blocks) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	k_mem_slab_free(&pool->_impl, block);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_get_stats(eai_osal_mempool_t *pool,
+					     eai_osal_mempool_stats_t *stats)
+{
+	if (pool == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	stats->block_size = (uint32_t)pool->_impl.info.block_size;
+	stats->n_blocks = pool->_impl.info.num_blocks;
+	stats->used = k_mem_slab_num_used_get(&pool->_impl);
+	stats->high_water = (uint32_t)atomic_get(&pool->_high_water);
+	stats->failures = (uint32_t)atomic_get(&pool->_failures);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_mempool_reset_stats(eai_osal_mempool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	atomic_clear(&pool->_failures);
+	atomic_set(&pool->_high_water,
+		   (atomic_val_t)k_mem_slab_num_used_get(&pool->_impl));
+	return EAI_OSAL_OK;
+}
@@ -1,12 +1,24 @@
 #include <eai_osal/mutex.h>
 #include "internal.h"
+#include "../stats_internal.h"
 
 eai_osal_status_t eai_osal_mutex_create(eai_osal_mutex_t *mutex)
+{
+	return eai_osal_mutex_create_named(mutex, NULL);
+}
+
+eai_osal_status_t eai_osal_mutex_create_named(eai_osal_mutex_t *mutex,
+					      const char *name)
 {
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_mutex_init(&mutex->_impl));
+	int ret = k_mutex_init(&mutex->_impl);
+
+	if (ret == 0) {
+		OSAL_STATS_INIT(mutex, EAI_OSAL_STATS_MUTEX, name);
+	}
+	return osal_status(ret);
 }
 
 eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex)
@@ -14,6 +26,7 @@ eai_osal_status_t eai_osal_mutex_destroy(eai_osal_mutex_t *mutex)
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(mutex);
 	return EAI_OSAL_OK;
 }
 
@@ -22,7 +35,24 @@ eai_osal_status_t eai_osal_mutex_lock(eai_osal_mutex_t *mutex, uint32_t timeout_
 	if (mutex == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_mutex_lock(&mutex->_impl, osal_timeout(timeout_ms)));
+	k_timeout_t timeout = osal_timeout(timeout_ms);
+	uint32_t t0 = 0;
+	int ret;
+
+	/* Stats: try first, so only a lock that blocks is timed */
+	if (OSAL_STATS_ENABLED && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = k_mutex_lock(&mutex->_impl, K_NO_WAIT);
+		if (ret == 0) {
+			OSAL_STATS_RECORD(mutex, t0);
+			return EAI_OSAL_OK;
+		}
+		t0 = OSAL_STATS_STAMP();
+	}
+	ret = k_mutex_lock(&mutex->_impl, timeout);
+	if (ret == 0) {
+		OSAL_STATS_RECORD(mutex, t0);
+	}
+	return osal_status(ret);
 }
 
 eai_osal_status_t eai_osal_mutex_unlock(eai_osal_mutex_t *mutex)
@@ -0,0 +1,110 @@
+#include <eai_osal/pipe.h>
+#include <zephyr/sys/ring_buffer.h>
+#include "internal.h"
+
+/*
+ * Byte pipe on k_pipe. k_pipe_read() waits for all it is asked for, so a
+ * read first waits for its threshold, then takes whatever else is there
+ * without waiting. Both calls stop at one deadline.
+ */
+
+eai_osal_status_t eai_osal_pipe_create(eai_osal_pipe_t *pipe, void *buffer,
+				       size_t size, size_t threshold)
+{
+	if (pipe == NULL || buffer == NULL || size == 0 ||
+	    threshold == 0 || threshold > size) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	k_pipe_init(&pipe->_impl, (uint8_t *)buffer, size);
+	pipe->_threshold = threshold;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_pipe_destroy(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	k_pipe_reset(&pipe->_impl);
+	return EAI_OSAL_OK;
+}
+
+/* Bytes moved by a k_pipe call, or the error once nothing moved */
+static eai_osal_status_t pipe_result(int ret, size_t *done)
+{
+	if (ret >= 0) {
+		*done += (size_t)ret;
+		return EAI_OSAL_OK;
+	}
+	return ret == -EAGAIN ? EAI_OSAL_TIMEOUT : EAI_OSAL_ERROR;
+}
+
+eai_osal_status_t eai_osal_pipe_write(eai_osal_pipe_t *pipe, const void *data,
+				      size_t len, size_t *written,
+				      uint32_t timeout_ms)
+{
+	if (pipe == NULL || (data == NULL && len > 0)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	size_t done = 0;
+	eai_osal_status_t ret = EAI_OSAL_OK;
+
+	if (len > 0) {
+		ret = pipe_result(k_pipe_write(&pipe->_impl, data, len,
+					       osal_timeout(timeout_ms)),
+				  &done);
+	}
+	if (ret == EAI_OSAL_OK && done < len) {
+		ret = EAI_OSAL_TIMEOUT;
+	}
+	if (written != NULL) {
+		*written = done;
+	}
+	return ret;
+}
+
+eai_osal_status_t eai_osal_pipe_read(eai_osal_pipe_t *pipe, void *data,
+				     size_t len, size_t *read,
+				     uint32_t timeout_ms)
+{
+	if (pipe == NULL || (data == NULL && len > 0) || read == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint8_t *dst = data;
+	size_t need = len < pipe->_threshold ? len : pipe->_threshold;
+	k_timepoint_t end = sys_timepoint_calc(osal_timeout(timeout_ms));
+	eai_osal_status_t ret = EAI_OSAL_OK;
+	size_t done = 0;
+
+	while (done < need && ret == EAI_OSAL_OK) {
+		ret = pipe_result(k_pipe_read(&pipe->_impl, dst + done, need - done,
+					      sys_timepoint_timeout(end)),
+				  &done);
+	}
+	if (done < len && ret != EAI_OSAL_ERROR) {
+		/* Whatever else is there; on timeout, whatever came */
+		(void)pipe_result(k_pipe_read(&pipe->_impl, dst + done, len - done,
+					      K_NO_WAIT),
+				  &done);
+	}
+	*read = done;
+	return done >= need ? EAI_OSAL_OK : ret;
+}
+
+size_t eai_osal_pipe_count(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return 0;
+	}
+	return ring_buf_size_get(&pipe->_impl.buf);
+}
+
+size_t eai_osal_pipe_space(eai_osal_pipe_t *pipe)
+{
+	if (pipe == NULL) {
+		return 0;
+	}
+	return ring_buf_space_get(&pipe->_impl.buf);
+}
@@ -0,0 +1,188 @@
+#include <eai_osal/poll.h>
+#include "internal.h"
+
+/*
+ * Zephyr poll — k_poll() over a k_poll_event array built on the stack.
+ *
+ * Semaphores and message queues map directly. An event group has no poll
+ * type, so each poller brings one k_poll_signal and lists its event
+ * entries on their groups; eai_osal_event_set() raises every listed
+ * signal. The poller resets its signal before it checks the bits, so a
+ * set that lands after the check still wakes k_poll(). A wake for bits
+ * nobody asked for goes round the loop again with the time left.
+ * Triggered work (workqueue.c) builds the same events into a k_work_poll.
+ */
+
+static struct k_spinlock poll_lock;
+
+void osal_poll_notify(eai_osal_event_t *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&poll_lock);
+
+	for (struct osal_poll_node *n = event->_pollers; n != NULL; n = n->_next) {
+		k_poll_signal_raise(n->_signal, 0);
+	}
+	k_spin_unlock(&poll_lock, key);
+}
+
+static bool entry_valid(const eai_osal_poll_event_t *ev)
+{
+	switch (ev->type) {
+	case EAI_OSAL_POLL_SEM_AVAILABLE:
+		return ev->sem != NULL;
+	case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+		return ev->queue != NULL;
+	case EAI_OSAL_POLL_EVENT_BITS:
+		return ev->event != NULL && ev->bits != 0;
+	default:
+		return false;
+	}
+}
+
+bool osal_poll_valid(const eai_osal_poll_event_t *events, size_t n)
+{
+	if (events == NULL || n == 0 || n > CONFIG_EAI_OSAL_POLL_MAX_EVENTS) {
+		return false;
+	}
+	for (size_t i = 0; i < n; i++) {
+		if (!entry_valid(&events[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool osal_poll_scan(eai_osal_poll_event_t *events, size_t n)
+{
+	bool any = false;
+
+	for (size_t i = 0; i < n; i++) {
+		eai_osal_poll_event_t *ev = &events[i];
+
+		switch (ev->type) {
+		case EAI_OSAL_POLL_SEM_AVAILABLE:
+			ev->ready = k_sem_count_get(&ev->sem->_impl) > 0;
+			break;
+		case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+			ev->ready = k_msgq_num_used_get(&ev->queue->_impl) > 0;
+			break;
+		default:
+			ev->ready = k_event_test(&ev->event->_impl, ev->bits) != 0;
+			break;
+		}
+		any |= ev->ready;
+	}
+	return any;
+}
+
+int osal_poll_build(eai_osal_poll_event_t *events, size_t n,
+		    struct k_poll_event *kev, struct k_poll_signal *signal)
+{
+	/* Sems and queues get an entry each; all event groups share one signal */
+	int n_kev = 0;
+	bool has_events = false;
+
+	for (size_t i = 0; i < n; i++) {
+		switch (events[i].type) {
+		case EAI_OSAL_POLL_SEM_AVAILABLE:
+			k_poll_event_init(&kev[n_kev++], K_POLL_TYPE_SEM_AVAILABLE,
+					  K_POLL_MODE_NOTIFY_ONLY, &events[i].sem->_impl);
+			break;
+		case EAI_OSAL_POLL_QUEUE_NOT_EMPTY:
+			k_poll_event_init(&kev[n_kev++], K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+					  K_POLL_MODE_NOTIFY_ONLY, &events[i].queue->_impl);
+			break;
+		default:
+			has_events = true;
+			break;
+		}
+	}
+	if (has_events) {
+		k_poll_event_init(&kev[n_kev++], K_POLL_TYPE_SIGNAL,
+				  K_POLL_MODE_NOTIFY_ONLY, signal);
+	}
+	return n_kev;
+}
+
+void osal_poll_register(eai_osal_poll_event_t *events, size_t n,
+			struct k_poll_signal *signal)
+{
+	k_spinlock_key_t key = k_spin_lock(&poll_lock);
+
+	for (size_t i = 0; i < n; i++) {
+		if (events[i].type != EAI_OSAL_POLL_EVENT_BITS) {
+			continue;
+		}
+
+		struct osal_poll_node *node = &events[i]._priv;
+
+		node->_signal = signal;
+		node->_next = events[i].event->_pollers;
+		events[i].event->_pollers = node;
+	}
+	k_spin_unlock(&poll_lock, key);
+}
+
+void osal_poll_unregister(eai_osal_poll_event_t *events, size_t n)
+{
+	k_spinlock_key_t key = k_spin_lock(&poll_lock);
+
+	for (size_t i = 0; i < n; i++) {
+		if (events[i].type != EAI_OSAL_POLL_EVENT_BITS) {
+			continue;
+		}
+
+		struct osal_poll_node **link = &events[i].event->_pollers;
+
+		while (*link != &events[i]._priv) {
+			link = &(*link)->_next;
+		}
+		*link = events[i]._priv._next;
+	}
+	k_spin_unlock(&poll_lock, key);
+}
+
+eai_osal_status_t eai_osal_poll(eai_osal_poll_event_t *events, size_t n,
+				uint32_t timeout_ms)
+{
+	if (!osal_poll_valid(events, n)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	if (osal_poll_scan(events, n)) {
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		return EAI_OSAL_TIMEOUT;
+	}
+
+	struct k_poll_event kev[CONFIG_EAI_OSAL_POLL_MAX_EVENTS];
+	struct k_poll_signal signal;
+
+	k_poll_signal_init(&signal);
+
+	int n_kev = osal_poll_build(events, n, kev, &signal);
+
+	k_timepoint_t end = sys_timepoint_calc(osal_timeout(timeout_ms));
+	eai_osal_status_t ret = EAI_OSAL_TIMEOUT;
+
+	osal_poll_register(events, n, &signal);
+	for (;;) {
+		k_poll_signal_reset(&signal);
+		for (int i = 0; i < n_kev; i++) {
+			kev[i].state = K_POLL_STATE_NOT_READY;
+		}
+		if (osal_poll_scan(events, n)) {
+			ret = EAI_OSAL_OK;
+			break;
+		}
+		if (k_poll(kev, n_kev, sys_timepoint_timeout(end)) == -EAGAIN) {
+			if (osal_poll_scan(events, n)) {
+				ret = EAI_OSAL_OK;
+			}
+			break;
+		}
+	}
+	osal_poll_unregister(events, n);
+	return ret;
+}
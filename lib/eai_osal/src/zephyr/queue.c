@@ -1,13 +1,69 @@
 #include <eai_osal/queue.h>
 #include "internal.h"
+#include "../stats_internal.h"
+
+/*
+ * Blocking put/get for every queue operation. With stats on, try without
+ * waiting first so that only a call that blocks is timed.
+ */
+static int msgq_put(eai_osal_queue_t *queue, const void *msg, k_timeout_t timeout)
+{
+	uint32_t t0 = 0;
+	int ret;
+
+	if (OSAL_STATS_ENABLED && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = k_msgq_put(&queue->_impl, msg, K_NO_WAIT);
+		if (ret == 0) {
+			OSAL_STATS_RECORD(queue, t0);
+			return 0;
+		}
+		t0 = OSAL_STATS_STAMP();
+	}
+	ret = k_msgq_put(&queue->_impl, msg, timeout);
+	if (ret == 0) {
+		OSAL_STATS_RECORD(queue, t0);
+	}
+	return ret;
+}
+
+static int msgq_get(eai_osal_queue_t *queue, void *msg, k_timeout_t timeout)
+{
+	uint32_t t0 = 0;
+	int ret;
+
+	if (OSAL_STATS_ENABLED && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = k_msgq_get(&queue->_impl, msg, K_NO_WAIT);
+		if (ret == 0) {
+			OSAL_STATS_RECORD(queue, t0);
+			return 0;
+		}
+		t0 = OSAL_STATS_STAMP();
+	}
+	ret = k_msgq_get(&queue->_impl, msg, timeout);
+	if (ret == 0) {
+		OSAL_STATS_RECORD(queue, t0);
+	}
+	return ret;
+}
 
 eai_osal_status_t eai_osal_queue_create(eai_osal_queue_t *queue, size_t msg_size,
 					uint32_t max_msgs, void *buffer)
+{
+	return eai_osal_queue_create_named(queue, msg_size, max_msgs, buffer, NULL);
+}
+
+eai_osal_status_t eai_osal_queue_create_named(eai_osal_queue_t *queue,
+					      size_t msg_size, uint32_t max_msgs,
+					      void *buffer, const char *name)
 {
 	if (queue == NULL || buffer == NULL || msg_size == 0 || max_msgs == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
 	k_msgq_init(&queue->_impl, (char *)buffer, msg_size, max_msgs);
+	queue->_wr_timeout_ms = 0;
+	atomic_clear(&queue->_wr_busy);
+	atomic_clear(&queue->_rd_busy);
+	OSAL_STATS_INIT(queue, EAI_OSAL_STATS_QUEUE, name);
 	return EAI_OSAL_OK;
 }
 
@@ -16,6 +72,7 @@ eai_osal_status_t eai_osal_queue_destroy(eai_osal_queue_t *queue)
 	if (queue == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(queue);
 	k_msgq_purge(&queue->_impl);
 	return EAI_OSAL_OK;
 }
@@ -26,7 +83,7 @@ eai_osal_status_t eai_osal_queue_send(eai_osal_queue_t *queue, const void *msg,
 	if (queue == NULL || msg == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_msgq_put(&queue->_impl, msg, osal_timeout(timeout_ms)));
+	return osal_status(msgq_put(queue, msg, osal_timeout(timeout_ms)));
 }
 
 eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
@@ -35,5 +92,215 @@ eai_osal_status_t eai_osal_queue_recv(eai_osal_queue_t *queue, void *msg,
 	if (queue == NULL || msg == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_msgq_get(&queue->_impl, msg, osal_timeout(timeout_ms)));
+	return osal_status(msgq_get(queue, msg, osal_timeout(timeout_ms)));
+}
+
+/*
+ * Batched transfer — k_msgq has no multi-message call. The first message
+ * of each round waits (for whatever is left of the timeout); the rest of
+ * the burst goes through with K_NO_WAIT under k_sched_lock(), so a woken
+ * peer thread is switched to once per burst rather than once per message.
+ */
+
+static uint32_t put_burst(eai_osal_queue_t *queue, const uint8_t *src,
+			  uint32_t n)
+{
+	uint32_t done = 0;
+
+	k_sched_lock();
+	while (done < n &&
+	       k_msgq_put(&queue->_impl, src + done * queue->_impl.msg_size,
+			  K_NO_WAIT) == 0) {
+		done++;
+	}
+	k_sched_unlock();
+	return done;
+}
+
+static uint32_t get_burst(eai_osal_queue_t *queue, uint8_t *dst, uint32_t n)
+{
+	uint32_t done = 0;
+
+	k_sched_lock();
+	while (done < n &&
+	       k_msgq_get(&queue->_impl, dst + done * queue->_impl.msg_size,
+			  K_NO_WAIT) == 0) {
+		done++;
+	}
+	k_sched_unlock();
+	return done;
+}
+
+eai_osal_status_t eai_osal_queue_send_many(eai_osal_queue_t *queue,
+					   const void *msgs, uint32_t count,
+					   uint32_t *sent, uint32_t timeout_ms)
+{
+	if (queue == NULL || msgs == NULL || count == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	const uint8_t *src = (const uint8_t *)msgs;
+	size_t size = queue->_impl.msg_size;
+	k_timepoint_t end = sys_timepoint_calc(osal_timeout(timeout_ms));
+	uint32_t done = 0;
+	int ret = 0;
+
+	while (done < count) {
+		ret = msgq_put(queue, src + done * size,
+			       sys_timepoint_timeout(end));
+		if (ret != 0) {
+			break;
+		}
+		done++;
+		done += put_burst(queue, src + done * size, count - done);
+	}
+
+	if (sent != NULL) {
+		*sent = done;
+	}
+	return osal_status(ret);
+}
+
+/* Shared by recv_many (fill = false) and drain (fill = true) */
+static eai_osal_status_t recv_batch(eai_osal_queue_t *queue, void *msgs,
+				    uint32_t max_msgs, uint32_t *received,
+				    uint32_t timeout_ms, bool fill)
+{
+	if (queue == NULL || msgs == NULL || max_msgs == 0 || received == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint8_t *dst = (uint8_t *)msgs;
+	size_t size = queue->_impl.msg_size;
+	k_timepoint_t end = sys_timepoint_calc(osal_timeout(timeout_ms));
+	uint32_t done = 0;
+	int ret = 0;
+
+	while (done < max_msgs) {
+		ret = msgq_get(queue, dst + done * size,
+			       sys_timepoint_timeout(end));
+		if (ret != 0) {
+			break;
+		}
+		done++;
+		done += get_burst(queue, dst + done * size, max_msgs - done);
+		if (!fill) {
+			break;
+		}
+	}
+
+	*received = done;
+	return osal_status(ret);
+}
+
+eai_osal_status_t eai_osal_queue_recv_many(eai_osal_queue_t *queue, void *msgs,
+					   uint32_t max_msgs, uint32_t *received,
+					   uint32_t timeout_ms)
+{
+	return recv_batch(queue, msgs, max_msgs, received, timeout_ms, false);
+}
+
+eai_osal_status_t eai_osal_queue_drain(eai_osal_queue_t *queue, void *msgs,
+				       uint32_t max_msgs, uint32_t *received,
+				       uint32_t timeout_ms)
+{
+	return recv_batch(queue, msgs, max_msgs, received, timeout_ms, true);
+}
+
+/*
+ * Zero-copy access — k_msgq has no in-place API, so reserve/peek hand out
+ * a staging buffer embedded in the queue (CONFIG_EAI_OSAL_QUEUE_STAGE_SIZE
+ * bytes per side), commit does the k_msgq_put and peek does the k_msgq_get.
+ */
+
+#if CONFIG_EAI_OSAL_QUEUE_STAGE_SIZE > 0
+#define WR_STAGE(queue) ((void *)(queue)->_wr_stage)
+#define RD_STAGE(queue) ((void *)(queue)->_rd_stage)
+#else
+#define WR_STAGE(queue) NULL
+#define RD_STAGE(queue) NULL
+#endif
+
+static eai_osal_status_t stage_check(eai_osal_queue_t *queue)
+{
+	return queue->_impl.msg_size <= CONFIG_EAI_OSAL_QUEUE_STAGE_SIZE ?
+	       EAI_OSAL_OK : EAI_OSAL_NO_MEMORY;
+}
+
+eai_osal_status_t eai_osal_queue_reserve(eai_osal_queue_t *queue, void **slot,
+					 uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!atomic_cas(&queue->_wr_busy, 0, 1)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	eai_osal_status_t ret = stage_check(queue);
+
+	if (ret == EAI_OSAL_OK && timeout_ms == EAI_OSAL_NO_WAIT &&
+	    k_msgq_num_free_get(&queue->_impl) == 0) {
+		ret = EAI_OSAL_TIMEOUT;
+	}
+	if (ret != EAI_OSAL_OK) {
+		atomic_clear(&queue->_wr_busy);
+		return ret;
+	}
+
+	queue->_wr_timeout_ms = timeout_ms;
+	*slot = WR_STAGE(queue);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_commit(eai_osal_queue_t *queue, void *slot)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!atomic_get(&queue->_wr_busy) || slot != WR_STAGE(queue)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	int ret = msgq_put(queue, slot, osal_timeout(queue->_wr_timeout_ms));
+
+	atomic_clear(&queue->_wr_busy);
+	return osal_status(ret);
+}
+
+eai_osal_status_t eai_osal_queue_peek(eai_osal_queue_t *queue, void **slot,
+				      uint32_t timeout_ms)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!atomic_cas(&queue->_rd_busy, 0, 1)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	eai_osal_status_t ret = stage_check(queue);
+
+	if (ret == EAI_OSAL_OK) {
+		ret = osal_status(msgq_get(queue, RD_STAGE(queue),
+					   osal_timeout(timeout_ms)));
+	}
+	if (ret != EAI_OSAL_OK) {
+		atomic_clear(&queue->_rd_busy);
+		return ret;
+	}
+
+	*slot = RD_STAGE(queue);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_queue_release(eai_osal_queue_t *queue, void *slot)
+{
+	if (queue == NULL || slot == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!atomic_get(&queue->_rd_busy) || slot != RD_STAGE(queue)) {
+		return EAI_OSAL_ERROR;
+	}
+	atomic_clear(&queue->_rd_busy);
+	return EAI_OSAL_OK;
 }
@@ -0,0 +1,163 @@
+#include <eai_osal/rwlock.h>
+#include "internal.h"
+
+/*
+ * Zephyr reader-writer lock.
+ *
+ * Zephyr has no rwlock object, so this works the same way as the FreeRTOS
+ * backend. The counts live under a short-held k_mutex. Whoever releases
+ * hands the lock on under that mutex: to one queued writer through
+ * _write_sem, or to every queued reader at once through _read_sem. A
+ * waiter that times out retakes the mutex and checks for a hand-off that
+ * raced its timeout before it gives up.
+ */
+
+/* Let every queued reader in (_lock held, no writer) */
+static void grant_readers(eai_osal_rwlock_t *rwlock)
+{
+	rwlock->_readers += rwlock->_readers_waiting;
+	while (rwlock->_readers_waiting > 0) {
+		k_sem_give(&rwlock->_read_sem);
+		rwlock->_readers_waiting--;
+	}
+}
+
+eai_osal_status_t eai_osal_rwlock_create(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	rwlock->_readers = 0;
+	rwlock->_readers_waiting = 0;
+	rwlock->_writers_waiting = 0;
+	rwlock->_writer = false;
+	k_mutex_init(&rwlock->_lock);
+	k_sem_init(&rwlock->_read_sem, 0, K_SEM_MAX_LIMIT);
+	k_sem_init(&rwlock->_write_sem, 0, 1);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_destroy(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_lock(eai_osal_rwlock_t *rwlock,
+					    uint32_t timeout_ms)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	k_mutex_lock(&rwlock->_lock, K_FOREVER);
+	if (!rwlock->_writer && rwlock->_writers_waiting == 0) {
+		rwlock->_readers++;
+		k_mutex_unlock(&rwlock->_lock);
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		k_mutex_unlock(&rwlock->_lock);
+		return EAI_OSAL_TIMEOUT;
+	}
+	rwlock->_readers_waiting++;
+	k_mutex_unlock(&rwlock->_lock);
+
+	if (k_sem_take(&rwlock->_read_sem, osal_timeout(timeout_ms)) == 0) {
+		return EAI_OSAL_OK; /* counted in _readers by grant_readers() */
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_TIMEOUT;
+
+	k_mutex_lock(&rwlock->_lock, K_FOREVER);
+	if (k_sem_take(&rwlock->_read_sem, K_NO_WAIT) == 0) {
+		ret = EAI_OSAL_OK;
+	} else {
+		rwlock->_readers_waiting--;
+	}
+	k_mutex_unlock(&rwlock->_lock);
+	return ret;
+}
+
+eai_osal_status_t eai_osal_rwlock_read_unlock(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_OK;
+
+	k_mutex_lock(&rwlock->_lock, K_FOREVER);
+	if (rwlock->_readers == 0) {
+		ret = EAI_OSAL_ERROR;
+	} else if (--rwlock->_readers == 0 && rwlock->_writers_waiting > 0) {
+		rwlock->_writers_waiting--;
+		rwlock->_writer = true;
+		k_sem_give(&rwlock->_write_sem);
+	}
+	k_mutex_unlock(&rwlock->_lock);
+	return ret;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_lock(eai_osal_rwlock_t *rwlock,
+					     uint32_t timeout_ms)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	k_mutex_lock(&rwlock->_lock, K_FOREVER);
+	if (!rwlock->_writer && rwlock->_readers == 0) {
+		rwlock->_writer = true;
+		k_mutex_unlock(&rwlock->_lock);
+		return EAI_OSAL_OK;
+	}
+	if (timeout_ms == EAI_OSAL_NO_WAIT) {
+		k_mutex_unlock(&rwlock->_lock);
+		return EAI_OSAL_TIMEOUT;
+	}
+	rwlock->_writers_waiting++;
+	k_mutex_unlock(&rwlock->_lock);
+
+	if (k_sem_take(&rwlock->_write_sem, osal_timeout(timeout_ms)) == 0) {
+		return EAI_OSAL_OK; /* _writer was set by whoever handed off */
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_TIMEOUT;
+
+	k_mutex_lock(&rwlock->_lock, K_FOREVER);
+	if (k_sem_take(&rwlock->_write_sem, K_NO_WAIT) == 0) {
+		ret = EAI_OSAL_OK;
+	} else if (--rwlock->_writers_waiting == 0 && !rwlock->_writer) {
+		/* Readers held back for us alone can go now */
+		grant_readers(rwlock);
+	}
+	k_mutex_unlock(&rwlock->_lock);
+	return ret;
+}
+
+eai_osal_status_t eai_osal_rwlock_write_unlock(eai_osal_rwlock_t *rwlock)
+{
+	if (rwlock == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_OK;
+
+	k_mutex_lock(&rwlock->_lock, K_FOREVER);
+	if (!rwlock->_writer) {
+		ret = EAI_OSAL_ERROR;
+	} else if (rwlock->_writers_waiting > 0) {
+		/* Stays write-held; ownership passes to the next writer */
+		rwlock->_writers_waiting--;
+		k_sem_give(&rwlock->_write_sem);
+	} else {
+		rwlock->_writer = false;
+		grant_readers(rwlock);
+	}
+	k_mutex_unlock(&rwlock->_lock);
+	return ret;
+}
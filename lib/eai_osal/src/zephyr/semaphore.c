@@ -1,13 +1,25 @@
 #include <eai_osal/semaphore.h>
 #include "internal.h"
+#include "../stats_internal.h"
 
 eai_osal_status_t eai_osal_sem_create(eai_osal_sem_t *sem, uint32_t initial,
 				      uint32_t limit)
+{
+	return eai_osal_sem_create_named(sem, initial, limit, NULL);
+}
+
+eai_osal_status_t eai_osal_sem_create_named(eai_osal_sem_t *sem, uint32_t initial,
+					    uint32_t limit, const char *name)
 {
 	if (sem == NULL || limit == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_sem_init(&sem->_impl, initial, limit));
+	int ret = k_sem_init(&sem->_impl, initial, limit);
+
+	if (ret == 0) {
+		OSAL_STATS_INIT(sem, EAI_OSAL_STATS_SEM, name);
+	}
+	return osal_status(ret);
 }
 
 eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
@@ -15,6 +27,7 @@ eai_osal_status_t eai_osal_sem_destroy(eai_osal_sem_t *sem)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	OSAL_STATS_DEINIT(sem);
 	return EAI_OSAL_OK;
 }
 
@@ -32,5 +45,22 @@ eai_osal_status_t eai_osal_sem_take(eai_osal_sem_t *sem, uint32_t timeout_ms)
 	if (sem == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	return osal_status(k_sem_take(&sem->_impl, osal_timeout(timeout_ms)));
+	k_timeout_t timeout = osal_timeout(timeout_ms);
+	uint32_t t0 = 0;
+	int ret;
+
+	/* Stats: try first, so only a take that blocks is timed */
+	if (OSAL_STATS_ENABLED && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = k_sem_take(&sem->_impl, K_NO_WAIT);
+		if (ret == 0) {
+			OSAL_STATS_RECORD(sem, t0);
+			return EAI_OSAL_OK;
+		}
+		t0 = OSAL_STATS_STAMP();
+	}
+	ret = k_sem_take(&sem->_impl, timeout);
+	if (ret == 0) {
+		OSAL_STATS_RECORD(sem, t0);
+	}
+	return osal_status(ret);
 }
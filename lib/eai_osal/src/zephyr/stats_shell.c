@@ -0,0 +1,135 @@
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <eai_osal/stats.h>
+#include <eai_osal/thread.h>
+#include <string.h>
+
+#ifdef CONFIG_EAI_OSAL_STATS
+
+struct hist_ctx {
+	const struct shell *sh;
+	const char *name;
+	bool found;
+};
+
+static void print_row(const eai_osal_stats_t *st, void *arg)
+{
+	const struct shell *sh = arg;
+	uint32_t avg = st->contended ? (uint32_t)(st->wait_total_us / st->contended) : 0;
+
+	shell_print(sh, "%-20s %-5s %10u %10u %10u %10u",
+		    st->name, eai_osal_stats_kind_str(st->kind),
+		    st->acquires, st->contended, avg, st->wait_max_us);
+}
+
+static void print_hist(const eai_osal_stats_t *st, void *arg)
+{
+	struct hist_ctx *ctx = arg;
+
+	if (ctx->found || strcmp(st->name, ctx->name) != 0) {
+		return;
+	}
+	ctx->found = true;
+
+	shell_print(ctx->sh, "%s (%s): %u acquires, %u contended",
+		    st->name, eai_osal_stats_kind_str(st->kind),
+		    st->acquires, st->contended);
+	for (int i = 0; i < EAI_OSAL_STATS_BUCKETS; i++) {
+		if (st->hist[i] == 0) {
+			continue;
+		}
+		if (i == 0) {
+			shell_print(ctx->sh, "  %10s  < 1 us     %10u", "", st->hist[i]);
+		} else if (i == EAI_OSAL_STATS_BUCKETS - 1) {
+			shell_print(ctx->sh, "  >= %7u us           %10u",
+				    1u << (i - 1), st->hist[i]);
+		} else {
+			shell_print(ctx->sh, "  %7u .. %7u us %10u",
+				    1u << (i - 1), (1u << i) - 1, st->hist[i]);
+		}
+	}
+}
+
+static int cmd_osal_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-20s %-5s %10s %10s %10s %10s",
+		    "Name", "Kind", "Acquires", "Contended", "Avg us", "Max us");
+	eai_osal_stats_foreach(print_row, (void *)sh);
+
+	return 0;
+}
+
+static int cmd_osal_hist(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+
+	struct hist_ctx ctx = { .sh = sh, .name = argv[1] };
+
+	eai_osal_stats_foreach(print_hist, &ctx);
+	if (!ctx.found) {
+		shell_error(sh, "No OSAL object named '%s'", argv[1]);
+		return -ENOENT;
+	}
+
+	return 0;
+}
+
+static int cmd_osal_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	eai_osal_stats_reset();
+	shell_print(sh, "OSAL stats cleared");
+
+	return 0;
+}
+
+#endif /* CONFIG_EAI_OSAL_STATS */
+
+#ifdef CONFIG_EAI_OSAL_THREAD_STATS
+
+static void print_thread(const eai_osal_thread_stats_t *st, void *arg)
+{
+	const struct shell *sh = arg;
+
+	shell_print(sh, "%-16s %12llu %10u %6zu/%-6zu",
+		    st->name, (unsigned long long)(st->runtime_ns / 1000),
+		    st->switches, st->stack_used, st->stack_size);
+}
+
+static int cmd_osal_threads(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-16s %12s %10s %13s",
+		    "Name", "CPU us", "Switches", "Stack used");
+	eai_osal_thread_foreach(print_thread, (void *)sh);
+
+	return 0;
+}
+
+#endif /* CONFIG_EAI_OSAL_THREAD_STATS */
+
+/* Each group of subcommands is only there when its stats are enabled */
+SHELL_SUBCMD_SET_CREATE(sub_osal, (osal));
+
+#ifdef CONFIG_EAI_OSAL_STATS
+SHELL_SUBCMD_ADD((osal), stats, NULL, "Per-object wait statistics",
+		 cmd_osal_stats, 1, 0);
+SHELL_SUBCMD_ADD((osal), hist, NULL, "Wait-time histogram: hist <name>",
+		 cmd_osal_hist, 2, 0);
+SHELL_SUBCMD_ADD((osal), reset, NULL, "Zero all counters",
+		 cmd_osal_reset, 1, 0);
+#endif
+
+#ifdef CONFIG_EAI_OSAL_THREAD_STATS
+SHELL_SUBCMD_ADD((osal), threads, NULL, "CPU time and stack use per OSAL thread",
+		 cmd_osal_threads, 1, 0);
+#endif
+
+SHELL_CMD_REGISTER(osal, &sub_osal, "OSAL diagnostics", NULL);
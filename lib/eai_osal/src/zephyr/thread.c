@@ -1,14 +1,124 @@
 #include <eai_osal/thread.h>
 #include "internal.h"
 #include <zephyr/sys/util.h>
+#include <string.h>
 
 BUILD_ASSERT(CONFIG_NUM_PREEMPT_PRIORITIES >= 32,
 	     "EAI OSAL requires CONFIG_NUM_PREEMPT_PRIORITIES >= 32");
 
-static void thread_trampoline(void *entry, void *arg, void *unused)
+/* ── Stats registry ──────────────────────────────────────────────────── */
+
+/*
+ * A thread is listed from create until its entry function returns, and
+ * stats are read with registry_lock held. A k_mutex rather than a
+ * spinlock, because k_thread_stack_space_get() walks the stack.
+ */
+static K_MUTEX_DEFINE(registry_lock);
+static eai_osal_thread_t *registry;
+
+static void registry_remove(eai_osal_thread_t *thread)
+{
+	k_mutex_lock(&registry_lock, K_FOREVER);
+	for (eai_osal_thread_t **it = &registry; *it != NULL; it = &(*it)->_next) {
+		if (*it == thread) {
+			*it = thread->_next;
+			break;
+		}
+	}
+	k_mutex_unlock(&registry_lock);
+}
+
+/* Fill *out from a listed thread (registry_lock held) */
+static void thread_snapshot(eai_osal_thread_t *thread, eai_osal_thread_stats_t *out)
+{
+	k_tid_t tid = &thread->_impl;
+
+	memset(out, 0, sizeof(*out));
+	out->stack_size = thread->_stack_size;
+
+#ifdef CONFIG_THREAD_NAME
+	const char *name = k_thread_name_get(tid);
+
+	if (name != NULL) {
+		strncpy(out->name, name, sizeof(out->name) - 1);
+	}
+#endif
+#ifdef CONFIG_THREAD_RUNTIME_STATS
+	k_thread_runtime_stats_t rt;
+
+	if (k_thread_runtime_stats_get(tid, &rt) == 0) {
+		out->runtime_ns = k_cyc_to_ns_floor64(rt.execution_cycles);
+	}
+#endif
+#ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
+	/* Bumped on every switch-in; k_thread_runtime_stats_t only has the average */
+	out->switches = tid->base.usage.num_windows;
+#endif
+#if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO)
+	size_t unused;
+
+	if (k_thread_stack_space_get(tid, &unused) == 0) {
+		out->stack_used = tid->stack_info.size - unused;
+	}
+#endif
+}
+
+eai_osal_status_t eai_osal_thread_get_stats(eai_osal_thread_t *thread,
+					    eai_osal_thread_stats_t *stats)
+{
+	if (thread == NULL || stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	eai_osal_status_t ret = EAI_OSAL_ERROR;
+
+	k_mutex_lock(&registry_lock, K_FOREVER);
+	for (eai_osal_thread_t *it = registry; it != NULL; it = it->_next) {
+		if (it == thread) {
+			thread_snapshot(thread, stats);
+			ret = EAI_OSAL_OK;
+			break;
+		}
+	}
+	k_mutex_unlock(&registry_lock);
+	return ret;
+}
+
+void eai_osal_thread_foreach(eai_osal_thread_stats_cb_t cb, void *arg)
+{
+	eai_osal_thread_stats_t snap;
+
+	if (cb == NULL) {
+		return;
+	}
+
+	/* Re-walk to the i-th entry each round, as eai_osal_stats_foreach() does */
+	for (uint32_t i = 0;; i++) {
+		k_mutex_lock(&registry_lock, K_FOREVER);
+
+		eai_osal_thread_t *thread = registry;
+
+		for (uint32_t j = 0; j < i && thread != NULL; j++) {
+			thread = thread->_next;
+		}
+		if (thread != NULL) {
+			thread_snapshot(thread, &snap);
+		}
+		k_mutex_unlock(&registry_lock);
+
+		if (thread == NULL) {
+			break;
+		}
+		cb(&snap, arg);
+	}
+}
+
+/* ── Threads ─────────────────────────────────────────────────────────── */
+
+static void thread_trampoline(void *entry, void *arg, void *thread)
 {
-	ARG_UNUSED(unused);
 	((eai_osal_thread_entry_t)entry)(arg);
+	registry_remove(thread);
 }
 
 eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
@@ -29,16 +139,19 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 	/* OSAL 0-31 (higher=higher) → Zephyr 31-0 (lower=higher) */
 	int zephyr_prio = 31 - (int)priority;
 
+	thread->_stack_size = stack_size;
+
+	/* Created suspended: named and listed before it can run and return */
 	k_tid_t tid = k_thread_create(&thread->_impl,
 				      (k_thread_stack_t *)stack,
 				      stack_size,
 				      thread_trampoline,
 				      (void *)entry,
 				      arg,
-				      NULL,
+				      thread,
 				      zephyr_prio,
 				      0,
-				      K_NO_WAIT);
+				      K_FOREVER);
 	if (tid == NULL) {
 		return EAI_OSAL_ERROR;
 	}
@@ -47,6 +160,13 @@ eai_osal_status_t eai_osal_thread_create(eai_osal_thread_t *thread,
 		k_thread_name_set(tid, name);
 	}
 
+	k_mutex_lock(&registry_lock, K_FOREVER);
+	thread->_next = registry;
+	registry = thread;
+	k_mutex_unlock(&registry_lock);
+
+	k_thread_start(tid);
+
 	return EAI_OSAL_OK;
 }
 
@@ -59,6 +179,46 @@ eai_osal_status_t eai_osal_thread_join(eai_osal_thread_t *thread,
 	return osal_status(k_thread_join(&thread->_impl, osal_timeout(timeout_ms)));
 }
 
+eai_osal_status_t eai_osal_thread_set_affinity(eai_osal_thread_t *thread,
+					       uint32_t cpu_mask)
+{
+	if (thread == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t all = BIT_MASK(arch_num_cpus());
+
+	cpu_mask &= all;
+	if (cpu_mask == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (cpu_mask == all) {
+		return EAI_OSAL_OK;
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	k_tid_t tid = &thread->_impl;
+
+	/* The mask can only change while the thread is not runnable */
+	if (tid == k_current_get()) {
+		return EAI_OSAL_ERROR;
+	}
+	k_thread_suspend(tid);
+
+	int rc = k_thread_cpu_mask_clear(tid);
+
+	for (unsigned int cpu = 0; rc == 0 && cpu < arch_num_cpus(); cpu++) {
+		if (cpu_mask & BIT(cpu)) {
+			rc = k_thread_cpu_mask_enable(tid, cpu);
+		}
+	}
+	k_thread_resume(tid);
+	return osal_status(rc);
+#else
+	return EAI_OSAL_ERROR;
+#endif
+}
+
 void eai_osal_thread_sleep(uint32_t ms)
 {
 	k_msleep(ms);
@@ -6,6 +6,29 @@ uint32_t eai_osal_time_get_ms(void)
 	return (uint32_t)k_uptime_get();
 }
 
+/*
+ * Sub-millisecond uptime comes from the hardware cycle counter when it
+ * is 64 bits wide; otherwise from kernel ticks, which is as fine as the
+ * uptime clock gets (CONFIG_SYS_CLOCK_TICKS_PER_SEC).
+ */
+uint64_t eai_osal_time_get_us(void)
+{
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+	return k_cyc_to_us_floor64(k_cycle_get_64());
+#else
+	return k_ticks_to_us_floor64(k_uptime_ticks());
+#endif
+}
+
+uint64_t eai_osal_time_get_ns(void)
+{
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+	return k_cyc_to_ns_floor64(k_cycle_get_64());
+#else
+	return k_ticks_to_ns_floor64(k_uptime_ticks());
+#endif
+}
+
 uint64_t eai_osal_time_get_ticks(void)
 {
 	return k_uptime_ticks();
@@ -15,3 +38,13 @@ uint32_t eai_osal_time_ticks_to_ms(uint64_t ticks)
 {
 	return (uint32_t)k_ticks_to_ms_floor64(ticks);
 }
+
+uint32_t eai_osal_cycle_get(void)
+{
+	return k_cycle_get_32();
+}
+
+uint64_t eai_osal_cycles_to_ns(uint32_t cycles)
+{
+	return k_cyc_to_ns_floor64(cycles);
+}
@@ -9,10 +9,72 @@
 
 #include <zephyr/kernel.h>
 
-typedef struct { struct k_mutex _impl; } eai_osal_mutex_t;
-typedef struct { struct k_sem _impl; } eai_osal_sem_t;
-typedef struct { struct k_thread _impl; } eai_osal_thread_t;
-typedef struct { struct k_msgq _impl; } eai_osal_queue_t;
+/*
+ * eai_osal_poll() registration of one event-group entry. Event groups have
+ * no k_poll type, so eai_osal_event_set() raises the signal of every
+ * poller listed on the group.
+ */
+typedef struct osal_poll_node {
+	struct osal_poll_node *_next;
+	struct k_poll_signal *_signal;
+} eai_osal_poll_priv_t;
+
+typedef struct {
+	struct k_mutex _impl;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
+} eai_osal_mutex_t;
+
+typedef struct {
+	struct k_sem _impl;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
+} eai_osal_sem_t;
+
+typedef struct eai_osal_thread {
+	struct k_thread _impl;
+	struct eai_osal_thread *_next; /* stats registry (thread.c) */
+	size_t _stack_size;
+} eai_osal_thread_t;
+typedef struct {
+	struct k_msgq _impl;
+#if CONFIG_EAI_OSAL_QUEUE_STAGE_SIZE > 0
+	/* reserve/commit and peek/release staging (k_msgq copies in and out) */
+	uint8_t _wr_stage[CONFIG_EAI_OSAL_QUEUE_STAGE_SIZE] __aligned(8);
+	uint8_t _rd_stage[CONFIG_EAI_OSAL_QUEUE_STAGE_SIZE] __aligned(8);
+#endif
+	uint32_t _wr_timeout_ms;
+	atomic_t _wr_busy;
+	atomic_t _rd_busy;
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
+} eai_osal_queue_t;
+
+/* Byte pipe — a k_pipe (the k_pipe_read/k_pipe_write API of Zephyr 4.1+) */
+typedef struct {
+	struct k_pipe _impl;
+	size_t _threshold;
+} eai_osal_pipe_t;
+
+/* Reader-writer lock — counts under _lock, hand-offs via semaphores (rwlock.c) */
+typedef struct {
+	struct k_mutex _lock;
+	struct k_sem _read_sem;  /* one give per queued reader let in */
+	struct k_sem _write_sem; /* hand-off to one queued writer */
+	uint32_t _readers;
+	uint32_t _readers_waiting;
+	uint32_t _writers_waiting;
+	bool _writer;
+} eai_osal_rwlock_t;
+
+typedef struct {
+	struct k_mem_slab _impl;
+	atomic_t _high_water;
+	atomic_t _failures;
+} eai_osal_mempool_t;
 
 typedef struct {
 	struct k_timer _impl;
@@ -20,13 +82,31 @@ typedef struct {
 	void *_cb_arg;
 } eai_osal_timer_t;
 
-typedef struct { struct k_event _impl; } eai_osal_event_t;
+typedef struct {
+	struct k_event _impl;
+	struct osal_poll_node *_pollers; /* eai_osal_poll() waiters */
+#ifdef CONFIG_EAI_OSAL_STATS
+	struct osal_stats_rec _stats;
+#endif
+} eai_osal_event_t;
+
 typedef unsigned int eai_osal_critical_key_t;
 
+
+/* Work queue counters, updated by submit and the work trampoline */
+struct osal_wq_counters {
+	atomic_t pending;
+	atomic_t high_water;
+	atomic_t rejected;
+	atomic_t max_latency_us;
+};
+
 typedef struct {
 	struct k_work _impl;
 	eai_osal_work_cb_t _cb;
 	void *_cb_arg;
+	uint32_t _queued_cyc;               /* k_cycle_get_32() at submit */
+	struct osal_wq_counters *_counters; /* NULL when run by a pool */
 } eai_osal_work_t;
 
 typedef struct {
@@ -35,9 +115,41 @@ typedef struct {
 	void *_cb_arg;
 } eai_osal_dwork_t;
 
-typedef struct { struct k_work_q _impl; } eai_osal_workqueue_t;
+/*
+ * Triggered work — a k_work_poll over k_poll events built at submit.
+ * Event group entries share _signal, as in eai_osal_poll() (poll.c).
+ */
+struct eai_osal_poll_event;
+
+typedef struct {
+	struct k_work_poll _impl;
+	struct k_poll_event _kev[CONFIG_EAI_OSAL_POLL_MAX_EVENTS];
+	struct k_poll_signal _signal;
+	int _n_kev;
+	eai_osal_work_cb_t _cb;
+	void *_cb_arg;
+	struct eai_osal_poll_event *_events;
+	size_t _n;
+	struct k_work_q *_queue;
+	k_timepoint_t _end;
+	atomic_t _busy; /* armed or queued */
+} eai_osal_work_poll_t;
+
+typedef struct {
+	struct k_work_q _impl;
+	struct osal_wq_counters _counters;
+} eai_osal_workqueue_t;
+
+/* Work queue pool — one k_work_q per worker, submissions round-robin */
+typedef struct {
+	struct k_work_q _queues[CONFIG_EAI_OSAL_WQ_POOL_MAX_WORKERS];
+	uint32_t _n_workers;
+	atomic_t _next;
+} eai_osal_workqueue_pool_t;
 
 #define EAI_OSAL_THREAD_STACK_DEFINE(name, size) K_THREAD_STACK_DEFINE(name, size)
 #define EAI_OSAL_THREAD_STACK_SIZEOF(name)       K_THREAD_STACK_SIZEOF(name)
+#define EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(name, n, size) \
+	K_THREAD_STACK_ARRAY_DEFINE(name, n, size)
 
 #endif /* EAI_OSAL_ZEPHYR_TYPES_H */
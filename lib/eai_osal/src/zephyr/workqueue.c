@@ -1,12 +1,40 @@
 #include <eai_osal/workqueue.h>
 #include "internal.h"
 
+/*
+ * k_work queues are unbounded intrusive lists, so depth does not apply and
+ * submits are never rejected for lack of room; rejected counts k_work
+ * refusals (queue draining or stopped). pending counts submits that queued
+ * the item and the trampoline that took it off, which is why the counters
+ * pointer lives in the work item. Triggered work is a k_work_poll, which
+ * goes uncounted like delayed work.
+ */
+
+static struct osal_wq_counters sys_counters;
+
+static void counter_max(atomic_t *counter, atomic_val_t val)
+{
+	atomic_val_t cur = atomic_get(counter);
+
+	while (val > cur && !atomic_cas(counter, cur, val)) {
+		cur = atomic_get(counter);
+	}
+}
+
 /* ── Work item trampoline ──────────────────────────────────────────────── */
 
 static void work_trampoline(struct k_work *zwork)
 {
 	eai_osal_work_t *work = CONTAINER_OF(zwork, eai_osal_work_t, _impl);
+	struct osal_wq_counters *counters = work->_counters;
+
+	if (counters != NULL) {
+		uint32_t waited = k_cycle_get_32() - work->_queued_cyc;
 
+		atomic_dec(&counters->pending);
+		counter_max(&counters->max_latency_us,
+			    (atomic_val_t)k_cyc_to_us_floor32(waited));
+	}
 	if (work->_cb != NULL) {
 		work->_cb(work->_cb_arg);
 	}
@@ -21,18 +49,45 @@ eai_osal_status_t eai_osal_work_init(eai_osal_work_t *work,
 	}
 	work->_cb = callback;
 	work->_cb_arg = arg;
+	work->_queued_cyc = 0;
+	work->_counters = NULL;
 	k_work_init(&work->_impl, work_trampoline);
 	return EAI_OSAL_OK;
 }
 
+/* Callable from ISRs, like k_work_submit_to_queue() itself */
+static int submit_counted(eai_osal_work_t *work, struct k_work_q *queue,
+			  struct osal_wq_counters *counters)
+{
+	/* Keep the stamp of a queued item; a running one gets a fresh one */
+	if ((k_work_busy_get(&work->_impl) & K_WORK_QUEUED) == 0) {
+		work->_queued_cyc = k_cycle_get_32();
+	}
+	work->_counters = counters;
+
+	/* Count first so the trampoline never takes pending below zero */
+	atomic_val_t n = atomic_inc(&counters->pending) + 1;
+	int ret = k_work_submit_to_queue(queue, &work->_impl);
+
+	/* k_work_submit returns: 1 = queued, 2 = running/queued, 0 = already queued */
+	if (ret > 0) {
+		counter_max(&counters->high_water, n);
+	} else {
+		atomic_dec(&counters->pending);
+		if (ret < 0) {
+			atomic_inc(&counters->rejected);
+		}
+	}
+	return ret;
+}
+
 eai_osal_status_t eai_osal_work_submit(eai_osal_work_t *work)
 {
 	if (work == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	int ret = k_work_submit(&work->_impl);
+	int ret = submit_counted(work, &k_sys_work_q, &sys_counters);
 
-	/* k_work_submit returns: 1 = queued, 2 = running/queued, 0 = already queued */
 	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
 }
 
@@ -42,7 +97,37 @@ eai_osal_status_t eai_osal_work_submit_to(eai_osal_work_t *work,
 	if (work == NULL || wq == NULL) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
-	int ret = k_work_submit_to_queue(&wq->_impl, &work->_impl);
+	int ret = submit_counted(work, &wq->_impl, &wq->_counters);
+
+	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
+}
+
+/* Never waits: a k_work queue has no capacity to wait for */
+eai_osal_status_t eai_osal_work_submit_timeout(eai_osal_work_t *work,
+					       eai_osal_workqueue_t *wq,
+					       uint32_t timeout_ms)
+{
+	ARG_UNUSED(timeout_ms);
+
+	if (work == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	int ret = wq == NULL ? submit_counted(work, &k_sys_work_q, &sys_counters)
+			     : submit_counted(work, &wq->_impl, &wq->_counters);
+
+	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
+}
+
+/* k_work queues are FIFO: the level is checked, then ignored */
+eai_osal_status_t eai_osal_work_submit_prio(eai_osal_work_t *work,
+					    eai_osal_workqueue_t *wq,
+					    uint8_t prio)
+{
+	if (work == NULL || prio >= EAI_OSAL_PQUEUE_LEVELS) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	int ret = wq == NULL ? submit_counted(work, &k_sys_work_q, &sys_counters)
+			     : submit_counted(work, &wq->_impl, &wq->_counters);
 
 	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
 }
@@ -109,6 +194,105 @@ eai_osal_status_t eai_osal_dwork_cancel(eai_osal_dwork_t *dwork)
 	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
 }
 
+/* ── Triggered work ────────────────────────────────────────────────────── */
+
+/*
+ * A k_work_poll does the waiting. Its handler rescans the entries, since
+ * a k_poll event only says something changed: an event group signal may
+ * be for bits nobody asked for, and another consumer may have got there
+ * first. With nothing ready and time left it submits again.
+ *
+ * The signal is reset before each scan and the event group entries stay
+ * listed throughout, so a set that lands after a scan still fires the
+ * next k_work_poll. Bits already set at submit raise the signal by hand.
+ */
+static int wp_arm(eai_osal_work_poll_t *wp)
+{
+	for (int i = 0; i < wp->_n_kev; i++) {
+		wp->_kev[i].state = K_POLL_STATE_NOT_READY;
+	}
+	return k_work_poll_submit_to_queue(wp->_queue, &wp->_impl, wp->_kev,
+					   wp->_n_kev, sys_timepoint_timeout(wp->_end));
+}
+
+static void wp_trampoline(struct k_work *zwork)
+{
+	struct k_work_poll *zwp = CONTAINER_OF(zwork, struct k_work_poll, work);
+	eai_osal_work_poll_t *wp = CONTAINER_OF(zwp, eai_osal_work_poll_t, _impl);
+
+	k_poll_signal_reset(&wp->_signal);
+	if (!osal_poll_scan(wp->_events, wp->_n) &&
+	    !sys_timepoint_expired(wp->_end) && wp_arm(wp) == 0) {
+		return;
+	}
+	osal_poll_unregister(wp->_events, wp->_n);
+	atomic_clear(&wp->_busy);
+	wp->_cb(wp->_cb_arg);
+}
+
+eai_osal_status_t eai_osal_work_poll_init(eai_osal_work_poll_t *wp,
+					  eai_osal_work_cb_t callback,
+					  void *arg)
+{
+	if (wp == NULL || callback == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	wp->_cb = callback;
+	wp->_cb_arg = arg;
+	wp->_events = NULL;
+	wp->_n = 0;
+	wp->_n_kev = 0;
+	atomic_clear(&wp->_busy);
+	k_poll_signal_init(&wp->_signal);
+	k_work_poll_init(&wp->_impl, wp_trampoline);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_poll_submit(eai_osal_work_poll_t *wp,
+					    eai_osal_workqueue_t *wq,
+					    eai_osal_poll_event_t *events,
+					    size_t n, uint32_t timeout_ms)
+{
+	if (wp == NULL || !osal_poll_valid(events, n)) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	if (!atomic_cas(&wp->_busy, 0, 1)) {
+		return EAI_OSAL_ERROR;
+	}
+
+	wp->_events = events;
+	wp->_n = n;
+	wp->_queue = wq != NULL ? &wq->_impl : &k_sys_work_q;
+	wp->_end = sys_timepoint_calc(osal_timeout(timeout_ms));
+	wp->_n_kev = osal_poll_build(events, n, wp->_kev, &wp->_signal);
+
+	k_poll_signal_reset(&wp->_signal);
+	osal_poll_register(events, n, &wp->_signal);
+	if (osal_poll_scan(events, n)) {
+		k_poll_signal_raise(&wp->_signal, 0);
+	}
+	if (wp_arm(wp) != 0) {
+		osal_poll_unregister(events, n);
+		atomic_clear(&wp->_busy);
+		return EAI_OSAL_ERROR;
+	}
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_poll_cancel(eai_osal_work_poll_t *wp)
+{
+	if (wp == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	/* Fails once triggered: the handler is queued or running */
+	if (!atomic_get(&wp->_busy) || k_work_poll_cancel(&wp->_impl) != 0) {
+		return EAI_OSAL_ERROR;
+	}
+	osal_poll_unregister(wp->_events, wp->_n);
+	atomic_clear(&wp->_busy);
+	return EAI_OSAL_OK;
+}
+
 /* ── Custom work queue ─────────────────────────────────────────────────── */
 
 eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
@@ -117,9 +301,25 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 					    size_t stack_size,
 					    uint8_t priority)
 {
-	if (wq == NULL || stack == NULL || stack_size == 0) {
+	return eai_osal_workqueue_create_with_depth(wq, name, stack, stack_size,
+						    priority,
+						    EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH);
+}
+
+eai_osal_status_t eai_osal_workqueue_create_with_depth(eai_osal_workqueue_t *wq,
+						       const char *name,
+						       void *stack,
+						       size_t stack_size,
+						       uint8_t priority,
+						       uint32_t depth)
+{
+	if (wq == NULL || stack == NULL || stack_size == 0 || depth == 0) {
 		return EAI_OSAL_INVALID_PARAM;
 	}
+	atomic_clear(&wq->_counters.pending);
+	atomic_clear(&wq->_counters.high_water);
+	atomic_clear(&wq->_counters.rejected);
+	atomic_clear(&wq->_counters.max_latency_us);
 
 	int zephyr_prio = 31 - (priority > 31 ? 31 : priority);
 
@@ -132,3 +332,31 @@ eai_osal_status_t eai_osal_workqueue_create(eai_osal_workqueue_t *wq,
 
 	return EAI_OSAL_OK;
 }
+
+/* ── Counters ──────────────────────────────────────────────────────────── */
+
+eai_osal_status_t eai_osal_workqueue_get_stats(eai_osal_workqueue_t *wq,
+					       eai_osal_workqueue_stats_t *stats)
+{
+	if (stats == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+	struct osal_wq_counters *counters = wq ? &wq->_counters : &sys_counters;
+
+	stats->depth = 0;
+	stats->pending = (uint32_t)atomic_get(&counters->pending);
+	stats->high_water = (uint32_t)atomic_get(&counters->high_water);
+	stats->rejected = (uint32_t)atomic_get(&counters->rejected);
+	stats->max_latency_us = (uint32_t)atomic_get(&counters->max_latency_us);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_workqueue_reset_stats(eai_osal_workqueue_t *wq)
+{
+	struct osal_wq_counters *counters = wq ? &wq->_counters : &sys_counters;
+
+	atomic_set(&counters->high_water, atomic_get(&counters->pending));
+	atomic_clear(&counters->rejected);
+	atomic_clear(&counters->max_latency_us);
+	return EAI_OSAL_OK;
+}
@@ -0,0 +1,77 @@
+#include <eai_osal/workqueue.h>
+#include "internal.h"
+
+/*
+ * Zephyr work queue pool — one k_work_q per worker.
+ *
+ * k_work has no stealing, so submissions are spread round-robin. The
+ * kernel already keeps an item from running concurrently with itself: a
+ * k_work that is queued stays where it is, and one that is running is
+ * re-queued to the queue it is running on.
+ */
+
+eai_osal_status_t eai_osal_workqueue_pool_create(eai_osal_workqueue_pool_t *pool,
+						 uint32_t n_workers,
+						 const char *name,
+						 void *stacks,
+						 size_t stack_size,
+						 uint8_t priority)
+{
+	if (pool == NULL || stacks == NULL || stack_size == 0 || n_workers == 0 ||
+	    n_workers > CONFIG_EAI_OSAL_WQ_POOL_MAX_WORKERS) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	int zephyr_prio = 31 - (priority > 31 ? 31 : priority);
+	/* Element stride of K_THREAD_STACK_ARRAY_DEFINE for this stack size */
+	size_t stride = K_THREAD_STACK_LEN(stack_size);
+
+	struct k_work_queue_config cfg = {
+		.name = name,
+	};
+
+	for (uint32_t i = 0; i < n_workers; i++) {
+		k_thread_stack_t *stack =
+			(k_thread_stack_t *)((uint8_t *)stacks + i * stride);
+
+		k_work_queue_init(&pool->_queues[i]);
+		k_work_queue_start(&pool->_queues[i], stack, stack_size,
+				   zephyr_prio, &cfg);
+	}
+
+	pool->_n_workers = n_workers;
+	atomic_set(&pool->_next, 0);
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_workqueue_pool_destroy(eai_osal_workqueue_pool_t *pool)
+{
+	if (pool == NULL) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	for (uint32_t i = 0; i < pool->_n_workers; i++) {
+		k_work_queue_drain(&pool->_queues[i], true);
+		if (k_work_queue_stop(&pool->_queues[i], K_FOREVER) != 0) {
+			return EAI_OSAL_ERROR;
+		}
+	}
+	pool->_n_workers = 0;
+	return EAI_OSAL_OK;
+}
+
+eai_osal_status_t eai_osal_work_submit_to_pool(eai_osal_work_t *work,
+					       eai_osal_workqueue_pool_t *pool)
+{
+	if (work == NULL || pool == NULL || pool->_n_workers == 0) {
+		return EAI_OSAL_INVALID_PARAM;
+	}
+
+	uint32_t idx = (uint32_t)atomic_inc(&pool->_next) % pool->_n_workers;
+
+	work->_counters = NULL;
+	int ret = k_work_submit_to_queue(&pool->_queues[idx], &work->_impl);
+
+	/* 0 = already queued, 1 = queued, 2 = re-queued to its running queue */
+	return ret >= 0 ? EAI_OSAL_OK : EAI_OSAL_ERROR;
+}
@@ -0,0 +1,677 @@
+/*
+ * OSAL POSIX backend micro-benchmarks.
+ *
+ * Not a pass/fail test — prints per-operation cost so backend changes can
+ * be compared before/after on the same host. Run all benchmarks, or name
+ * the ones to run:
+ *
+ *   ./osal_bench
+ *   ./osal_bench dwork spsc
+ */
+
+#include <eai_osal/eai_osal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Helper thread priority. On POSIX, 15 maps to nice 0, level with the
+ * main thread, so handoffs aren't skewed by one side preempting the other.
+ */
+#define BENCH_PRIO 15
+
+static uint64_t bench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void bench_report(const char *name, uint32_t ops, uint64_t elapsed_ns)
+{
+	double ns_per_op = (double)elapsed_ns / ops;
+
+	printf("%-32s %10u ops %10.1f ns/op %12.0f ops/s\n",
+	       name, ops, ns_per_op, 1e9 / ns_per_op);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Delayed work
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define DWORK_OPS 20000
+
+static void dwork_noop(void *arg)
+{
+	(void)arg;
+}
+
+/* Submit + cancel pairs on one item — the debounce-timer pattern */
+static void bench_dwork_submit_cancel(void)
+{
+	eai_osal_dwork_t dwork;
+
+	eai_osal_dwork_init(&dwork, dwork_noop, NULL);
+
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t i = 0; i < DWORK_OPS; i++) {
+		eai_osal_dwork_submit(&dwork, 1000);
+		eai_osal_dwork_cancel(&dwork);
+	}
+	bench_report("dwork submit+cancel", DWORK_OPS, bench_now_ns() - start);
+}
+
+/* Re-arm an already pending item without cancelling first */
+static void bench_dwork_rearm(void)
+{
+	eai_osal_dwork_t dwork;
+
+	eai_osal_dwork_init(&dwork, dwork_noop, NULL);
+
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t i = 0; i < DWORK_OPS; i++) {
+		eai_osal_dwork_submit(&dwork, 1000);
+	}
+	bench_report("dwork re-arm", DWORK_OPS, bench_now_ns() - start);
+	eai_osal_dwork_cancel(&dwork);
+}
+
+static void bench_dwork(void)
+{
+	bench_dwork_submit_cancel();
+	bench_dwork_rearm();
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SPSC ring vs queue — one producer thread, one consumer thread
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define XFER_OPS   1000000
+#define XFER_DEPTH 256
+#define XFER_BATCH 32
+
+static eai_osal_queue_t xfer_queue;
+static eai_osal_spsc_ring_t xfer_ring;
+static uint32_t xfer_buf[XFER_DEPTH];
+
+EAI_OSAL_THREAD_STACK_DEFINE(xfer_stack, 4096);
+
+static void queue_producer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < XFER_OPS; i++) {
+		eai_osal_queue_send(&xfer_queue, &i, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void spsc_producer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < XFER_OPS; i++) {
+		eai_osal_spsc_push(&xfer_ring, &i, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void spsc_bulk_producer(void *arg)
+{
+	(void)arg;
+	uint32_t batch[XFER_BATCH];
+	uint32_t seq = 0;
+
+	while (seq < XFER_OPS) {
+		for (uint32_t j = 0; j < XFER_BATCH; j++) {
+			batch[j] = seq + j;
+		}
+		uint32_t n = eai_osal_spsc_write(&xfer_ring, batch, XFER_BATCH);
+
+		seq += n;
+		if (n == 0) {
+			eai_osal_thread_yield();
+		}
+	}
+}
+
+static void run_xfer(const char *name, eai_osal_thread_entry_t producer,
+		     bool use_queue, bool bulk)
+{
+	eai_osal_thread_t thread;
+	uint32_t batch[XFER_BATCH];
+	uint32_t val;
+
+	uint64_t start = bench_now_ns();
+
+	eai_osal_thread_create(&thread, "producer", producer, NULL, xfer_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(xfer_stack), BENCH_PRIO);
+
+	for (uint32_t got = 0; got < XFER_OPS;) {
+		if (use_queue) {
+			eai_osal_queue_recv(&xfer_queue, &val, EAI_OSAL_WAIT_FOREVER);
+			got++;
+		} else if (bulk) {
+			uint32_t n = eai_osal_spsc_read(&xfer_ring, batch, XFER_BATCH);
+
+			got += n;
+			if (n == 0) {
+				eai_osal_thread_yield();
+			}
+		} else {
+			eai_osal_spsc_pop(&xfer_ring, &val, EAI_OSAL_WAIT_FOREVER);
+			got++;
+		}
+	}
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	bench_report(name, XFER_OPS, bench_now_ns() - start);
+}
+
+static void bench_spsc(void)
+{
+	eai_osal_queue_create(&xfer_queue, sizeof(uint32_t), XFER_DEPTH, xfer_buf);
+	run_xfer("queue send/recv", queue_producer, true, false);
+	eai_osal_queue_destroy(&xfer_queue);
+
+	eai_osal_spsc_create(&xfer_ring, sizeof(uint32_t), XFER_DEPTH, xfer_buf,
+			     true);
+	run_xfer("spsc push/pop (blocking)", spsc_producer, false, false);
+	eai_osal_spsc_destroy(&xfer_ring);
+
+	/* Bulk transfer polls and yields instead of parking, like a mixer loop */
+	eai_osal_spsc_create(&xfer_ring, sizeof(uint32_t), XFER_DEPTH, xfer_buf,
+			     false);
+	run_xfer("spsc write/read x32", spsc_bulk_producer, false, true);
+	eai_osal_spsc_destroy(&xfer_ring);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Batched queue transfer — bursts of XFER_BATCH messages
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void queue_burst_producer(void *arg)
+{
+	(void)arg;
+	uint32_t batch[XFER_BATCH];
+
+	for (uint32_t seq = 0; seq < XFER_OPS; seq += XFER_BATCH) {
+		for (uint32_t j = 0; j < XFER_BATCH; j++) {
+			batch[j] = seq + j;
+			eai_osal_queue_send(&xfer_queue, &batch[j],
+					    EAI_OSAL_WAIT_FOREVER);
+		}
+	}
+}
+
+static void queue_batch_producer(void *arg)
+{
+	(void)arg;
+	uint32_t batch[XFER_BATCH];
+
+	for (uint32_t seq = 0; seq < XFER_OPS; seq += XFER_BATCH) {
+		for (uint32_t j = 0; j < XFER_BATCH; j++) {
+			batch[j] = seq + j;
+		}
+		eai_osal_queue_send_many(&xfer_queue, batch, XFER_BATCH, NULL,
+					 EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void run_batch(const char *name, eai_osal_thread_entry_t producer,
+		      bool batched)
+{
+	eai_osal_thread_t thread;
+	uint32_t batch[XFER_BATCH];
+	uint32_t n;
+
+	eai_osal_queue_create(&xfer_queue, sizeof(uint32_t), XFER_DEPTH, xfer_buf);
+
+	uint64_t start = bench_now_ns();
+
+	eai_osal_thread_create(&thread, "producer", producer, NULL, xfer_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(xfer_stack), BENCH_PRIO);
+
+	for (uint32_t got = 0; got < XFER_OPS; got += n) {
+		if (batched) {
+			eai_osal_queue_recv_many(&xfer_queue, batch, XFER_BATCH, &n,
+						 EAI_OSAL_WAIT_FOREVER);
+		} else {
+			eai_osal_queue_recv(&xfer_queue, batch, EAI_OSAL_WAIT_FOREVER);
+			n = 1;
+		}
+	}
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	bench_report(name, XFER_OPS, bench_now_ns() - start);
+	eai_osal_queue_destroy(&xfer_queue);
+}
+
+static void bench_batch(void)
+{
+	run_batch("queue send/recv x32 burst", queue_burst_producer, false);
+	run_batch("queue send_many/recv_many x32", queue_batch_producer, true);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Byte pipe vs queue of max-size messages — mixed payload sizes
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define STREAM_MSGS  400000
+#define STREAM_MAX   256
+#define STREAM_DEPTH 8
+
+struct stream_msg {
+	uint16_t len;
+	uint8_t data[STREAM_MAX];
+};
+
+/* Both carry the payloads through the same storage */
+static struct stream_msg stream_slots[STREAM_DEPTH];
+static eai_osal_queue_t stream_queue;
+static eai_osal_pipe_t stream_pipe;
+
+/* Mostly short writes and the odd full one, like BLE notifications */
+static uint16_t stream_len(uint32_t i)
+{
+	return i % 8 == 0 ? STREAM_MAX : 20;
+}
+
+static void stream_queue_producer(void *arg)
+{
+	static struct stream_msg msg;
+
+	(void)arg;
+	for (uint32_t i = 0; i < STREAM_MSGS; i++) {
+		msg.len = stream_len(i);
+		msg.data[0] = (uint8_t)i;
+		eai_osal_queue_send(&stream_queue, &msg, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void stream_pipe_producer(void *arg)
+{
+	uint8_t data[STREAM_MAX] = {0};
+
+	(void)arg;
+	for (uint32_t i = 0; i < STREAM_MSGS; i++) {
+		data[0] = (uint8_t)i;
+		eai_osal_pipe_write(&stream_pipe, data, stream_len(i), NULL,
+				    EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void run_stream(const char *name, bool use_pipe)
+{
+	static struct stream_msg msg;
+	eai_osal_thread_t thread;
+	uint64_t total = 0;
+	uint64_t bytes = 0;
+
+	for (uint32_t i = 0; i < STREAM_MSGS; i++) {
+		total += stream_len(i);
+	}
+
+	uint64_t start = bench_now_ns();
+
+	eai_osal_thread_create(&thread, "producer",
+			       use_pipe ? stream_pipe_producer : stream_queue_producer,
+			       NULL, xfer_stack, EAI_OSAL_THREAD_STACK_SIZEOF(xfer_stack),
+			       BENCH_PRIO);
+
+	while (bytes < total) {
+		if (use_pipe) {
+			size_t want = total - bytes < STREAM_MAX ? total - bytes : STREAM_MAX;
+			size_t n;
+
+			eai_osal_pipe_read(&stream_pipe, msg.data, want, &n,
+					   EAI_OSAL_WAIT_FOREVER);
+			bytes += n;
+		} else {
+			eai_osal_queue_recv(&stream_queue, &msg, EAI_OSAL_WAIT_FOREVER);
+			bytes += msg.len;
+		}
+	}
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	bench_report(name, STREAM_MSGS, bench_now_ns() - start);
+}
+
+static void bench_pipe(void)
+{
+	eai_osal_queue_create(&stream_queue, sizeof(struct stream_msg), STREAM_DEPTH,
+			      stream_slots);
+	run_stream("queue of 256 B messages", false);
+	eai_osal_queue_destroy(&stream_queue);
+
+	eai_osal_pipe_create(&stream_pipe, stream_slots, sizeof(stream_slots), 1);
+	run_stream("pipe, threshold 1", true);
+	eai_osal_pipe_destroy(&stream_pipe);
+
+	eai_osal_pipe_create(&stream_pipe, stream_slots, sizeof(stream_slots), 256);
+	run_stream("pipe, threshold 256", true);
+	eai_osal_pipe_destroy(&stream_pipe);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Priority queue vs queue — per-message cost and urgent work latency
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define PQ_OPS     1000000
+#define PQ_BACKLOG 128
+
+static eai_osal_pqueue_t xfer_pqueue;
+static uint8_t xfer_pq_buf[EAI_OSAL_PQUEUE_BUF_SIZE(sizeof(uint32_t), XFER_DEPTH)]
+	__attribute__((aligned(4)));
+
+static void pqueue_producer(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < XFER_OPS; i++) {
+		eai_osal_pqueue_send(&xfer_pqueue, &i, (uint8_t)(i & 3),
+				     EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+/*
+ * Send+recv pairs on one thread with PQ_BACKLOG messages already queued,
+ * so the cost per message shows it doesn't grow with the fill level.
+ */
+static void bench_pqueue_uncontended(void)
+{
+	uint32_t val = 0;
+
+	eai_osal_queue_create(&xfer_queue, sizeof(uint32_t), XFER_DEPTH, xfer_buf);
+	for (uint32_t i = 0; i < PQ_BACKLOG; i++) {
+		eai_osal_queue_send(&xfer_queue, &i, EAI_OSAL_NO_WAIT);
+	}
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t i = 0; i < PQ_OPS; i++) {
+		eai_osal_queue_send(&xfer_queue, &i, EAI_OSAL_NO_WAIT);
+		eai_osal_queue_recv(&xfer_queue, &val, EAI_OSAL_NO_WAIT);
+	}
+	bench_report("queue send+recv", PQ_OPS, bench_now_ns() - start);
+	eai_osal_queue_destroy(&xfer_queue);
+
+	eai_osal_pqueue_create(&xfer_pqueue, sizeof(uint32_t), XFER_DEPTH, xfer_pq_buf);
+	for (uint32_t i = 0; i < PQ_BACKLOG; i++) {
+		eai_osal_pqueue_send(&xfer_pqueue, &i, (uint8_t)(i & 7), EAI_OSAL_NO_WAIT);
+	}
+	start = bench_now_ns();
+	for (uint32_t i = 0; i < PQ_OPS; i++) {
+		eai_osal_pqueue_send(&xfer_pqueue, &i, (uint8_t)(i & 7), EAI_OSAL_NO_WAIT);
+		eai_osal_pqueue_recv(&xfer_pqueue, &val, NULL, EAI_OSAL_NO_WAIT);
+	}
+	bench_report("pqueue send+recv (8 levels)", PQ_OPS, bench_now_ns() - start);
+	eai_osal_pqueue_destroy(&xfer_pqueue);
+}
+
+static void bench_pqueue_xfer(void)
+{
+	eai_osal_thread_t thread;
+	uint32_t val;
+
+	eai_osal_pqueue_create(&xfer_pqueue, sizeof(uint32_t), XFER_DEPTH, xfer_pq_buf);
+
+	uint64_t start = bench_now_ns();
+
+	eai_osal_thread_create(&thread, "producer", pqueue_producer, NULL, xfer_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(xfer_stack), BENCH_PRIO);
+	for (uint32_t got = 0; got < XFER_OPS; got++) {
+		eai_osal_pqueue_recv(&xfer_pqueue, &val, NULL, EAI_OSAL_WAIT_FOREVER);
+	}
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	bench_report("pqueue send/recv (threads)", XFER_OPS, bench_now_ns() - start);
+	eai_osal_pqueue_destroy(&xfer_pqueue);
+}
+
+/*
+ * Submit-to-start latency of one item queued behind a full backlog of
+ * bulk items that each take about URGENT_BULK_US. The worker is held at
+ * a gate while the backlog and the item are queued.
+ */
+#define URGENT_ROUNDS  200
+#define URGENT_BULK    13
+#define URGENT_BULK_US 20
+
+static eai_osal_sem_t urgent_gate;
+static eai_osal_sem_t urgent_done;
+static uint64_t urgent_submit_ns;
+static uint64_t urgent_total_ns;
+
+static void urgent_gate_item(void *arg)
+{
+	(void)arg;
+	eai_osal_sem_take(&urgent_gate, EAI_OSAL_WAIT_FOREVER);
+}
+
+static void urgent_bulk_item(void *arg)
+{
+	(void)arg;
+	uint64_t end = bench_now_ns() + URGENT_BULK_US * 1000;
+
+	while (bench_now_ns() < end) {
+	}
+}
+
+static void urgent_item(void *arg)
+{
+	(void)arg;
+	urgent_total_ns += bench_now_ns() - urgent_submit_ns;
+}
+
+static void urgent_last_item(void *arg)
+{
+	(void)arg;
+	eai_osal_sem_give(&urgent_done);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(urgent_wq_stack, 16384);
+static eai_osal_workqueue_t urgent_wq; /* work queues are never destroyed */
+
+static void bench_pqueue_urgent(const char *name, eai_osal_workqueue_t *wq,
+				uint8_t prio)
+{
+	eai_osal_work_t gate, urgent, last;
+	eai_osal_work_t bulk[URGENT_BULK];
+
+	eai_osal_work_init(&gate, urgent_gate_item, NULL);
+	eai_osal_work_init(&urgent, urgent_item, NULL);
+	eai_osal_work_init(&last, urgent_last_item, NULL);
+	for (int i = 0; i < URGENT_BULK; i++) {
+		eai_osal_work_init(&bulk[i], urgent_bulk_item, NULL);
+	}
+
+	urgent_total_ns = 0;
+	for (uint32_t r = 0; r < URGENT_ROUNDS; r++) {
+		eai_osal_work_submit_to(&gate, wq);
+		for (int i = 0; i < URGENT_BULK; i++) {
+			eai_osal_work_submit_to(&bulk[i], wq);
+		}
+		urgent_submit_ns = bench_now_ns();
+		eai_osal_work_submit_prio(&urgent, wq, prio);
+		eai_osal_work_submit_to(&last, wq);
+		eai_osal_sem_give(&urgent_gate);
+		eai_osal_sem_take(&urgent_done, EAI_OSAL_WAIT_FOREVER);
+	}
+	bench_report(name, URGENT_ROUNDS, urgent_total_ns);
+}
+
+static void bench_pqueue(void)
+{
+	bench_pqueue_uncontended();
+	bench_pqueue_xfer();
+
+	eai_osal_sem_create(&urgent_gate, 0, 1);
+	eai_osal_sem_create(&urgent_done, 0, 1);
+	eai_osal_workqueue_create(&urgent_wq, "urgent_wq", urgent_wq_stack,
+				  EAI_OSAL_THREAD_STACK_SIZEOF(urgent_wq_stack),
+				  BENCH_PRIO);
+	bench_pqueue_urgent("work latency behind 13 (default)", &urgent_wq,
+			    EAI_OSAL_WORK_PRIO_DEFAULT);
+	bench_pqueue_urgent("work latency behind 13 (prio 7)", &urgent_wq,
+			    EAI_OSAL_PQUEUE_LEVELS - 1);
+	eai_osal_sem_destroy(&urgent_gate);
+	eai_osal_sem_destroy(&urgent_done);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Work queue pool scaling — CPU-bound items submitted from outside the pool
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define POOL_ITEMS  4096
+#define POOL_ROUNDS 10
+#define POOL_SPIN   2000 /* ~a few µs of work per item */
+
+static eai_osal_work_t pool_items[POOL_ITEMS];
+static atomic_uint pool_done;
+static volatile uint32_t pool_sink;
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(pool_stacks, 8, 4096);
+
+static void pool_item(void *arg)
+{
+	uint32_t x = (uint32_t)(uintptr_t)arg;
+
+	for (uint32_t i = 0; i < POOL_SPIN; i++) {
+		x = x * 1664525u + 1013904223u;
+	}
+	pool_sink = x;
+	atomic_fetch_add_explicit(&pool_done, 1, memory_order_release);
+}
+
+static void bench_pool_workers(uint32_t n_workers)
+{
+	eai_osal_workqueue_pool_t pool;
+	char name[32];
+
+	eai_osal_workqueue_pool_create(&pool, n_workers, "bench", pool_stacks,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+				       BENCH_PRIO);
+	for (uint32_t i = 0; i < POOL_ITEMS; i++) {
+		eai_osal_work_init(&pool_items[i], pool_item, (void *)(uintptr_t)i);
+	}
+
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t r = 0; r < POOL_ROUNDS; r++) {
+		atomic_store(&pool_done, 0);
+		for (uint32_t i = 0; i < POOL_ITEMS; i++) {
+			eai_osal_work_submit_to_pool(&pool_items[i], &pool);
+		}
+		while (atomic_load_explicit(&pool_done, memory_order_acquire) <
+		       POOL_ITEMS) {
+			eai_osal_thread_yield();
+		}
+	}
+
+	snprintf(name, sizeof(name), "pool %u worker%s", n_workers,
+		 n_workers == 1 ? "" : "s");
+	bench_report(name, POOL_ITEMS * POOL_ROUNDS, bench_now_ns() - start);
+	eai_osal_workqueue_pool_destroy(&pool);
+}
+
+static void bench_pool(void)
+{
+	for (uint32_t n = 1; n <= 8; n *= 2) {
+		bench_pool_workers(n);
+	}
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Sync primitives — uncontended fast paths and a two-thread ping-pong
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define SYNC_OPS     1000000
+#define PINGPONG_OPS 100000
+
+static eai_osal_sem_t ping_sem;
+static eai_osal_sem_t pong_sem;
+
+EAI_OSAL_THREAD_STACK_DEFINE(pong_stack, 4096);
+
+static void pong_thread(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < PINGPONG_OPS; i++) {
+		eai_osal_sem_take(&ping_sem, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_sem_give(&pong_sem);
+	}
+}
+
+static void bench_sync(void)
+{
+	eai_osal_sem_t sem;
+	eai_osal_event_t event;
+	eai_osal_thread_t thread;
+	uint32_t bits;
+
+	eai_osal_sem_create(&sem, 0, SYNC_OPS);
+	uint64_t start = bench_now_ns();
+
+	for (uint32_t i = 0; i < SYNC_OPS; i++) {
+		eai_osal_sem_give(&sem);
+		eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT);
+	}
+	bench_report("sem give+take", SYNC_OPS, bench_now_ns() - start);
+	eai_osal_sem_destroy(&sem);
+
+	/* Set with no waiter parked, then an already-satisfied wait */
+	eai_osal_event_create(&event);
+	start = bench_now_ns();
+	for (uint32_t i = 0; i < SYNC_OPS; i++) {
+		eai_osal_event_set(&event, 0x1);
+		eai_osal_event_wait(&event, 0x1, false, &bits, EAI_OSAL_NO_WAIT);
+	}
+	bench_report("event set+wait", SYNC_OPS, bench_now_ns() - start);
+	eai_osal_event_destroy(&event);
+
+	eai_osal_sem_create(&ping_sem, 0, 1);
+	eai_osal_sem_create(&pong_sem, 0, 1);
+	start = bench_now_ns();
+	eai_osal_thread_create(&thread, "pong", pong_thread, NULL, pong_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(pong_stack), BENCH_PRIO);
+	for (uint32_t i = 0; i < PINGPONG_OPS; i++) {
+		eai_osal_sem_give(&ping_sem);
+		eai_osal_sem_take(&pong_sem, EAI_OSAL_WAIT_FOREVER);
+	}
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	bench_report("sem ping-pong", PINGPONG_OPS, bench_now_ns() - start);
+	eai_osal_sem_destroy(&ping_sem);
+	eai_osal_sem_destroy(&pong_sem);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Runner
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static const struct {
+	const char *name;
+	void (*fn)(void);
+} benches[] = {
+	{ "dwork",  bench_dwork },
+	{ "spsc",   bench_spsc },
+	{ "batch",  bench_batch },
+	{ "pipe",   bench_pipe },
+	{ "pqueue", bench_pqueue },
+	{ "pool",   bench_pool },
+	{ "sync",   bench_sync },
+};
+
+int main(int argc, char **argv)
+{
+	for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+		bool run = argc < 2;
+
+		for (int a = 1; a < argc; a++) {
+			if (strcmp(argv[a], benches[i].name) == 0) {
+				run = true;
+			}
+		}
+		if (run) {
+			benches[i].fn();
+		}
+	}
+	return 0;
+}
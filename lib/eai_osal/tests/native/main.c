@@ -1,26 +1,37 @@
 /*
  * OSAL POSIX backend tests — ported from ESP-IDF Unity tests.
  *
- * 44 tests across 9 suites: mutex, semaphore, thread, queue, timer,
- * event, critical, time, work.
+ * 115 tests across 19 suites: mutex, semaphore, thread, queue, timer,
+ * event, critical, time, work, spsc, stats, mempool, buf, poll, rwlock,
+ * atomic, pqueue, task, pipe.
  *
  * FreeRTOS-specific helpers replaced with OSAL semaphores (since
  * the semaphore is tested before any test that uses it as a helper).
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_getname_np, pthread_getaffinity_np */
+#endif
+
 #include "unity.h"
 #include <eai_osal/eai_osal.h>
+#include <errno.h>
 #include <string.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
 /* Unity requires setUp/tearDown */
 void setUp(void) {}
 void tearDown(void) {}
 
-/* Helper: sleep for ms */
+/* Helper: sleep for ms (a real sleep would stall the virtual clock) */
 static void test_sleep_ms(uint32_t ms)
 {
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+	eai_osal_thread_sleep(ms);
+#else
 	usleep((useconds_t)ms * 1000);
+#endif
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
@@ -156,7 +167,7 @@ static void test_sem_give_at_limit(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Thread tests (4)
+ * Thread tests (9)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static volatile int thread_counter;
@@ -208,12 +219,12 @@ static void test_thread_yield(void)
  * execute at different OSAL priority levels.
  */
 static eai_osal_sem_t prio_gate;
-static volatile int prio_exec_count;
+static eai_osal_sem_t prio_started;
 
 static void prio_thread_entry_gated(void *arg)
 {
 	(void)arg;
-	__atomic_fetch_add(&prio_exec_count, 1, __ATOMIC_SEQ_CST);
+	eai_osal_sem_give(&prio_started);
 	eai_osal_sem_take(&prio_gate, EAI_OSAL_WAIT_FOREVER);
 }
 
@@ -223,8 +234,8 @@ EAI_OSAL_THREAD_STACK_DEFINE(prio_stack_b, 2048);
 static void test_thread_priority(void)
 {
 	eai_osal_thread_t thread_lo, thread_hi;
-	prio_exec_count = 0;
 	eai_osal_sem_create(&prio_gate, 0, 2);
+	eai_osal_sem_create(&prio_started, 0, 2);
 
 	eai_osal_thread_create(&thread_lo, "lo", prio_thread_entry_gated,
 			       NULL, prio_stack_a,
@@ -234,11 +245,9 @@ static void test_thread_priority(void)
 			       NULL, prio_stack_b,
 			       EAI_OSAL_THREAD_STACK_SIZEOF(prio_stack_b), 20);
 
-	/* Give threads time to start */
-	test_sleep_ms(50);
-
 	/* Verify both threads executed (regardless of priority ordering) */
-	TEST_ASSERT_EQUAL(2, prio_exec_count);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&prio_started, 500));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&prio_started, 500));
 
 	/* Release both threads and clean up */
 	eai_osal_sem_give(&prio_gate);
@@ -246,11 +255,177 @@ static void test_thread_priority(void)
 
 	eai_osal_thread_join(&thread_lo, EAI_OSAL_WAIT_FOREVER);
 	eai_osal_thread_join(&thread_hi, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_sem_destroy(&prio_started);
+	eai_osal_sem_destroy(&prio_gate);
+}
+
+/* Scheduling as seen from inside the thread */
+static char sched_name[16];
+static int sched_policy;
+static int sched_nice;
+
+static void sched_probe_entry(void *arg)
+{
+	struct sched_param sp;
+
+	(void)arg;
+	pthread_getname_np(pthread_self(), sched_name, sizeof(sched_name));
+	pthread_getschedparam(pthread_self(), &sched_policy, &sp);
+	errno = 0;
+	sched_nice = getpriority(PRIO_PROCESS, 0);
+}
+
+static void test_thread_name_and_low_priority(void)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_thread_create(&thread, "osal_name_is_truncated",
+			       sched_probe_entry, NULL, test_thread_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(test_thread_stack), 0);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+
+	TEST_ASSERT_EQUAL_STRING("osal_name_is_tr", sched_name);
+	TEST_ASSERT_EQUAL(SCHED_OTHER, sched_policy);
+#if defined(__linux__)
+	/* Lowering priority never needs privileges */
+	TEST_ASSERT_EQUAL(10, sched_nice);
+#endif
+}
+
+static void test_thread_high_priority(void)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_thread_create(&thread, "hi", sched_probe_entry, NULL,
+			       test_thread_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(test_thread_stack), 31);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+
+	/* Real-time if permitted, otherwise a nice value no lower than default */
+	if (sched_policy != SCHED_FIFO) {
+		TEST_ASSERT_EQUAL(SCHED_OTHER, sched_policy);
+#if defined(__linux__)
+		TEST_ASSERT_TRUE(sched_nice <= 0);
+#endif
+	}
+}
+
+static void test_thread_set_affinity(void)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_sem_create(&prio_gate, 0, 1);
+	eai_osal_sem_create(&prio_started, 0, 1);
+	eai_osal_thread_create(&thread, "pinned", prio_thread_entry_gated, NULL,
+			       prio_stack_a,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(prio_stack_a), 10);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_thread_set_affinity(&thread, 0));
+#if defined(__linux__)
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_thread_set_affinity(&thread, 0x1));
+
+	cpu_set_t set;
+
+	pthread_getaffinity_np(thread._handle, sizeof(set), &set);
+	TEST_ASSERT_EQUAL(1, CPU_COUNT(&set));
+	TEST_ASSERT_TRUE(CPU_ISSET(0, &set));
+#endif
+
+	eai_osal_sem_give(&prio_gate);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_sem_destroy(&prio_started);
+	eai_osal_sem_destroy(&prio_gate);
+}
+
+static eai_osal_sem_t stats_ready;
+
+/* Touch 4 KiB of stack and burn some CPU, then park on prio_gate */
+static void stats_thread_entry(void *arg)
+{
+	volatile uint8_t buf[4096];
+	volatile uint32_t acc = 0;
+
+	(void)arg;
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)i;
+	}
+	for (uint32_t i = 0; i < 2000000; i++) {
+		acc += i ^ buf[i & 4095];
+	}
+	eai_osal_sem_give(&stats_ready);
+	eai_osal_sem_take(&prio_gate, EAI_OSAL_WAIT_FOREVER);
+}
+
+static void test_thread_stats(void)
+{
+	eai_osal_thread_t thread;
+	eai_osal_thread_stats_t st;
+
+	eai_osal_sem_create(&prio_gate, 0, 1);
+	eai_osal_sem_create(&stats_ready, 0, 1);
+	eai_osal_thread_create(&thread, "stats", stats_thread_entry, NULL,
+			       prio_stack_a,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(prio_stack_a), 10);
+	eai_osal_sem_take(&stats_ready, EAI_OSAL_WAIT_FOREVER);
+	test_sleep_ms(20); /* let it park on the gate */
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_thread_get_stats(&thread, NULL));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_thread_get_stats(&thread, &st));
+	TEST_ASSERT_EQUAL_STRING("stats", st.name);
+	TEST_ASSERT_TRUE(st.stack_size >= 16384);
+#if defined(__linux__)
+	TEST_ASSERT_TRUE(st.runtime_ns > 0);
+	TEST_ASSERT_TRUE(st.switches >= 1);
+	TEST_ASSERT_TRUE(st.stack_used >= 4096);
+	TEST_ASSERT_TRUE(st.stack_used <= st.stack_size);
+#endif
+
+	eai_osal_sem_give(&prio_gate);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_thread_get_stats(&thread, &st));
+	eai_osal_sem_destroy(&stats_ready);
+	eai_osal_sem_destroy(&prio_gate);
+}
+
+static void count_stats_threads(const eai_osal_thread_stats_t *st, void *arg)
+{
+	if (strncmp(st->name, "st_", 3) == 0) {
+		(*(int *)arg)++;
+	}
+}
+
+static void test_thread_foreach(void)
+{
+	eai_osal_thread_t thread_a, thread_b;
+	int found = 0;
+
+	eai_osal_sem_create(&prio_gate, 0, 2);
+	eai_osal_sem_create(&prio_started, 0, 2);
+	eai_osal_thread_create(&thread_a, "st_a", prio_thread_entry_gated, NULL,
+			       prio_stack_a,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(prio_stack_a), 10);
+	eai_osal_thread_create(&thread_b, "st_b", prio_thread_entry_gated, NULL,
+			       prio_stack_b,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(prio_stack_b), 10);
+
+	eai_osal_thread_foreach(count_stats_threads, &found);
+	TEST_ASSERT_EQUAL(2, found);
+
+	eai_osal_sem_give(&prio_gate);
+	eai_osal_sem_give(&prio_gate);
+	eai_osal_thread_join(&thread_a, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_thread_join(&thread_b, EAI_OSAL_WAIT_FOREVER);
+
+	found = 0;
+	eai_osal_thread_foreach(count_stats_threads, &found);
+	TEST_ASSERT_EQUAL(0, found);
+	eai_osal_sem_destroy(&prio_started);
 	eai_osal_sem_destroy(&prio_gate);
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Queue tests (5)
+ * Queue tests (12)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static uint8_t __attribute__((aligned(4))) queue_buf_4[4 * sizeof(int)];
@@ -329,8 +504,198 @@ static void test_queue_empty_timeout(void)
 	eai_osal_queue_destroy(&queue);
 }
 
+static void test_queue_reserve_commit(void)
+{
+	eai_osal_queue_t queue;
+	void *slot;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT));
+	*(int *)slot = 7;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_commit(&queue, slot));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_peek(&queue, &slot, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(7, *(int *)slot);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_release(&queue, slot));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_peek(&queue, &slot, EAI_OSAL_NO_WAIT));
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_reserve_outstanding(void)
+{
+	eai_osal_queue_t queue;
+	void *wr, *rd, *other;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_reserve(&queue, &wr, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR,
+			  eai_osal_queue_reserve(&queue, &other, EAI_OSAL_NO_WAIT));
+	*(int *)wr = 1;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_commit(&queue, wr));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_queue_commit(&queue, wr));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_peek(&queue, &rd, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR,
+			  eai_osal_queue_peek(&queue, &other, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_release(&queue, rd));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_queue_release(&queue, rd));
+
+	eai_osal_queue_destroy(&queue);
+}
+
+/* POSIX slots live in the caller's ring buffer and keep FIFO order */
+static void test_queue_zero_copy_in_place(void)
+{
+	eai_osal_queue_t queue;
+	int msg = 1;
+	void *slot;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	eai_osal_queue_send(&queue, &msg, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_TRUE((uint8_t *)slot >= queue_buf_4 &&
+			 (uint8_t *)slot < queue_buf_4 + sizeof(queue_buf_4));
+	*(int *)slot = 2;
+	eai_osal_queue_commit(&queue, slot);
+	msg = 3;
+	eai_osal_queue_send(&queue, &msg, EAI_OSAL_NO_WAIT);
+
+	for (int i = 1; i <= 3; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_queue_peek(&queue, &slot, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_TRUE((uint8_t *)slot >= queue_buf_4 &&
+				 (uint8_t *)slot < queue_buf_4 + sizeof(queue_buf_4));
+		TEST_ASSERT_EQUAL(i, *(int *)slot);
+		eai_osal_queue_release(&queue, slot);
+	}
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_send_recv_many(void)
+{
+	eai_osal_queue_t queue;
+	int in[3] = {1, 2, 3};
+	int out[4] = {0};
+	uint32_t n = 0;
+	int msg = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	/* Offset the ring so the batch wraps around the end of the buffer */
+	eai_osal_queue_send(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_recv(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_recv(&queue, &msg, EAI_OSAL_NO_WAIT);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_send_many(&queue, in, 3, &n,
+						   EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(3, n);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_recv_many(&queue, out, 4, &n,
+						   EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(3, n);
+	TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 3);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_recv_many(&queue, out, 4, &n, 50));
+	TEST_ASSERT_EQUAL(0, n);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_send_many_partial(void)
+{
+	eai_osal_queue_t queue;
+	int in[6] = {1, 2, 3, 4, 5, 6};
+	int out[4] = {0};
+	uint32_t n = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_send_many(&queue, in, 6, &n, 50));
+	TEST_ASSERT_EQUAL(4, n);
+
+	eai_osal_queue_recv_many(&queue, out, 4, &n, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(4, n);
+	TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 4);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static void test_queue_drain_timeout(void)
+{
+	eai_osal_queue_t queue;
+	int in[2] = {7, 8};
+	int out[4] = {0};
+	uint32_t n = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+	eai_osal_queue_send_many(&queue, in, 2, NULL, EAI_OSAL_NO_WAIT);
+
+	uint32_t start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_queue_drain(&queue, out, 4, &n, 50));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	/* Partial batch is still delivered after waiting out the timeout */
+	TEST_ASSERT_EQUAL(2, n);
+	TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 2);
+	TEST_ASSERT_GREATER_OR_EQUAL(40, elapsed);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+static eai_osal_queue_t drain_queue;
+
+static void drain_producer_entry(void *arg)
+{
+	(void)arg;
+	for (int i = 0; i < 4; i++) {
+		test_sleep_ms(10);
+		eai_osal_queue_send(&drain_queue, &i, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(drain_stack, 2048);
+
+static void test_queue_drain_collects(void)
+{
+	eai_osal_thread_t thread;
+	int out[4] = {0};
+	int expect[4] = {0, 1, 2, 3};
+	uint32_t n = 0;
+
+	eai_osal_queue_create(&drain_queue, sizeof(int), 4, queue_buf_4);
+	eai_osal_thread_create(&thread, "drain", drain_producer_entry, NULL,
+			       drain_stack, EAI_OSAL_THREAD_STACK_SIZEOF(drain_stack),
+			       10);
+
+	/* Messages trickle in one at a time; drain keeps collecting */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_drain(&drain_queue, out, 4, &n, 1000));
+	TEST_ASSERT_EQUAL(4, n);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expect, out, 4);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_queue_destroy(&drain_queue);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Timer tests (5)
+ * Timer tests (7)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static eai_osal_sem_t timer_sem;
@@ -427,6 +792,60 @@ static void test_timer_is_running(void)
 	eai_osal_timer_destroy(&timer);
 }
 
+/*
+ * Periodic phase must not drift with callback runtime: a 20ms timer whose
+ * callback burns 10ms still fires every 20ms, not every 30ms.
+ */
+static void slow_timer_callback(void *arg)
+{
+	(void)arg;
+	__atomic_fetch_add(&timer_count, 1, __ATOMIC_SEQ_CST);
+	test_sleep_ms(10);
+}
+
+static void test_timer_periodic_no_drift(void)
+{
+	eai_osal_timer_t timer;
+	timer_count = 0;
+
+	eai_osal_timer_create(&timer, slow_timer_callback, NULL);
+	eai_osal_timer_start(&timer, 20, 20);
+
+	test_sleep_ms(410);
+	eai_osal_timer_stop(&timer);
+	eai_osal_timer_destroy(&timer);
+
+	TEST_ASSERT_GREATER_OR_EQUAL(18, timer_count);
+	TEST_ASSERT_LESS_OR_EQUAL(21, timer_count);
+}
+
+/* Many concurrent timers share one service thread */
+#define MANY_TIMERS 200
+
+static void test_timer_many(void)
+{
+	static eai_osal_timer_t timers[MANY_TIMERS];
+	timer_count = 0;
+	eai_osal_sem_create(&timer_sem, 0, MANY_TIMERS);
+
+	for (int i = 0; i < MANY_TIMERS; i++) {
+		eai_osal_timer_create(&timers[i], timer_callback, NULL);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_timer_start(&timers[i],
+						       10 + (uint32_t)(i % 40), 0));
+	}
+	for (int i = 0; i < MANY_TIMERS; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&timer_sem, 500));
+	}
+	TEST_ASSERT_EQUAL(MANY_TIMERS, timer_count);
+
+	for (int i = 0; i < MANY_TIMERS; i++) {
+		TEST_ASSERT_FALSE(eai_osal_timer_is_running(&timers[i]));
+		eai_osal_timer_destroy(&timers[i]);
+	}
+	eai_osal_sem_destroy(&timer_sem);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Event tests (5)
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -529,7 +948,7 @@ static void test_critical_nested(void)
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * Time tests (3)
+ * Time tests (5, plus 2 in virtual-time builds)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static void test_time_get_ms(void)
@@ -556,8 +975,84 @@ static void test_time_tick_roundtrip(void)
 	TEST_ASSERT_INT_WITHIN(10, 0, diff);
 }
 
+static void test_time_us_ns(void)
+{
+	uint32_t ms = eai_osal_time_get_ms();
+	uint64_t us = eai_osal_time_get_us();
+	uint64_t ns = eai_osal_time_get_ns();
+
+	/* Same clock at three resolutions */
+	TEST_ASSERT_UINT32_WITHIN(2, ms, (uint32_t)(us / 1000));
+	TEST_ASSERT_TRUE(ns / 1000 >= us);
+	TEST_ASSERT_TRUE(ns / 1000 - us < 1000);
+
+	test_sleep_ms(2);
+	uint64_t us2 = eai_osal_time_get_us();
+
+	TEST_ASSERT_TRUE(us2 - us >= 2000);
+	TEST_ASSERT_TRUE(eai_osal_time_get_ns() > ns);
+}
+
+static void test_time_cycles(void)
+{
+	uint32_t c0 = eai_osal_cycle_get();
+	test_sleep_ms(5);
+	uint32_t c1 = eai_osal_cycle_get();
+
+	uint64_t ns = eai_osal_cycles_to_ns(c1 - c0);
+
+	TEST_ASSERT_TRUE(ns >= 5000000);
+	TEST_ASSERT_TRUE(ns < 500000000);
+}
+
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+/* Virtual time lands exactly on deadlines, however long they are */
+static void test_vt_waits_exact(void)
+{
+	eai_osal_sem_t sem;
+	uint64_t t0 = eai_osal_time_get_ns();
+
+	eai_osal_thread_sleep(3600 * 1000);
+	TEST_ASSERT_EQUAL_UINT64(t0 + 3600ULL * 1000000000ULL, eai_osal_time_get_ns());
+
+	eai_osal_sem_create(&sem, 0, 1);
+	t0 = eai_osal_time_get_ns();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&sem, 250));
+	TEST_ASSERT_EQUAL_UINT64(t0 + 250000000ULL, eai_osal_time_get_ns());
+	eai_osal_sem_destroy(&sem);
+}
+
+static volatile uint32_t vt_ticks;
+static volatile uint64_t vt_last_tick_ns;
+
+static void vt_tick(void *arg)
+{
+	(void)arg;
+	vt_ticks++;
+	vt_last_tick_ns = eai_osal_time_get_ns();
+}
+
+static void test_vt_timer_exact(void)
+{
+	eai_osal_timer_t timer;
+
+	vt_ticks = 0;
+	eai_osal_timer_create(&timer, vt_tick, NULL);
+
+	uint64_t t0 = eai_osal_time_get_ns();
+
+	eai_osal_timer_start(&timer, 100, 100);
+	eai_osal_thread_sleep(1050);
+	eai_osal_timer_stop(&timer);
+
+	TEST_ASSERT_EQUAL(10, vt_ticks);
+	TEST_ASSERT_EQUAL_UINT64(t0 + 1000000000ULL, vt_last_tick_ns);
+	eai_osal_timer_destroy(&timer);
+}
+#endif
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * Work queue tests (9)
+ * Work queue tests (19)
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 static eai_osal_sem_t work_sem;
@@ -669,6 +1164,28 @@ static void test_dwork_cancel(void)
 	eai_osal_sem_destroy(&work_sem);
 }
 
+/* Re-submitting a pending item re-arms it — it still runs only once */
+static void test_dwork_resubmit(void)
+{
+	eai_osal_dwork_t dwork;
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 5);
+
+	eai_osal_dwork_init(&dwork, work_callback, NULL);
+	for (int i = 0; i < 5; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_dwork_submit(&dwork, 50));
+		test_sleep_ms(10);
+	}
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&work_sem, 500));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&work_sem, 100));
+	TEST_ASSERT_EQUAL(1, work_counter);
+
+	/* Sync with the timer service before dwork leaves the stack */
+	eai_osal_dwork_cancel(&dwork);
+	eai_osal_sem_destroy(&work_sem);
+}
+
 /* Custom work queue — static, persists across tests */
 EAI_OSAL_THREAD_STACK_DEFINE(custom_wq_stack, 2048);
 static eai_osal_workqueue_t test_wq;
@@ -719,48 +1236,2602 @@ static void test_dwork_submit_to_queue(void)
 	eai_osal_sem_destroy(&work_sem);
 }
 
-/* ═══════════════════════════════════════════════════════════════════════════
- * Test runner
- * ═══════════════════════════════════════════════════════════════════════════ */
+/* Bounded work queue — depth 2, its worker parked in a gate item */
+EAI_OSAL_THREAD_STACK_DEFINE(depth_wq_stack, 2048);
+static eai_osal_workqueue_t depth_wq;
+static bool depth_wq_started;
+static eai_osal_sem_t wq_gate;
 
-int main(void)
+static void wq_gate_callback(void *arg)
 {
-	UNITY_BEGIN();
+	(void)arg;
+	eai_osal_sem_take(&wq_gate, 2000);
+}
 
-	/* Mutex (6) */
-	RUN_TEST(test_mutex_create_destroy);
-	RUN_TEST(test_mutex_lock_unlock);
-	RUN_TEST(test_mutex_recursive_lock);
-	RUN_TEST(test_mutex_try_lock);
-	RUN_TEST(test_mutex_contention_timeout);
-	RUN_TEST(test_mutex_null_param);
+static void wq_release_callback(void *arg)
+{
+	(void)arg;
+	eai_osal_sem_give(&wq_gate);
+}
 
-	/* Semaphore (5) */
-	RUN_TEST(test_sem_create_destroy);
+static void depth_wq_block(eai_osal_work_t *gate)
+{
+	eai_osal_workqueue_stats_t stats;
+
+	if (!depth_wq_started) {
+		eai_osal_workqueue_create_with_depth(&depth_wq, "depth_wq",
+						     depth_wq_stack,
+						     EAI_OSAL_THREAD_STACK_SIZEOF(depth_wq_stack),
+						     10, 2);
+		depth_wq_started = true;
+	}
+	eai_osal_sem_create(&wq_gate, 0, 1);
+	eai_osal_work_init(gate, wq_gate_callback, NULL);
+	eai_osal_work_submit_to(gate, &depth_wq);
+
+	/* Wait for the worker to take the gate item off the queue */
+	for (int i = 0; i < 100; i++) {
+		eai_osal_workqueue_get_stats(&depth_wq, &stats);
+		if (stats.pending == 0) {
+			break;
+		}
+		test_sleep_ms(5);
+	}
+	eai_osal_workqueue_reset_stats(&depth_wq);
+}
+
+static void test_workqueue_depth_backpressure(void)
+{
+	eai_osal_work_t gate, items[3];
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 3);
+	depth_wq_block(&gate);
+
+	for (int i = 0; i < 3; i++) {
+		eai_osal_work_init(&items[i], work_callback, NULL);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&items[0], &depth_wq));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&items[1], &depth_wq));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_work_submit_to(&items[2], &depth_wq));
+
+	uint32_t start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_work_submit_timeout(&items[2], &depth_wq, 30));
+	TEST_ASSERT_GREATER_OR_EQUAL(25, eai_osal_time_get_ms() - start);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_workqueue_get_stats(&depth_wq, &stats));
+	TEST_ASSERT_EQUAL(2, stats.depth);
+	TEST_ASSERT_EQUAL(2, stats.pending);
+	TEST_ASSERT_EQUAL(2, stats.high_water);
+	TEST_ASSERT_EQUAL(2, stats.rejected);
+
+	eai_osal_sem_give(&wq_gate);
+	eai_osal_sem_take(&work_sem, 500);
+	eai_osal_sem_take(&work_sem, 500);
+	TEST_ASSERT_EQUAL(2, work_counter);
+
+	eai_osal_sem_destroy(&wq_gate);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* A blocking submit waits for the worker to make room */
+static void test_work_submit_timeout_waits(void)
+{
+	eai_osal_work_t gate, items[3];
+	eai_osal_dwork_t release;
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 3);
+	depth_wq_block(&gate);
+
+	for (int i = 0; i < 3; i++) {
+		eai_osal_work_init(&items[i], work_callback, NULL);
+	}
+	eai_osal_work_submit_to(&items[0], &depth_wq);
+	eai_osal_work_submit_to(&items[1], &depth_wq);
+
+	/* Open the gate from the system queue while the third submit waits */
+	eai_osal_dwork_init(&release, wq_release_callback, NULL);
+	eai_osal_dwork_submit(&release, 50);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_submit_timeout(&items[2], &depth_wq, 1000));
+
+	for (int i = 0; i < 3; i++) {
+		eai_osal_sem_take(&work_sem, 500);
+	}
+	TEST_ASSERT_EQUAL(3, work_counter);
+
+	eai_osal_workqueue_get_stats(&depth_wq, &stats);
+	TEST_ASSERT_EQUAL(0, stats.rejected);
+
+	eai_osal_sem_destroy(&wq_gate);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* Delayed work held up by a full queue runs once and counts one reject */
+static void test_dwork_full_queue_retry(void)
+{
+	eai_osal_work_t gate, items[2];
+	eai_osal_dwork_t dwork;
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 3);
+	depth_wq_block(&gate);
+
+	for (int i = 0; i < 2; i++) {
+		eai_osal_work_init(&items[i], work_callback, NULL);
+		eai_osal_work_submit_to(&items[i], &depth_wq);
+	}
+	eai_osal_dwork_init(&dwork, work_callback, NULL);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_dwork_submit_to(&dwork, &depth_wq, 10));
+
+	/* Expires at 10 ms, then retries every millisecond while full */
+	test_sleep_ms(60);
+	eai_osal_workqueue_get_stats(&depth_wq, &stats);
+	TEST_ASSERT_EQUAL(2, stats.pending);
+	TEST_ASSERT_EQUAL(1, stats.rejected);
+
+	eai_osal_sem_give(&wq_gate);
+	for (int i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&work_sem, 500));
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&work_sem, 50));
+	TEST_ASSERT_EQUAL(3, work_counter);
+
+	eai_osal_workqueue_get_stats(&depth_wq, &stats);
+	TEST_ASSERT_EQUAL(1, stats.rejected);
+
+	eai_osal_dwork_cancel(&dwork);
+	eai_osal_sem_destroy(&wq_gate);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+static void test_workqueue_stats_latency(void)
+{
+	eai_osal_work_t gate, work;
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 1);
+	depth_wq_block(&gate);
+
+	eai_osal_work_init(&work, work_callback, NULL);
+	eai_osal_work_submit_to(&work, &depth_wq);
+	test_sleep_ms(30);
+	eai_osal_sem_give(&wq_gate);
+	eai_osal_sem_take(&work_sem, 500);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_workqueue_get_stats(&depth_wq, &stats));
+	TEST_ASSERT_EQUAL(0, stats.pending);
+	TEST_ASSERT_EQUAL(1, stats.high_water);
+	TEST_ASSERT_GREATER_OR_EQUAL(25000, stats.max_latency_us);
+
+	/* NULL reads the system work queue */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_workqueue_get_stats(NULL, &stats));
+	TEST_ASSERT_EQUAL(EAI_OSAL_WORKQUEUE_DEFAULT_DEPTH, stats.depth);
+
+	eai_osal_sem_destroy(&wq_gate);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* Work queue pool */
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(pool_stacks, 2, 2048);
+
+#define POOL_ITEMS 16
+
+static volatile int pool_counter;
+static volatile int pool_in_flight;
+static volatile int pool_overlap;
+
+static void pool_count_callback(void *arg)
+{
+	(void)arg;
+	__atomic_fetch_add(&pool_counter, 1, __ATOMIC_SEQ_CST);
+}
+
+/* Flags overlap if two workers are ever inside the same item at once */
+static void pool_exclusive_callback(void *arg)
+{
+	(void)arg;
+	if (__atomic_fetch_add(&pool_in_flight, 1, __ATOMIC_SEQ_CST) != 0) {
+		pool_overlap = 1;
+	}
+	test_sleep_ms(20);
+	__atomic_fetch_sub(&pool_in_flight, 1, __ATOMIC_SEQ_CST);
+	__atomic_fetch_add(&pool_counter, 1, __ATOMIC_SEQ_CST);
+}
+
+static void test_pool_runs_all(void)
+{
+	eai_osal_workqueue_pool_t pool;
+	eai_osal_work_t items[POOL_ITEMS];
+
+	pool_counter = 0;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_workqueue_pool_create(&pool, 2, "pool",
+							 pool_stacks,
+							 EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+							 10));
+
+	for (int i = 0; i < POOL_ITEMS; i++) {
+		eai_osal_work_init(&items[i], pool_count_callback, NULL);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_work_submit_to_pool(&items[i], &pool));
+	}
+
+	/* Destroy finishes queued work before stopping the workers */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_workqueue_pool_destroy(&pool));
+	TEST_ASSERT_EQUAL(POOL_ITEMS, pool_counter);
+}
+
+static void test_pool_no_self_concurrency(void)
+{
+	eai_osal_workqueue_pool_t pool;
+	eai_osal_work_t work;
+
+	pool_counter = 0;
+	pool_in_flight = 0;
+	pool_overlap = 0;
+	eai_osal_workqueue_pool_create(&pool, 2, "pool", pool_stacks,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+				       10);
+	eai_osal_work_init(&work, pool_exclusive_callback, NULL);
+
+	/* Resubmit while running: must queue one rerun, never a second copy */
+	eai_osal_work_submit_to_pool(&work, &pool);
+	test_sleep_ms(5);
+	for (int i = 0; i < 5; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_work_submit_to_pool(&work, &pool));
+	}
+
+	eai_osal_workqueue_pool_destroy(&pool);
+	TEST_ASSERT_EQUAL(0, pool_overlap);
+	TEST_ASSERT_EQUAL(2, pool_counter);
+}
+
+static eai_osal_sem_t pool_gate;
+
+static void pool_blocker_callback(void *arg)
+{
+	(void)arg;
+	eai_osal_sem_take(&pool_gate, 2000);
+}
+
+static void test_pool_no_head_of_line(void)
+{
+	eai_osal_workqueue_pool_t pool;
+	eai_osal_work_t blocker, quick;
+
+	pool_counter = 0;
+	eai_osal_sem_create(&pool_gate, 0, 1);
+	eai_osal_workqueue_pool_create(&pool, 2, "pool", pool_stacks,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+				       10);
+	eai_osal_work_init(&blocker, pool_blocker_callback, NULL);
+	eai_osal_work_init(&quick, pool_count_callback, NULL);
+
+	eai_osal_work_submit_to_pool(&blocker, &pool);
+	eai_osal_work_submit_to_pool(&quick, &pool);
+
+	/* The other worker runs the quick item while the blocker is stuck */
+	for (int i = 0; i < 100 && __atomic_load_n(&pool_counter, __ATOMIC_SEQ_CST) == 0; i++) {
+		test_sleep_ms(5);
+	}
+	TEST_ASSERT_EQUAL(1, __atomic_load_n(&pool_counter, __ATOMIC_SEQ_CST));
+
+	eai_osal_sem_give(&pool_gate);
+	eai_osal_workqueue_pool_destroy(&pool);
+	eai_osal_sem_destroy(&pool_gate);
+}
+
+/* Fan-out: each parent submits children from inside the pool */
+#define FANOUT_PARENTS  8
+#define FANOUT_CHILDREN 32
+
+static eai_osal_workqueue_pool_t fanout_pool;
+static eai_osal_work_t fanout_children[FANOUT_PARENTS][FANOUT_CHILDREN];
+
+static void fanout_parent_callback(void *arg)
+{
+	eai_osal_work_t *children = (eai_osal_work_t *)arg;
+
+	for (int i = 0; i < FANOUT_CHILDREN; i++) {
+		eai_osal_work_submit_to_pool(&children[i], &fanout_pool);
+	}
+}
+
+static void test_pool_fanout(void)
+{
+	eai_osal_work_t parents[FANOUT_PARENTS];
+
+	pool_counter = 0;
+	eai_osal_workqueue_pool_create(&fanout_pool, 2, "pool", pool_stacks,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+				       10);
+
+	for (int p = 0; p < FANOUT_PARENTS; p++) {
+		for (int c = 0; c < FANOUT_CHILDREN; c++) {
+			eai_osal_work_init(&fanout_children[p][c],
+					   pool_count_callback, NULL);
+		}
+		eai_osal_work_init(&parents[p], fanout_parent_callback,
+				   fanout_children[p]);
+		eai_osal_work_submit_to_pool(&parents[p], &fanout_pool);
+	}
+
+	eai_osal_workqueue_pool_destroy(&fanout_pool);
+	TEST_ASSERT_EQUAL(FANOUT_PARENTS * FANOUT_CHILDREN, pool_counter);
+}
+
+/* A prioritized item overtakes default-level work already queued */
+static int prio_order[2];
+static volatile int prio_ran;
+
+static void prio_record_callback(void *arg)
+{
+	prio_order[__atomic_fetch_add(&prio_ran, 1, __ATOMIC_SEQ_CST)] = (int)(intptr_t)arg;
+	eai_osal_sem_give(&work_sem);
+}
+
+static void test_work_submit_prio(void)
+{
+	eai_osal_work_t gate, bulk, urgent;
+
+	prio_ran = 0;
+	eai_osal_sem_create(&work_sem, 0, 2);
+	depth_wq_block(&gate);
+
+	eai_osal_work_init(&bulk, prio_record_callback, (void *)(intptr_t)1);
+	eai_osal_work_init(&urgent, prio_record_callback, (void *)(intptr_t)2);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_submit_to(&bulk, &depth_wq));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_submit_prio(&urgent, &depth_wq,
+						    EAI_OSAL_PQUEUE_LEVELS - 1));
+
+	/* Full queue: prioritized submits don't wait either */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_work_submit_prio(&urgent, &depth_wq, 1));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_work_submit_prio(&urgent, &depth_wq,
+						    EAI_OSAL_PQUEUE_LEVELS));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_work_submit_prio(NULL, NULL, 0));
+
+	eai_osal_sem_give(&wq_gate);
+	eai_osal_sem_take(&work_sem, 500);
+	eai_osal_sem_take(&work_sem, 500);
+	TEST_ASSERT_EQUAL(2, prio_ran);
+	TEST_ASSERT_EQUAL(2, prio_order[0]);
+	TEST_ASSERT_EQUAL(1, prio_order[1]);
+
+	eai_osal_sem_destroy(&wq_gate);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SPSC tests (6)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static uint32_t spsc_buf[8];
+
+static void test_spsc_push_pop(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t val;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_spsc_create(&ring, sizeof(uint32_t), 8,
+					       spsc_buf, false));
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_count(&ring));
+	TEST_ASSERT_EQUAL(8, eai_osal_spsc_space(&ring));
+
+	for (uint32_t i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_spsc_push(&ring, &i, EAI_OSAL_NO_WAIT));
+	}
+	TEST_ASSERT_EQUAL(3, eai_osal_spsc_count(&ring));
+
+	for (uint32_t i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_spsc_pop(&ring, &val, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_EQUAL(i, val);
+	}
+	eai_osal_spsc_destroy(&ring);
+}
+
+static void test_spsc_full_empty(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t val = 0;
+
+	eai_osal_spsc_create(&ring, sizeof(uint32_t), 8, spsc_buf, false);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_spsc_pop(&ring, &val, EAI_OSAL_NO_WAIT));
+	for (uint32_t i = 0; i < 8; i++) {
+		eai_osal_spsc_push(&ring, &i, EAI_OSAL_NO_WAIT);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_spsc_push(&ring, &val, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_space(&ring));
+
+	eai_osal_spsc_destroy(&ring);
+}
+
+static void test_spsc_bulk_wraparound(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t in[6], out[8];
+
+	eai_osal_spsc_create(&ring, sizeof(uint32_t), 8, spsc_buf, false);
+
+	/* Move the indices so the next bulk write straddles the end */
+	for (uint32_t i = 0; i < 6; i++) {
+		in[i] = 100 + i;
+	}
+	TEST_ASSERT_EQUAL(5, eai_osal_spsc_write(&ring, in, 5));
+	TEST_ASSERT_EQUAL(5, eai_osal_spsc_read(&ring, out, 8));
+
+	TEST_ASSERT_EQUAL(6, eai_osal_spsc_write(&ring, in, 6));
+	/* Only 2 slots left — write is truncated, not rejected */
+	TEST_ASSERT_EQUAL(2, eai_osal_spsc_write(&ring, in, 6));
+	TEST_ASSERT_EQUAL(8, eai_osal_spsc_read(&ring, out, 8));
+	TEST_ASSERT_EQUAL_UINT32_ARRAY(in, out, 6);
+	TEST_ASSERT_EQUAL(100, out[6]);
+	TEST_ASSERT_EQUAL(101, out[7]);
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_read(&ring, out, 8));
+
+	eai_osal_spsc_destroy(&ring);
+}
+
+static void test_spsc_invalid(void)
+{
+	eai_osal_spsc_ring_t ring;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_spsc_create(&ring, sizeof(uint32_t), 6,
+					       spsc_buf, false));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_spsc_create(&ring, 0, 8, spsc_buf, false));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_spsc_create(NULL, sizeof(uint32_t), 8,
+					       spsc_buf, false));
+}
+
+static void test_spsc_blocking_timeout(void)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t val;
+
+	eai_osal_spsc_create(&ring, sizeof(uint32_t), 8, spsc_buf, true);
+
+	uint32_t start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_spsc_pop(&ring, &val, 50));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	TEST_ASSERT_GREATER_OR_EQUAL(40, elapsed);
+	TEST_ASSERT_LESS_OR_EQUAL(150, elapsed);
+
+	eai_osal_spsc_destroy(&ring);
+}
+
+#define SPSC_STRESS_COUNT 200000
+
+static eai_osal_spsc_ring_t stress_ring;
+static uint32_t stress_buf[64];
+
+static void spsc_producer_entry(void *arg)
+{
+	(void)arg;
+	uint32_t batch[5];
+	uint32_t seq = 0;
+
+	/* Mix single pushes with bulk writes to exercise both paths */
+	while (seq < SPSC_STRESS_COUNT) {
+		if (seq % 3 == 0) {
+			eai_osal_spsc_push(&stress_ring, &seq, EAI_OSAL_WAIT_FOREVER);
+			seq++;
+			continue;
+		}
+		uint32_t n = 0;
+
+		while (n < 5 && seq + n < SPSC_STRESS_COUNT) {
+			batch[n] = seq + n;
+			n++;
+		}
+		uint32_t done = eai_osal_spsc_write(&stress_ring, batch, n);
+
+		seq += done;
+		if (done == 0) {
+			eai_osal_thread_yield();
+		}
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(spsc_producer_stack, 2048);
+
+static void test_spsc_stress(void)
+{
+	eai_osal_thread_t producer;
+	uint32_t val;
+	uint32_t errors = 0;
+
+	eai_osal_spsc_create(&stress_ring, sizeof(uint32_t), 64, stress_buf,
+			     true);
+	eai_osal_thread_create(&producer, "spsc_tx", spsc_producer_entry, NULL,
+			       spsc_producer_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(spsc_producer_stack),
+			       10);
+
+	for (uint32_t i = 0; i < SPSC_STRESS_COUNT; i++) {
+		if (eai_osal_spsc_pop(&stress_ring, &val, 1000) != EAI_OSAL_OK ||
+		    val != i) {
+			errors++;
+			break;
+		}
+	}
+
+	eai_osal_thread_join(&producer, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(0, errors);
+	TEST_ASSERT_EQUAL(0, eai_osal_spsc_count(&stress_ring));
+	eai_osal_spsc_destroy(&stress_ring);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Stats tests (5)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+/* Find one named object's snapshot via the registry walk */
+struct stats_find {
+	const char *name;
+	eai_osal_stats_t out;
+	int hits;
+};
+
+static void stats_find_cb(const eai_osal_stats_t *st, void *arg)
+{
+	struct stats_find *f = arg;
+
+	if (strcmp(st->name, f->name) == 0) {
+		f->out = *st;
+		f->hits++;
+	}
+}
+
+static int stats_find(const char *name, eai_osal_stats_t *out)
+{
+	struct stats_find f = { .name = name };
+
+	eai_osal_stats_foreach(stats_find_cb, &f);
+	if (out) {
+		*out = f.out;
+	}
+	return f.hits;
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(stats_stack, 4096);
+
+static eai_osal_mutex_t stats_mtx;
+static eai_osal_sem_t stats_done;
+
+static void stats_mutex_locker(void *arg)
+{
+	(void)arg;
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mutex_unlock(&stats_mtx);
+	eai_osal_sem_give(&stats_done);
+}
+
+static void test_stats_mutex_contention(void)
+{
+	eai_osal_thread_t t;
+	eai_osal_stats_t st;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mutex_create_named(&stats_mtx, "st_mtx"));
+	eai_osal_sem_create(&stats_done, 0, 1);
+
+	/* Uncontended lock: counted, no wait */
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mutex_unlock(&stats_mtx);
+
+	/* Contended lock: the thread blocks ~20ms behind us */
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_thread_create(&t, "st_lock", stats_mutex_locker, NULL,
+			       stats_stack, EAI_OSAL_THREAD_STACK_SIZEOF(stats_stack), 10);
+	test_sleep_ms(20);
+	eai_osal_mutex_unlock(&stats_mtx);
+	eai_osal_sem_take(&stats_done, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_thread_join(&t, EAI_OSAL_WAIT_FOREVER);
+
+	TEST_ASSERT_EQUAL(1, stats_find("st_mtx", &st));
+	TEST_ASSERT_EQUAL(EAI_OSAL_STATS_MUTEX, st.kind);
+	TEST_ASSERT_EQUAL_STRING("mutex", eai_osal_stats_kind_str(st.kind));
+	TEST_ASSERT_EQUAL(3, st.acquires);
+	TEST_ASSERT_EQUAL(1, st.contended);
+	TEST_ASSERT_UINT32_WITHIN(15000, 20000, st.wait_max_us);
+	TEST_ASSERT_TRUE(st.wait_total_us >= st.wait_max_us);
+
+	eai_osal_mutex_destroy(&stats_mtx);
+	eai_osal_sem_destroy(&stats_done);
+}
+
+static eai_osal_sem_t stats_sem;
+
+static void stats_sem_giver(void *arg)
+{
+	(void)arg;
+	test_sleep_ms(10);
+	eai_osal_sem_give(&stats_sem);
+}
+
+static void test_stats_sem_histogram(void)
+{
+	eai_osal_thread_t t;
+	eai_osal_stats_t st;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_create_named(&stats_sem, 1, 1, "st_sem"));
+
+	/* Immediate take lands in bucket 0 */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&stats_sem, EAI_OSAL_NO_WAIT));
+
+	/* Failed take is not an acquire */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&stats_sem, 5));
+
+	/* ~10ms wait lands in the 8192..16383 us bucket (or a neighbour) */
+	eai_osal_thread_create(&t, "st_give", stats_sem_giver, NULL,
+			       stats_stack, EAI_OSAL_THREAD_STACK_SIZEOF(stats_stack), 10);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&stats_sem, EAI_OSAL_WAIT_FOREVER));
+	eai_osal_thread_join(&t, EAI_OSAL_WAIT_FOREVER);
+
+	TEST_ASSERT_EQUAL(1, stats_find("st_sem", &st));
+	TEST_ASSERT_EQUAL(2, st.acquires);
+	TEST_ASSERT_EQUAL(1, st.contended);
+	TEST_ASSERT_EQUAL(1, st.hist[0]);
+
+	uint32_t slow = 0;
+
+	for (int i = 13; i < EAI_OSAL_STATS_BUCKETS; i++) {
+		slow += st.hist[i];
+	}
+	TEST_ASSERT_EQUAL(1, slow);
+
+	eai_osal_sem_destroy(&stats_sem);
+}
+
+static void test_stats_queue_and_event(void)
+{
+	eai_osal_queue_t q;
+	eai_osal_event_t ev;
+	uint8_t qbuf[4 * sizeof(uint32_t)];
+	uint32_t v = 7, bits;
+	eai_osal_stats_t st;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_queue_create_named(&q, sizeof(uint32_t), 4, qbuf, "st_q"));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_event_create_named(&ev, "st_ev"));
+
+	eai_osal_queue_send(&q, &v, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_recv(&q, &v, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_queue_recv(&q, &v, 5));
+
+	TEST_ASSERT_EQUAL(1, stats_find("st_q", &st));
+	TEST_ASSERT_EQUAL(EAI_OSAL_STATS_QUEUE, st.kind);
+	TEST_ASSERT_EQUAL(2, st.acquires);
+	TEST_ASSERT_EQUAL(0, st.contended);
+
+	eai_osal_event_set(&ev, 0x1);
+	eai_osal_event_wait(&ev, 0x1, false, &bits, EAI_OSAL_NO_WAIT);
+
+	TEST_ASSERT_EQUAL(1, stats_find("st_ev", &st));
+	TEST_ASSERT_EQUAL(EAI_OSAL_STATS_EVENT, st.kind);
+	TEST_ASSERT_EQUAL(1, st.acquires);
+
+	eai_osal_queue_destroy(&q);
+	eai_osal_event_destroy(&ev);
+}
+
+static void test_stats_registry(void)
+{
+	eai_osal_mutex_t named, unnamed;
+
+	eai_osal_mutex_create_named(&named, "st_reg");
+	eai_osal_mutex_create(&unnamed);
+
+	/* Only named objects are listed */
+	TEST_ASSERT_EQUAL(1, stats_find("st_reg", NULL));
+
+	eai_osal_mutex_destroy(&named);
+	TEST_ASSERT_EQUAL(0, stats_find("st_reg", NULL));
+
+	eai_osal_mutex_destroy(&unnamed);
+}
+
+static void test_stats_reset(void)
+{
+	eai_osal_mutex_t m;
+	eai_osal_stats_t st;
+
+	eai_osal_mutex_create_named(&m, "st_rst");
+	eai_osal_mutex_lock(&m, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mutex_unlock(&m);
+
+	TEST_ASSERT_EQUAL(1, stats_find("st_rst", &st));
+	TEST_ASSERT_EQUAL(1, st.acquires);
+
+	eai_osal_stats_reset();
+	TEST_ASSERT_EQUAL(1, stats_find("st_rst", &st));
+	TEST_ASSERT_EQUAL(0, st.acquires);
+	TEST_ASSERT_EQUAL(0, st.hist[0]);
+
+	eai_osal_mutex_destroy(&m);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Mempool tests (5)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define MEMPOOL_BLOCK 32
+#define MEMPOOL_N     4
+
+EAI_OSAL_MEMPOOL_BUF_DEFINE(mempool_buf, MEMPOOL_BLOCK, MEMPOOL_N);
+
+static void test_mempool_alloc_free(void)
+{
+	eai_osal_mempool_t pool;
+	void *blk[MEMPOOL_N];
+	void *extra;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mempool_create(&pool, MEMPOOL_BLOCK, MEMPOOL_N,
+						  mempool_buf));
+
+	for (int i = 0; i < MEMPOOL_N; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_mempool_alloc(&pool, &blk[i], EAI_OSAL_NO_WAIT));
+		/* A fresh pool hands blocks out in address order */
+		TEST_ASSERT_EQUAL_PTR(mempool_buf + i * MEMPOOL_BLOCK, blk[i]);
+		memset(blk[i], 0xA5, MEMPOOL_BLOCK);
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_mempool_alloc(&pool, &extra, EAI_OSAL_NO_WAIT));
+
+	/* Last freed is first reused */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_free(&pool, blk[2]));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mempool_alloc(&pool, &extra, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL_PTR(blk[2], extra);
+
+	for (int i = 0; i < MEMPOOL_N; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_free(&pool, blk[i]));
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_destroy(&pool));
+}
+
+static void test_mempool_invalid(void)
+{
+	eai_osal_mempool_t pool;
+	void *blk;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(&pool, 3, MEMPOOL_N, mempool_buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(&pool, MEMPOOL_BLOCK, 0, mempool_buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(&pool, MEMPOOL_BLOCK, 2,
+						  mempool_buf + 1));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_create(NULL, MEMPOOL_BLOCK, MEMPOOL_N,
+						  mempool_buf));
+
+	eai_osal_mempool_create(&pool, MEMPOOL_BLOCK, MEMPOOL_N, mempool_buf);
+	eai_osal_mempool_alloc(&pool, &blk, EAI_OSAL_NO_WAIT);
+
+	/* Pointers that aren't the start of one of the pool's blocks */
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_free(&pool, (uint8_t *)blk + 8));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_free(&pool, mempool_buf + sizeof(mempool_buf)));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_free(&pool, &pool));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_mempool_alloc(&pool, NULL, EAI_OSAL_NO_WAIT));
+
+	eai_osal_mempool_free(&pool, blk);
+	eai_osal_mempool_destroy(&pool);
+}
+
+static void test_mempool_stats(void)
+{
+	eai_osal_mempool_t pool;
+	eai_osal_mempool_stats_t st;
+	void *a, *b, *c;
+
+	eai_osal_mempool_create(&pool, MEMPOOL_BLOCK, 2, mempool_buf);
+
+	eai_osal_mempool_alloc(&pool, &a, EAI_OSAL_NO_WAIT);
+	eai_osal_mempool_alloc(&pool, &b, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_mempool_alloc(&pool, &c, EAI_OSAL_NO_WAIT));
+	eai_osal_mempool_free(&pool, a);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_get_stats(&pool, &st));
+	TEST_ASSERT_EQUAL(MEMPOOL_BLOCK, st.block_size);
+	TEST_ASSERT_EQUAL(2, st.n_blocks);
+	TEST_ASSERT_EQUAL(1, st.used);
+	TEST_ASSERT_EQUAL(2, st.high_water);
+	TEST_ASSERT_EQUAL(1, st.failures);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_mempool_reset_stats(&pool));
+	eai_osal_mempool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(1, st.high_water);
+	TEST_ASSERT_EQUAL(0, st.failures);
+
+	eai_osal_mempool_free(&pool, b);
+	eai_osal_mempool_destroy(&pool);
+}
+
+static eai_osal_mempool_t mempool_wait_pool;
+static void *mempool_held;
+
+static void mempool_free_entry(void *arg)
+{
+	(void)arg;
+	test_sleep_ms(50);
+	eai_osal_mempool_free(&mempool_wait_pool, mempool_held);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(mempool_stack, 2048);
+
+static void test_mempool_blocking(void)
+{
+	eai_osal_thread_t thread;
+	void *blk;
+
+	eai_osal_mempool_create(&mempool_wait_pool, MEMPOOL_BLOCK, 1, mempool_buf);
+	eai_osal_mempool_alloc(&mempool_wait_pool, &mempool_held, EAI_OSAL_NO_WAIT);
+
+	uint32_t start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_mempool_alloc(&mempool_wait_pool, &blk, 50));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	TEST_ASSERT_GREATER_OR_EQUAL(40, elapsed);
+	TEST_ASSERT_LESS_OR_EQUAL(150, elapsed);
+
+	/* A free from another thread wakes a waiting alloc */
+	eai_osal_thread_create(&thread, "mp_free", mempool_free_entry, NULL,
+			       mempool_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(mempool_stack), 10);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_mempool_alloc(&mempool_wait_pool, &blk, 1000));
+	TEST_ASSERT_EQUAL_PTR(mempool_held, blk);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mempool_free(&mempool_wait_pool, blk);
+	eai_osal_mempool_destroy(&mempool_wait_pool);
+}
+
+#define MEMPOOL_STRESS_THREADS 4
+#define MEMPOOL_STRESS_ITERS   20000
+
+static eai_osal_mempool_t mempool_stress_pool;
+static volatile uint32_t mempool_stress_errors;
+
+static void mempool_stress_entry(void *arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg;
+
+	for (uint32_t i = 0; i < MEMPOOL_STRESS_ITERS; i++) {
+		uint32_t *blk;
+
+		if (eai_osal_mempool_alloc(&mempool_stress_pool, (void **)&blk,
+					   1000) != EAI_OSAL_OK) {
+			mempool_stress_errors++;
+			return;
+		}
+		/* Stamp the block; a block handed out twice shows up here */
+		for (int w = 0; w < MEMPOOL_BLOCK / 4; w++) {
+			blk[w] = id;
+		}
+		if (i % 16 == 0) {
+			eai_osal_thread_yield();
+		}
+		for (int w = 0; w < MEMPOOL_BLOCK / 4; w++) {
+			if (blk[w] != id) {
+				mempool_stress_errors++;
+			}
+		}
+		eai_osal_mempool_free(&mempool_stress_pool, blk);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(mempool_stress_stacks, MEMPOOL_STRESS_THREADS, 2048);
+
+static void test_mempool_stress(void)
+{
+	eai_osal_thread_t threads[MEMPOOL_STRESS_THREADS];
+	eai_osal_mempool_stats_t st;
+
+	/* Fewer blocks than threads, so allocs contend and wait */
+	mempool_stress_errors = 0;
+	eai_osal_mempool_create(&mempool_stress_pool, MEMPOOL_BLOCK, 3, mempool_buf);
+
+	for (uint32_t i = 0; i < MEMPOOL_STRESS_THREADS; i++) {
+		eai_osal_thread_create(&threads[i], "mp_stress",
+				       mempool_stress_entry, (void *)(uintptr_t)(i + 1),
+				       mempool_stress_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(mempool_stress_stacks[0]),
+				       10);
+	}
+	for (uint32_t i = 0; i < MEMPOOL_STRESS_THREADS; i++) {
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+	}
+
+	TEST_ASSERT_EQUAL(0, mempool_stress_errors);
+	eai_osal_mempool_get_stats(&mempool_stress_pool, &st);
+	TEST_ASSERT_EQUAL(0, st.used);
+	TEST_ASSERT_EQUAL(3, st.high_water);
+	eai_osal_mempool_destroy(&mempool_stress_pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Buf tests (5)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define BUF_DATA 64
+#define BUF_N    4
+
+EAI_BUF_POOL_STORAGE_DEFINE(buf_storage, BUF_N, BUF_DATA);
+
+static void test_buf_headroom_tailroom(void)
+{
+	eai_buf_pool_t pool;
+	eai_buf_t *buf;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_buf_pool_create(&pool, BUF_N, BUF_DATA, buf_storage));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_buf_alloc(&pool, &buf, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(0, buf->len);
+	TEST_ASSERT_EQUAL(BUF_DATA, eai_buf_tailroom(buf));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_buf_reserve(buf, 8));
+	TEST_ASSERT_EQUAL(8, eai_buf_headroom(buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_buf_add_mem(buf, "payload", 7));
+	TEST_ASSERT_EQUAL(BUF_DATA - 15, eai_buf_tailroom(buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_buf_reserve(buf, 1));
+
+	/* Prepend a header in the headroom; the payload doesn't move */
+	uint8_t *hdr = eai_buf_push(buf, 2);
+
+	TEST_ASSERT_NOT_NULL(hdr);
+	hdr[0] = 0xAB;
+	hdr[1] = 7;
+	TEST_ASSERT_EQUAL(9, buf->len);
+	TEST_ASSERT_NULL(eai_buf_push(buf, 7));
+
+	TEST_ASSERT_NOT_NULL(eai_buf_pull(buf, 2));
+	TEST_ASSERT_EQUAL_MEMORY("payload", buf->data, 7);
+	TEST_ASSERT_NULL(eai_buf_pull(buf, 8));
+	TEST_ASSERT_NULL(eai_buf_add(buf, BUF_DATA));
+	TEST_ASSERT_EQUAL(EAI_OSAL_NO_MEMORY,
+			  eai_buf_add_mem(buf, buf_storage, BUF_DATA));
+
+	eai_buf_unref(buf);
+	eai_buf_pool_destroy(&pool);
+}
+
+static void test_buf_refcount(void)
+{
+	eai_buf_pool_t pool;
+	eai_osal_mempool_stats_t st;
+	eai_buf_t *buf;
+
+	eai_buf_pool_create(&pool, BUF_N, BUF_DATA, buf_storage);
+	eai_buf_alloc(&pool, &buf, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(buf, "shared", 6);
+
+	TEST_ASSERT_EQUAL_PTR(buf, eai_buf_ref(buf));
+	eai_buf_ref(buf);
+	eai_buf_unref(buf);
+	eai_buf_unref(buf);
+	eai_buf_pool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(1, st.used);
+	TEST_ASSERT_EQUAL_MEMORY("shared", buf->data, 6);
+
+	eai_buf_unref(buf);
+	eai_buf_pool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(0, st.used);
+
+	eai_buf_unref(NULL);
+	eai_buf_pool_destroy(&pool);
+}
+
+static void test_buf_fragments(void)
+{
+	eai_buf_pool_t pool;
+	eai_osal_mempool_stats_t st;
+	eai_buf_t *head, *frag;
+	char out[16] = {0};
+
+	eai_buf_pool_create(&pool, BUF_N, BUF_DATA, buf_storage);
+
+	eai_buf_alloc(&pool, &head, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(head, "abc", 3);
+	eai_buf_alloc(&pool, &frag, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(frag, "defg", 4);
+	eai_buf_frag_add(head, frag);
+	eai_buf_alloc(&pool, &frag, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(frag, "hi", 2);
+	eai_buf_frag_add(head, frag);
+
+	TEST_ASSERT_EQUAL(9, eai_buf_chain_len(head));
+	TEST_ASSERT_EQUAL(9, eai_buf_linearize(head, out, 0, sizeof(out)));
+	TEST_ASSERT_EQUAL_STRING("abcdefghi", out);
+
+	/* Offset and length both cut across fragment boundaries */
+	memset(out, 0, sizeof(out));
+	TEST_ASSERT_EQUAL(5, eai_buf_linearize(head, out, 2, 5));
+	TEST_ASSERT_EQUAL_STRING("cdefg", out);
+	TEST_ASSERT_EQUAL(0, eai_buf_linearize(head, out, 9, 4));
+
+	/* A fragment with its own holder outlives the chain */
+	eai_buf_ref(frag);
+	eai_buf_unref(head);
+	eai_buf_pool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(1, st.used);
+	TEST_ASSERT_EQUAL_MEMORY("hi", frag->data, 2);
+
+	eai_buf_unref(frag);
+	eai_buf_pool_get_stats(&pool, &st);
+	TEST_ASSERT_EQUAL(0, st.used);
+	eai_buf_pool_destroy(&pool);
+}
+
+static void test_buf_exhaustion(void)
+{
+	eai_buf_pool_t pool;
+	eai_buf_t *bufs[BUF_N];
+	eai_buf_t *extra;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_buf_pool_create(&pool, BUF_N, 0, buf_storage));
+	eai_buf_pool_create(&pool, BUF_N, BUF_DATA, buf_storage);
+
+	for (int i = 0; i < BUF_N; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_buf_alloc(&pool, &bufs[i], EAI_OSAL_NO_WAIT));
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_buf_alloc(&pool, &extra, 10));
+
+	eai_buf_unref(bufs[1]);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_buf_alloc(&pool, &extra, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL_PTR(bufs[1], extra);
+	/* A recycled buffer comes back empty */
+	TEST_ASSERT_EQUAL(0, extra->len);
+	TEST_ASSERT_NULL(extra->frags);
+
+	bufs[1] = extra;
+	for (int i = 0; i < BUF_N; i++) {
+		eai_buf_unref(bufs[i]);
+	}
+	eai_buf_pool_destroy(&pool);
+}
+
+/*
+ * One producer fans each buffer out to two consumers by reference. The
+ * last consumer to finish frees it; under ASan/TSan a premature free or
+ * a missing barrier on the final unref shows up here.
+ */
+#define BUF_SHARE_COUNT 5000
+
+static eai_buf_pool_t buf_share_pool;
+static eai_osal_queue_t buf_share_q[2];
+static eai_buf_t *buf_share_slots[2][4];
+static volatile uint32_t buf_share_errors;
+
+static void buf_share_consumer(void *arg)
+{
+	eai_osal_queue_t *q = arg;
+
+	for (uint32_t i = 0; i < BUF_SHARE_COUNT; i++) {
+		eai_buf_t *buf;
+		uint32_t seq;
+
+		eai_osal_queue_recv(q, &buf, EAI_OSAL_WAIT_FOREVER);
+		memcpy(&seq, buf->data, sizeof(seq));
+		if (seq != i || buf->len != BUF_DATA) {
+			buf_share_errors++;
+		}
+		eai_buf_unref(buf);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(buf_share_stacks, 2, 2048);
+
+static void test_buf_shared_stress(void)
+{
+	eai_osal_thread_t consumers[2];
+	eai_osal_mempool_stats_t st;
+
+	buf_share_errors = 0;
+	eai_buf_pool_create(&buf_share_pool, BUF_N, BUF_DATA, buf_storage);
+	for (int i = 0; i < 2; i++) {
+		eai_osal_queue_create(&buf_share_q[i], sizeof(eai_buf_t *), 4,
+				      buf_share_slots[i]);
+		eai_osal_thread_create(&consumers[i], "buf_rx", buf_share_consumer,
+				       &buf_share_q[i], buf_share_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(buf_share_stacks[0]),
+				       10);
+	}
+
+	for (uint32_t i = 0; i < BUF_SHARE_COUNT; i++) {
+		eai_buf_t *buf;
+
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_buf_alloc(&buf_share_pool, &buf, 1000));
+		uint8_t *p = eai_buf_add(buf, BUF_DATA);
+
+		memset(p, 0x5A, BUF_DATA);
+		memcpy(p, &i, sizeof(i));
+
+		eai_buf_ref(buf);
+		eai_osal_queue_send(&buf_share_q[0], &buf, EAI_OSAL_WAIT_FOREVER);
+		eai_osal_queue_send(&buf_share_q[1], &buf, EAI_OSAL_WAIT_FOREVER);
+	}
+
+	for (int i = 0; i < 2; i++) {
+		eai_osal_thread_join(&consumers[i], EAI_OSAL_WAIT_FOREVER);
+		eai_osal_queue_destroy(&buf_share_q[i]);
+	}
+	TEST_ASSERT_EQUAL(0, buf_share_errors);
+	eai_buf_pool_get_stats(&buf_share_pool, &st);
+	TEST_ASSERT_EQUAL(0, st.used);
+	eai_buf_pool_destroy(&buf_share_pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Poll tests (5)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_poll_ready_now(void)
+{
+	eai_osal_sem_t sem;
+	eai_osal_queue_t q;
+	eai_osal_event_t ev;
+	uint32_t q_buf[4];
+	uint32_t msg = 7;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	eai_osal_queue_create(&q, sizeof(uint32_t), 4, q_buf);
+	eai_osal_event_create(&ev);
+
+	eai_osal_poll_event_t events[] = {
+		EAI_OSAL_POLL_SEM(&sem),
+		EAI_OSAL_POLL_QUEUE(&q),
+		EAI_OSAL_POLL_EVENT(&ev, 0x06),
+	};
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(events, 3, EAI_OSAL_NO_WAIT));
+
+	/* Bits outside the mask don't count */
+	eai_osal_event_set(&ev, 0x01);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(events, 3, EAI_OSAL_NO_WAIT));
+
+	eai_osal_queue_send(&q, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_event_set(&ev, 0x04);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(events, 3, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_FALSE(events[0].ready);
+	TEST_ASSERT_TRUE(events[1].ready);
+	TEST_ASSERT_TRUE(events[2].ready);
+
+	/* Polling doesn't consume anything */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(events, 3, 100));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_queue_recv(&q, &msg, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(7, msg);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(events, 3, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_FALSE(events[1].ready);
+
+	eai_osal_queue_destroy(&q);
+	eai_osal_sem_destroy(&sem);
+	eai_osal_event_destroy(&ev);
+}
+
+static void test_poll_timeout(void)
+{
+	eai_osal_sem_t sem;
+	eai_osal_event_t ev;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	eai_osal_event_create(&ev);
+
+	eai_osal_poll_event_t events[] = {
+		EAI_OSAL_POLL_SEM(&sem),
+		EAI_OSAL_POLL_EVENT(&ev, 0x01),
+	};
+	uint32_t start = eai_osal_time_get_ms();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(events, 2, 50));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	TEST_ASSERT_GREATER_OR_EQUAL(50, elapsed);
+	TEST_ASSERT_LESS_THAN(200, elapsed);
+	TEST_ASSERT_FALSE(events[0].ready);
+	TEST_ASSERT_FALSE(events[1].ready);
+
+	eai_osal_sem_destroy(&sem);
+	eai_osal_event_destroy(&ev);
+}
+
+/* Helper makes one entry ready after the poller has gone to sleep */
+static eai_osal_sem_t poll_wake_sem;
+static eai_osal_queue_t poll_wake_q;
+static eai_osal_event_t poll_wake_ev;
+static uint32_t poll_wake_q_buf[4];
+
+static void poll_waker(void *arg)
+{
+	int which = (int)(intptr_t)arg;
+	uint32_t msg = 1;
+
+	test_sleep_ms(30);
+	if (which == 0) {
+		eai_osal_sem_give(&poll_wake_sem);
+	} else if (which == 1) {
+		eai_osal_queue_send(&poll_wake_q, &msg, EAI_OSAL_NO_WAIT);
+	} else {
+		eai_osal_event_set(&poll_wake_ev, 0x10);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(poll_waker_stack, 2048);
+
+static void test_poll_wakes_on_each_type(void)
+{
+	eai_osal_sem_create(&poll_wake_sem, 0, 1);
+	eai_osal_queue_create(&poll_wake_q, sizeof(uint32_t), 4, poll_wake_q_buf);
+	eai_osal_event_create(&poll_wake_ev);
+
+	for (int which = 0; which < 3; which++) {
+		eai_osal_poll_event_t events[] = {
+			EAI_OSAL_POLL_SEM(&poll_wake_sem),
+			EAI_OSAL_POLL_QUEUE(&poll_wake_q),
+			EAI_OSAL_POLL_EVENT(&poll_wake_ev, 0x10),
+		};
+		eai_osal_thread_t waker;
+
+		eai_osal_thread_create(&waker, "poll_wake", poll_waker,
+				       (void *)(intptr_t)which, poll_waker_stack,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(poll_waker_stack), 10);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_poll(events, 3, EAI_OSAL_WAIT_FOREVER));
+		eai_osal_thread_join(&waker, EAI_OSAL_WAIT_FOREVER);
+		for (int i = 0; i < 3; i++) {
+			TEST_ASSERT_EQUAL(i == which, events[i].ready);
+		}
+
+		/* Consume it, so only the next iteration's object polls ready */
+		uint32_t msg;
+
+		eai_osal_sem_take(&poll_wake_sem, EAI_OSAL_NO_WAIT);
+		eai_osal_queue_recv(&poll_wake_q, &msg, EAI_OSAL_NO_WAIT);
+		eai_osal_event_clear(&poll_wake_ev, 0x10);
+	}
+
+	/* Nothing left ready, and the poller lists are empty again */
+	eai_osal_poll_event_t again[] = {
+		EAI_OSAL_POLL_SEM(&poll_wake_sem),
+		EAI_OSAL_POLL_QUEUE(&poll_wake_q),
+		EAI_OSAL_POLL_EVENT(&poll_wake_ev, 0x10),
+	};
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_poll(again, 3, 10));
+
+	eai_osal_queue_destroy(&poll_wake_q);
+	eai_osal_sem_destroy(&poll_wake_sem);
+	eai_osal_event_destroy(&poll_wake_ev);
+}
+
+static void test_poll_invalid(void)
+{
+	eai_osal_sem_t sem;
+	eai_osal_event_t ev;
+
+	eai_osal_sem_create(&sem, 1, 1);
+	eai_osal_event_create(&ev);
+
+	eai_osal_poll_event_t good = EAI_OSAL_POLL_SEM(&sem);
+	eai_osal_poll_event_t no_bits = EAI_OSAL_POLL_EVENT(&ev, 0);
+	eai_osal_poll_event_t no_obj = EAI_OSAL_POLL_QUEUE(NULL);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_poll(NULL, 1, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_poll(&good, 0, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_poll(&no_bits, 1, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_poll(&no_obj, 1, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_poll(&good, 1, 0));
+
+	eai_osal_sem_destroy(&sem);
+	eai_osal_event_destroy(&ev);
+}
+
+/*
+ * Two producers feed a queue and an event group; two consumers poll on
+ * both and drain with NO_WAIT. A lost wakeup leaves a consumer asleep
+ * with work pending, which shows up as a 1 s poll timeout.
+ */
+#define POLL_STRESS_MSGS 5000
+#define POLL_STRESS_KICKS 2000
+
+static eai_osal_queue_t poll_stress_q;
+static eai_osal_event_t poll_stress_ev;
+static uint32_t poll_stress_q_buf[8];
+static atomic_uint poll_stress_got;
+static atomic_uint poll_stress_kicks;
+static atomic_uint poll_stress_timeouts;
+static atomic_bool poll_stress_done;
+
+static void poll_stress_sender(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < POLL_STRESS_MSGS; i++) {
+		eai_osal_queue_send(&poll_stress_q, &i, EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+static void poll_stress_kicker(void *arg)
+{
+	(void)arg;
+	for (uint32_t i = 0; i < POLL_STRESS_KICKS; i++) {
+		eai_osal_event_set(&poll_stress_ev, 0x01);
+		if ((i & 63) == 0) {
+			test_sleep_ms(1);
+		}
+	}
+}
+
+static void poll_stress_consumer(void *arg)
+{
+	(void)arg;
+	eai_osal_poll_event_t events[] = {
+		EAI_OSAL_POLL_QUEUE(&poll_stress_q),
+		EAI_OSAL_POLL_EVENT(&poll_stress_ev, 0x01),
+	};
+
+	while (!atomic_load(&poll_stress_done)) {
+		uint32_t msg;
+		uint32_t actual;
+
+		if (eai_osal_poll(events, 2, 1000) != EAI_OSAL_OK) {
+			if (!atomic_load(&poll_stress_done)) {
+				atomic_fetch_add(&poll_stress_timeouts, 1);
+			}
+			continue;
+		}
+		while (eai_osal_queue_recv(&poll_stress_q, &msg, EAI_OSAL_NO_WAIT) ==
+		       EAI_OSAL_OK) {
+			atomic_fetch_add(&poll_stress_got, 1);
+		}
+		if (eai_osal_event_wait(&poll_stress_ev, 0x01, false, &actual,
+					EAI_OSAL_NO_WAIT) == EAI_OSAL_OK) {
+			eai_osal_event_clear(&poll_stress_ev, 0x01);
+			atomic_fetch_add(&poll_stress_kicks, 1);
+		}
+	}
+}
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(poll_stress_stacks, 4, 2048);
+
+static void test_poll_stress(void)
+{
+	eai_osal_thread_t threads[4];
+	void (*fns[4])(void *) = {
+		poll_stress_consumer, poll_stress_consumer,
+		poll_stress_sender, poll_stress_kicker,
+	};
+
+	atomic_store(&poll_stress_got, 0);
+	atomic_store(&poll_stress_kicks, 0);
+	atomic_store(&poll_stress_timeouts, 0);
+	atomic_store(&poll_stress_done, false);
+	eai_osal_queue_create(&poll_stress_q, sizeof(uint32_t), 8, poll_stress_q_buf);
+	eai_osal_event_create(&poll_stress_ev);
+
+	for (int i = 0; i < 4; i++) {
+		eai_osal_thread_create(&threads[i], "poll_st", fns[i], NULL,
+				       poll_stress_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(poll_stress_stacks[0]),
+				       10);
+	}
+	eai_osal_thread_join(&threads[2], EAI_OSAL_WAIT_FOREVER);
+	eai_osal_thread_join(&threads[3], EAI_OSAL_WAIT_FOREVER);
+
+	for (int i = 0; i < 500 && atomic_load(&poll_stress_got) < POLL_STRESS_MSGS; i++) {
+		test_sleep_ms(10);
+	}
+	atomic_store(&poll_stress_done, true);
+	eai_osal_event_set(&poll_stress_ev, 0x01);
+	eai_osal_thread_join(&threads[0], EAI_OSAL_WAIT_FOREVER);
+	eai_osal_thread_join(&threads[1], EAI_OSAL_WAIT_FOREVER);
+
+	TEST_ASSERT_EQUAL(POLL_STRESS_MSGS, atomic_load(&poll_stress_got));
+	TEST_ASSERT_GREATER_THAN(0, atomic_load(&poll_stress_kicks));
+	TEST_ASSERT_EQUAL(0, atomic_load(&poll_stress_timeouts));
+
+	eai_osal_queue_destroy(&poll_stress_q);
+	eai_osal_event_destroy(&poll_stress_ev);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * RWLock tests (5)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_rwlock_readers_share(void)
+{
+	eai_osal_rwlock_t rw;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_create(&rw));
+
+	/* Readers share, and keep a writer out */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+
+	/* A writer keeps out everyone */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_unlock(&rw));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw, 100));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+
+	eai_osal_rwlock_destroy(&rw);
+}
+
+static void test_rwlock_unlock_errors(void)
+{
+	eai_osal_rwlock_t rw;
+
+	eai_osal_rwlock_create(&rw);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_write_unlock(&rw));
+
+	/* The wrong kind of unlock leaves the hold in place */
+	eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_write_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_unlock(&rw));
+	eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_rwlock_read_unlock(&rw));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_unlock(&rw));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_rwlock_create(NULL));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_rwlock_read_lock(NULL, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_rwlock_write_lock(NULL, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_rwlock_read_unlock(NULL));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_rwlock_write_unlock(NULL));
+
+	eai_osal_rwlock_destroy(&rw);
+}
+
+/* Helpers block on the lock from their own threads */
+static eai_osal_rwlock_t rw_helper_lock;
+static atomic_int rw_helper_result;
+
+static void rw_writer_helper(void *arg)
+{
+	uint32_t timeout_ms = (uint32_t)(uintptr_t)arg;
+	eai_osal_status_t ret = eai_osal_rwlock_write_lock(&rw_helper_lock, timeout_ms);
+
+	atomic_store(&rw_helper_result, ret);
+	if (ret == EAI_OSAL_OK) {
+		test_sleep_ms(20);
+		eai_osal_rwlock_write_unlock(&rw_helper_lock);
+	}
+}
+
+static void rw_reader_helper(void *arg)
+{
+	if (eai_osal_rwlock_read_lock(&rw_helper_lock, EAI_OSAL_WAIT_FOREVER) ==
+	    EAI_OSAL_OK) {
+		atomic_store((atomic_int *)arg, 1);
+		eai_osal_rwlock_read_unlock(&rw_helper_lock);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(rw_helper_stacks, 2, 2048);
+
+static void test_rwlock_writer_preference(void)
+{
+	eai_osal_thread_t writer;
+
+	eai_osal_rwlock_create(&rw_helper_lock);
+	atomic_store(&rw_helper_result, -1);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_rwlock_read_lock(&rw_helper_lock, EAI_OSAL_NO_WAIT));
+	eai_osal_thread_create(&writer, "rw_writer", rw_writer_helper,
+			       (void *)(uintptr_t)EAI_OSAL_WAIT_FOREVER,
+			       rw_helper_stacks[0],
+			       EAI_OSAL_THREAD_STACK_SIZEOF(rw_helper_stacks[0]), 10);
+	test_sleep_ms(30);
+
+	/* The writer is queued, so a new reader waits behind it */
+	TEST_ASSERT_EQUAL(-1, atomic_load(&rw_helper_result));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_rwlock_read_lock(&rw_helper_lock, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_read_lock(&rw_helper_lock, 20));
+
+	/* The last reader out hands over to the writer */
+	eai_osal_rwlock_read_unlock(&rw_helper_lock);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_read_lock(&rw_helper_lock, 1000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, atomic_load(&rw_helper_result));
+	eai_osal_rwlock_read_unlock(&rw_helper_lock);
+
+	eai_osal_thread_join(&writer, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_rwlock_destroy(&rw_helper_lock);
+}
+
+static void test_rwlock_write_timeout(void)
+{
+	eai_osal_thread_t writer;
+	eai_osal_thread_t reader;
+	atomic_int reader_in = 0;
+
+	eai_osal_rwlock_create(&rw_helper_lock);
+	atomic_store(&rw_helper_result, -1);
+
+	eai_osal_rwlock_read_lock(&rw_helper_lock, EAI_OSAL_NO_WAIT);
+
+	uint32_t start = eai_osal_time_get_ms();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_rwlock_write_lock(&rw_helper_lock, 50));
+	uint32_t elapsed = eai_osal_time_get_ms() - start;
+
+	TEST_ASSERT_GREATER_OR_EQUAL(50, elapsed);
+	TEST_ASSERT_LESS_THAN(200, elapsed);
+
+	/* A reader held back by a writer gets in once that writer gives up */
+	eai_osal_thread_create(&writer, "rw_writer", rw_writer_helper, (void *)(uintptr_t)60,
+			       rw_helper_stacks[0],
+			       EAI_OSAL_THREAD_STACK_SIZEOF(rw_helper_stacks[0]), 10);
+	test_sleep_ms(20);
+	eai_osal_thread_create(&reader, "rw_reader", rw_reader_helper, &reader_in,
+			       rw_helper_stacks[1],
+			       EAI_OSAL_THREAD_STACK_SIZEOF(rw_helper_stacks[1]), 10);
+	test_sleep_ms(20);
+	TEST_ASSERT_EQUAL(0, atomic_load(&reader_in));
+
+	eai_osal_thread_join(&writer, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, atomic_load(&rw_helper_result));
+	eai_osal_thread_join(&reader, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(1, atomic_load(&reader_in));
+
+	eai_osal_rwlock_read_unlock(&rw_helper_lock);
+	eai_osal_rwlock_destroy(&rw_helper_lock);
+}
+
+/*
+ * Writers bump two counters together; readers check they always match.
+ * A reader that ever sees them differ overlapped a writer.
+ */
+#define RW_STRESS_READERS 4
+#define RW_STRESS_WRITERS 2
+#define RW_STRESS_ITERS 2000
+
+static eai_osal_rwlock_t rw_stress_lock;
+static uint32_t rw_stress_a;
+static uint32_t rw_stress_b;
+static atomic_uint rw_stress_torn;
+
+static void rw_stress_reader(void *arg)
+{
+	(void)arg;
+	for (int i = 0; i < RW_STRESS_ITERS; i++) {
+		eai_osal_rwlock_read_lock(&rw_stress_lock, EAI_OSAL_WAIT_FOREVER);
+		if (rw_stress_a != rw_stress_b) {
+			atomic_fetch_add(&rw_stress_torn, 1);
+		}
+		eai_osal_rwlock_read_unlock(&rw_stress_lock);
+	}
+}
+
+static void rw_stress_writer(void *arg)
+{
+	(void)arg;
+	for (int i = 0; i < RW_STRESS_ITERS; i++) {
+		eai_osal_rwlock_write_lock(&rw_stress_lock, EAI_OSAL_WAIT_FOREVER);
+		rw_stress_a++;
+		rw_stress_b++;
+		eai_osal_rwlock_write_unlock(&rw_stress_lock);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(rw_stress_stacks,
+				   RW_STRESS_READERS + RW_STRESS_WRITERS, 2048);
+
+static void test_rwlock_stress(void)
+{
+	eai_osal_thread_t threads[RW_STRESS_READERS + RW_STRESS_WRITERS];
+
+	rw_stress_a = 0;
+	rw_stress_b = 0;
+	atomic_store(&rw_stress_torn, 0);
+	eai_osal_rwlock_create(&rw_stress_lock);
+
+	for (int i = 0; i < RW_STRESS_READERS + RW_STRESS_WRITERS; i++) {
+		eai_osal_thread_create(&threads[i], "rw_st",
+				       i < RW_STRESS_READERS ? rw_stress_reader
+							     : rw_stress_writer,
+				       NULL, rw_stress_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(rw_stress_stacks[0]), 10);
+	}
+	for (int i = 0; i < RW_STRESS_READERS + RW_STRESS_WRITERS; i++) {
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+	}
+
+	TEST_ASSERT_EQUAL(0, atomic_load(&rw_stress_torn));
+	TEST_ASSERT_EQUAL(RW_STRESS_WRITERS * RW_STRESS_ITERS, rw_stress_a);
+
+	/* Nothing left held or queued */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_rwlock_write_lock(&rw_stress_lock, EAI_OSAL_NO_WAIT));
+	eai_osal_rwlock_write_unlock(&rw_stress_lock);
+	eai_osal_rwlock_destroy(&rw_stress_lock);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Atomic tests (2)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_atomic_ops(void)
+{
+	eai_osal_atomic_t a = EAI_OSAL_ATOMIC_INIT(5);
+
+	TEST_ASSERT_EQUAL(5, eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_RELAXED));
+	eai_osal_atomic_store(&a, 10, EAI_OSAL_ATOMIC_RELEASE);
+	TEST_ASSERT_EQUAL(10, eai_osal_atomic_add(&a, 3, EAI_OSAL_ATOMIC_ACQ_REL));
+	TEST_ASSERT_EQUAL(13, eai_osal_atomic_sub(&a, 1, EAI_OSAL_ATOMIC_SEQ_CST));
+	TEST_ASSERT_EQUAL(12, eai_osal_atomic_or(&a, 0x100, EAI_OSAL_ATOMIC_RELAXED));
+	TEST_ASSERT_EQUAL(0x10c, eai_osal_atomic_and(&a, 0x0ff, EAI_OSAL_ATOMIC_RELAXED));
+	TEST_ASSERT_EQUAL(12, eai_osal_atomic_exchange(&a, 20, EAI_OSAL_ATOMIC_ACQ_REL));
+
+	/* Wraps like unsigned arithmetic */
+	eai_osal_atomic_init(&a, 0);
+	eai_osal_atomic_sub(&a, 1, EAI_OSAL_ATOMIC_RELAXED);
+	TEST_ASSERT_EQUAL_HEX32(0xffffffff, eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_ACQUIRE));
+
+	/* A failed CAS reports what it found */
+	uint32_t expected = 1;
+
+	TEST_ASSERT_FALSE(eai_osal_atomic_cas(&a, &expected, 2, EAI_OSAL_ATOMIC_RELEASE));
+	TEST_ASSERT_EQUAL_HEX32(0xffffffff, expected);
+	TEST_ASSERT_TRUE(eai_osal_atomic_cas(&a, &expected, 2, EAI_OSAL_ATOMIC_ACQ_REL));
+	TEST_ASSERT_EQUAL(2, eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_SEQ_CST));
+
+	int x, y;
+	eai_osal_atomic_ptr_t p = EAI_OSAL_ATOMIC_INIT(NULL);
+	void *old = &y;
+
+	TEST_ASSERT_NULL(eai_osal_atomic_ptr_load(&p, EAI_OSAL_ATOMIC_ACQUIRE));
+	eai_osal_atomic_ptr_store(&p, &x, EAI_OSAL_ATOMIC_RELEASE);
+	TEST_ASSERT_FALSE(eai_osal_atomic_ptr_cas(&p, &old, &y, EAI_OSAL_ATOMIC_ACQ_REL));
+	TEST_ASSERT_EQUAL_PTR(&x, old);
+	TEST_ASSERT_TRUE(eai_osal_atomic_ptr_cas(&p, &old, &y, EAI_OSAL_ATOMIC_ACQ_REL));
+	TEST_ASSERT_EQUAL_PTR(&y, eai_osal_atomic_ptr_exchange(&p, NULL,
+							       EAI_OSAL_ATOMIC_SEQ_CST));
+	TEST_ASSERT_NULL(eai_osal_atomic_ptr_load(&p, EAI_OSAL_ATOMIC_RELAXED));
+}
+
+/*
+ * Threads race a fetch-add counter and a CAS-loop maximum. Lost updates
+ * show up as a short count or a wrong maximum.
+ */
+#define ATOMIC_STRESS_THREADS 4
+#define ATOMIC_STRESS_ITERS 50000
+
+static eai_osal_atomic_t atomic_stress_count;
+static eai_osal_atomic_t atomic_stress_max;
+
+static void atomic_stress_fn(void *arg)
+{
+	uint32_t base = (uint32_t)(uintptr_t)arg;
+
+	for (uint32_t i = 0; i < ATOMIC_STRESS_ITERS; i++) {
+		uint32_t v = base + i * ATOMIC_STRESS_THREADS;
+		uint32_t cur = eai_osal_atomic_load(&atomic_stress_max,
+						    EAI_OSAL_ATOMIC_RELAXED);
+
+		eai_osal_atomic_add(&atomic_stress_count, 1, EAI_OSAL_ATOMIC_RELAXED);
+		while (cur < v &&
+		       !eai_osal_atomic_cas(&atomic_stress_max, &cur, v,
+					    EAI_OSAL_ATOMIC_RELAXED)) {
+		}
+	}
+}
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(atomic_stress_stacks, ATOMIC_STRESS_THREADS, 2048);
+
+static void test_atomic_stress(void)
+{
+	eai_osal_thread_t threads[ATOMIC_STRESS_THREADS];
+
+	eai_osal_atomic_init(&atomic_stress_count, 0);
+	eai_osal_atomic_init(&atomic_stress_max, 0);
+
+	for (int i = 0; i < ATOMIC_STRESS_THREADS; i++) {
+		eai_osal_thread_create(&threads[i], "atomic_st", atomic_stress_fn,
+				       (void *)(uintptr_t)i, atomic_stress_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(atomic_stress_stacks[0]),
+				       10);
+	}
+	for (int i = 0; i < ATOMIC_STRESS_THREADS; i++) {
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+	}
+
+	TEST_ASSERT_EQUAL(ATOMIC_STRESS_THREADS * ATOMIC_STRESS_ITERS,
+			  eai_osal_atomic_load(&atomic_stress_count, EAI_OSAL_ATOMIC_ACQUIRE));
+	TEST_ASSERT_EQUAL(ATOMIC_STRESS_THREADS * ATOMIC_STRESS_ITERS - 1,
+			  eai_osal_atomic_load(&atomic_stress_max, EAI_OSAL_ATOMIC_ACQUIRE));
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PQueue tests (5)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define PQ_DEPTH 8
+
+static uint8_t pq_buf[EAI_OSAL_PQUEUE_BUF_SIZE(sizeof(uint32_t), PQ_DEPTH)];
+
+static void test_pqueue_priority_order(void)
+{
+	eai_osal_pqueue_t pq;
+	uint32_t v;
+	uint8_t prio;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_pqueue_create(&pq, sizeof(uint32_t), PQ_DEPTH, pq_buf));
+
+	/* Level in the tens digit, arrival order in the units */
+	static const uint32_t sent[] = { 10, 30, 11, 70, 31, 12, 71 };
+	static const uint32_t want[] = { 70, 71, 30, 31, 10, 11, 12 };
+
+	for (size_t i = 0; i < sizeof(sent) / sizeof(sent[0]); i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_pqueue_send(&pq, &sent[i], (uint8_t)(sent[i] / 10),
+						       EAI_OSAL_NO_WAIT));
+	}
+	TEST_ASSERT_EQUAL(7, eai_osal_pqueue_count(&pq));
+
+	for (size_t i = 0; i < sizeof(want) / sizeof(want[0]); i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_pqueue_recv(&pq, &v, &prio, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_EQUAL(want[i], v);
+		TEST_ASSERT_EQUAL(want[i] / 10, prio);
+	}
+	TEST_ASSERT_EQUAL(0, eai_osal_pqueue_count(&pq));
+
+	/* Slots recycle; prio is optional */
+	for (uint32_t round = 0; round < 3 * PQ_DEPTH; round++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_pqueue_send(&pq, &round, round % 8, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_pqueue_recv(&pq, &v, NULL, EAI_OSAL_NO_WAIT));
+		TEST_ASSERT_EQUAL(round, v);
+	}
+
+	eai_osal_pqueue_destroy(&pq);
+}
+
+static void test_pqueue_full_empty_timeout(void)
+{
+	eai_osal_pqueue_t pq;
+	uint32_t v = 0;
+
+	eai_osal_pqueue_create(&pq, sizeof(uint32_t), PQ_DEPTH, pq_buf);
+
+	uint32_t start = eai_osal_time_get_ms();
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_pqueue_recv(&pq, &v, NULL, 30));
+	TEST_ASSERT_GREATER_OR_EQUAL(25, eai_osal_time_get_ms() - start);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_pqueue_recv(&pq, &v, NULL, EAI_OSAL_NO_WAIT));
+
+	for (uint32_t i = 0; i < PQ_DEPTH; i++) {
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+				  eai_osal_pqueue_send(&pq, &i, 0, EAI_OSAL_NO_WAIT));
+	}
+	/* Full is full at every level */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_pqueue_send(&pq, &v, EAI_OSAL_PQUEUE_LEVELS - 1,
+					       EAI_OSAL_NO_WAIT));
+	start = eai_osal_time_get_ms();
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_pqueue_send(&pq, &v, 0, 30));
+	TEST_ASSERT_GREATER_OR_EQUAL(25, eai_osal_time_get_ms() - start);
+	TEST_ASSERT_EQUAL(PQ_DEPTH, eai_osal_pqueue_count(&pq));
+
+	eai_osal_pqueue_destroy(&pq);
+}
+
+static void test_pqueue_invalid(void)
+{
+	eai_osal_pqueue_t pq;
+	uint32_t v = 0;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pqueue_create(NULL, sizeof(v), PQ_DEPTH, pq_buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pqueue_create(&pq, 0, PQ_DEPTH, pq_buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pqueue_create(&pq, sizeof(v), 0, pq_buf));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pqueue_create(&pq, sizeof(v), PQ_DEPTH, NULL));
+
+	eai_osal_pqueue_create(&pq, sizeof(v), PQ_DEPTH, pq_buf);
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pqueue_send(&pq, &v, EAI_OSAL_PQUEUE_LEVELS, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_pqueue_send(&pq, NULL, 0, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_pqueue_send(NULL, &v, 0, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_pqueue_recv(&pq, NULL, NULL, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_pqueue_recv(NULL, &v, NULL, 0));
+	TEST_ASSERT_EQUAL(0, eai_osal_pqueue_count(NULL));
+	TEST_ASSERT_EQUAL(0, eai_osal_pqueue_count(&pq));
+	eai_osal_pqueue_destroy(&pq);
+}
+
+/* Several producers and consumers through a small queue: nothing lost or
+ * duplicated, and each producer's messages stay in order within a level */
+#define PQ_STRESS_PRODUCERS 3
+#define PQ_STRESS_CONSUMERS 2
+#define PQ_STRESS_MSGS      2000
+
+static eai_osal_pqueue_t pq_stress;
+static atomic_int pq_stress_errors;
+static atomic_int pq_stress_received;
+static uint32_t pq_stress_last[PQ_STRESS_CONSUMERS][PQ_STRESS_PRODUCERS][2];
+
+static void pq_producer_entry(void *arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg;
+
+	for (uint32_t i = 1; i <= PQ_STRESS_MSGS; i++) {
+		uint32_t msg = id << 16 | i;
+
+		if (eai_osal_pqueue_send(&pq_stress, &msg, (uint8_t)(i & 1) * 5,
+					 2000) != EAI_OSAL_OK) {
+			atomic_fetch_add(&pq_stress_errors, 1);
+			return;
+		}
+	}
+}
+
+static void pq_consumer_entry(void *arg)
+{
+	uint32_t (*last)[2] = pq_stress_last[(uintptr_t)arg];
+	uint32_t msg;
+	uint8_t prio;
+
+	while (atomic_load(&pq_stress_received) < PQ_STRESS_PRODUCERS * PQ_STRESS_MSGS) {
+		if (eai_osal_pqueue_recv(&pq_stress, &msg, &prio, 20) != EAI_OSAL_OK) {
+			continue;
+		}
+		uint32_t id = msg >> 16, seq = msg & 0xffff;
+
+		/* Odd sequence numbers went at level 5, even at level 0 */
+		if (id >= PQ_STRESS_PRODUCERS || prio != (seq & 1) * 5 ||
+		    seq <= last[id][seq & 1]) {
+			atomic_fetch_add(&pq_stress_errors, 1);
+		}
+		last[id][seq & 1] = seq;
+		atomic_fetch_add(&pq_stress_received, 1);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(pq_stress_stacks,
+				   PQ_STRESS_PRODUCERS + PQ_STRESS_CONSUMERS, 2048);
+
+static void test_pqueue_stress(void)
+{
+	eai_osal_thread_t threads[PQ_STRESS_PRODUCERS + PQ_STRESS_CONSUMERS];
+	uint32_t n = 0;
+
+	atomic_store(&pq_stress_errors, 0);
+	atomic_store(&pq_stress_received, 0);
+	memset(pq_stress_last, 0, sizeof(pq_stress_last));
+	eai_osal_pqueue_create(&pq_stress, sizeof(uint32_t), 4, pq_buf);
+
+	for (uint32_t i = 0; i < PQ_STRESS_CONSUMERS; i++, n++) {
+		eai_osal_thread_create(&threads[n], "pq_rx", pq_consumer_entry,
+				       (void *)(uintptr_t)i, pq_stress_stacks[n],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pq_stress_stacks[0]), 10);
+	}
+	for (uint32_t i = 0; i < PQ_STRESS_PRODUCERS; i++, n++) {
+		eai_osal_thread_create(&threads[n], "pq_tx", pq_producer_entry,
+				       (void *)(uintptr_t)i, pq_stress_stacks[n],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pq_stress_stacks[0]), 10);
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+	}
+
+	TEST_ASSERT_EQUAL(0, atomic_load(&pq_stress_errors));
+	TEST_ASSERT_EQUAL(PQ_STRESS_PRODUCERS * PQ_STRESS_MSGS,
+			  atomic_load(&pq_stress_received));
+	TEST_ASSERT_EQUAL(0, eai_osal_pqueue_count(&pq_stress));
+	eai_osal_pqueue_destroy(&pq_stress);
+}
+
+/*
+ * One side polls with 1 ms timeouts against a peer that works in bursts,
+ * so timeouts keep landing just as tokens are handed over. A waiter must
+ * leave the count exactly once, by its own timeout or by a token, and no
+ * token may be left over for a waiter that isn't there.
+ */
+#define PQ_TIMEOUT_THREADS 3
+#define PQ_TIMEOUT_MSGS    3000
+
+static atomic_int pq_timeout_done;
+
+static void pq_timeout_rx_entry(void *arg)
+{
+	(void)arg;
+	uint32_t msg;
+
+	while (atomic_load(&pq_timeout_done) < PQ_TIMEOUT_MSGS) {
+		if (eai_osal_pqueue_recv(&pq_stress, &msg, NULL, 1) == EAI_OSAL_OK) {
+			atomic_fetch_add(&pq_timeout_done, 1);
+		}
+	}
+}
+
+static void pq_timeout_tx_entry(void *arg)
+{
+	(void)arg;
+	uint32_t msg = 0;
+
+	while (atomic_fetch_add(&pq_timeout_done, 1) < PQ_TIMEOUT_MSGS) {
+		while (eai_osal_pqueue_send(&pq_stress, &msg, 0, 1) != EAI_OSAL_OK) {
+		}
+	}
+}
+
+static void pq_timeout_run(eai_osal_thread_entry_t entry, bool rx_side)
+{
+	eai_osal_thread_t threads[PQ_TIMEOUT_THREADS];
+	uint32_t msg = 0;
+
+	atomic_store(&pq_timeout_done, 0);
+	eai_osal_pqueue_create(&pq_stress, sizeof(uint32_t), 1, pq_buf);
+	for (uint32_t i = 0; i < PQ_TIMEOUT_THREADS; i++) {
+		eai_osal_thread_create(&threads[i], "pq_to", entry, NULL,
+				       pq_stress_stacks[i],
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pq_stress_stacks[0]), 10);
+	}
+
+	/* The busy peer: blocking calls, with a pause every 64 */
+	for (uint32_t i = 0; i < PQ_TIMEOUT_MSGS; i++) {
+		if (rx_side) {
+			eai_osal_pqueue_send(&pq_stress, &msg, 0, EAI_OSAL_WAIT_FOREVER);
+		} else {
+			eai_osal_pqueue_recv(&pq_stress, &msg, NULL, EAI_OSAL_WAIT_FOREVER);
+		}
+		if (i % 64 == 0) {
+			eai_osal_thread_sleep(1);
+		}
+	}
+	for (uint32_t i = 0; i < PQ_TIMEOUT_THREADS; i++) {
+		eai_osal_thread_join(&threads[i], EAI_OSAL_WAIT_FOREVER);
+	}
+
+	TEST_ASSERT_EQUAL(0, pq_stress._rx_waiting);
+	TEST_ASSERT_EQUAL(0, pq_stress._tx_waiting);
+	TEST_ASSERT_NOT_EQUAL(EAI_OSAL_OK,
+			      eai_osal_sem_take(&pq_stress._items_sig, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_NOT_EQUAL(EAI_OSAL_OK,
+			      eai_osal_sem_take(&pq_stress._spaces_sig, EAI_OSAL_NO_WAIT));
+	eai_osal_pqueue_destroy(&pq_stress);
+}
+
+static void test_pqueue_timeout_stress(void)
+{
+	pq_timeout_run(pq_timeout_rx_entry, true);
+	pq_timeout_run(pq_timeout_tx_entry, false);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Task tests (6)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+EAI_OSAL_THREAD_STACK_DEFINE(task_wq_stack, 4096);
+static eai_osal_workqueue_t task_wq;
+static bool task_wq_started;
+
+static eai_osal_workqueue_t *task_wq_get(void)
+{
+	if (!task_wq_started) {
+		/* Room for every ring task's first step at once */
+		eai_osal_workqueue_create_with_depth(&task_wq, "task_wq", task_wq_stack,
+						     EAI_OSAL_THREAD_STACK_SIZEOF(task_wq_stack),
+						     10, 64);
+		task_wq_started = true;
+	}
+	return &task_wq;
+}
+
+static eai_osal_poll_event_t wp_events[2];
+static bool wp_ready[2];
+static uint32_t wp_fired_ms;
+static eai_osal_sem_t wp_done;
+
+static void wp_callback(void *arg)
+{
+	(void)arg;
+	wp_ready[0] = wp_events[0].ready;
+	wp_ready[1] = wp_events[1].ready;
+	wp_fired_ms = eai_osal_time_get_ms();
+	eai_osal_sem_give(&wp_done);
+}
+
+static void test_work_poll_fires_on_ready(void)
+{
+	eai_osal_work_poll_t wp;
+	eai_osal_sem_t sem;
+	eai_osal_event_t event;
+
+	eai_osal_sem_create(&wp_done, 0, 1);
+	eai_osal_sem_create(&sem, 0, 1);
+	eai_osal_event_create(&event);
+	wp_events[0] = (eai_osal_poll_event_t)EAI_OSAL_POLL_SEM(&sem);
+	wp_events[1] = (eai_osal_poll_event_t)EAI_OSAL_POLL_EVENT(&event, 0x4);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_poll_init(&wp, wp_callback, NULL));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_poll_submit(&wp, task_wq_get(), wp_events, 2, 2000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR,
+			  eai_osal_work_poll_submit(&wp, task_wq_get(), wp_events, 2, 2000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&wp_done, 20));
+
+	uint32_t start = eai_osal_time_get_ms();
+
+	eai_osal_event_set(&event, 0x4);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&wp_done, 1000));
+	TEST_ASSERT_LESS_THAN(500, wp_fired_ms - start);
+	TEST_ASSERT_FALSE(wp_ready[0]);
+	TEST_ASSERT_TRUE(wp_ready[1]);
+
+	/* Already ready when armed: fires straight away, on the system queue */
+	eai_osal_sem_give(&sem);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_poll_submit(&wp, NULL, wp_events, 1, 2000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&wp_done, 1000));
+	TEST_ASSERT_TRUE(wp_ready[0]);
+	/* Readiness is reported, not consumed */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT));
+
+	eai_osal_event_destroy(&event);
+	eai_osal_sem_destroy(&sem);
+	eai_osal_sem_destroy(&wp_done);
+}
+
+static void test_work_poll_timeout_cancel(void)
+{
+	eai_osal_work_poll_t wp;
+	eai_osal_sem_t sem;
+
+	eai_osal_sem_create(&wp_done, 0, 1);
+	eai_osal_sem_create(&sem, 0, 1);
+	wp_events[0] = (eai_osal_poll_event_t)EAI_OSAL_POLL_SEM(&sem);
+	eai_osal_work_poll_init(&wp, wp_callback, NULL);
+
+	uint32_t start = eai_osal_time_get_ms();
+
+	wp_ready[0] = true;
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_poll_submit(&wp, task_wq_get(), wp_events, 1, 30));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&wp_done, 1000));
+	TEST_ASSERT_GREATER_OR_EQUAL(25, wp_fired_ms - start);
+	TEST_ASSERT_FALSE(wp_ready[0]);
+
+	/* Cancelled work never runs, even once its entry becomes ready */
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_work_poll_cancel(&wp));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_poll_submit(&wp, task_wq_get(), wp_events, 1,
+						    EAI_OSAL_WAIT_FOREVER));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_work_poll_cancel(&wp));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_work_poll_cancel(&wp));
+	eai_osal_sem_give(&sem);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&wp_done, 50));
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_work_poll_submit(&wp, NULL, wp_events, 0, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_work_poll_submit(NULL, NULL, wp_events, 1, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_work_poll_init(&wp, NULL, NULL));
+
+	eai_osal_sem_destroy(&sem);
+	eai_osal_sem_destroy(&wp_done);
+}
+
+/* A trigger that finds the queue full is retried, not dropped */
+static void test_work_poll_full_queue_retry(void)
+{
+	eai_osal_work_t gate, filler[2];
+	eai_osal_work_poll_t wp;
+	eai_osal_sem_t sem;
+
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 2);
+	eai_osal_sem_create(&wp_done, 0, 1);
+	eai_osal_sem_create(&sem, 0, 1);
+	depth_wq_block(&gate);
+	for (int i = 0; i < 2; i++) {
+		eai_osal_work_init(&filler[i], work_callback, NULL);
+		eai_osal_work_submit_to(&filler[i], &depth_wq);
+	}
+
+	wp_events[0] = (eai_osal_poll_event_t)EAI_OSAL_POLL_SEM(&sem);
+	eai_osal_work_poll_init(&wp, wp_callback, NULL);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_work_poll_submit(&wp, &depth_wq, wp_events, 1,
+						    EAI_OSAL_WAIT_FOREVER));
+	eai_osal_sem_give(&sem);
+	test_sleep_ms(20);
+
+	eai_osal_sem_give(&wq_gate);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&wp_done, 1000));
+	TEST_ASSERT_TRUE(wp_ready[0]);
+	eai_osal_sem_take(&work_sem, 500);
+	eai_osal_sem_take(&work_sem, 500);
+	TEST_ASSERT_EQUAL(2, work_counter);
+
+	eai_osal_sem_destroy(&sem);
+	eai_osal_sem_destroy(&wq_gate);
+	eai_osal_sem_destroy(&wp_done);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* A sleep that ends while the queue is full resumes once there is room */
+static eai_osal_sem_t sleeper_asleep;
+
+static void sleeper_fn(eai_osal_task_t *task)
+{
+	EAI_OSAL_TASK_BEGIN(task);
+	eai_osal_sem_give(&sleeper_asleep);
+	EAI_OSAL_TASK_SLEEP(task, 20);
+	EAI_OSAL_TASK_END(task);
+}
+
+static void test_task_sleep_full_queue(void)
+{
+	eai_osal_work_t gate, filler[2];
+	eai_osal_task_t task;
+
+	work_counter = 0;
+	eai_osal_sem_create(&work_sem, 0, 2);
+	eai_osal_sem_create(&sleeper_asleep, 0, 1);
+	eai_osal_task_init(&task, sleeper_fn, NULL);
+
+	/* Sets up depth_wq; the gate opens straight away */
+	depth_wq_block(&gate);
+	eai_osal_sem_give(&wq_gate);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_task_start(&task, &depth_wq));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&sleeper_asleep, 500));
+	eai_osal_sem_destroy(&wq_gate);
+
+	/* Fill the queue behind a blocked worker until well past the wake */
+	depth_wq_block(&gate);
+	for (int i = 0; i < 2; i++) {
+		eai_osal_work_init(&filler[i], work_callback, NULL);
+		eai_osal_work_submit_to(&filler[i], &depth_wq);
+	}
+	test_sleep_ms(50);
+	TEST_ASSERT_FALSE(eai_osal_task_is_done(&task));
+
+	eai_osal_sem_give(&wq_gate);
+	for (int i = 0; i < 100 && !eai_osal_task_is_done(&task); i++) {
+		test_sleep_ms(5);
+	}
+	TEST_ASSERT_TRUE(eai_osal_task_is_done(&task));
+	eai_osal_sem_take(&work_sem, 500);
+	eai_osal_sem_take(&work_sem, 500);
+	TEST_ASSERT_EQUAL(2, work_counter);
+
+	eai_osal_sem_destroy(&wq_gate);
+	eai_osal_sem_destroy(&sleeper_asleep);
+	eai_osal_sem_destroy(&work_sem);
+}
+
+/* One task through every kind of await */
+struct await_flow {
+	eai_osal_task_t task;
+	eai_osal_sem_t sem;
+	eai_osal_queue_t queue;
+	eai_osal_event_t event;
+	eai_osal_sem_t done;
+	eai_osal_status_t sem_timeout, sem_ok, queue_ok, event_ok;
+	uint32_t msg, bits, slept_ms, steps;
+};
+
+static uint8_t await_queue_buf[4 * sizeof(uint32_t)];
+
+static void await_flow_fn(eai_osal_task_t *task)
+{
+	struct await_flow *f = eai_osal_task_arg(task);
+	uint32_t msg = 0; /* a local: filled in by the resuming step */
+
+	f->steps++;
+	EAI_OSAL_TASK_BEGIN(task);
+
+	EAI_OSAL_TASK_AWAIT_SEM(task, &f->sem, 20, f->sem_timeout);
+	EAI_OSAL_TASK_AWAIT_SEM(task, &f->sem, EAI_OSAL_WAIT_FOREVER, f->sem_ok);
+	EAI_OSAL_TASK_AWAIT_QUEUE(task, &f->queue, &msg, 1000, f->queue_ok);
+	f->msg = msg;
+	EAI_OSAL_TASK_AWAIT_EVENT(task, &f->event, 0x3, true, &f->bits, 1000, f->event_ok);
+
+	f->slept_ms = eai_osal_time_get_ms();
+	EAI_OSAL_TASK_SLEEP(task, 20);
+	f->slept_ms = eai_osal_time_get_ms() - f->slept_ms;
+	EAI_OSAL_TASK_YIELD(task);
+	eai_osal_sem_give(&f->done);
+
+	EAI_OSAL_TASK_END(task);
+}
+
+static void test_task_awaits(void)
+{
+	static struct await_flow f;
+	uint32_t msg = 42;
+
+	memset(&f, 0, sizeof(f));
+	eai_osal_sem_create(&f.sem, 0, 2);
+	eai_osal_sem_create(&f.done, 0, 1);
+	eai_osal_queue_create(&f.queue, sizeof(uint32_t), 4, await_queue_buf);
+	eai_osal_event_create(&f.event);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM, eai_osal_task_init(&f.task, NULL, &f));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_task_init(&f.task, await_flow_fn, &f));
+	TEST_ASSERT_FALSE(eai_osal_task_is_done(&f.task));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_task_start(&f.task, task_wq_get()));
+	TEST_ASSERT_EQUAL(EAI_OSAL_ERROR, eai_osal_task_start(&f.task, task_wq_get()));
+
+	test_sleep_ms(50);
+	eai_osal_sem_give(&f.sem);
+	test_sleep_ms(10);
+	eai_osal_queue_send(&f.queue, &msg, EAI_OSAL_NO_WAIT);
+	test_sleep_ms(10);
+	/* One bit of two doesn't finish a wait_all */
+	eai_osal_event_set(&f.event, 0x1);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_sem_take(&f.done, 50));
+	eai_osal_event_set(&f.event, 0x2);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&f.done, 1000));
+	for (int i = 0; i < 100 && !eai_osal_task_is_done(&f.task); i++) {
+		test_sleep_ms(1);
+	}
+	TEST_ASSERT_TRUE(eai_osal_task_is_done(&f.task));
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, f.sem_timeout);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, f.sem_ok);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, f.queue_ok);
+	TEST_ASSERT_EQUAL(42, f.msg);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, f.event_ok);
+	TEST_ASSERT_EQUAL(0x3, f.bits);
+	TEST_ASSERT_GREATER_OR_EQUAL(18, f.slept_ms);
+	/* Parked steps, not spins: top, each await that parked, sleep, yield */
+	TEST_ASSERT_LESS_OR_EQUAL(10, f.steps);
+
+	/* Finished tasks can run again; this time everything is ready */
+	f.steps = 0;
+	eai_osal_sem_give(&f.sem);
+	eai_osal_sem_give(&f.sem);
+	eai_osal_queue_send(&f.queue, &msg, EAI_OSAL_NO_WAIT);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_task_start(&f.task, task_wq_get()));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&f.done, 1000));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, f.sem_timeout);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, f.sem_ok);
+	/* Only the sleep and the yield step out */
+	TEST_ASSERT_EQUAL(3, f.steps);
+
+	eai_osal_event_destroy(&f.event);
+	eai_osal_queue_destroy(&f.queue);
+	eai_osal_sem_destroy(&f.done);
+	eai_osal_sem_destroy(&f.sem);
+}
+
+/* Many tasks on one work queue thread, passing a token round a ring */
+#define TASK_RING     32
+#define TASK_LAPS     50
+
+struct ring_task {
+	eai_osal_task_t task;
+	eai_osal_sem_t token;
+	uint32_t lap;
+};
+
+static struct ring_task ring[TASK_RING];
+static volatile uint32_t ring_hops;
+static eai_osal_sem_t ring_done;
+
+static void ring_fn(eai_osal_task_t *task)
+{
+	struct ring_task *self = eai_osal_task_arg(task);
+	struct ring_task *next = &ring[(self - ring + 1) % TASK_RING];
+	eai_osal_status_t ret;
+
+	EAI_OSAL_TASK_BEGIN(task);
+	for (self->lap = 0; self->lap < TASK_LAPS; self->lap++) {
+		EAI_OSAL_TASK_AWAIT_SEM(task, &self->token, 2000, ret);
+		if (ret != EAI_OSAL_OK) {
+			EAI_OSAL_TASK_EXIT(task);
+		}
+		ring_hops++;
+		eai_osal_sem_give(&next->token);
+	}
+	if (self == &ring[TASK_RING - 1]) {
+		eai_osal_sem_give(&ring_done);
+	}
+	EAI_OSAL_TASK_END(task);
+}
+
+static void test_task_many_on_one_queue(void)
+{
+	ring_hops = 0;
+	eai_osal_sem_create(&ring_done, 0, 1);
+	for (int i = 0; i < TASK_RING; i++) {
+		eai_osal_sem_create(&ring[i].token, 0, 1);
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_task_init(&ring[i].task, ring_fn, &ring[i]));
+		TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_task_start(&ring[i].task, task_wq_get()));
+	}
+
+	eai_osal_sem_give(&ring[0].token);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_sem_take(&ring_done, 5000));
+	TEST_ASSERT_EQUAL(TASK_RING * TASK_LAPS, ring_hops);
+	for (int i = 0; i < 100 && !eai_osal_task_is_done(&ring[TASK_RING - 1].task); i++) {
+		test_sleep_ms(1);
+	}
+	for (int i = 0; i < TASK_RING; i++) {
+		TEST_ASSERT_TRUE(eai_osal_task_is_done(&ring[i].task));
+		eai_osal_sem_destroy(&ring[i].token);
+	}
+	eai_osal_sem_destroy(&ring_done);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Pipe tests (4)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void test_pipe_partial_transfer(void)
+{
+	eai_osal_pipe_t pipe;
+	uint8_t storage[16];
+	uint8_t in[40], out[40];
+	size_t n;
+
+	for (size_t i = 0; i < sizeof(in); i++) {
+		in[i] = (uint8_t)i;
+	}
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_create(&pipe, storage, 16, 1));
+
+	/* Only what fits goes in */
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT,
+			  eai_osal_pipe_write(&pipe, in, 20, &n, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(16, n);
+	TEST_ASSERT_EQUAL(16, eai_osal_pipe_count(&pipe));
+	TEST_ASSERT_EQUAL(0, eai_osal_pipe_space(&pipe));
+
+	/* Reads take up to len, then what is left */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_read(&pipe, out, 10, &n, 0));
+	TEST_ASSERT_EQUAL(10, n);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_read(&pipe, out + 10, 30, &n, 0));
+	TEST_ASSERT_EQUAL(6, n);
+	TEST_ASSERT_EQUAL_MEMORY(in, out, 16);
+
+	/* Across the end of the storage */
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_pipe_write(&pipe, in + 16, 12, NULL, EAI_OSAL_NO_WAIT));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_read(&pipe, out, 40, &n, 0));
+	TEST_ASSERT_EQUAL(12, n);
+	TEST_ASSERT_EQUAL_MEMORY(in + 16, out, 12);
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_pipe_read(&pipe, out, 4, &n, 20));
+	TEST_ASSERT_EQUAL(0, n);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_destroy(&pipe));
+}
+
+static void test_pipe_invalid(void)
+{
+	eai_osal_pipe_t pipe;
+	uint8_t storage[8];
+	uint8_t b = 0;
+	size_t n;
+
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pipe_create(&pipe, storage, 8, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pipe_create(&pipe, storage, 8, 9));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pipe_create(&pipe, NULL, 8, 1));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_create(&pipe, storage, 8, 8));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pipe_write(&pipe, NULL, 1, NULL, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pipe_read(&pipe, &b, 1, NULL, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_INVALID_PARAM,
+			  eai_osal_pipe_read(NULL, &b, 1, &n, 0));
+	eai_osal_pipe_destroy(&pipe);
+}
+
+static eai_osal_pipe_t pipe_dut;
+static uint8_t pipe_storage[256];
+EAI_OSAL_THREAD_STACK_DEFINE(pipe_helper_stack, 4096);
+
+static void pipe_dribble_entry(void *arg)
+{
+	(void)arg;
+	for (uint8_t i = 0; i < 4; i++) {
+		uint8_t chunk[4] = { i, i, i, i };
+
+		eai_osal_thread_sleep(10);
+		eai_osal_pipe_write(&pipe_dut, chunk, sizeof(chunk), NULL,
+				    EAI_OSAL_WAIT_FOREVER);
+	}
+}
+
+/* A read sleeps through writes that leave the pipe under its threshold */
+static void test_pipe_threshold(void)
+{
+	eai_osal_thread_t thread;
+	uint8_t out[32];
+	size_t n;
+
+	eai_osal_pipe_create(&pipe_dut, pipe_storage, sizeof(pipe_storage), 8);
+
+	/* Under the threshold at the timeout, the bytes still come out */
+	eai_osal_pipe_write(&pipe_dut, "abc", 3, NULL, 0);
+	TEST_ASSERT_EQUAL(EAI_OSAL_TIMEOUT, eai_osal_pipe_read(&pipe_dut, out, 32, &n, 20));
+	TEST_ASSERT_EQUAL(3, n);
+	/* A short read needs only what it asked for */
+	eai_osal_pipe_write(&pipe_dut, "abc", 3, NULL, 0);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_read(&pipe_dut, out, 2, &n, 0));
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK, eai_osal_pipe_read(&pipe_dut, out, 1, &n, 0));
+	TEST_ASSERT_EQUAL(0, eai_osal_pipe_count(&pipe_dut));
+
+	eai_osal_thread_create(&thread, "dribble", pipe_dribble_entry, NULL,
+			       pipe_helper_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(pipe_helper_stack), 10);
+	TEST_ASSERT_EQUAL(EAI_OSAL_OK,
+			  eai_osal_pipe_read(&pipe_dut, out, sizeof(out), &n, 1000));
+	TEST_ASSERT_TRUE(n >= 8);
+	TEST_ASSERT_EQUAL(0, out[0]);
+	TEST_ASSERT_EQUAL(1, out[4]);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_pipe_destroy(&pipe_dut);
+}
+
+/* Mixed chunk sizes on both sides, in order and intact */
+#define PIPE_STREAM_BYTES 200000
+
+static atomic_int pipe_stream_errors;
+
+static void pipe_writer_entry(void *arg)
+{
+	uint8_t chunk[61];
+	uint32_t seq = 0;
+	size_t len = 1;
+
+	(void)arg;
+	while (seq < PIPE_STREAM_BYTES) {
+		size_t n = PIPE_STREAM_BYTES - seq < len ? PIPE_STREAM_BYTES - seq : len;
+		size_t written;
+
+		for (size_t i = 0; i < n; i++) {
+			chunk[i] = (uint8_t)(seq + i);
+		}
+		if (eai_osal_pipe_write(&pipe_dut, chunk, n, &written,
+					EAI_OSAL_WAIT_FOREVER) != EAI_OSAL_OK ||
+		    written != n) {
+			atomic_fetch_add(&pipe_stream_errors, 1);
+			return;
+		}
+		seq += n;
+		len = len % (sizeof(chunk) - 7) + 7;
+	}
+}
+
+static void test_pipe_stream(void)
+{
+	eai_osal_thread_t thread;
+	uint8_t out[97];
+	uint32_t seq = 0;
+	size_t len = 3;
+
+	atomic_store(&pipe_stream_errors, 0);
+	eai_osal_pipe_create(&pipe_dut, pipe_storage, 100, 5);
+	eai_osal_thread_create(&thread, "pipe_tx", pipe_writer_entry, NULL,
+			       pipe_helper_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(pipe_helper_stack), 10);
+
+	while (seq < PIPE_STREAM_BYTES) {
+		size_t n;
+
+		if (eai_osal_pipe_read(&pipe_dut, out, len, &n, 2000) != EAI_OSAL_OK &&
+		    seq + n < PIPE_STREAM_BYTES) {
+			break;
+		}
+		for (size_t i = 0; i < n; i++) {
+			if (out[i] != (uint8_t)(seq + i)) {
+				atomic_fetch_add(&pipe_stream_errors, 1);
+			}
+		}
+		seq += n;
+		len = len % (sizeof(out) - 11) + 11;
+	}
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	TEST_ASSERT_EQUAL(0, atomic_load(&pipe_stream_errors));
+	TEST_ASSERT_EQUAL(PIPE_STREAM_BYTES, seq);
+	TEST_ASSERT_EQUAL(0, eai_osal_pipe_count(&pipe_dut));
+	eai_osal_pipe_destroy(&pipe_dut);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Test runner
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+int main(void)
+{
+	UNITY_BEGIN();
+
+	/* Mutex (6) */
+	RUN_TEST(test_mutex_create_destroy);
+	RUN_TEST(test_mutex_lock_unlock);
+	RUN_TEST(test_mutex_recursive_lock);
+	RUN_TEST(test_mutex_try_lock);
+	RUN_TEST(test_mutex_contention_timeout);
+	RUN_TEST(test_mutex_null_param);
+
+	/* Semaphore (5) */
+	RUN_TEST(test_sem_create_destroy);
 	RUN_TEST(test_sem_binary);
 	RUN_TEST(test_sem_counting);
 	RUN_TEST(test_sem_timeout);
 	RUN_TEST(test_sem_give_at_limit);
 
-	/* Thread (4) */
+	/* Thread (9) */
 	RUN_TEST(test_thread_create_join);
 	RUN_TEST(test_thread_sleep);
 	RUN_TEST(test_thread_yield);
 	RUN_TEST(test_thread_priority);
+	RUN_TEST(test_thread_name_and_low_priority);
+	RUN_TEST(test_thread_high_priority);
+	RUN_TEST(test_thread_set_affinity);
+	RUN_TEST(test_thread_stats);
+	RUN_TEST(test_thread_foreach);
 
-	/* Queue (5) */
+	/* Queue (12) */
 	RUN_TEST(test_queue_create_destroy);
 	RUN_TEST(test_queue_send_recv);
 	RUN_TEST(test_queue_full);
 	RUN_TEST(test_queue_fifo_order);
 	RUN_TEST(test_queue_empty_timeout);
-
-	/* Timer (5) */
+	RUN_TEST(test_queue_reserve_commit);
+	RUN_TEST(test_queue_reserve_outstanding);
+	RUN_TEST(test_queue_zero_copy_in_place);
+	RUN_TEST(test_queue_send_recv_many);
+	RUN_TEST(test_queue_send_many_partial);
+	RUN_TEST(test_queue_drain_timeout);
+	RUN_TEST(test_queue_drain_collects);
+
+	/* Timer (7) */
 	RUN_TEST(test_timer_create_destroy);
 	RUN_TEST(test_timer_one_shot);
 	RUN_TEST(test_timer_periodic);
 	RUN_TEST(test_timer_stop);
 	RUN_TEST(test_timer_is_running);
+	RUN_TEST(test_timer_periodic_no_drift);
+	RUN_TEST(test_timer_many);
 
 	/* Event (5) */
 	RUN_TEST(test_event_create_destroy);
@@ -773,12 +3844,18 @@ int main(void)
 	RUN_TEST(test_critical_enter_exit);
 	RUN_TEST(test_critical_nested);
 
-	/* Time (3) */
+	/* Time (5 + 2 virtual-time) */
 	RUN_TEST(test_time_get_ms);
 	RUN_TEST(test_time_monotonic);
 	RUN_TEST(test_time_tick_roundtrip);
-
-	/* Work (9) */
+	RUN_TEST(test_time_us_ns);
+	RUN_TEST(test_time_cycles);
+#ifdef CONFIG_EAI_OSAL_VIRTUAL_TIME
+	RUN_TEST(test_vt_waits_exact);
+	RUN_TEST(test_vt_timer_exact);
+#endif
+
+	/* Work (18) */
 	RUN_TEST(test_work_init);
 	RUN_TEST(test_work_init_null);
 	RUN_TEST(test_work_submit);
@@ -786,8 +3863,86 @@ int main(void)
 	RUN_TEST(test_dwork_init);
 	RUN_TEST(test_dwork_submit);
 	RUN_TEST(test_dwork_cancel);
+	RUN_TEST(test_dwork_resubmit);
 	RUN_TEST(test_custom_workqueue);
 	RUN_TEST(test_dwork_submit_to_queue);
+	RUN_TEST(test_workqueue_depth_backpressure);
+	RUN_TEST(test_work_submit_timeout_waits);
+	RUN_TEST(test_dwork_full_queue_retry);
+	RUN_TEST(test_workqueue_stats_latency);
+	RUN_TEST(test_pool_runs_all);
+	RUN_TEST(test_pool_no_self_concurrency);
+	RUN_TEST(test_pool_no_head_of_line);
+	RUN_TEST(test_pool_fanout);
+	RUN_TEST(test_work_submit_prio);
+
+	/* SPSC (6) */
+	RUN_TEST(test_spsc_push_pop);
+	RUN_TEST(test_spsc_full_empty);
+	RUN_TEST(test_spsc_bulk_wraparound);
+	RUN_TEST(test_spsc_invalid);
+	RUN_TEST(test_spsc_blocking_timeout);
+	RUN_TEST(test_spsc_stress);
+
+	/* Stats (5) */
+	RUN_TEST(test_stats_mutex_contention);
+	RUN_TEST(test_stats_sem_histogram);
+	RUN_TEST(test_stats_queue_and_event);
+	RUN_TEST(test_stats_registry);
+	RUN_TEST(test_stats_reset);
+
+	/* Mempool (5) */
+	RUN_TEST(test_mempool_alloc_free);
+	RUN_TEST(test_mempool_invalid);
+	RUN_TEST(test_mempool_stats);
+	RUN_TEST(test_mempool_blocking);
+	RUN_TEST(test_mempool_stress);
+
+	/* Buf (5) */
+	RUN_TEST(test_buf_headroom_tailroom);
+	RUN_TEST(test_buf_refcount);
+	RUN_TEST(test_buf_fragments);
+	RUN_TEST(test_buf_exhaustion);
+	RUN_TEST(test_buf_shared_stress);
+
+	/* Poll (5) */
+	RUN_TEST(test_poll_ready_now);
+	RUN_TEST(test_poll_timeout);
+	RUN_TEST(test_poll_wakes_on_each_type);
+	RUN_TEST(test_poll_invalid);
+	RUN_TEST(test_poll_stress);
+
+	/* RWLock (5) */
+	RUN_TEST(test_rwlock_readers_share);
+	RUN_TEST(test_rwlock_unlock_errors);
+	RUN_TEST(test_rwlock_writer_preference);
+	RUN_TEST(test_rwlock_write_timeout);
+	RUN_TEST(test_rwlock_stress);
+
+	/* Atomic (2) */
+	RUN_TEST(test_atomic_ops);
+	RUN_TEST(test_atomic_stress);
+
+	/* PQueue (4) */
+	RUN_TEST(test_pqueue_priority_order);
+	RUN_TEST(test_pqueue_full_empty_timeout);
+	RUN_TEST(test_pqueue_invalid);
+	RUN_TEST(test_pqueue_stress);
+	RUN_TEST(test_pqueue_timeout_stress);
+
+	/* Task (5) */
+	RUN_TEST(test_work_poll_fires_on_ready);
+	RUN_TEST(test_work_poll_timeout_cancel);
+	RUN_TEST(test_work_poll_full_queue_retry);
+	RUN_TEST(test_task_sleep_full_queue);
+	RUN_TEST(test_task_awaits);
+	RUN_TEST(test_task_many_on_one_queue);
+
+	/* Pipe (4) */
+	RUN_TEST(test_pipe_partial_transfer);
+	RUN_TEST(test_pipe_invalid);
+	RUN_TEST(test_pipe_threshold);
+	RUN_TEST(test_pipe_stream);
 
 	return UNITY_END();
 }
@@ -1,6 +1,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/kernel.h>
 #include <eai_osal/eai_osal.h>
+#include <string.h>
 
 /* ═══════════════════════════════════════════════════════════════════════════
  * Mutex tests
@@ -249,6 +250,72 @@ ZTEST(osal_thread, test_priority)
 	zassert_equal(prio_order[1], 0, "Lower priority thread should run second");
 }
 
+ZTEST(osal_thread, test_set_affinity)
+{
+	eai_osal_thread_t thread;
+
+	prio_idx = 0;
+	eai_osal_thread_create(&thread, "aff", prio_thread_entry,
+			       (void *)(intptr_t)0,
+			       prio_stack_a,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(prio_stack_a), 5);
+
+	zassert_equal(eai_osal_thread_set_affinity(&thread, 0),
+		      EAI_OSAL_INVALID_PARAM);
+	/* Every CPU is always accepted */
+	zassert_equal(eai_osal_thread_set_affinity(&thread, UINT32_MAX), EAI_OSAL_OK);
+	zassert_equal(eai_osal_thread_set_affinity(NULL, 1), EAI_OSAL_INVALID_PARAM);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+}
+
+static K_SEM_DEFINE(stats_gate, 0, 1);
+EAI_OSAL_THREAD_STACK_DEFINE(stats_stack, 1024);
+
+/* Touch 256 bytes of stack, then hold on the gate */
+static void stats_thread_entry(void *arg)
+{
+	volatile uint8_t buf[256];
+
+	ARG_UNUSED(arg);
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)i;
+	}
+	k_sem_take(&stats_gate, K_FOREVER);
+}
+
+static void count_stats_thread(const eai_osal_thread_stats_t *st, void *arg)
+{
+	if (strcmp(st->name, "stats") == 0) {
+		(*(int *)arg)++;
+	}
+}
+
+ZTEST(osal_thread, test_stats)
+{
+	eai_osal_thread_t thread;
+	eai_osal_thread_stats_t st;
+	int found = 0;
+
+	eai_osal_thread_create(&thread, "stats", stats_thread_entry, NULL,
+			       stats_stack, EAI_OSAL_THREAD_STACK_SIZEOF(stats_stack), 10);
+	k_msleep(20);
+
+	zassert_equal(eai_osal_thread_get_stats(&thread, &st), EAI_OSAL_OK);
+	zassert_equal(strcmp(st.name, "stats"), 0);
+	zassert_true(st.stack_used >= 256, "stack_used %zu", st.stack_used);
+	zassert_true(st.stack_used < st.stack_size);
+	zassert_true(st.runtime_ns > 0);
+	zassert_true(st.switches >= 1);
+
+	eai_osal_thread_foreach(count_stats_thread, &found);
+	zassert_equal(found, 1);
+
+	k_sem_give(&stats_gate);
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	zassert_equal(eai_osal_thread_get_stats(&thread, &st), EAI_OSAL_ERROR);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Queue tests
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -331,6 +398,128 @@ ZTEST(osal_queue, test_empty_timeout)
 	eai_osal_queue_destroy(&queue);
 }
 
+ZTEST(osal_queue, test_reserve_commit)
+{
+	eai_osal_queue_t queue;
+	void *slot;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	zassert_equal(eai_osal_queue_reserve(&queue, &slot, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	*(int *)slot = 7;
+	zassert_equal(eai_osal_queue_commit(&queue, slot), EAI_OSAL_OK);
+
+	zassert_equal(eai_osal_queue_peek(&queue, &slot, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(*(int *)slot, 7);
+	zassert_equal(eai_osal_queue_release(&queue, slot), EAI_OSAL_OK);
+
+	zassert_equal(eai_osal_queue_peek(&queue, &slot, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_TIMEOUT);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+ZTEST(osal_queue, test_reserve_outstanding)
+{
+	eai_osal_queue_t queue;
+	void *wr, *rd, *other;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	zassert_equal(eai_osal_queue_reserve(&queue, &wr, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	/* Only one reservation per side at a time */
+	zassert_equal(eai_osal_queue_reserve(&queue, &other, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_ERROR);
+	*(int *)wr = 1;
+	zassert_equal(eai_osal_queue_commit(&queue, wr), EAI_OSAL_OK);
+	zassert_equal(eai_osal_queue_commit(&queue, wr), EAI_OSAL_ERROR);
+
+	zassert_equal(eai_osal_queue_peek(&queue, &rd, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(eai_osal_queue_peek(&queue, &other, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_ERROR);
+	zassert_equal(eai_osal_queue_release(&queue, rd), EAI_OSAL_OK);
+	zassert_equal(eai_osal_queue_release(&queue, rd), EAI_OSAL_ERROR);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+ZTEST(osal_queue, test_send_recv_many)
+{
+	eai_osal_queue_t queue;
+	int in[3] = {1, 2, 3};
+	int out[4] = {0};
+	uint32_t n = 0;
+	int msg = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	/* Offset the ring so the batch wraps around the end of the buffer */
+	eai_osal_queue_send(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_send(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_recv(&queue, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_queue_recv(&queue, &msg, EAI_OSAL_NO_WAIT);
+
+	zassert_equal(eai_osal_queue_send_many(&queue, in, 3, &n, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(n, 3);
+	zassert_equal(eai_osal_queue_recv_many(&queue, out, 4, &n, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(n, 3);
+	zassert_mem_equal(out, in, sizeof(in));
+
+	zassert_equal(eai_osal_queue_recv_many(&queue, out, 4, &n, 50),
+		      EAI_OSAL_TIMEOUT);
+	zassert_equal(n, 0);
+
+	eai_osal_queue_destroy(&queue);
+}
+
+ZTEST(osal_queue, test_send_many_partial)
+{
+	eai_osal_queue_t queue;
+	int in[6] = {1, 2, 3, 4, 5, 6};
+	int out[4] = {0};
+	uint32_t n = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+
+	zassert_equal(eai_osal_queue_send_many(&queue, in, 6, &n, 50),
+		      EAI_OSAL_TIMEOUT);
+	zassert_equal(n, 4, "Send should stop when the queue stays full");
+
+	eai_osal_queue_recv_many(&queue, out, 4, &n, EAI_OSAL_NO_WAIT);
+	zassert_equal(n, 4);
+	zassert_mem_equal(out, in, sizeof(out));
+
+	eai_osal_queue_destroy(&queue);
+}
+
+ZTEST(osal_queue, test_drain_timeout)
+{
+	eai_osal_queue_t queue;
+	int in[2] = {7, 8};
+	int out[4] = {0};
+	uint32_t n = 0;
+
+	eai_osal_queue_create(&queue, sizeof(int), 4, queue_buf_4);
+	eai_osal_queue_send_many(&queue, in, 2, NULL, EAI_OSAL_NO_WAIT);
+
+	int64_t start = k_uptime_get();
+
+	zassert_equal(eai_osal_queue_drain(&queue, out, 4, &n, 50),
+		      EAI_OSAL_TIMEOUT);
+	/* Partial batch is still delivered after waiting out the timeout */
+	zassert_equal(n, 2);
+	zassert_mem_equal(out, in, sizeof(in));
+	zassert_true(k_uptime_get() - start >= 40);
+
+	eai_osal_queue_destroy(&queue);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Timer tests
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -581,6 +770,33 @@ ZTEST(osal_time, test_tick_roundtrip)
 		     "Tick roundtrip off by %d ms", diff);
 }
 
+ZTEST(osal_time, test_us_ns)
+{
+	uint64_t us = eai_osal_time_get_us();
+	uint64_t ns = eai_osal_time_get_ns();
+
+	zassert_true(ns / 1000 >= us, "ns and us should share a clock");
+
+	k_msleep(5);
+
+	uint64_t us2 = eai_osal_time_get_us();
+
+	zassert_true(us2 - us >= 4000, "Elapsed %llu us, expected ~5000",
+		     us2 - us);
+}
+
+ZTEST(osal_time, test_cycles)
+{
+	uint32_t c0 = eai_osal_cycle_get();
+
+	k_msleep(5);
+
+	uint64_t ns = eai_osal_cycles_to_ns(eai_osal_cycle_get() - c0);
+
+	zassert_true(ns >= 4000000 && ns < 500000000,
+		     "Cycle delta %llu ns, expected ~5 ms", ns);
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * Work queue tests
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -628,6 +844,24 @@ ZTEST(osal_work, test_work_submit)
 	zassert_equal(work_counter, 1, "Work callback should have executed");
 }
 
+/* k_work is FIFO, so the level is only checked, but the item still runs */
+ZTEST(osal_work, test_work_submit_prio)
+{
+	eai_osal_work_t work;
+
+	work_counter = 0;
+	k_sem_init(&work_sem, 0, 1);
+
+	eai_osal_work_init(&work, work_callback, NULL);
+	zassert_equal(eai_osal_work_submit_prio(&work, NULL, EAI_OSAL_PQUEUE_LEVELS),
+		      EAI_OSAL_INVALID_PARAM);
+	zassert_equal(eai_osal_work_submit_prio(&work, NULL, EAI_OSAL_PQUEUE_LEVELS - 1),
+		      EAI_OSAL_OK);
+
+	k_sem_take(&work_sem, K_MSEC(500));
+	zassert_equal(work_counter, 1, "Work callback should have executed");
+}
+
 static volatile int work_arg_val;
 
 static void work_with_arg(void *arg)
@@ -745,3 +979,826 @@ ZTEST(osal_work, test_dwork_submit_to_queue)
 	k_sem_take(&work_sem, K_MSEC(500));
 	zassert_equal(work_counter, 1, "Delayed work on custom queue should execute");
 }
+
+static struct k_sem wq_gate;
+
+static void wq_gate_callback(void *arg)
+{
+	ARG_UNUSED(arg);
+	k_sem_take(&wq_gate, K_MSEC(2000));
+}
+
+ZTEST(osal_work, test_workqueue_stats_latency)
+{
+	eai_osal_work_t gate, work;
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	k_sem_init(&work_sem, 0, 1);
+	k_sem_init(&wq_gate, 0, 1);
+
+	ensure_test_wq();
+
+	/* Park the worker in the gate item so the next one waits in the queue */
+	eai_osal_work_init(&gate, wq_gate_callback, NULL);
+	eai_osal_work_submit_to(&gate, &test_wq);
+	k_msleep(10);
+	eai_osal_workqueue_reset_stats(&test_wq);
+
+	eai_osal_work_init(&work, work_callback, NULL);
+	eai_osal_work_submit_to(&work, &test_wq);
+	k_msleep(30);
+	k_sem_give(&wq_gate);
+	k_sem_take(&work_sem, K_MSEC(500));
+
+	zassert_equal(eai_osal_workqueue_get_stats(&test_wq, &stats), EAI_OSAL_OK);
+	zassert_equal(stats.depth, 0, "k_work queues are unbounded");
+	zassert_equal(stats.pending, 0);
+	zassert_equal(stats.high_water, 1);
+	zassert_equal(stats.rejected, 0);
+	zassert_true(stats.max_latency_us >= 25000,
+		     "Latency %u us should cover the 30ms wait", stats.max_latency_us);
+}
+
+ZTEST(osal_work, test_work_submit_timeout)
+{
+	eai_osal_work_t work;
+	eai_osal_workqueue_stats_t stats;
+
+	work_counter = 0;
+	k_sem_init(&work_sem, 0, 1);
+
+	/* NULL targets the system work queue */
+	eai_osal_work_init(&work, work_callback, NULL);
+	zassert_equal(eai_osal_work_submit_timeout(&work, NULL, 100), EAI_OSAL_OK);
+
+	k_sem_take(&work_sem, K_MSEC(500));
+	zassert_equal(work_counter, 1, "Work submitted with timeout should execute");
+	zassert_equal(eai_osal_workqueue_get_stats(NULL, &stats), EAI_OSAL_OK);
+	zassert_true(stats.high_water >= 1);
+}
+
+/* Work queue pool */
+EAI_OSAL_THREAD_STACK_ARRAY_DEFINE(pool_stacks, 2, 1024);
+
+#define POOL_ITEMS 16
+
+static atomic_t pool_counter;
+static atomic_t pool_in_flight;
+static volatile bool pool_overlap;
+
+static void pool_count_callback(void *arg)
+{
+	ARG_UNUSED(arg);
+	atomic_inc(&pool_counter);
+}
+
+/* Flags overlap if two workers are ever inside the same item at once */
+static void pool_exclusive_callback(void *arg)
+{
+	ARG_UNUSED(arg);
+	if (atomic_inc(&pool_in_flight) != 0) {
+		pool_overlap = true;
+	}
+	k_msleep(20);
+	atomic_dec(&pool_in_flight);
+	atomic_inc(&pool_counter);
+}
+
+ZTEST(osal_work, test_pool_runs_all)
+{
+	eai_osal_workqueue_pool_t pool;
+	eai_osal_work_t items[POOL_ITEMS];
+
+	atomic_set(&pool_counter, 0);
+	zassert_equal(eai_osal_workqueue_pool_create(&pool, 2, "pool", pool_stacks,
+						     EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+						     10), EAI_OSAL_OK);
+
+	for (int i = 0; i < POOL_ITEMS; i++) {
+		eai_osal_work_init(&items[i], pool_count_callback, NULL);
+		zassert_equal(eai_osal_work_submit_to_pool(&items[i], &pool),
+			      EAI_OSAL_OK);
+	}
+
+	/* Destroy finishes queued work before stopping the workers */
+	zassert_equal(eai_osal_workqueue_pool_destroy(&pool), EAI_OSAL_OK);
+	zassert_equal(atomic_get(&pool_counter), POOL_ITEMS,
+		      "Pool should run every submitted item");
+}
+
+ZTEST(osal_work, test_pool_no_self_concurrency)
+{
+	eai_osal_workqueue_pool_t pool;
+	eai_osal_work_t work;
+
+	atomic_set(&pool_counter, 0);
+	atomic_set(&pool_in_flight, 0);
+	pool_overlap = false;
+	eai_osal_workqueue_pool_create(&pool, 2, "pool", pool_stacks,
+				       EAI_OSAL_THREAD_STACK_SIZEOF(pool_stacks[0]),
+				       10);
+	eai_osal_work_init(&work, pool_exclusive_callback, NULL);
+
+	/* Resubmit while running: must queue one rerun, never a second copy */
+	eai_osal_work_submit_to_pool(&work, &pool);
+	k_msleep(5);
+	for (int i = 0; i < 5; i++) {
+		zassert_equal(eai_osal_work_submit_to_pool(&work, &pool),
+			      EAI_OSAL_OK);
+	}
+
+	eai_osal_workqueue_pool_destroy(&pool);
+	zassert_false(pool_overlap, "Work item ran concurrently with itself");
+	zassert_equal(atomic_get(&pool_counter), 2);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SPSC ring tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_spsc, NULL, NULL, NULL, NULL, NULL);
+
+static uint32_t spsc_buf[8];
+
+ZTEST(osal_spsc, test_push_pop)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t val;
+
+	zassert_equal(eai_osal_spsc_create(&ring, sizeof(uint32_t), 8, spsc_buf,
+					   false), EAI_OSAL_OK);
+
+	for (uint32_t i = 0; i < 3; i++) {
+		zassert_equal(eai_osal_spsc_push(&ring, &i, EAI_OSAL_NO_WAIT),
+			      EAI_OSAL_OK);
+	}
+	zassert_equal(eai_osal_spsc_count(&ring), 3);
+
+	for (uint32_t i = 0; i < 3; i++) {
+		zassert_equal(eai_osal_spsc_pop(&ring, &val, EAI_OSAL_NO_WAIT),
+			      EAI_OSAL_OK);
+		zassert_equal(val, i, "SPSC ring should preserve FIFO order");
+	}
+	eai_osal_spsc_destroy(&ring);
+}
+
+ZTEST(osal_spsc, test_full_empty)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t val = 0;
+
+	eai_osal_spsc_create(&ring, sizeof(uint32_t), 8, spsc_buf, false);
+
+	zassert_equal(eai_osal_spsc_pop(&ring, &val, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_TIMEOUT);
+	for (uint32_t i = 0; i < 8; i++) {
+		eai_osal_spsc_push(&ring, &i, EAI_OSAL_NO_WAIT);
+	}
+	zassert_equal(eai_osal_spsc_push(&ring, &val, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_TIMEOUT);
+	zassert_equal(eai_osal_spsc_space(&ring), 0);
+
+	eai_osal_spsc_destroy(&ring);
+}
+
+ZTEST(osal_spsc, test_bulk_wraparound)
+{
+	eai_osal_spsc_ring_t ring;
+	uint32_t in[6] = {100, 101, 102, 103, 104, 105};
+	uint32_t out[8];
+
+	eai_osal_spsc_create(&ring, sizeof(uint32_t), 8, spsc_buf, false);
+
+	zassert_equal(eai_osal_spsc_write(&ring, in, 5), 5);
+	zassert_equal(eai_osal_spsc_read(&ring, out, 8), 5);
+
+	zassert_equal(eai_osal_spsc_write(&ring, in, 6), 6);
+	zassert_equal(eai_osal_spsc_write(&ring, in, 6), 2,
+		      "Bulk write should truncate to free space");
+	zassert_equal(eai_osal_spsc_read(&ring, out, 8), 8);
+	zassert_mem_equal(out, in, sizeof(in));
+	zassert_equal(out[6], 100);
+	zassert_equal(out[7], 101);
+
+	eai_osal_spsc_destroy(&ring);
+}
+
+ZTEST(osal_spsc, test_invalid_capacity)
+{
+	eai_osal_spsc_ring_t ring;
+
+	zassert_equal(eai_osal_spsc_create(&ring, sizeof(uint32_t), 6, spsc_buf,
+					   false), EAI_OSAL_INVALID_PARAM);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Wait-time stats tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_stats, NULL, NULL, NULL, NULL, NULL);
+
+struct stats_find {
+	const char *name;
+	eai_osal_stats_t out;
+	int hits;
+};
+
+static void stats_find_cb(const eai_osal_stats_t *st, void *arg)
+{
+	struct stats_find *f = arg;
+
+	if (strcmp(st->name, f->name) == 0) {
+		f->out = *st;
+		f->hits++;
+	}
+}
+
+static eai_osal_mutex_t stats_mtx;
+K_THREAD_STACK_DEFINE(stats_stack, 1024);
+static struct k_thread stats_thread;
+
+static void stats_locker(void *p1, void *p2, void *p3)
+{
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mutex_unlock(&stats_mtx);
+}
+
+ZTEST(osal_stats, test_mutex_contention)
+{
+	struct stats_find f = { .name = "st_mtx" };
+
+	zassert_equal(eai_osal_mutex_create_named(&stats_mtx, "st_mtx"), EAI_OSAL_OK);
+
+	eai_osal_mutex_lock(&stats_mtx, EAI_OSAL_WAIT_FOREVER);
+	k_thread_create(&stats_thread, stats_stack,
+			K_THREAD_STACK_SIZEOF(stats_stack), stats_locker,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	k_msleep(20);
+	eai_osal_mutex_unlock(&stats_mtx);
+	k_thread_join(&stats_thread, K_FOREVER);
+
+	eai_osal_stats_foreach(stats_find_cb, &f);
+	zassert_equal(f.hits, 1);
+	zassert_equal(f.out.acquires, 2);
+	zassert_equal(f.out.contended, 1);
+	zassert_true(f.out.wait_max_us >= 10000, "Wait should cover the hold");
+
+	eai_osal_mutex_destroy(&stats_mtx);
+}
+
+ZTEST(osal_stats, test_registry_and_reset)
+{
+	eai_osal_sem_t sem;
+	struct stats_find f = { .name = "st_sem" };
+
+	eai_osal_sem_create_named(&sem, 1, 1, "st_sem");
+	eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT);
+
+	eai_osal_stats_foreach(stats_find_cb, &f);
+	zassert_equal(f.hits, 1);
+	zassert_equal(f.out.acquires, 1);
+
+	eai_osal_stats_reset();
+	f.hits = 0;
+	eai_osal_stats_foreach(stats_find_cb, &f);
+	zassert_equal(f.out.acquires, 0);
+
+	eai_osal_sem_destroy(&sem);
+	f.hits = 0;
+	eai_osal_stats_foreach(stats_find_cb, &f);
+	zassert_equal(f.hits, 0, "Destroy should unlist the object");
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Mempool tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_mempool, NULL, NULL, NULL, NULL, NULL);
+
+#define MEMPOOL_BLOCK 32
+
+EAI_OSAL_MEMPOOL_BUF_DEFINE(mempool_buf, MEMPOOL_BLOCK, 4);
+
+ZTEST(osal_mempool, test_alloc_free)
+{
+	eai_osal_mempool_t pool;
+	eai_osal_mempool_stats_t st;
+	void *blk[4];
+	void *extra;
+
+	zassert_equal(eai_osal_mempool_create(&pool, MEMPOOL_BLOCK, 4, mempool_buf),
+		      EAI_OSAL_OK);
+	for (int i = 0; i < 4; i++) {
+		zassert_equal(eai_osal_mempool_alloc(&pool, &blk[i], EAI_OSAL_NO_WAIT),
+			      EAI_OSAL_OK);
+		memset(blk[i], 0xA5, MEMPOOL_BLOCK);
+	}
+	zassert_equal(eai_osal_mempool_alloc(&pool, &extra, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_TIMEOUT);
+	zassert_equal(eai_osal_mempool_free(&pool, (uint8_t *)blk[0] + 4),
+		      EAI_OSAL_INVALID_PARAM);
+
+	eai_osal_mempool_get_stats(&pool, &st);
+	zassert_equal(st.used, 4);
+	zassert_equal(st.high_water, 4);
+	zassert_equal(st.failures, 1);
+
+	for (int i = 0; i < 4; i++) {
+		zassert_equal(eai_osal_mempool_free(&pool, blk[i]), EAI_OSAL_OK);
+	}
+	eai_osal_mempool_get_stats(&pool, &st);
+	zassert_equal(st.used, 0);
+	eai_osal_mempool_destroy(&pool);
+}
+
+static eai_osal_mempool_t mempool_wait_pool;
+static void *mempool_held;
+
+static void mempool_free_entry(void *arg)
+{
+	ARG_UNUSED(arg);
+	k_msleep(50);
+	eai_osal_mempool_free(&mempool_wait_pool, mempool_held);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(mempool_stack, 1024);
+
+ZTEST(osal_mempool, test_blocking_alloc)
+{
+	eai_osal_thread_t thread;
+	void *blk;
+
+	eai_osal_mempool_create(&mempool_wait_pool, MEMPOOL_BLOCK, 1, mempool_buf);
+	eai_osal_mempool_alloc(&mempool_wait_pool, &mempool_held, EAI_OSAL_NO_WAIT);
+
+	zassert_equal(eai_osal_mempool_alloc(&mempool_wait_pool, &blk, 20),
+		      EAI_OSAL_TIMEOUT);
+
+	eai_osal_thread_create(&thread, "mp_free", mempool_free_entry, NULL,
+			       mempool_stack,
+			       EAI_OSAL_THREAD_STACK_SIZEOF(mempool_stack), 10);
+	zassert_equal(eai_osal_mempool_alloc(&mempool_wait_pool, &blk, 1000),
+		      EAI_OSAL_OK);
+	zassert_equal_ptr(blk, mempool_held);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_mempool_free(&mempool_wait_pool, blk);
+	eai_osal_mempool_destroy(&mempool_wait_pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Buffer tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_buf, NULL, NULL, NULL, NULL, NULL);
+
+EAI_BUF_POOL_STORAGE_DEFINE(buf_storage, 3, 32);
+
+ZTEST(osal_buf, test_headroom_and_ref)
+{
+	eai_buf_pool_t pool;
+	eai_osal_mempool_stats_t st;
+	eai_buf_t *buf;
+
+	zassert_equal(eai_buf_pool_create(&pool, 3, 32, buf_storage), EAI_OSAL_OK);
+	zassert_equal(eai_buf_alloc(&pool, &buf, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+
+	eai_buf_reserve(buf, 4);
+	eai_buf_add_mem(buf, "data", 4);
+	zassert_not_null(eai_buf_push(buf, 4));
+	zassert_equal(buf->len, 8);
+	zassert_equal(eai_buf_tailroom(buf), 24);
+
+	eai_buf_ref(buf);
+	eai_buf_unref(buf);
+	eai_buf_pool_get_stats(&pool, &st);
+	zassert_equal(st.used, 1);
+	eai_buf_unref(buf);
+	eai_buf_pool_get_stats(&pool, &st);
+	zassert_equal(st.used, 0);
+	eai_buf_pool_destroy(&pool);
+}
+
+ZTEST(osal_buf, test_fragments)
+{
+	eai_buf_pool_t pool;
+	eai_osal_mempool_stats_t st;
+	eai_buf_t *head, *frag;
+	char out[8] = {0};
+
+	eai_buf_pool_create(&pool, 3, 32, buf_storage);
+	eai_buf_alloc(&pool, &head, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(head, "abc", 3);
+	eai_buf_alloc(&pool, &frag, EAI_OSAL_NO_WAIT);
+	eai_buf_add_mem(frag, "defg", 4);
+	eai_buf_frag_add(head, frag);
+
+	zassert_equal(eai_buf_chain_len(head), 7);
+	zassert_equal(eai_buf_linearize(head, out, 1, 4), 4);
+	zassert_mem_equal(out, "bcde", 4);
+
+	eai_buf_unref(head);
+	eai_buf_pool_get_stats(&pool, &st);
+	zassert_equal(st.used, 0, "Freeing the head should free the chain");
+	eai_buf_pool_destroy(&pool);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Poll tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_poll, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(osal_poll, test_ready_and_timeout)
+{
+	eai_osal_sem_t sem;
+	eai_osal_queue_t q;
+	eai_osal_event_t ev;
+	uint32_t q_buf[4];
+	uint32_t msg = 7;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	eai_osal_queue_create(&q, sizeof(uint32_t), 4, q_buf);
+	eai_osal_event_create(&ev);
+
+	eai_osal_poll_event_t events[] = {
+		EAI_OSAL_POLL_SEM(&sem),
+		EAI_OSAL_POLL_QUEUE(&q),
+		EAI_OSAL_POLL_EVENT(&ev, 0x06),
+	};
+
+	eai_osal_event_set(&ev, 0x01);
+	zassert_equal(eai_osal_poll(events, 3, 20), EAI_OSAL_TIMEOUT,
+		      "Bits outside the mask should not count");
+
+	eai_osal_queue_send(&q, &msg, EAI_OSAL_NO_WAIT);
+	eai_osal_event_set(&ev, 0x04);
+	zassert_equal(eai_osal_poll(events, 3, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_false(events[0].ready);
+	zassert_true(events[1].ready);
+	zassert_true(events[2].ready);
+
+	zassert_equal(eai_osal_poll(NULL, 1, 0), EAI_OSAL_INVALID_PARAM);
+	zassert_equal(eai_osal_poll(events, 0, 0), EAI_OSAL_INVALID_PARAM);
+
+	eai_osal_queue_destroy(&q);
+	eai_osal_sem_destroy(&sem);
+	eai_osal_event_destroy(&ev);
+}
+
+static eai_osal_sem_t poll_sem;
+static eai_osal_event_t poll_ev;
+
+static void poll_event_setter(void *arg)
+{
+	ARG_UNUSED(arg);
+	k_msleep(30);
+	eai_osal_event_set(&poll_ev, 0x10);
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(poll_stack, 1024);
+
+ZTEST(osal_poll, test_wake_on_event)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_sem_create(&poll_sem, 0, 1);
+	eai_osal_event_create(&poll_ev);
+
+	eai_osal_poll_event_t events[] = {
+		EAI_OSAL_POLL_SEM(&poll_sem),
+		EAI_OSAL_POLL_EVENT(&poll_ev, 0x10),
+	};
+
+	eai_osal_thread_create(&thread, "poll_set", poll_event_setter, NULL,
+			       poll_stack, EAI_OSAL_THREAD_STACK_SIZEOF(poll_stack), 10);
+	zassert_equal(eai_osal_poll(events, 2, 1000), EAI_OSAL_OK);
+	zassert_false(events[0].ready);
+	zassert_true(events[1].ready);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_sem_destroy(&poll_sem);
+	eai_osal_event_destroy(&poll_ev);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * RWLock tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_rwlock, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(osal_rwlock, test_readers_share)
+{
+	eai_osal_rwlock_t rw;
+
+	zassert_equal(eai_osal_rwlock_create(&rw), EAI_OSAL_OK);
+
+	zassert_equal(eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_write_lock(&rw, 20), EAI_OSAL_TIMEOUT,
+		      "Readers should keep a writer out");
+	zassert_equal(eai_osal_rwlock_read_unlock(&rw), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_read_unlock(&rw), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_read_unlock(&rw), EAI_OSAL_ERROR);
+
+	zassert_equal(eai_osal_rwlock_write_lock(&rw, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_read_lock(&rw, 20), EAI_OSAL_TIMEOUT,
+		      "A writer should keep readers out");
+	zassert_equal(eai_osal_rwlock_write_unlock(&rw), EAI_OSAL_OK);
+	zassert_equal(eai_osal_rwlock_write_unlock(&rw), EAI_OSAL_ERROR);
+
+	zassert_equal(eai_osal_rwlock_read_lock(&rw, EAI_OSAL_NO_WAIT), EAI_OSAL_OK,
+		      "A timed-out writer should not hold readers back");
+	eai_osal_rwlock_read_unlock(&rw);
+	eai_osal_rwlock_destroy(&rw);
+}
+
+static eai_osal_rwlock_t rw_lock;
+static eai_osal_atomic_t rw_writer_done;
+
+static void rw_writer(void *arg)
+{
+	ARG_UNUSED(arg);
+	if (eai_osal_rwlock_write_lock(&rw_lock, EAI_OSAL_WAIT_FOREVER) == EAI_OSAL_OK) {
+		eai_osal_atomic_store(&rw_writer_done, 1, EAI_OSAL_ATOMIC_RELEASE);
+		eai_osal_rwlock_write_unlock(&rw_lock);
+	}
+}
+
+EAI_OSAL_THREAD_STACK_DEFINE(rw_stack, 1024);
+
+ZTEST(osal_rwlock, test_writer_preference)
+{
+	eai_osal_thread_t thread;
+
+	eai_osal_rwlock_create(&rw_lock);
+	eai_osal_atomic_init(&rw_writer_done, 0);
+
+	eai_osal_rwlock_read_lock(&rw_lock, EAI_OSAL_NO_WAIT);
+	eai_osal_thread_create(&thread, "rw_writer", rw_writer, NULL,
+			       rw_stack, EAI_OSAL_THREAD_STACK_SIZEOF(rw_stack), 10);
+	k_msleep(30);
+
+	zassert_equal(eai_osal_rwlock_read_lock(&rw_lock, 20), EAI_OSAL_TIMEOUT,
+		      "A new reader should queue behind a waiting writer");
+
+	eai_osal_rwlock_read_unlock(&rw_lock);
+	zassert_equal(eai_osal_rwlock_read_lock(&rw_lock, 1000), EAI_OSAL_OK);
+	zassert_equal(eai_osal_atomic_load(&rw_writer_done, EAI_OSAL_ATOMIC_ACQUIRE), 1,
+		      "The writer should have gone first");
+	eai_osal_rwlock_read_unlock(&rw_lock);
+
+	eai_osal_thread_join(&thread, EAI_OSAL_WAIT_FOREVER);
+	eai_osal_rwlock_destroy(&rw_lock);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Atomic tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_atomic, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(osal_atomic, test_ops)
+{
+	eai_osal_atomic_t a = EAI_OSAL_ATOMIC_INIT(5);
+
+	zassert_equal(eai_osal_atomic_add(&a, 3, EAI_OSAL_ATOMIC_ACQ_REL), 5);
+	zassert_equal(eai_osal_atomic_sub(&a, 1, EAI_OSAL_ATOMIC_SEQ_CST), 8);
+	zassert_equal(eai_osal_atomic_or(&a, 0x100, EAI_OSAL_ATOMIC_RELAXED), 7);
+	zassert_equal(eai_osal_atomic_and(&a, 0x0ff, EAI_OSAL_ATOMIC_RELAXED), 0x107);
+	zassert_equal(eai_osal_atomic_exchange(&a, 20, EAI_OSAL_ATOMIC_ACQ_REL), 7);
+
+	uint32_t expected = 1;
+
+	zassert_false(eai_osal_atomic_cas(&a, &expected, 2, EAI_OSAL_ATOMIC_RELEASE));
+	zassert_equal(expected, 20, "A failed CAS should load the current value");
+	zassert_true(eai_osal_atomic_cas(&a, &expected, 2, EAI_OSAL_ATOMIC_ACQ_REL));
+	zassert_equal(eai_osal_atomic_load(&a, EAI_OSAL_ATOMIC_ACQUIRE), 2);
+
+	int x;
+	eai_osal_atomic_ptr_t p = EAI_OSAL_ATOMIC_INIT(NULL);
+	void *old = NULL;
+
+	zassert_true(eai_osal_atomic_ptr_cas(&p, &old, &x, EAI_OSAL_ATOMIC_ACQ_REL));
+	zassert_equal_ptr(eai_osal_atomic_ptr_exchange(&p, NULL, EAI_OSAL_ATOMIC_SEQ_CST), &x);
+	zassert_is_null(eai_osal_atomic_ptr_load(&p, EAI_OSAL_ATOMIC_ACQUIRE));
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PQueue tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_pqueue, NULL, NULL, NULL, NULL, NULL);
+
+static uint8_t pq_buf[EAI_OSAL_PQUEUE_BUF_SIZE(sizeof(uint32_t), 8)];
+
+ZTEST(osal_pqueue, test_priority_order)
+{
+	eai_osal_pqueue_t pq;
+	static const uint32_t sent[] = { 10, 30, 11, 70, 31, 12, 71 };
+	static const uint32_t want[] = { 70, 71, 30, 31, 10, 11, 12 };
+	uint32_t v;
+	uint8_t prio;
+
+	zassert_equal(eai_osal_pqueue_create(&pq, sizeof(uint32_t), 8, pq_buf), EAI_OSAL_OK);
+
+	/* Level in the tens digit, arrival order in the units */
+	for (size_t i = 0; i < ARRAY_SIZE(sent); i++) {
+		zassert_equal(eai_osal_pqueue_send(&pq, &sent[i], (uint8_t)(sent[i] / 10),
+						   EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	}
+	zassert_equal(eai_osal_pqueue_count(&pq), ARRAY_SIZE(sent));
+	for (size_t i = 0; i < ARRAY_SIZE(want); i++) {
+		zassert_equal(eai_osal_pqueue_recv(&pq, &v, &prio, EAI_OSAL_NO_WAIT),
+			      EAI_OSAL_OK);
+		zassert_equal(v, want[i], "Highest level first, FIFO within a level");
+		zassert_equal(prio, want[i] / 10);
+	}
+
+	eai_osal_pqueue_destroy(&pq);
+}
+
+ZTEST(osal_pqueue, test_full_empty)
+{
+	eai_osal_pqueue_t pq;
+	uint32_t v = 0;
+
+	eai_osal_pqueue_create(&pq, sizeof(uint32_t), 2, pq_buf);
+
+	zassert_equal(eai_osal_pqueue_recv(&pq, &v, NULL, 20), EAI_OSAL_TIMEOUT);
+	zassert_equal(eai_osal_pqueue_send(&pq, &v, 0, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(eai_osal_pqueue_send(&pq, &v, 0, EAI_OSAL_NO_WAIT), EAI_OSAL_OK);
+	zassert_equal(eai_osal_pqueue_send(&pq, &v, 7, 20), EAI_OSAL_TIMEOUT,
+		      "A full queue is full at every level");
+	zassert_equal(eai_osal_pqueue_send(&pq, &v, EAI_OSAL_PQUEUE_LEVELS, 0),
+		      EAI_OSAL_INVALID_PARAM);
+
+	eai_osal_pqueue_destroy(&pq);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Task tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_task, NULL, NULL, NULL, NULL, NULL);
+
+static eai_osal_poll_event_t wp_event;
+static bool wp_was_ready;
+static K_SEM_DEFINE(wp_fired, 0, 1);
+
+static void wp_callback(void *arg)
+{
+	wp_was_ready = wp_event.ready;
+	k_sem_give(&wp_fired);
+}
+
+ZTEST(osal_task, test_work_poll)
+{
+	eai_osal_work_poll_t wp;
+	eai_osal_sem_t sem;
+
+	eai_osal_sem_create(&sem, 0, 1);
+	wp_event = (eai_osal_poll_event_t)EAI_OSAL_POLL_SEM(&sem);
+	zassert_equal(eai_osal_work_poll_init(&wp, wp_callback, NULL), EAI_OSAL_OK);
+
+	zassert_equal(eai_osal_work_poll_submit(&wp, NULL, &wp_event, 1, 2000), EAI_OSAL_OK);
+	zassert_equal(eai_osal_work_poll_submit(&wp, NULL, &wp_event, 1, 2000),
+		      EAI_OSAL_ERROR, "Already armed");
+	eai_osal_sem_give(&sem);
+	zassert_equal(k_sem_take(&wp_fired, K_MSEC(1000)), 0);
+	zassert_true(wp_was_ready);
+	eai_osal_sem_take(&sem, EAI_OSAL_NO_WAIT);
+
+	zassert_equal(eai_osal_work_poll_submit(&wp, NULL, &wp_event, 1, 20), EAI_OSAL_OK);
+	zassert_equal(k_sem_take(&wp_fired, K_MSEC(1000)), 0);
+	zassert_false(wp_was_ready, "Fired on the timeout");
+
+	zassert_equal(eai_osal_work_poll_submit(&wp, NULL, &wp_event, 1,
+						EAI_OSAL_WAIT_FOREVER), EAI_OSAL_OK);
+	zassert_equal(eai_osal_work_poll_cancel(&wp), EAI_OSAL_OK);
+	eai_osal_sem_give(&sem);
+	zassert_equal(k_sem_take(&wp_fired, K_MSEC(50)), -EAGAIN, "Cancelled work ran");
+
+	eai_osal_sem_destroy(&sem);
+}
+
+struct relay {
+	eai_osal_task_t task;
+	eai_osal_queue_t in;
+	uint32_t in_buf[4];
+	uint32_t sum;
+	eai_osal_status_t ret;
+};
+
+static K_SEM_DEFINE(relay_done, 0, 1);
+
+static void relay_fn(eai_osal_task_t *task)
+{
+	struct relay *r = CONTAINER_OF(task, struct relay, task);
+	uint32_t v = 0;
+
+	EAI_OSAL_TASK_BEGIN(task);
+	for (;;) {
+		EAI_OSAL_TASK_AWAIT_QUEUE(task, &r->in, &v, 1000, r->ret);
+		if (r->ret != EAI_OSAL_OK || v == 0) {
+			break;
+		}
+		r->sum += v;
+		EAI_OSAL_TASK_SLEEP(task, 1);
+	}
+	k_sem_give(&relay_done);
+	EAI_OSAL_TASK_END(task);
+}
+
+ZTEST(osal_task, test_task_queue_flow)
+{
+	static struct relay r;
+	uint32_t v;
+
+	memset(&r, 0, sizeof(r));
+	eai_osal_queue_create(&r.in, sizeof(uint32_t), 4, r.in_buf);
+	zassert_equal(eai_osal_task_init(&r.task, relay_fn, NULL), EAI_OSAL_OK);
+	zassert_equal(eai_osal_task_start(&r.task, NULL), EAI_OSAL_OK);
+
+	for (v = 1; v <= 3; v++) {
+		eai_osal_queue_send(&r.in, &v, EAI_OSAL_WAIT_FOREVER);
+		k_msleep(5);
+	}
+	v = 0;
+	eai_osal_queue_send(&r.in, &v, EAI_OSAL_WAIT_FOREVER);
+
+	zassert_equal(k_sem_take(&relay_done, K_MSEC(1000)), 0);
+	zassert_equal(r.ret, EAI_OSAL_OK);
+	zassert_equal(r.sum, 6);
+	k_msleep(5);
+	zassert_true(eai_osal_task_is_done(&r.task));
+
+	eai_osal_queue_destroy(&r.in);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * Pipe tests
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+ZTEST_SUITE(osal_pipe, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(osal_pipe, test_partial_transfer)
+{
+	eai_osal_pipe_t pipe;
+	uint8_t storage[16];
+	uint8_t in[20], out[20];
+	size_t n;
+
+	for (size_t i = 0; i < sizeof(in); i++) {
+		in[i] = (uint8_t)i;
+	}
+	zassert_equal(eai_osal_pipe_create(&pipe, storage, sizeof(storage), 1),
+		      EAI_OSAL_OK);
+
+	zassert_equal(eai_osal_pipe_write(&pipe, in, 20, &n, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_TIMEOUT, "Only what fits goes in");
+	zassert_equal(n, 16);
+	zassert_equal(eai_osal_pipe_space(&pipe), 0);
+
+	zassert_equal(eai_osal_pipe_read(&pipe, out, 10, &n, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(n, 10);
+	zassert_equal(eai_osal_pipe_read(&pipe, out + 10, 10, &n, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(n, 6);
+	zassert_mem_equal(in, out, 16);
+
+	zassert_equal(eai_osal_pipe_read(&pipe, out, 4, &n, 20), EAI_OSAL_TIMEOUT);
+	zassert_equal(n, 0);
+	eai_osal_pipe_destroy(&pipe);
+}
+
+ZTEST(osal_pipe, test_threshold)
+{
+	eai_osal_pipe_t pipe;
+	uint8_t storage[64];
+	uint8_t out[32];
+	size_t n;
+
+	zassert_equal(eai_osal_pipe_create(&pipe, storage, sizeof(storage), 8),
+		      EAI_OSAL_OK);
+	zassert_equal(eai_osal_pipe_create(&pipe, storage, sizeof(storage), 0),
+		      EAI_OSAL_INVALID_PARAM);
+
+	/* Under the threshold at the timeout, the bytes still come out */
+	eai_osal_pipe_write(&pipe, "abc", 3, NULL, EAI_OSAL_NO_WAIT);
+	zassert_equal(eai_osal_pipe_read(&pipe, out, sizeof(out), &n, 20),
+		      EAI_OSAL_TIMEOUT);
+	zassert_equal(n, 3);
+
+	/* A short read needs only what it asked for */
+	eai_osal_pipe_write(&pipe, "abcdefgh", 8, NULL, EAI_OSAL_NO_WAIT);
+	zassert_equal(eai_osal_pipe_read(&pipe, out, 2, &n, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_OK);
+	zassert_equal(n, 2);
+	zassert_equal(eai_osal_pipe_read(&pipe, out, sizeof(out), &n, EAI_OSAL_NO_WAIT),
+		      EAI_OSAL_TIMEOUT, "6 bytes are under the threshold");
+	zassert_equal(n, 6);
+	eai_osal_pipe_destroy(&pipe);
+}
@@ -1,11 +1,12 @@
 /*
  * WiFi Provisioning Orchestrator — Portable implementation.
- * Uses eai_osal for work queues, eai_settings for init, eai_log for logging.
+ * Uses an eai_osal task for the flow, eai_settings for init, eai_log for logging.
  */
 
 #include <eai_log/eai_log.h>
 #include <eai_osal/eai_osal.h>
 #include <eai_settings/eai_settings.h>
+#include <errno.h>
 #include <string.h>
 
 #include <wifi_prov/wifi_prov.h>
@@ -15,19 +16,39 @@ EAI_LOG_MODULE_DECLARE(wifi_prov, EAI_LOG_LEVEL_INF);
 
 static uint8_t cached_ip[4];
 
-/* Work items for deferred processing */
-static eai_osal_work_t cred_work;
-static eai_osal_work_t factory_reset_work;
-static eai_osal_dwork_t auto_connect_work;
+/*
+ * Provisioning flow — one task on the system work queue. The BLE
+ * callbacks only queue a command, and the task stores credentials,
+ * connects and factory-resets strictly one after another. With stored
+ * credentials at boot it first waits AUTO_CONNECT_DELAY_MS for a command
+ * and only then connects from them, so credentials sent right after boot
+ * win over the stored ones rather than racing them.
+ */
+enum prov_cmd_type {
+	PROV_CMD_CREDENTIALS,
+	PROV_CMD_FACTORY_RESET,
+};
 
-static struct wifi_prov_cred pending_cred;
+struct prov_cmd {
+	enum prov_cmd_type type;
+	struct wifi_prov_cred cred;
+};
 
-static void factory_reset_handler(void *arg)
-{
-	wifi_prov_factory_reset();
-}
+#define PROV_CMD_DEPTH        4
+#define AUTO_CONNECT_DELAY_MS 2000
 
-static void auto_connect_handler(void *arg)
+static eai_osal_queue_t cmd_queue;
+static struct prov_cmd cmd_queue_buf[PROV_CMD_DEPTH];
+static eai_osal_task_t prov_task;
+
+/* Task state that must outlive an await */
+static struct {
+	struct prov_cmd cmd;
+	eai_osal_status_t ret;
+	bool auto_connect;
+} flow;
+
+static void auto_connect(void)
 {
 	struct wifi_prov_cred cred;
 	int ret;
@@ -49,14 +70,14 @@ static void auto_connect_handler(void *arg)
 	}
 }
 
-static void cred_work_handler(void *arg)
+static void connect_with(const struct wifi_prov_cred *cred)
 {
 	int ret;
 
-	wifi_prov_cred_store(&pending_cred);
+	wifi_prov_cred_store(cred);
 	wifi_prov_sm_process_event(WIFI_PROV_EVT_WIFI_CONNECTING);
 
-	ret = wifi_prov_wifi_connect(&pending_cred);
+	ret = wifi_prov_wifi_connect(cred);
 	if (ret) {
 		EAI_LOG_ERR("WiFi connect request failed: %d", ret);
 		wifi_prov_sm_process_event(WIFI_PROV_EVT_WIFI_FAILED);
@@ -67,6 +88,47 @@ static void cred_work_handler(void *arg)
 	}
 }
 
+static void run_cmd(const struct prov_cmd *cmd)
+{
+	if (cmd->type == PROV_CMD_CREDENTIALS) {
+		connect_with(&cmd->cred);
+	} else {
+		wifi_prov_factory_reset();
+	}
+}
+
+static void prov_flow(eai_osal_task_t *task)
+{
+	EAI_OSAL_TASK_BEGIN(task);
+
+	if (flow.auto_connect) {
+		EAI_OSAL_TASK_AWAIT_QUEUE(task, &cmd_queue, &flow.cmd,
+					  AUTO_CONNECT_DELAY_MS, flow.ret);
+		if (flow.ret == EAI_OSAL_OK) {
+			run_cmd(&flow.cmd);
+		} else {
+			auto_connect();
+		}
+	}
+
+	for (;;) {
+		EAI_OSAL_TASK_AWAIT_QUEUE(task, &cmd_queue, &flow.cmd,
+					  EAI_OSAL_WAIT_FOREVER, flow.ret);
+		if (flow.ret == EAI_OSAL_OK) {
+			run_cmd(&flow.cmd);
+		}
+	}
+
+	EAI_OSAL_TASK_END(task);
+}
+
+static void queue_cmd(const struct prov_cmd *cmd)
+{
+	if (eai_osal_queue_send(&cmd_queue, cmd, EAI_OSAL_NO_WAIT) != EAI_OSAL_OK) {
+		EAI_LOG_WRN("Command %d dropped: queue full", cmd->type);
+	}
+}
+
 /* --- Internal callbacks --- */
 
 static void on_scan_result_received(const struct wifi_prov_scan_result *result)
@@ -87,14 +149,17 @@ static void on_scan_trigger(void)
 
 static void on_credentials_received(const struct wifi_prov_cred *cred)
 {
+	struct prov_cmd cmd = { .type = PROV_CMD_CREDENTIALS, .cred = *cred };
+
 	wifi_prov_sm_process_event(WIFI_PROV_EVT_CREDENTIALS_RX);
-	pending_cred = *cred;
-	eai_osal_work_submit(&cred_work);
+	queue_cmd(&cmd);
 }
 
 static void on_factory_reset_triggered(void)
 {
-	eai_osal_work_submit(&factory_reset_work);
+	struct prov_cmd cmd = { .type = PROV_CMD_FACTORY_RESET };
+
+	queue_cmd(&cmd);
 }
 
 static void on_wifi_state_changed(bool connected)
@@ -138,9 +203,12 @@ int wifi_prov_init(void)
 
 	wifi_prov_sm_init(on_state_changed);
 
-	eai_osal_work_init(&cred_work, cred_work_handler, NULL);
-	eai_osal_work_init(&factory_reset_work, factory_reset_handler, NULL);
-	eai_osal_dwork_init(&auto_connect_work, auto_connect_handler, NULL);
+	if (eai_osal_queue_create(&cmd_queue, sizeof(struct prov_cmd),
+				  PROV_CMD_DEPTH, cmd_queue_buf) != EAI_OSAL_OK ||
+	    eai_osal_task_init(&prov_task, prov_flow, NULL) != EAI_OSAL_OK) {
+		EAI_LOG_ERR("Provisioning task init failed");
+		return -ENOMEM;
+	}
 
 	ret = wifi_prov_wifi_init(on_wifi_state_changed);
 	if (ret) {
@@ -163,10 +231,13 @@ int wifi_prov_init(void)
 	}
 
 #ifdef CONFIG_WIFI_PROV_AUTO_CONNECT
-	if (wifi_prov_cred_exists()) {
-		eai_osal_dwork_submit(&auto_connect_work, 2000);
-	}
+	flow.auto_connect = wifi_prov_cred_exists();
 #endif
+	ret = eai_osal_task_start(&prov_task, NULL);
+	if (ret) {
+		EAI_LOG_ERR("Provisioning task start failed: %d", ret);
+		return -EIO;
+	}
 
 	EAI_LOG_INF("WiFi provisioning initialized");
 	return 0;